@@ -131,6 +131,12 @@ public:
    */
   virtual SysCallSizeResult sendmsg(os_fd_t sockfd, const msghdr* message, int flags) PURE;
 
+  /**
+   * @see man 2 sendmmsg
+   */
+  virtual SysCallIntResult sendmmsg(os_fd_t sockfd, struct mmsghdr* msgvec, unsigned int vlen,
+                                    int flags) PURE;
+
   /**
    * @see man 2 getsockname
    */
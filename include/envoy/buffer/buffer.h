@@ -113,6 +113,28 @@ public:
 
 using BufferMemoryAccountSharedPtr = std::shared_ptr<BufferMemoryAccount>;
 
+/**
+ * Chooses the length of the reservations made by Instance::reserveForRead(), and observes how much
+ * of each reservation was filled by the read.
+ */
+class ReadReservationPolicy {
+public:
+  virtual ~ReadReservationPolicy() = default;
+
+  /**
+   * @return uint64_t the preferred length of the next read reservation.
+   */
+  virtual uint64_t readReservationLength() const PURE;
+
+  /**
+   * Called when a reservation made by reserveForRead() is committed.
+   * @param reserved supplies the length of the reservation.
+   * @param committed supplies the number of bytes committed, which is 0 if the read returned no
+   *   data.
+   */
+  virtual void onReadCommitted(uint64_t reserved, uint64_t committed) PURE;
+};
+
 /**
  * A basic buffer abstraction.
  */
@@ -248,6 +270,13 @@ public:
    */
   virtual Reservation reserveForRead() PURE;
 
+  /**
+   * Set the policy which sizes the reservations made by reserveForRead().
+   * @param policy supplies the policy, which must outlive the buffer, or nullptr to reserve the
+   *   default length.
+   */
+  virtual void setReadReservationPolicy(ReadReservationPolicy* policy) PURE;
+
   /**
    * Reserve space in the buffer in a single slice.
    * @param length the exact length of the reservation.
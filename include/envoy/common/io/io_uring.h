@@ -0,0 +1,130 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "envoy/common/platform.h"
+#include "envoy/common/pure.h"
+#include "envoy/network/address.h"
+
+namespace Envoy {
+namespace Io {
+
+/**
+ * Callback invoked when iterating over entries in the completion queue.
+ * @param user_data is a pointer to user data supplied when the request was prepared.
+ * @param result is the result of the operation, following the kernel convention of returning
+ *        a negated errno value on failure.
+ */
+using CompletionCb = std::function<void(void* user_data, int32_t result)>;
+
+enum class IoUringResult { Ok, Busy, Failed };
+
+/**
+ * Abstract wrapper around `io_uring`. Requests are prepared into the submission queue with one of
+ * the prepare*() methods, handed to the kernel in a batch with submit() and reaped with
+ * forEveryCompletion(). An instance is not thread safe and is expected to be owned by a single
+ * dispatcher thread.
+ */
+class IoUring {
+public:
+  virtual ~IoUring() = default;
+
+  /**
+   * Registers an eventfd file descriptor for the ring and returns it. The descriptor becomes
+   * readable whenever new entries are posted to the completion queue, so it can be watched by
+   * the dispatcher event loop like any other file event.
+   */
+  virtual os_fd_t registerEventfd() PURE;
+
+  /**
+   * Resets the eventfd file descriptor for the ring.
+   */
+  virtual void unregisterEventfd() PURE;
+
+  /**
+   * Returns true if an eventfd file descriptor is registered with the ring.
+   */
+  virtual bool isEventfdRegistered() const PURE;
+
+  /**
+   * Iterates over entries in the completion queue, calls the given callback for every entry and
+   * marks them consumed. The callback may prepare new requests.
+   */
+  virtual void forEveryCompletion(CompletionCb completion_cb) PURE;
+
+  /**
+   * Prepares an accept system call and puts it into the submission queue.
+   * Returns IoUringResult::Failed in case the submission queue is full already
+   * and IoUringResult::Ok otherwise.
+   */
+  virtual IoUringResult prepareAccept(os_fd_t fd, struct sockaddr* remote_addr,
+                                      socklen_t* remote_addr_len, void* user_data) PURE;
+
+  /**
+   * Prepares a connect system call and puts it into the submission queue. The address must
+   * outlive the request.
+   * Returns IoUringResult::Failed in case the submission queue is full already
+   * and IoUringResult::Ok otherwise.
+   */
+  virtual IoUringResult prepareConnect(os_fd_t fd,
+                                       const Network::Address::InstanceConstSharedPtr& address,
+                                       void* user_data) PURE;
+
+  /**
+   * Prepares a readv system call and puts it into the submission queue. The iovecs and the
+   * memory they point to must outlive the request.
+   * Returns IoUringResult::Failed in case the submission queue is full already
+   * and IoUringResult::Ok otherwise.
+   */
+  virtual IoUringResult prepareReadv(os_fd_t fd, const struct iovec* iovecs, unsigned nr_vecs,
+                                     off_t offset, void* user_data) PURE;
+
+  /**
+   * Prepares a writev system call and puts it into the submission queue. The iovecs and the
+   * memory they point to must outlive the request.
+   * Returns IoUringResult::Failed in case the submission queue is full already
+   * and IoUringResult::Ok otherwise.
+   */
+  virtual IoUringResult prepareWritev(os_fd_t fd, const struct iovec* iovecs, unsigned nr_vecs,
+                                      off_t offset, void* user_data) PURE;
+
+  /**
+   * Prepares a one-shot poll for the given events (e.g. POLLIN) and puts it into the submission
+   * queue. The completion result carries the returned events mask.
+   * Returns IoUringResult::Failed in case the submission queue is full already
+   * and IoUringResult::Ok otherwise.
+   */
+  virtual IoUringResult preparePoll(os_fd_t fd, uint32_t events, void* user_data) PURE;
+
+  /**
+   * Prepares a cancellation of the pending request identified by cancelling_user_data and puts
+   * it into the submission queue. The cancelled request still posts a completion, typically with
+   * -ECANCELED.
+   * Returns IoUringResult::Failed in case the submission queue is full already
+   * and IoUringResult::Ok otherwise.
+   */
+  virtual IoUringResult prepareCancel(void* cancelling_user_data, void* user_data) PURE;
+
+  /**
+   * Prepares a close system call and puts it into the submission queue.
+   * Returns IoUringResult::Failed in case the submission queue is full already
+   * and IoUringResult::Ok otherwise.
+   */
+  virtual IoUringResult prepareClose(os_fd_t fd, void* user_data) PURE;
+
+  /**
+   * Submits the entries in the submission queue to the kernel using the `io_uring_enter()`
+   * system call.
+   * Returns IoUringResult::Ok in case of success and may return
+   * IoUringResult::Busy if we over commit the number of requests. In the latter case the
+   * application should drain the completion queue by handling some completions with the
+   * forEveryCompletion() method and try again.
+   */
+  virtual IoUringResult submit() PURE;
+};
+
+using IoUringPtr = std::unique_ptr<IoUring>;
+
+} // namespace Io
+} // namespace Envoy
@@ -462,6 +462,16 @@ struct Http1Settings {
   // True if this is an edge Envoy (using downstream address, no trusted hops)
   // and https:// URLs should be rejected over unencrypted connections.
   bool validate_scheme_{false};
+
+  enum class Parser {
+    // The http-parser library.
+    HttpParser,
+    // A parser which scans for delimiters with SIMD instructions where available.
+    Vectorized,
+  };
+
+  // The implementation which parses received messages.
+  Parser parser_{Parser::HttpParser};
 };
 
 /**
@@ -96,6 +96,9 @@ public:
     Stats::Counter* bind_errors_;
     // Optional counter. Delayed close timeouts will not be tracked if this is nullptr.
     Stats::Counter* delayed_close_timeouts_;
+    // Optional counter. Reads from the transport socket, including those which returned no data,
+    // will not be tracked if this is nullptr.
+    Stats::Counter* read_calls_;
   };
 
   ~Connection() override = default;
@@ -323,6 +326,19 @@ public:
    *  returned.
    */
   virtual absl::optional<std::chrono::milliseconds> lastRoundTripTime() const PURE;
+
+  /**
+   * Starts moving the data received on this connection to the peer connection and vice versa
+   * inside the kernel, without copying it to user space. The data bypasses the filter chains of
+   * both connections, while buffer limits, byte accounting, bytes sent callbacks and end of stream
+   * handling keep working. This is only possible if both connections are established, use the
+   * same dispatcher, pass their data through their transport sockets unmodified, have no data
+   * buffered, and no filter needs to see the data. Moving the data ends when either connection
+   * is closed.
+   * @param peer supplies the connection to exchange data with.
+   * @return bool whether the data is moved inside the kernel from now on.
+   */
+  virtual bool startSplice(Connection& peer) PURE;
 };
 
 using ConnectionPtr = std::unique_ptr<Connection>;
@@ -198,6 +198,13 @@ public:
    * @param callbacks supplies the callbacks.
    */
   virtual void initializeReadFilterCallbacks(ReadFilterCallbacks& callbacks) PURE;
+
+  /**
+   * @return bool whether the filter needs to see the data received on the connection. The
+   *         connection can only move its data to another connection inside the kernel, bypassing
+   *         the filter chain, if none of its read filters need it. @see Connection::startSplice().
+   */
+  virtual bool needsData() const { return true; }
 };
 
 using ReadFilterSharedPtr = std::shared_ptr<ReadFilter>;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include "envoy/api/io_error.h"
@@ -104,6 +105,44 @@ public:
    */
   virtual Api::IoCallUint64Result write(Buffer::Instance& buffer) PURE;
 
+  /**
+   * Write the data in slices out without copying it into the kernel (see MSG_ZEROCOPY in
+   * Documentation/networking/msg_zerocopy.rst). Unlike writev(), the memory the slices point to
+   * is still referenced after the call returns and must be neither modified nor released until
+   * readZeroCopyCompletions() reports the send as completed. Every call that writes data is
+   * numbered by the kernel, counting from 0 for the first zero copy send on the socket. The socket
+   * must have been opted in with the SO_ZEROCOPY option beforehand.
+   * @param slices points to the location of data to be written.
+   * @param num_slice indicates number of slices |slices| contains.
+   * @return a Api::IoCallUint64Result with err_ = an Api::IoError instance or
+   * err_ = nullptr and rc_ = the bytes written for success. The error code is
+   * IoErrorCode::NoSupport if the handle is not able to write without copies.
+   */
+  virtual Api::IoCallUint64Result writevZeroCopy(const Buffer::RawSlice* slices,
+                                                 uint64_t num_slice) PURE;
+
+  /**
+   * A range of zero copy sends the kernel has released, identified by the sequence numbers
+   * assigned by writevZeroCopy().
+   */
+  struct ZeroCopyCompletion {
+    // First and last sequence number of the range, both inclusive. The range may wrap around.
+    uint32_t first_;
+    uint32_t last_;
+    // True if the kernel fell back to copying the data of the range, e.g. on loopback devices.
+    bool copied_;
+  };
+  using ZeroCopyCompletionCb = std::function<void(const ZeroCopyCompletion& completion)>;
+
+  /**
+   * Drain the zero copy completions the kernel queued for the handle. Completions are signaled as
+   * an error condition on the socket, which file events report as readable and writable.
+   * @param cb supplies the callback invoked for every completed range, in order.
+   * @return a Api::IoCallUint64Result with err_ = an Api::IoError instance or
+   * err_ = nullptr and rc_ = the number of completions read, which is 0 if none was pending.
+   */
+  virtual Api::IoCallUint64Result readZeroCopyCompletions(const ZeroCopyCompletionCb& cb) PURE;
+
   /**
    * Send a message to the address.
    * @param slices points to the location of data to be sent.
@@ -118,6 +157,20 @@ public:
                                           int flags, const Address::Ip* self_ip,
                                           const Address::Instance& peer_address) PURE;
 
+  /**
+   * If the platform supports, send each of the given slices as a datagram of its own to the
+   * address, in a single system call.
+   * @param datagrams points to the datagrams to be sent.
+   * @param num_datagrams indicates number of datagrams |datagrams| contains.
+   * @param peer_address is the destination address.
+   * @return a Api::IoCallUint64Result with err_ = an Api::IoError instance or
+   * err_ = nullptr and rc_ = the number of datagrams sent for success, which may be less than
+   * num_datagrams.
+   */
+  virtual Api::IoCallUint64Result sendmmsg(const Buffer::RawSlice* datagrams,
+                                           uint64_t num_datagrams, int flags,
+                                           const Address::Instance& peer_address) PURE;
+
   struct RecvMsgPerPacketInfo {
     // The destination address from transport header.
     Address::InstanceConstSharedPtr local_address_;
@@ -199,6 +252,12 @@ public:
    */
   virtual bool supportsUdpGro() const PURE;
 
+  /**
+   * return true if the data of the handle can be moved to and from pipes with splice(). This
+   * requires a socket descriptor which is not read from or written to by anything else.
+   */
+  virtual bool supportsSplice() const PURE;
+
   /**
    * Bind to address. The handle should have been created with a call to socket()
    * @param address address to bind to.
@@ -156,6 +156,12 @@ public:
    * @return boolean indicating if the transport socket was able to start secure transport.
    */
   virtual bool startSecureTransport() PURE;
+
+  /**
+   * @return bool whether the socket passes the data of the connection through unmodified, so that
+   *         the connection can move it between sockets inside the kernel instead.
+   */
+  virtual bool supportsSplice() const { return false; }
 };
 
 using TransportSocketPtr = std::unique_ptr<TransportSocket>;
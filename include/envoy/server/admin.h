@@ -21,12 +21,28 @@ class AdminStream {
 public:
   virtual ~AdminStream() = default;
 
+  /**
+   * Function which appends the next chunk of a response to the buffer.
+   * @return bool true if there are more chunks to come, false if the response is complete.
+   */
+  using ResponseChunkFn = std::function<bool(Buffer::Instance& response)>;
+
   /**
    * @param end_stream set to false for streaming response. Default is true, which will
    * end the response when the initial handler completes.
    */
   virtual void setEndStreamOnComplete(bool end_stream) PURE;
 
+  /**
+   * Continues the response of the handler with chunks produced by next_chunk, for responses too
+   * large to be built in one piece. Once the handler completes, next_chunk is called each time the
+   * downstream connection can take more data, until it returns false. The response is ended with
+   * the last chunk, unless setEndStreamOnComplete(false) was called. next_chunk is dropped without
+   * being called again if the stream is destroyed first.
+   * @param next_chunk supplies the function producing the rest of the response.
+   */
+  virtual void setResponseChunks(ResponseChunkFn next_chunk) PURE;
+
   /**
    * @param cb callback to be added to the list of callbacks invoked by onDestroy() when stream
    * is closed.
@@ -84,6 +84,18 @@ public:
    * @return bool indicator to flush stats on-demand via the admin interface instead of on a timer.
    */
   virtual bool flushOnAdmin() const PURE;
+
+  /**
+   * @return bool whether the snapshot of stats flushed to sinks on a timer is taken on a dedicated
+   *         stats flush thread rather than on the main thread.
+   */
+  virtual bool flushSnapshotOnThread() const PURE;
+
+  /**
+   * @return bool whether stats snapshots only include the metrics which changed since the previous
+   *         flush.
+   */
+  virtual bool flushDeltasOnly() const PURE;
 };
 
 /**
@@ -234,6 +234,12 @@ public:
    */
   virtual bool mutexTracingEnabled() const PURE;
 
+  /**
+   * @return bool indicating whether stat names are symbolized by a symbol table sharded for
+   *         concurrent use.
+   */
+  virtual bool concurrentSymbolTableEnabled() const PURE;
+
   /**
    * @return bool indicating whether core dumps have been enabled.
    */
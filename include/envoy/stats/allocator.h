@@ -58,6 +58,39 @@ public:
   virtual const SymbolTable& constSymbolTable() const PURE;
   virtual SymbolTable& symbolTable() PURE;
 
+  /**
+   * Stripes the values of the counters with the given tag extracted names across one cache line
+   * per thread, so that threads incrementing them do not contend. Only applies to the counters
+   * created after this call.
+   * @param tag_extracted_names the tag extracted names of the counters to stripe.
+   * @param num_stripes the number of stripes of each counter, rounded up to a power of 2. Counters
+   *        are not striped if this is less than 2.
+   */
+  virtual void setStripedCounters(const std::vector<std::string>& tag_extracted_names,
+                                  uint32_t num_stripes) PURE;
+
+  /**
+   * Returns the counters selected by filter. The first call to this or to gaugesMatching() or
+   * textReadoutsMatching() builds an index of the names of the stats in the allocator, which is
+   * then kept up to date as stats are created and freed, so that each call only visits the stats
+   * whose names start with the filter's prefix.
+   * @param filter the filter selecting the counters.
+   * @return the counters selected by filter, ordered by name.
+   */
+  virtual std::vector<CounterSharedPtr> countersMatching(const StatNameFilter& filter) PURE;
+
+  /**
+   * @param filter the filter selecting the gauges.
+   * @return the gauges selected by filter, ordered by name. See countersMatching().
+   */
+  virtual std::vector<GaugeSharedPtr> gaugesMatching(const StatNameFilter& filter) PURE;
+
+  /**
+   * @param filter the filter selecting the text readouts.
+   * @return the text readouts selected by filter, ordered by name. See countersMatching().
+   */
+  virtual std::vector<TextReadoutSharedPtr> textReadoutsMatching(const StatNameFilter& filter) PURE;
+
   // TODO(jmarantz): create a parallel mechanism to instantiate histograms. At
   // the moment, histograms don't fit the same pattern of counters and gauges
   // as they are not actually created in the context of a stats allocator.
@@ -24,6 +24,12 @@ public:
    * @return The buckets for the histogram. Each value is an upper bound of a bucket.
    */
   virtual ConstSupportedBuckets& buckets(absl::string_view stat_name) const PURE;
+
+  /**
+   * @return whether worker threads record histogram values into dense arrays of log-linear
+   *         buckets, which are cheaper to merge on each stats flush than circllhist histograms.
+   */
+  virtual bool denseThreadLocalHistograms() const PURE;
 };
 
 using HistogramSettingsConstPtr = std::unique_ptr<const HistogramSettings>;
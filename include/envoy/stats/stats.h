@@ -190,5 +190,17 @@ public:
 
 using TextReadoutSharedPtr = RefcountPtr<TextReadout>;
 
+/**
+ * Selects stats by name, in a way that can be answered from an index of stat names.
+ */
+struct StatNameFilter {
+  // Only stats whose names start with this are selected.
+  std::string prefix_;
+  // If not empty, only stats whose names contain this are selected.
+  std::string substring_;
+  // If set, only stats which have been used are selected.
+  bool used_only_{};
+};
+
 } // namespace Stats
 } // namespace Envoy
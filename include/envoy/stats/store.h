@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "envoy/common/pure.h"
@@ -48,6 +49,27 @@ public:
    * @return a list of all known histograms.
    */
   virtual std::vector<ParentHistogramSharedPtr> histograms() const PURE;
+
+  /**
+   * Returns the counters selected by filter, without visiting every counter in the store. The
+   * first call to this or to gaugesMatching() or textReadoutsMatching() builds an index of stat
+   * names, which is then kept up to date as stats are created and freed.
+   * @param filter the filter selecting the counters.
+   * @return the counters selected by filter, ordered by name.
+   */
+  virtual std::vector<CounterSharedPtr> countersMatching(const StatNameFilter& filter) PURE;
+
+  /**
+   * @param filter the filter selecting the gauges.
+   * @return the gauges selected by filter, ordered by name. See countersMatching().
+   */
+  virtual std::vector<GaugeSharedPtr> gaugesMatching(const StatNameFilter& filter) PURE;
+
+  /**
+   * @param filter the filter selecting the text readouts.
+   * @return the text readouts selected by filter, ordered by name. See countersMatching().
+   */
+  virtual std::vector<TextReadoutSharedPtr> textReadoutsMatching(const StatNameFilter& filter) PURE;
 };
 
 using StorePtr = std::unique_ptr<Store>;
@@ -85,6 +107,15 @@ public:
    */
   virtual void setHistogramSettings(HistogramSettingsConstPtr&& histogram_settings) PURE;
 
+  /**
+   * Stripes the values of the counters with the given tag extracted names across one cache line
+   * per thread. See Allocator::setStripedCounters().
+   * @param tag_extracted_names the tag extracted names of the counters to stripe.
+   * @param num_stripes the number of stripes of each counter.
+   */
+  virtual void setStripedCounters(const std::vector<std::string>& tag_extracted_names,
+                                  uint32_t num_stripes) PURE;
+
   /**
    * Initialize the store for threading. This will be called once after all worker threads have
    * been initialized. At this point the store can initialize itself for multi-threaded operation.
@@ -102,6 +102,14 @@ public:
    */
   virtual Tcp::ConnectionPool::ConnectionData*
   onDownstreamEvent(Network::ConnectionEvent event) PURE;
+
+  /**
+   * Starts moving data between the downstream connection and the upstream inside the kernel.
+   * @see Network::Connection::startSplice().
+   * @param downstream supplies the downstream connection.
+   * @return bool whether the data is moved inside the kernel from now on.
+   */
+  virtual bool startSplice(Network::Connection& downstream) PURE;
 };
 
 using GenericConnPoolPtr = std::unique_ptr<GenericConnPool>;
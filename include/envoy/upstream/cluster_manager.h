@@ -304,11 +304,29 @@ public:
    * @return the stat names.
    */
   virtual const ClusterStatNames& clusterStatNames() const PURE;
+  virtual const ClusterConfigUpdateStatNames& clusterConfigUpdateStatNames() const PURE;
+  virtual const ClusterEndpointStatNames& clusterEndpointStatNames() const PURE;
+  virtual const ClusterLbStatNames& clusterLbStatNames() const PURE;
   virtual const ClusterLoadReportStatNames& clusterLoadReportStatNames() const PURE;
   virtual const ClusterCircuitBreakersStatNames& clusterCircuitBreakersStatNames() const PURE;
   virtual const ClusterRequestResponseSizeStatNames&
   clusterRequestResponseSizeStatNames() const PURE;
   virtual const ClusterTimeoutBudgetStatNames& clusterTimeoutBudgetStatNames() const PURE;
+
+  /**
+   * @return const ClusterStats* the zero-valued traffic stats shared by the clusters which have not
+   *         created theirs yet, or nullptr if clusters create their traffic stats with the cluster.
+   *         @see ClusterManager.lazy_cluster_stats in the bootstrap.
+   */
+  virtual const ClusterStats* clusterStatsPlaceholder() const PURE;
+
+  /**
+   * @return uint64_t the approximate number of bytes of heap used by the traffic and load report
+   *         stats of one cluster, as measured when creating the placeholder. This is zero if
+   *         clusters create their traffic stats with the cluster, or if the allocator does not
+   *         report its usage.
+   */
+  virtual uint64_t lazyClusterStatsBytes() const PURE;
 };
 
 using ClusterManagerPtr = std::unique_ptr<ClusterManager>;
@@ -189,6 +189,20 @@ SysCallSizeResult OsSysCallsImpl::sendmsg(os_fd_t fd, const msghdr* message, int
   return {rc, rc != -1 ? 0 : errno};
 }
 
+SysCallIntResult OsSysCallsImpl::sendmmsg(os_fd_t sockfd, struct mmsghdr* msgvec,
+                                          unsigned int vlen, int flags) {
+#if ENVOY_MMSG_MORE
+  const int rc = ::sendmmsg(sockfd, msgvec, vlen, flags);
+  return {rc, rc != -1 ? 0 : errno};
+#else
+  UNREFERENCED_PARAMETER(sockfd);
+  UNREFERENCED_PARAMETER(msgvec);
+  UNREFERENCED_PARAMETER(vlen);
+  UNREFERENCED_PARAMETER(flags);
+  NOT_IMPLEMENTED_GCOVR_EXCL_LINE;
+#endif
+}
+
 SysCallIntResult OsSysCallsImpl::getsockname(os_fd_t sockfd, sockaddr* addr, socklen_t* addrlen) {
   const int rc = ::getsockname(sockfd, addr, addrlen);
   return {rc, rc != -1 ? 0 : errno};
@@ -240,6 +240,11 @@ SysCallSizeResult OsSysCallsImpl::sendmsg(os_fd_t sockfd, const msghdr* msg, int
   return {bytes_received, 0};
 }
 
+SysCallIntResult OsSysCallsImpl::sendmmsg(os_fd_t sockfd, struct mmsghdr* msgvec,
+                                          unsigned int vlen, int flags) {
+  NOT_IMPLEMENTED_GCOVR_EXCL_LINE;
+}
+
 SysCallIntResult OsSysCallsImpl::getsockname(os_fd_t sockfd, sockaddr* addr, socklen_t* addrlen) {
   const int rc = ::getsockname(sockfd, addr, addrlen);
   return {rc, rc != -1 ? 0 : ::WSAGetLastError()};
@@ -38,6 +38,8 @@ public:
                               socklen_t* optlen) override;
   SysCallSocketResult socket(int domain, int type, int protocol) override;
   SysCallSizeResult sendmsg(os_fd_t fd, const msghdr* message, int flags) override;
+  SysCallIntResult sendmmsg(os_fd_t sockfd, struct mmsghdr* msgvec, unsigned int vlen,
+                            int flags) override;
   SysCallIntResult getsockname(os_fd_t sockfd, sockaddr* addr, socklen_t* addrlen) override;
   SysCallIntResult gethostname(char* name, size_t length) override;
 
@@ -19,8 +19,6 @@ namespace {
 constexpr uint64_t CopyThreshold = 512;
 } // namespace
 
-thread_local absl::InlinedVector<Slice::StoragePtr, Slice::free_list_max_> Slice::free_list_;
-
 void OwnedImpl::addImpl(const void* data, uint64_t size) {
   const char* src = static_cast<const char*>(data);
   bool new_slice_needed = slices_.empty();
@@ -311,10 +309,35 @@ void OwnedImpl::move(Instance& rhs, uint64_t length) {
 }
 
 Reservation OwnedImpl::reserveForRead() {
-  return reserveWithMaxLength(default_read_reservation_size_);
+  const uint64_t length = readReservationLength();
+  return reserveWithMaxLength(length, readSliceSize(length));
+}
+
+void OwnedImpl::setReadReservationPolicy(ReadReservationPolicy* policy) {
+  read_reservation_policy_ = policy;
 }
 
-Reservation OwnedImpl::reserveWithMaxLength(uint64_t max_length) {
+uint64_t OwnedImpl::readReservationLength() const {
+  if (read_reservation_policy_ == nullptr) {
+    return default_read_reservation_size_;
+  }
+  return std::min(read_reservation_policy_->readReservationLength(), max_read_reservation_size_);
+}
+
+uint64_t OwnedImpl::readSliceSize(uint64_t length) {
+  // Small reads only take the pages they need, and large reads take larger slices so that they
+  // still fit in Reservation::MAX_SLICES_ slices.
+  if (length < Slice::default_slice_size_) {
+    return std::max(IntUtil::roundUpToMultiple(length, SliceAllocator::PageSize),
+                    SliceAllocator::PageSize);
+  }
+  if (length > default_read_reservation_size_) {
+    return large_read_slice_size_;
+  }
+  return Slice::default_slice_size_;
+}
+
+Reservation OwnedImpl::reserveWithMaxLength(uint64_t max_length, uint64_t slice_size) {
   Reservation reservation = Reservation::bufferImplUseOnlyConstruct(*this);
   if (max_length == 0) {
     return reservation;
@@ -329,6 +352,7 @@ Reservation OwnedImpl::reserveWithMaxLength(uint64_t max_length) {
   uint64_t reserved = 0;
   auto& reservation_slices = reservation.bufferImplUseOnlySlices();
   auto slices_owner = std::make_unique<OwnedImplReservationSlicesOwnerMultiple>();
+  slices_owner->read_ = true;
 
   // Check whether there are any empty slices with reservable space at the end of the buffer.
   uint64_t reservable_size = slices_.empty() ? 0 : slices_.back().reservableSize();
@@ -343,7 +367,7 @@ Reservation OwnedImpl::reserveWithMaxLength(uint64_t max_length) {
   }
 
   while (bytes_remaining != 0 && reservation_slices.size() < reservation.MAX_SLICES_) {
-    const uint64_t size = Slice::default_slice_size_;
+    const uint64_t size = slice_size;
 
     // If the next slice would go over the desired size, and the amount already reserved is already
     // at least one full slice in size, stop allocating slices. This prevents returning a
@@ -355,7 +379,7 @@ Reservation OwnedImpl::reserveWithMaxLength(uint64_t max_length) {
 
     // We will tag the reservation slices on commit. This avoids unnecessary
     // work in the case that the entire reservation isn't used.
-    Slice slice(size, nullptr, slices_owner->free_list_);
+    Slice slice(size, nullptr);
     const auto raw_slice = slice.reserve(size);
     reservation_slices.push_back(raw_slice);
     slices_owner->owned_slices_.emplace_back(std::move(slice));
@@ -402,6 +426,15 @@ ReservationSingleSlice OwnedImpl::reserveSingleSlice(uint64_t length, bool separ
 
 void OwnedImpl::commit(uint64_t length, absl::Span<RawSlice> slices,
                        ReservationSlicesOwnerPtr slices_owner_base) {
+  if (read_reservation_policy_ != nullptr && slices_owner_base != nullptr &&
+      static_cast<OwnedImplReservationSlicesOwner*>(slices_owner_base.get())->read_) {
+    uint64_t reserved = 0;
+    for (const RawSlice& slice : slices) {
+      reserved += slice.len_;
+    }
+    read_reservation_policy_->onReadCommitted(reserved, length);
+  }
+
   if (length == 0) {
     return;
   }
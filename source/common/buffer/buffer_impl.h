@@ -8,6 +8,7 @@
 
 #include "envoy/buffer/buffer.h"
 
+#include "common/buffer/slice_allocator.h"
 #include "common/common/assert.h"
 #include "common/common/non_copyable.h"
 #include "common/common/utility.h"
@@ -34,16 +35,7 @@ namespace Buffer {
 class Slice {
 public:
   using Reservation = RawSlice;
-  using StoragePtr = std::unique_ptr<uint8_t[]>;
-
-  static constexpr uint32_t free_list_max_ = Buffer::Reservation::MAX_SLICES_;
-  using FreeListType = absl::InlinedVector<StoragePtr, free_list_max_>;
-  class FreeListReference {
-  private:
-    FreeListReference(FreeListType& free_list) : free_list_(free_list) {}
-    FreeListType& free_list_;
-    friend class Slice;
-  };
+  using StoragePtr = SliceAllocator::StoragePtr;
 
   /**
    * Create an empty Slice with 0 capacity.
@@ -56,12 +48,10 @@ public:
    * @param min_capacity number of bytes of space the slice should have. Actual capacity is rounded
    * up to the next multiple of 4kb.
    * @param account the account to charge.
-   * @param freelist to search for the backing storage, if any.
    */
-  Slice(uint64_t min_capacity, BufferMemoryAccountSharedPtr account,
-        absl::optional<FreeListReference> free_list = absl::nullopt)
-      : capacity_(sliceSize(min_capacity)), storage_(newStorage(capacity_, free_list)),
-        base_(storage_.get()), data_(0), reservable_(0) {
+  Slice(uint64_t min_capacity, BufferMemoryAccountSharedPtr account)
+      : capacity_(sliceSize(min_capacity)), storage_(newStorage(capacity_)), base_(storage_.get()),
+        data_(0), reservable_(0) {
     if (account) {
       account->charge(capacity_);
       account_ = account;
@@ -121,11 +111,6 @@ public:
     freeStorage(std::move(storage_), capacity_);
   }
 
-  void freeStorage(FreeListReference free_list) {
-    callAndClearDrainTrackersAndCharges();
-    freeStorage(std::move(storage_), capacity_, free_list);
-  }
-
   /**
    * @return true if the data in the slice is mutable
    */
@@ -337,8 +322,6 @@ public:
 
   static constexpr uint32_t default_slice_size_ = 16384;
 
-  static FreeListReference freeList() { return FreeListReference(free_list_); }
-
 protected:
   /**
    * Compute a slice size big enough to hold a specified amount of data.
@@ -346,54 +329,23 @@ protected:
    * @return a recommended slice size, in bytes.
    */
   static uint64_t sliceSize(uint64_t data_size) {
-    static constexpr uint64_t PageSize = 4096;
+    static constexpr uint64_t PageSize = SliceAllocator::PageSize;
     const uint64_t num_pages = (data_size + PageSize - 1) / PageSize;
     return num_pages * PageSize;
   }
 
-  static StoragePtr newStorage(uint64_t capacity, absl::optional<FreeListReference> free_list_opt) {
+  static StoragePtr newStorage(uint64_t capacity) {
     ASSERT(sliceSize(default_slice_size_) == default_slice_size_,
            "default_slice_size_ incompatible with sliceSize()");
     ASSERT(sliceSize(capacity) == capacity,
            "newStorage should only be called on values returned from sliceSize()");
-    ASSERT(!free_list_opt.has_value() || &free_list_opt->free_list_ == &free_list_);
-
-    StoragePtr storage;
-    if (capacity == default_slice_size_ && free_list_opt.has_value()) {
-      FreeListType& free_list = free_list_opt->free_list_;
-      if (!free_list.empty()) {
-        storage = std::move(free_list.back());
-        ASSERT(storage != nullptr);
-        ASSERT(free_list.back() == nullptr);
-        free_list.pop_back();
-        return storage;
-      }
-    }
-
-    storage.reset(new uint8_t[capacity]);
-    return storage;
+    return SliceAllocator::allocate(capacity);
   }
 
-  static void freeStorage(StoragePtr storage, uint64_t capacity,
-                          absl::optional<FreeListReference> free_list_opt = absl::nullopt) {
-    if (storage == nullptr) {
-      return;
-    }
-
-    if (capacity == default_slice_size_ && free_list_opt.has_value()) {
-      FreeListType& free_list = free_list_opt->free_list_;
-      if (free_list.size() < free_list_max_) {
-        free_list.emplace_back(std::move(storage));
-        ASSERT(storage == nullptr);
-        return;
-      }
-    }
-
-    storage.reset();
+  static void freeStorage(StoragePtr storage, uint64_t capacity) {
+    SliceAllocator::deallocate(std::move(storage), capacity);
   }
 
-  static thread_local FreeListType free_list_;
-
   /** Length of the byte array that base_ points to. This is also the offset in bytes from the start
    * of the slice to the end of the Reservable section. */
   uint64_t capacity_;
@@ -689,6 +641,7 @@ public:
   void move(Instance& rhs) override;
   void move(Instance& rhs, uint64_t length) override;
   Reservation reserveForRead() override;
+  void setReadReservationPolicy(ReadReservationPolicy* policy) override;
   ReservationSingleSlice reserveSingleSlice(uint64_t length, bool separate_slice = false) override;
   ssize_t search(const void* data, uint64_t size, size_t start, size_t length) const override;
   bool startsWith(absl::string_view data) const override;
@@ -731,14 +684,33 @@ public:
     return reserveWithMaxLength(length);
   }
 
-protected:
   static constexpr uint64_t default_read_reservation_size_ =
       Reservation::MAX_SLICES_ * Slice::default_slice_size_;
+  // Size of the slices of read reservations larger than default_read_reservation_size_. These are
+  // the largest slices whose storage is cached by the SliceAllocator.
+  static constexpr uint64_t large_read_slice_size_ = SliceAllocator::MaxCachedSize;
+  static constexpr uint64_t max_read_reservation_size_ =
+      Reservation::MAX_SLICES_ * large_read_slice_size_;
+
+protected:
+  /**
+   * @return the preferred length of the next reservation made by reserveForRead().
+   */
+  uint64_t readReservationLength() const;
+
+  /**
+   * @return the size of the slices of a read reservation.
+   * @param length supplies the length of the reservation.
+   */
+  static uint64_t readSliceSize(uint64_t length);
 
   /**
    * Create a reservation with a maximum length.
+   * @param max_length supplies the maximum length of the reservation.
+   * @param slice_size supplies the size of the slices allocated for the reservation.
    */
-  Reservation reserveWithMaxLength(uint64_t max_length);
+  Reservation reserveWithMaxLength(uint64_t max_length,
+                                   uint64_t slice_size = Slice::default_slice_size_);
 
   void commit(uint64_t length, absl::Span<RawSlice> slices,
               ReservationSlicesOwnerPtr slices_owner) override;
@@ -769,23 +741,26 @@ private:
 
   BufferMemoryAccountSharedPtr account_;
 
+  ReadReservationPolicy* read_reservation_policy_{};
+
   struct OwnedImplReservationSlicesOwner : public ReservationSlicesOwner {
     virtual absl::Span<Slice> ownedSlices() PURE;
+
+    // True if the reservation was made for reading into, in which case its commit is reported to
+    // the read reservation policy.
+    bool read_{};
   };
 
   struct OwnedImplReservationSlicesOwnerMultiple : public OwnedImplReservationSlicesOwner {
-    // Optimization: get the thread_local freeList() once per Reservation, outside the loop.
-    OwnedImplReservationSlicesOwnerMultiple() : free_list_(Slice::freeList()) {}
-
     ~OwnedImplReservationSlicesOwnerMultiple() override {
+      // Free the slices last to first, so that the next reservation reuses their storage in the
+      // same order.
       while (!owned_slices_.empty()) {
-        owned_slices_.back().freeStorage(free_list_);
         owned_slices_.pop_back();
       }
     }
     absl::Span<Slice> ownedSlices() override { return absl::MakeSpan(owned_slices_); }
 
-    Slice::FreeListReference free_list_;
     absl::InlinedVector<Slice, Buffer::Reservation::MAX_SLICES_> owned_slices_;
   };
 
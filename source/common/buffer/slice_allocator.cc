@@ -0,0 +1,159 @@
+#include "common/buffer/slice_allocator.h"
+
+#include "common/common/assert.h"
+
+namespace Envoy {
+namespace Buffer {
+
+std::atomic<uint64_t> SliceAllocator::max_cached_bytes_{SliceAllocator::DefaultMaxCachedBytes};
+std::atomic<uint64_t> SliceAllocator::release_epoch_{0};
+
+/**
+ * Owns the cache of a thread. The cache is reached through a trivially destructible pointer, so
+ * that storage freed by thread local destructors which run after this one is not cached.
+ */
+class ThreadLocalSliceAllocator {
+public:
+  ThreadLocalSliceAllocator() { allocator_ = new SliceAllocator(); }
+  ~ThreadLocalSliceAllocator() {
+    delete allocator_;
+    allocator_ = nullptr;
+    exited_ = true;
+  }
+
+  static thread_local SliceAllocator* allocator_;
+  static thread_local bool exited_;
+};
+
+thread_local SliceAllocator* ThreadLocalSliceAllocator::allocator_{};
+thread_local bool ThreadLocalSliceAllocator::exited_{};
+
+SliceAllocator* SliceAllocator::threadLocal() {
+  if (ThreadLocalSliceAllocator::allocator_ == nullptr && !ThreadLocalSliceAllocator::exited_) {
+    static thread_local ThreadLocalSliceAllocator owner;
+  }
+  return ThreadLocalSliceAllocator::allocator_;
+}
+
+SliceAllocator::StoragePtr SliceAllocator::allocate(uint64_t capacity) {
+  ASSERT(capacity % PageSize == 0);
+  SliceAllocator* allocator = threadLocal();
+  if (allocator == nullptr) {
+    return StoragePtr(new uint8_t[capacity]);
+  }
+  return allocator->allocateImpl(capacity);
+}
+
+void SliceAllocator::deallocate(StoragePtr storage, uint64_t capacity) {
+  if (storage == nullptr) {
+    return;
+  }
+  SliceAllocator* allocator = threadLocal();
+  if (allocator == nullptr) {
+    return;
+  }
+  allocator->deallocateImpl(std::move(storage), capacity);
+}
+
+void SliceAllocator::setMaxCachedBytes(uint64_t max_cached_bytes) {
+  max_cached_bytes_.store(max_cached_bytes, std::memory_order_relaxed);
+}
+
+void SliceAllocator::releaseFreeMemory() { release_epoch_.fetch_add(1, std::memory_order_relaxed); }
+
+void SliceAllocator::setStats(SliceAllocatorStats* stats) {
+  SliceAllocator* allocator = threadLocal();
+  if (allocator != nullptr) {
+    allocator->stats_ = stats;
+    if (stats != nullptr) {
+      stats->cached_bytes_.set(allocator->cached_bytes_);
+    }
+  }
+}
+
+void SliceAllocator::clearStats(const SliceAllocatorStats* stats) {
+  SliceAllocator* allocator = threadLocal();
+  if (allocator != nullptr && allocator->stats_ == stats) {
+    allocator->stats_ = nullptr;
+  }
+}
+
+uint64_t SliceAllocator::cachedBytes() {
+  SliceAllocator* allocator = threadLocal();
+  return allocator != nullptr ? allocator->cached_bytes_ : 0;
+}
+
+SliceAllocator::SliceAllocator()
+    : release_epoch_seen_(release_epoch_.load(std::memory_order_relaxed)) {}
+
+// Storage still cached is freed along with the free lists.
+SliceAllocator::~SliceAllocator() = default;
+
+SliceAllocator::StoragePtr SliceAllocator::allocateImpl(uint64_t capacity) {
+  maybeRelease();
+  if (capacity > 0 && capacity <= MaxCachedSize) {
+    std::vector<StoragePtr>& free_list = free_lists_[capacity / PageSize - 1];
+    if (!free_list.empty()) {
+      StoragePtr storage = std::move(free_list.back());
+      free_list.pop_back();
+      updateCachedBytes(cached_bytes_ - capacity);
+      if (stats_ != nullptr) {
+        stats_->cache_hit_.inc();
+      }
+      return storage;
+    }
+  }
+
+  if (stats_ != nullptr) {
+    stats_->cache_miss_.inc();
+  }
+  return StoragePtr(new uint8_t[capacity]);
+}
+
+void SliceAllocator::deallocateImpl(StoragePtr storage, uint64_t capacity) {
+  maybeRelease();
+  if (capacity == 0 || capacity > MaxCachedSize) {
+    return;
+  }
+  if (cached_bytes_ + capacity > max_cached_bytes_.load(std::memory_order_relaxed)) {
+    if (stats_ != nullptr) {
+      stats_->cache_overflow_.inc();
+    }
+    return;
+  }
+
+  free_lists_[capacity / PageSize - 1].emplace_back(std::move(storage));
+  updateCachedBytes(cached_bytes_ + capacity);
+}
+
+void SliceAllocator::maybeRelease() {
+  const uint64_t release_epoch = release_epoch_.load(std::memory_order_relaxed);
+  if (release_epoch != release_epoch_seen_) {
+    release_epoch_seen_ = release_epoch;
+    releaseCache();
+  }
+}
+
+void SliceAllocator::releaseCache() {
+  if (cached_bytes_ == 0) {
+    return;
+  }
+  for (std::vector<StoragePtr>& free_list : free_lists_) {
+    // Swap rather than clear so that the memory backing the list is released as well.
+    std::vector<StoragePtr>().swap(free_list);
+  }
+  updateCachedBytes(0);
+  if (stats_ != nullptr) {
+    stats_->cache_release_.inc();
+  }
+}
+
+void SliceAllocator::updateCachedBytes(uint64_t new_cached_bytes) {
+  cached_bytes_ = new_cached_bytes;
+  if (stats_ != nullptr) {
+    stats_->cached_bytes_.set(cached_bytes_);
+  }
+}
+
+} // namespace Buffer
+} // namespace Envoy
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "envoy/stats/scope.h"
+#include "envoy/stats/stats_macros.h"
+
+#include "common/common/non_copyable.h"
+
+namespace Envoy {
+namespace Buffer {
+
+/**
+ * All slice allocator stats. @see stats_macros.h
+ */
+#define ALL_SLICE_ALLOCATOR_STATS(COUNTER, GAUGE)                                                  \
+  COUNTER(cache_hit)                                                                               \
+  COUNTER(cache_miss)                                                                              \
+  COUNTER(cache_overflow)                                                                          \
+  COUNTER(cache_release)                                                                           \
+  GAUGE(cached_bytes, NeverImport)
+
+/**
+ * Struct definition for all slice allocator stats. @see stats_macros.h
+ */
+struct SliceAllocatorStats {
+  ALL_SLICE_ALLOCATOR_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT)
+};
+
+using SliceAllocatorStatsPtr = std::unique_ptr<SliceAllocatorStats>;
+
+/**
+ * Thread local cache of the storage backing buffer slices. Storage is cached by size, in classes of
+ * whole pages up to MaxCachedSize, so that buffers allocated and freed by a worker thread reuse the
+ * same memory without going through the global allocator. Storage freed on another thread than it
+ * was allocated on is cached by the freeing thread.
+ */
+class SliceAllocator : NonCopyable {
+public:
+  using StoragePtr = std::unique_ptr<uint8_t[]>;
+
+  static constexpr uint64_t PageSize = 4096;
+  // The largest size which is cached.
+  static constexpr uint64_t MaxCachedSize = 16 * PageSize;
+  static constexpr uint64_t DefaultMaxCachedBytes = 1024 * 1024;
+
+  /**
+   * Allocates storage from the cache of the calling thread.
+   * @param capacity supplies the number of bytes to allocate, which must be a multiple of PageSize.
+   * @return StoragePtr the storage.
+   */
+  static StoragePtr allocate(uint64_t capacity);
+
+  /**
+   * Returns storage to the cache of the calling thread.
+   * @param storage supplies storage returned by allocate().
+   * @param capacity supplies the capacity the storage was allocated with.
+   */
+  static void deallocate(StoragePtr storage, uint64_t capacity);
+
+  /**
+   * Sets the maximum number of bytes each thread keeps cached. This applies to all threads.
+   */
+  static void setMaxCachedBytes(uint64_t max_cached_bytes);
+
+  /**
+   * Empties the caches of all threads. Each thread releases its cache the next time it allocates or
+   * frees storage, as the caches are only accessed by their own thread.
+   */
+  static void releaseFreeMemory();
+
+  /**
+   * Sets the stats updated by the cache of the calling thread.
+   * @param stats supplies the stats, which must outlive the cache or be cleared with clearStats().
+   */
+  static void setStats(SliceAllocatorStats* stats);
+
+  /**
+   * Stops the cache of the calling thread from updating stats, if they were set with setStats().
+   * @param stats supplies the stats.
+   */
+  static void clearStats(const SliceAllocatorStats* stats);
+
+  /**
+   * @return uint64_t the number of bytes cached by the calling thread.
+   */
+  static uint64_t cachedBytes();
+
+private:
+  static constexpr uint32_t NumSizeClasses = MaxCachedSize / PageSize;
+
+  SliceAllocator();
+  ~SliceAllocator();
+
+  // Returns the cache of the calling thread, or nullptr if the thread is exiting.
+  static SliceAllocator* threadLocal();
+
+  StoragePtr allocateImpl(uint64_t capacity);
+  void deallocateImpl(StoragePtr storage, uint64_t capacity);
+  void maybeRelease();
+  void releaseCache();
+  void updateCachedBytes(uint64_t new_cached_bytes);
+
+  static std::atomic<uint64_t> max_cached_bytes_;
+  static std::atomic<uint64_t> release_epoch_;
+
+  std::array<std::vector<StoragePtr>, NumSizeClasses> free_lists_;
+  uint64_t cached_bytes_{};
+  uint64_t release_epoch_seen_{};
+  SliceAllocatorStats* stats_{};
+
+  friend class ThreadLocalSliceAllocator;
+};
+
+} // namespace Buffer
+} // namespace Envoy
@@ -62,7 +62,7 @@ SliceDataPtr WatermarkBuffer::extractMutableFrontSlice() {
 // the high watermark to avoid overshooting by a lot and thus violating the limits
 // the watermark is imposing.
 Reservation WatermarkBuffer::reserveForRead() {
-  constexpr auto preferred_length = default_read_reservation_size_;
+  const uint64_t preferred_length = OwnedImpl::readReservationLength();
   uint64_t adjusted_length = preferred_length;
 
   if (high_watermark_ > 0 && preferred_length > 0) {
@@ -78,7 +78,7 @@ Reservation WatermarkBuffer::reserveForRead() {
     }
   }
 
-  return OwnedImpl::reserveWithMaxLength(adjusted_length);
+  return OwnedImpl::reserveWithMaxLength(adjusted_length, readSliceSize(adjusted_length));
 }
 
 void WatermarkBuffer::appendSliceForTest(const void* data, uint64_t size) {
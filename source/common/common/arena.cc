@@ -0,0 +1,23 @@
+#include "common/common/arena.h"
+
+#include <algorithm>
+
+namespace Envoy {
+
+void* Arena::allocateSlow(size_t size) {
+  // Blocks from new[] are aligned for any type, so the allocation starts the new block.
+  if (size > next_block_size_ / 2) {
+    // A large allocation gets a block of its own, leaving the current block in use.
+    blocks_.emplace_back(new char[size]);
+    bytes_reserved_ += size;
+    return blocks_.back().get();
+  }
+  blocks_.emplace_back(new char[next_block_size_]);
+  bytes_reserved_ += next_block_size_;
+  next_ = blocks_.back().get() + size;
+  end_ = blocks_.back().get() + next_block_size_;
+  next_block_size_ = std::min(2 * next_block_size_, MaxBlockSize);
+  return blocks_.back().get();
+}
+
+} // namespace Envoy
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "common/common/assert.h"
+#include "common/common/non_copyable.h"
+
+#include "absl/container/inlined_vector.h"
+
+namespace Envoy {
+
+/**
+ * A monotonic arena: memory is carved out of blocks which are only released, all at once, when the
+ * arena is destroyed. It suits groups of objects which die together, such as the objects making up
+ * a single HTTP stream, replacing an allocation per object with an allocation per block. No memory
+ * is allocated until the first allocation from the arena.
+ *
+ * Objects constructed in the arena must be destroyed before the arena; ArenaPtr and ArenaAllocator
+ * make that work with unique_ptr and the standard containers.
+ */
+class Arena : NonCopyable {
+public:
+  static constexpr size_t DefaultInitialBlockSize = 2048;
+  // Blocks double in size up to this size.
+  static constexpr size_t MaxBlockSize = 64 * 1024;
+
+  explicit Arena(size_t initial_block_size = DefaultInitialBlockSize)
+      : next_block_size_(initial_block_size) {}
+
+  /**
+   * @return memory for size bytes aligned to alignment, which must be a power of two no larger
+   *         than alignof(std::max_align_t). The memory is valid until the arena is destroyed.
+   */
+  void* allocate(size_t size, size_t alignment) {
+    ASSERT(alignment <= alignof(std::max_align_t) && (alignment & (alignment - 1)) == 0);
+    const uintptr_t aligned =
+        (reinterpret_cast<uintptr_t>(next_) + alignment - 1) & ~(alignment - 1);
+    if (next_ == nullptr || aligned + size > reinterpret_cast<uintptr_t>(end_)) {
+      return allocateSlow(size);
+    }
+    next_ = reinterpret_cast<char*>(aligned + size);
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  /**
+   * Constructs an object in the arena. Its destructor is not run by the arena.
+   */
+  template <class T, class... Args> T* create(Args&&... args) {
+    return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+
+  /**
+   * @return the number of blocks allocated by the arena.
+   */
+  size_t blocks() const { return blocks_.size(); }
+
+  /**
+   * @return the number of bytes in the blocks allocated by the arena.
+   */
+  size_t bytesReserved() const { return bytes_reserved_; }
+
+private:
+  void* allocateSlow(size_t size);
+
+  absl::InlinedVector<std::unique_ptr<char[]>, 2> blocks_;
+  char* next_{};
+  char* end_{};
+  size_t next_block_size_;
+  size_t bytes_reserved_{};
+};
+
+/**
+ * Deleter for objects which may have been constructed in an Arena. Objects in an arena are only
+ * destroyed, as their memory goes with the arena, while others are deleted.
+ */
+template <class T> struct ArenaDeleter {
+  ArenaDeleter() = default;
+  explicit ArenaDeleter(bool in_arena) : in_arena_(in_arena) {}
+  // Allows converting an ArenaPtr of a derived class into an ArenaPtr of a base class.
+  template <class U> ArenaDeleter(const ArenaDeleter<U>& other) : in_arena_(other.in_arena_) {}
+
+  void operator()(T* object) const {
+    if (in_arena_) {
+      object->~T();
+    } else {
+      delete object;
+    }
+  }
+
+  bool in_arena_{};
+};
+
+template <class T> using ArenaPtr = std::unique_ptr<T, ArenaDeleter<T>>;
+
+/**
+ * Constructs an object in an arena, or on the heap if arena is nullptr.
+ */
+template <class T, class... Args> ArenaPtr<T> makeArenaPtr(Arena* arena, Args&&... args) {
+  if (arena == nullptr) {
+    return ArenaPtr<T>(new T(std::forward<Args>(args)...));
+  }
+  return ArenaPtr<T>(arena->create<T>(std::forward<Args>(args)...), ArenaDeleter<T>(true));
+}
+
+/**
+ * Allocator for standard containers which allocates from an arena, or from the heap if the arena
+ * is nullptr. Memory from the arena is not released until the arena is destroyed.
+ */
+template <class T> class ArenaAllocator {
+public:
+  using value_type = T;
+
+  explicit ArenaAllocator(Arena* arena) : arena_(arena) {}
+  template <class U> ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.arena()) {}
+
+  T* allocate(size_t n) {
+    if (arena_ == nullptr) {
+      return std::allocator<T>().allocate(n);
+    }
+    return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, size_t n) {
+    if (arena_ == nullptr) {
+      std::allocator<T>().deallocate(p, n);
+    }
+  }
+
+  Arena* arena() const { return arena_; }
+
+  template <class U> bool operator==(const ArenaAllocator<U>& other) const {
+    return arena_ == other.arena();
+  }
+  template <class U> bool operator!=(const ArenaAllocator<U>& other) const {
+    return arena_ != other.arena();
+  }
+
+private:
+  Arena* arena_;
+};
+
+} // namespace Envoy
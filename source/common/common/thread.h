@@ -140,6 +140,14 @@ public:
     return atomic_ref.load();
   }
 
+  /*
+   * Returns an already existing T* at index, without instantiating it.
+   *
+   * @param index the Index to look up.
+   * @return The already-existing T*, or nullptr if it has not been made yet.
+   */
+  T* getExisting(uint32_t index) const { return data_[index].load(); }
+
 private:
   std::atomic<T*> data_[size];
   absl::Mutex mutex_;
@@ -167,6 +175,11 @@ public:
    * @return The new or already-existing T*, possibly nullptr if make_object returns nullptr.
    */
   T* get(const MakeObject& make_object) { return BaseClass::get(0, make_object); }
+
+  /*
+   * @return The already-existing T*, or nullptr if it has not been made yet.
+   */
+  T* getExisting() const { return BaseClass::getExisting(0); }
 };
 
 struct MainThread {
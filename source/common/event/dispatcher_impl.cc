@@ -79,6 +79,9 @@ DispatcherImpl::DispatcherImpl(const std::string& name, Api::Api& api,
 DispatcherImpl::~DispatcherImpl() {
   ENVOY_LOG(debug, "destroying dispatcher {}", name_);
   FatalErrorHandler::removeFatalErrorHandler(*this);
+  if (slice_allocator_stats_ != nullptr) {
+    Buffer::SliceAllocator::clearStats(slice_allocator_stats_.get());
+  }
   // TODO(lambdai): Resolve https://github.com/envoyproxy/envoy/issues/15072 and enable
   // ASSERT(deletable_in_dispatcher_thread_.empty())
 }
@@ -99,6 +102,13 @@ void DispatcherImpl::initializeStats(Stats::Scope& scope,
     stats_ = std::make_unique<DispatcherStats>(
         DispatcherStats{ALL_DISPATCHER_STATS(POOL_HISTOGRAM_PREFIX(scope, stats_prefix_ + "."))});
     base_scheduler_.initializeStats(stats_.get());
+    // The slice allocator caches storage for the thread running the dispatcher.
+    const std::string slice_allocator_prefix = effective_prefix + "slice_allocator.";
+    slice_allocator_stats_ = std::make_unique<Buffer::SliceAllocatorStats>(
+        Buffer::SliceAllocatorStats{ALL_SLICE_ALLOCATOR_STATS(
+            POOL_COUNTER_PREFIX(scope, slice_allocator_prefix),
+            POOL_GAUGE_PREFIX(scope, slice_allocator_prefix))});
+    Buffer::SliceAllocator::setStats(slice_allocator_stats_.get());
     ENVOY_LOG(debug, "running {} on thread {}", stats_prefix_, run_tid_.debugString());
   });
 }
@@ -325,6 +335,10 @@ void DispatcherImpl::shutdown() {
   while (!local_deletables.empty()) {
     local_deletables.pop_front();
   }
+  // The stats may be destroyed before the thread frees the remaining buffers.
+  if (slice_allocator_stats_ != nullptr) {
+    Buffer::SliceAllocator::clearStats(slice_allocator_stats_.get());
+  }
   ASSERT(!shutdown_called_);
   shutdown_called_ = true;
   ENVOY_LOG(
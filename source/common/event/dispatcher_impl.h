@@ -14,6 +14,7 @@
 #include "envoy/network/connection_handler.h"
 #include "envoy/stats/scope.h"
 
+#include "common/buffer/slice_allocator.h"
 #include "common/common/logger.h"
 #include "common/common/thread.h"
 #include "common/event/libevent.h"
@@ -146,6 +147,7 @@ private:
   Api::Api& api_;
   std::string stats_prefix_;
   DispatcherStatsPtr stats_;
+  Buffer::SliceAllocatorStatsPtr slice_allocator_stats_;
   Thread::ThreadId run_tid_;
   Buffer::WatermarkFactorySharedPtr buffer_factory_;
   LibeventScheduler base_scheduler_;
@@ -118,7 +118,8 @@ public:
          parent_.host()->cluster().stats().upstream_cx_rx_bytes_buffered_,
          parent_.host()->cluster().stats().upstream_cx_tx_bytes_total_,
          parent_.host()->cluster().stats().upstream_cx_tx_bytes_buffered_,
-         &parent_.host()->cluster().stats().bind_errors_, nullptr});
+         &parent_.host()->cluster().stats().bind_errors_, nullptr,
+         &parent_.host()->cluster().stats().upstream_cx_rx_reads_total_});
   }
 
   absl::optional<Http::Protocol> protocol() const override { return codec_client_->protocol(); }
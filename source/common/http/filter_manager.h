@@ -14,6 +14,7 @@
 #include "envoy/type/matcher/v3/http_inputs.pb.validate.h"
 
 #include "common/buffer/watermark_buffer.h"
+#include "common/common/arena.h"
 #include "common/common/dump_state_utils.h"
 #include "common/common/linked_object.h"
 #include "common/common/logger.h"
@@ -24,6 +25,7 @@
 #include "common/local_reply/local_reply.h"
 #include "common/matcher/matcher.h"
 #include "common/protobuf/utility.h"
+#include "common/runtime/runtime_features.h"
 #include "common/stream_info/stream_info_impl.h"
 
 namespace Envoy {
@@ -206,12 +208,18 @@ struct ActiveStreamFilterBase : public virtual StreamFilterCallbacks,
   friend FilterMatchState;
 };
 
+struct ActiveStreamDecoderFilter;
+using ActiveStreamDecoderFilterPtr = ArenaPtr<ActiveStreamDecoderFilter>;
+using ActiveStreamDecoderFilterList =
+    std::list<ActiveStreamDecoderFilterPtr, ArenaAllocator<ActiveStreamDecoderFilterPtr>>;
+
 /**
  * Wrapper for a stream decoder filter.
  */
 struct ActiveStreamDecoderFilter : public ActiveStreamFilterBase,
                                    public StreamDecoderFilterCallbacks,
-                                   LinkedObject<ActiveStreamDecoderFilter> {
+                                   LinkedObject<ActiveStreamDecoderFilter,
+                                                ActiveStreamDecoderFilterList> {
   ActiveStreamDecoderFilter(FilterManager& parent, StreamDecoderFilterSharedPtr filter,
                             FilterMatchStateSharedPtr match_state, bool dual_filter)
       : ActiveStreamFilterBase(parent, dual_filter, std::move(match_state)), handle_(filter) {}
@@ -296,14 +304,18 @@ struct ActiveStreamDecoderFilter : public ActiveStreamFilterBase,
   bool is_grpc_request_{};
 };
 
-using ActiveStreamDecoderFilterPtr = std::unique_ptr<ActiveStreamDecoderFilter>;
+struct ActiveStreamEncoderFilter;
+using ActiveStreamEncoderFilterPtr = ArenaPtr<ActiveStreamEncoderFilter>;
+using ActiveStreamEncoderFilterList =
+    std::list<ActiveStreamEncoderFilterPtr, ArenaAllocator<ActiveStreamEncoderFilterPtr>>;
 
 /**
  * Wrapper for a stream encoder filter.
  */
 struct ActiveStreamEncoderFilter : public ActiveStreamFilterBase,
                                    public StreamEncoderFilterCallbacks,
-                                   LinkedObject<ActiveStreamEncoderFilter> {
+                                   LinkedObject<ActiveStreamEncoderFilter,
+                                                ActiveStreamEncoderFilterList> {
   ActiveStreamEncoderFilter(FilterManager& parent, StreamEncoderFilterSharedPtr filter,
                             FilterMatchStateSharedPtr match_state, bool dual_filter)
       : ActiveStreamFilterBase(parent, dual_filter, std::move(match_state)), handle_(filter) {}
@@ -353,8 +365,6 @@ struct ActiveStreamEncoderFilter : public ActiveStreamFilterBase,
   StreamEncoderFilterSharedPtr handle_;
 };
 
-using ActiveStreamEncoderFilterPtr = std::unique_ptr<ActiveStreamEncoderFilter>;
-
 /**
  * Callbacks invoked by the FilterManager to pass filter data/events back to the caller.
  */
@@ -645,7 +655,12 @@ public:
                 StreamInfo::FilterState::LifeSpan filter_state_life_span)
       : filter_manager_callbacks_(filter_manager_callbacks), dispatcher_(dispatcher),
         connection_(connection), stream_id_(stream_id), proxy_100_continue_(proxy_100_continue),
-        buffer_limit_(buffer_limit), filter_chain_factory_(filter_chain_factory),
+        arena_(Runtime::runtimeFeatureEnabled("envoy.reloadable_features.http_stream_arena")
+                   ? &stream_arena_
+                   : nullptr),
+        decoder_filters_(ArenaAllocator<ActiveStreamDecoderFilterPtr>(arena_)),
+        encoder_filters_(ArenaAllocator<ActiveStreamEncoderFilterPtr>(arena_)),
+        filters_(ArenaAllocator<StreamFilterBase*>(arena_)), buffer_limit_(buffer_limit), filter_chain_factory_(filter_chain_factory),
         local_reply_(local_reply),
         stream_info_(protocol, time_source, connection.addressProviderSharedPtr(),
                      parent_filter_state, filter_state_life_span) {}
@@ -923,11 +938,11 @@ private:
   enum class FilterIterationStartState { AlwaysStartFromNext, CanStartFromCurrent };
 
   // Returns the encoder filter to start iteration with.
-  std::list<ActiveStreamEncoderFilterPtr>::iterator
+  ActiveStreamEncoderFilterList::iterator
   commonEncodePrefix(ActiveStreamEncoderFilter* filter, bool end_stream,
                      FilterIterationStartState filter_iteration_start_state);
   // Returns the decoder filter to start iteration with.
-  std::list<ActiveStreamDecoderFilterPtr>::iterator
+  ActiveStreamDecoderFilterList::iterator
   commonDecodePrefix(ActiveStreamDecoderFilter* filter,
                      FilterIterationStartState filter_iteration_start_state);
   void addDecodedData(ActiveStreamDecoderFilter& filter, Buffer::Instance& data, bool streaming);
@@ -936,7 +951,7 @@ private:
   // Helper function for the case where we have a header only request, but a filter adds a body
   // to it.
   void maybeContinueDecoding(
-      const std::list<ActiveStreamDecoderFilterPtr>::iterator& maybe_continue_data_entry);
+      const ActiveStreamDecoderFilterList::iterator& maybe_continue_data_entry);
   void decodeHeaders(ActiveStreamDecoderFilter* filter, RequestHeaderMap& headers, bool end_stream);
   // Sends data through decoding filter chains. filter_iteration_start_state indicates which
   // filter to start the iteration with.
@@ -951,7 +966,7 @@ private:
   // filters before calling encodeHeadersInternal which does final header munging and passes the
   // headers to the encoder.
   void maybeContinueEncoding(
-      const std::list<ActiveStreamEncoderFilterPtr>::iterator& maybe_continue_data_entry);
+      const ActiveStreamEncoderFilterList::iterator& maybe_continue_data_entry);
   void encodeHeaders(ActiveStreamEncoderFilter* filter, ResponseHeaderMap& headers,
                      bool end_stream);
   // Sends data through encoding filter chains. filter_iteration_start_state indicates which
@@ -984,9 +999,14 @@ private:
   const uint64_t stream_id_;
   const bool proxy_100_continue_;
 
-  std::list<ActiveStreamDecoderFilterPtr> decoder_filters_;
-  std::list<ActiveStreamEncoderFilterPtr> encoder_filters_;
-  std::list<StreamFilterBase*> filters_;
+  // When the http_stream_arena runtime feature is enabled, the filter wrappers and the lists
+  // holding them are allocated from stream_arena_ and released together with the stream. The arena
+  // must outlive everything allocated from it, so it is declared first.
+  Arena stream_arena_;
+  Arena* const arena_;
+  ActiveStreamDecoderFilterList decoder_filters_;
+  ActiveStreamEncoderFilterList encoder_filters_;
+  std::list<StreamFilterBase*, ArenaAllocator<StreamFilterBase*>> filters_;
   std::list<AccessLog::InstanceSharedPtr> access_log_handlers_;
 
   // Stores metadata added in the decoding filter that is being processed. Will be cleared before
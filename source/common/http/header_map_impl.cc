@@ -1,7 +1,6 @@
 #include "common/http/header_map_impl.h"
 
 #include <cstdint>
-#include <list>
 #include <memory>
 #include <string>
 
@@ -179,13 +178,39 @@ template <> bool HeaderMapImpl::HeaderList::isPseudoHeader(const LowerCaseString
   return key.get().c_str()[0] == ':';
 }
 
+void HeaderMapImpl::EntryArena::reset() {
+  free_list_ = nullptr;
+  if (blocks_.empty()) {
+    return;
+  }
+  blocks_.resize(1);
+  block_size_ = InitialBlockSize;
+  next_ = blocks_[0].get();
+  block_end_ = next_ + block_size_;
+}
+
+void* HeaderMapImpl::EntryArena::allocate() {
+  if (free_list_ != nullptr) {
+    Slot* slot = free_list_;
+    free_list_ = slot->next_free_;
+    return slot;
+  }
+  if (next_ == block_end_) {
+    block_size_ = blocks_.empty() ? InitialBlockSize : std::min(2 * block_size_, MaxBlockSize);
+    blocks_.emplace_back(new Slot[block_size_]);
+    next_ = blocks_.back().get();
+    block_end_ = next_ + block_size_;
+  }
+  return next_++;
+}
+
 bool HeaderMapImpl::HeaderList::maybeMakeMap() {
   if (lazy_map_.empty()) {
     if (headers_.size() < lazy_map_min_size_) {
       return false;
     }
     // Add all entries from the list into the map.
-    for (auto node = headers_.begin(); node != headers_.end(); ++node) {
+    for (HeaderNode node : headers_) {
       HeaderNodeVector& v = lazy_map_[node->key().getStringView()];
       v.push_back(node);
     }
@@ -193,6 +218,16 @@ bool HeaderMapImpl::HeaderList::maybeMakeMap() {
   return true;
 }
 
+void HeaderMapImpl::HeaderList::removeFromMap(HeaderNode node) {
+  auto iter = lazy_map_.find(node->key().getStringView());
+  ASSERT(iter != lazy_map_.end());
+  HeaderNodeVector& v = iter->second;
+  v.erase(std::find(v.begin(), v.end(), node));
+  if (v.empty()) {
+    lazy_map_.erase(iter);
+  }
+}
+
 size_t HeaderMapImpl::HeaderList::remove(absl::string_view key) {
   size_t removed_bytes = 0;
   if (maybeMakeMap()) {
@@ -201,7 +236,7 @@ size_t HeaderMapImpl::HeaderList::remove(absl::string_view key) {
       // Erase from the map, and all same key entries from the list.
       HeaderNodeVector header_nodes = std::move(iter->second);
       lazy_map_.erase(iter);
-      for (const HeaderNode& node : header_nodes) {
+      for (HeaderNode node : header_nodes) {
         ASSERT(node->key() == key);
         removed_bytes += node->key().size() + node->value().size();
         erase(node, false /* remove_from_map */);
@@ -209,14 +244,13 @@ size_t HeaderMapImpl::HeaderList::remove(absl::string_view key) {
     }
   } else {
     // Erase all same key entries from the list.
-    for (auto i = headers_.begin(); i != headers_.end();) {
-      if (i->key() == key) {
-        removed_bytes += i->key().size() + i->value().size();
-        i = erase(i, false /* remove_from_map */);
-      } else {
-        ++i;
+    removeIf([key, &removed_bytes](const HeaderEntryImpl& entry) {
+      if (entry.key() == key) {
+        removed_bytes += entry.key().size() + entry.value().size();
+        return true;
       }
-    }
+      return false;
+    });
   }
   return removed_bytes;
 }
@@ -345,7 +379,7 @@ bool HeaderMapImpl::operator==(const HeaderMap& rhs) const {
   auto i = headers_.begin();
   auto j = rhs_headers.begin();
   for (; i != headers_.end(); ++i, ++j) {
-    if (i->key() != j->first || i->value() != j->second) {
+    if ((*i)->key() != j->first || (*i)->value() != j->second) {
       return false;
     }
   }
@@ -369,8 +403,7 @@ void HeaderMapImpl::insertByKey(HeaderString&& key, HeaderString&& value) {
     }
   } else {
     addSize(key.size() + value.size());
-    HeaderNode i = headers_.insert(std::move(key), std::move(value));
-    i->entry_ = i;
+    headers_.insert(std::move(key), std::move(value));
   }
 }
 
@@ -458,9 +491,9 @@ uint64_t HeaderMapImpl::byteSize() const { return cached_byte_size_; }
 void HeaderMapImpl::verifyByteSizeInternalForTest() const {
   // Computes the total byte size by summing the byte size of the keys and values.
   uint64_t byte_size = 0;
-  for (const HeaderEntryImpl& header : headers_) {
-    byte_size += header.key().size();
-    byte_size += header.value().size();
+  for (const HeaderEntryImpl* header : headers_) {
+    byte_size += header->key().size();
+    byte_size += header->value().size();
   }
   ASSERT(cached_byte_size_ == byte_size);
 }
@@ -492,7 +525,7 @@ HeaderMap::NonConstGetResult HeaderMapImpl::getExisting(const LowerCaseString& k
       ASSERT(!v.empty()); // It's impossible to have a map entry with an empty vector as its value.
       for (const auto& values_it : v) {
         // Convert the iterated value to a HeaderEntry*.
-        ret.push_back(&(*values_it));
+        ret.push_back(values_it);
       }
     }
     return ret;
@@ -501,9 +534,9 @@ HeaderMap::NonConstGetResult HeaderMapImpl::getExisting(const LowerCaseString& k
   // If the requested header is not an O(1) header and the lazy map is not in use, we do a full
   // scan. Doing the trie lookup is wasteful in the miss case, but is present for code consistency
   // with other functions that do similar things.
-  for (HeaderEntryImpl& header : headers_) {
-    if (header.key() == key.get().c_str()) {
-      ret.push_back(&header);
+  for (HeaderEntryImpl* header : headers_) {
+    if (header->key() == key.get().c_str()) {
+      ret.push_back(header);
     }
   }
 
@@ -511,8 +544,8 @@ HeaderMap::NonConstGetResult HeaderMapImpl::getExisting(const LowerCaseString& k
 }
 
 void HeaderMapImpl::iterate(HeaderMap::ConstIterateCb cb) const {
-  for (const HeaderEntryImpl& header : headers_) {
-    if (cb(header) == HeaderMap::Iterate::Break) {
+  for (const HeaderEntryImpl* header : headers_) {
+    if (cb(*header) == HeaderMap::Iterate::Break) {
       break;
     }
   }
@@ -520,7 +553,7 @@ void HeaderMapImpl::iterate(HeaderMap::ConstIterateCb cb) const {
 
 void HeaderMapImpl::iterateReverse(HeaderMap::ConstIterateCb cb) const {
   for (auto it = headers_.rbegin(); it != headers_.rend(); it++) {
-    if (cb(*it) == HeaderMap::Iterate::Break) {
+    if (cb(**it) == HeaderMap::Iterate::Break) {
       break;
     }
   }
@@ -589,9 +622,7 @@ HeaderMapImpl::HeaderEntryImpl& HeaderMapImpl::maybeCreateInline(HeaderEntryImpl
   }
 
   addSize(key.get().size());
-  HeaderNode i = headers_.insert(key);
-  i->entry_ = i;
-  *entry = &(*i);
+  *entry = headers_.insert(key);
   return **entry;
 }
 
@@ -604,9 +635,7 @@ HeaderMapImpl::HeaderEntryImpl& HeaderMapImpl::maybeCreateInline(HeaderEntryImpl
   }
 
   addSize(key.get().size() + value.size());
-  HeaderNode i = headers_.insert(key, std::move(value));
-  i->entry_ = i;
-  *entry = &(*i);
+  *entry = headers_.insert(key, std::move(value));
   return **entry;
 }
 
@@ -616,10 +645,10 @@ size_t HeaderMapImpl::removeInline(HeaderEntryImpl** ptr_to_entry) {
   }
 
   HeaderEntryImpl* entry = *ptr_to_entry;
-  const uint64_t size_to_subtract = entry->entry_->key().size() + entry->entry_->value().size();
+  const uint64_t size_to_subtract = entry->key().size() + entry->value().size();
   subtractSize(size_to_subtract);
   *ptr_to_entry = nullptr;
-  headers_.erase(entry->entry_, true);
+  headers_.erase(entry, true);
   return 1;
 }
 
@@ -1,8 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
-#include <list>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -122,9 +122,8 @@ protected:
 
     HeaderString key_;
     HeaderString value_;
-    std::list<HeaderEntryImpl>::iterator entry_;
   };
-  using HeaderNode = std::list<HeaderEntryImpl>::iterator;
+  using HeaderNode = HeaderEntryImpl*;
 
   /**
    * This is the static lookup table that is used to determine whether a header is one of the O(1)
@@ -179,17 +178,64 @@ protected:
   };
 
   /**
-   * List of HeaderEntryImpl that keeps the pseudo headers (key starting with ':') in the front
-   * of the list (as required by nghttp2) and otherwise maintains insertion order.
+   * Storage for the entries of a HeaderList. Entries are constructed in blocks which double in
+   * size, so populating a map with N headers allocates O(log N) times rather than N times. Entries
+   * never move, so pointers to them stay valid until they are destroyed, and the slots of destroyed
+   * entries are reused by later insertions.
+   */
+  class EntryArena : NonCopyable {
+  public:
+    template <class... Args> HeaderEntryImpl* create(Args&&... args) {
+      return new (allocate()) HeaderEntryImpl(std::forward<Args>(args)...);
+    }
+
+    void destroy(HeaderEntryImpl* entry) {
+      entry->~HeaderEntryImpl();
+      Slot* slot = reinterpret_cast<Slot*>(entry);
+      slot->next_free_ = free_list_;
+      free_list_ = slot;
+    }
+
+    /**
+     * Makes all slots available again, keeping the first block. All entries must have been
+     * destroyed.
+     */
+    void reset();
+
+  private:
+    union Slot {
+      Slot* next_free_;
+      alignas(HeaderEntryImpl) char entry_[sizeof(HeaderEntryImpl)];
+    };
+
+    // Most header maps hold a few headers, so the first block is small to keep trailers and
+    // locally generated maps cheap; blocks then double up to MaxBlockSize entries.
+    static constexpr size_t InitialBlockSize = 4;
+    static constexpr size_t MaxBlockSize = 64;
+
+    void* allocate();
+
+    absl::InlinedVector<std::unique_ptr<Slot[]>, 4> blocks_;
+    // The number of slots in the last block.
+    size_t block_size_{};
+    Slot* free_list_{};
+    Slot* next_{};
+    Slot* block_end_{};
+  };
+
+  /**
+   * Ordered list of HeaderEntryImpl that keeps the pseudo headers (key starting with ':') in the
+   * front of the list (as required by nghttp2) and otherwise maintains insertion order. The order
+   * is kept in a contiguous vector of pointers into an EntryArena, so iteration does not chase
+   * list nodes and adding a header rarely allocates.
    * When the list size is greater or equal to the envoy.http.headermap.lazy_map_min_size runtime
-   * feature value (or uint32_t max value if not set), all headers are added to a map, to allow
-   * fast access given a header key. Once the map is initialized, it will be used even if the number
-   * of headers decreases below the threshold.
+   * feature value (DefaultLazyMapMinSize if not set), all headers are added to a map on the first
+   * lookup of a header which is not an O(1) header, to allow fast access given a header key. Once
+   * the map is initialized, it will be used even if the number of headers decreases below the
+   * threshold.
    *
-   * Note: the internal iterators held in fields make this unsafe to copy and move, since the
-   * reference to end() is not preserved across a move (see Notes in
-   * https://en.cppreference.com/w/cpp/container/list/list). The NonCopyable will suppress both copy
-   * and move constructors/assignment.
+   * Note: the map holds pointers to the entries, which makes this unsafe to copy and move. The
+   * NonCopyable will suppress both copy and move constructors/assignment.
    * TODO(htuch): Maybe we want this to movable one day; for now, our header map moves happen on
    * HeaderMapPtr, so the performance impact should not be evident.
    */
@@ -197,11 +243,15 @@ protected:
   public:
     using HeaderNodeVector = absl::InlinedVector<HeaderNode, 1>;
     using HeaderLazyMap = absl::flat_hash_map<absl::string_view, HeaderNodeVector>;
+    using HeaderVector = absl::InlinedVector<HeaderNode, 8>;
+
+    // Below this many headers, scanning the contiguous list is as fast as a hash lookup.
+    static constexpr uint32_t DefaultLazyMapMinSize = 3;
 
     HeaderList()
-        : pseudo_headers_end_(headers_.end()),
-          lazy_map_min_size_(static_cast<uint32_t>(Runtime::getInteger(
-              "envoy.http.headermap.lazy_map_min_size", std::numeric_limits<uint32_t>::max()))) {}
+        : lazy_map_min_size_(static_cast<uint32_t>(Runtime::getInteger(
+              "envoy.http.headermap.lazy_map_min_size", DefaultLazyMapMinSize))) {}
+    ~HeaderList() { destroyEntries(); }
 
     template <class Key> bool isPseudoHeader(const Key& key) {
       return !key.getStringView().empty() && key.getStringView()[0] == ':';
@@ -209,72 +259,52 @@ protected:
 
     template <class Key, class... Value> HeaderNode insert(Key&& key, Value&&... value) {
       const bool is_pseudo_header = isPseudoHeader(key);
-      HeaderNode i = headers_.emplace(is_pseudo_header ? pseudo_headers_end_ : headers_.end(),
-                                      std::forward<Key>(key), std::forward<Value>(value)...);
+      HeaderNode i = arena_.create(std::forward<Key>(key), std::forward<Value>(value)...);
+      if (is_pseudo_header) {
+        headers_.insert(headers_.begin() + pseudo_headers_size_, i);
+        pseudo_headers_size_++;
+      } else {
+        headers_.push_back(i);
+      }
       if (!lazy_map_.empty()) {
         lazy_map_[i->key().getStringView()].push_back(i);
       }
-      if (!is_pseudo_header && pseudo_headers_end_ == headers_.end()) {
-        pseudo_headers_end_ = i;
-      }
       return i;
     }
 
-    HeaderNode erase(HeaderNode i, bool remove_from_map) {
-      if (pseudo_headers_end_ == i) {
-        pseudo_headers_end_++;
+    void erase(HeaderNode i, bool remove_from_map) {
+      auto position = std::find(headers_.begin(), headers_.end(), i);
+      ASSERT(position != headers_.end());
+      if (static_cast<size_t>(position - headers_.begin()) < pseudo_headers_size_) {
+        pseudo_headers_size_--;
       }
+      headers_.erase(position);
       if (remove_from_map) {
         lazy_map_.erase(i->key().getStringView());
       }
-      return headers_.erase(i);
+      arena_.destroy(i);
     }
 
     template <class UnaryPredicate> void removeIf(UnaryPredicate p) {
-      if (!lazy_map_.empty()) {
-        // Lazy map is used, iterate over its elements and remove those that satisfy the predicate
-        // from the map and from the list.
-        for (auto map_it = lazy_map_.begin(); map_it != lazy_map_.end();) {
-          auto& values_vec = map_it->second;
-          ASSERT(!values_vec.empty());
-          // The following call to std::remove_if removes the elements that satisfy the
-          // UnaryPredicate and shifts the vector elements, but does not resize the vector.
-          // The call to erase that follows erases the unneeded cells (from remove_pos to the
-          // end) and modifies the vector's size.
-          const auto remove_pos =
-              std::remove_if(values_vec.begin(), values_vec.end(), [&](HeaderNode it) {
-                if (p(*(it->entry_))) {
-                  // Remove the element from the list.
-                  if (pseudo_headers_end_ == it->entry_) {
-                    pseudo_headers_end_++;
-                  }
-                  headers_.erase(it);
-                  return true;
-                }
-                return false;
-              });
-          values_vec.erase(remove_pos, values_vec.end());
-
-          // If all elements were removed from the map entry, erase it.
-          if (values_vec.empty()) {
-            lazy_map_.erase(map_it++);
-          } else {
-            map_it++;
+      // Compact the list in place, keeping the relative order of the remaining headers.
+      size_t kept = 0;
+      size_t pseudo_headers_kept = 0;
+      for (size_t i = 0; i < headers_.size(); i++) {
+        HeaderNode node = headers_[i];
+        if (!p(*node)) {
+          if (i < pseudo_headers_size_) {
+            pseudo_headers_kept++;
           }
+          headers_[kept++] = node;
+          continue;
         }
-      } else {
-        // The lazy map isn't used, iterate over the list elements and remove elements that satisfy
-        // the predicate.
-        headers_.remove_if([&](const HeaderEntryImpl& entry) {
-          const bool to_remove = p(entry);
-          if (to_remove) {
-            if (pseudo_headers_end_ == entry.entry_) {
-              pseudo_headers_end_++;
-            }
-          }
-          return to_remove;
-        });
+        if (!lazy_map_.empty()) {
+          removeFromMap(node);
+        }
+        arena_.destroy(node);
       }
+      headers_.resize(kept);
+      pseudo_headers_size_ = pseudo_headers_kept;
     }
 
     /*
@@ -292,25 +322,34 @@ protected:
      */
     size_t remove(absl::string_view key);
 
-    std::list<HeaderEntryImpl>::iterator begin() { return headers_.begin(); }
-    std::list<HeaderEntryImpl>::iterator end() { return headers_.end(); }
-    std::list<HeaderEntryImpl>::const_iterator begin() const { return headers_.begin(); }
-    std::list<HeaderEntryImpl>::const_iterator end() const { return headers_.end(); }
-    std::list<HeaderEntryImpl>::const_reverse_iterator rbegin() const { return headers_.rbegin(); }
-    std::list<HeaderEntryImpl>::const_reverse_iterator rend() const { return headers_.rend(); }
+    HeaderVector::const_iterator begin() const { return headers_.begin(); }
+    HeaderVector::const_iterator end() const { return headers_.end(); }
+    HeaderVector::const_reverse_iterator rbegin() const { return headers_.rbegin(); }
+    HeaderVector::const_reverse_iterator rend() const { return headers_.rend(); }
     HeaderLazyMap::iterator mapFind(absl::string_view key) { return lazy_map_.find(key); }
     HeaderLazyMap::iterator mapEnd() { return lazy_map_.end(); }
     size_t size() const { return headers_.size(); }
     bool empty() const { return headers_.empty(); }
     void clear() {
+      destroyEntries();
       headers_.clear();
-      pseudo_headers_end_ = headers_.end();
+      pseudo_headers_size_ = 0;
       lazy_map_.clear();
+      arena_.reset();
     }
 
   private:
-    std::list<HeaderEntryImpl> headers_;
-    HeaderNode pseudo_headers_end_;
+    void removeFromMap(HeaderNode node);
+    void destroyEntries() {
+      for (HeaderNode node : headers_) {
+        node->~HeaderEntryImpl();
+      }
+    }
+
+    EntryArena arena_;
+    HeaderVector headers_;
+    // The number of pseudo headers at the front of headers_.
+    size_t pseudo_headers_size_{};
     // The number of headers threshold for lazy map usage.
     const uint32_t lazy_map_min_size_;
     HeaderLazyMap lazy_map_;
@@ -21,6 +21,7 @@
 #include "common/http/headers.h"
 #include "common/http/http1/header_formatter.h"
 #include "common/http/http1/legacy_parser_impl.h"
+#include "common/http/http1/vectorized_parser_impl.h"
 #include "common/http/utility.h"
 #include "common/runtime/runtime_features.h"
 
@@ -469,7 +470,14 @@ ConnectionImpl::ConnectionImpl(Network::Connection& connection, CodecStats& stat
                                []() -> void { /* TODO(adisuissa): Handle overflow watermark */ })),
       max_headers_kb_(max_headers_kb), max_headers_count_(max_headers_count) {
   output_buffer_->setWatermarks(connection.bufferLimit());
-  parser_ = std::make_unique<LegacyHttpParserImpl>(type, this);
+  switch (settings.parser_) {
+  case Http1Settings::Parser::HttpParser:
+    parser_ = std::make_unique<LegacyHttpParserImpl>(type, this);
+    break;
+  case Http1Settings::Parser::Vectorized:
+    parser_ = std::make_unique<VectorizedParserImpl>(type, this);
+    break;
+  }
 }
 
 Status ConnectionImpl::completeLastHeader() {
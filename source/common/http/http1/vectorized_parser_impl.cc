@@ -0,0 +1,1179 @@
+#include "common/http/http1/vectorized_parser_impl.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#include "common/common/assert.h"
+#include "common/common/macros.h"
+#include "common/http/http1/parser.h"
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ENVOY_HTTP1_PARSER_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace Envoy {
+namespace Http {
+namespace Http1 {
+namespace {
+
+// The return codes of the parser. The names reported by errnoName() are those http-parser uses for
+// the same errors, so that codec error details do not depend on the parser.
+enum class Errno : int {
+  Ok = 0,
+  Callback,
+  InvalidEofState,
+  ClosedConnection,
+  InvalidVersion,
+  InvalidStatus,
+  InvalidMethod,
+  InvalidUrl,
+  LfExpected,
+  InvalidHeaderToken,
+  InvalidContentLength,
+  UnexpectedContentLength,
+  InvalidChunkSize,
+  InvalidConstant,
+  InvalidTransferEncoding,
+  Paused,
+};
+
+// Methods known to http-parser. Requests with any other method are rejected.
+constexpr absl::string_view Methods[] = {
+    "DELETE", "GET", "HEAD", "POST", "PUT", "CONNECT", "OPTIONS", "TRACE", "COPY", "LOCK",
+    "MKCOL", "MOVE", "PROPFIND", "PROPPATCH", "SEARCH", "UNLOCK", "BIND", "REBIND", "UNBIND",
+    "ACL", "REPORT", "MKACTIVITY", "CHECKOUT", "MERGE", "M-SEARCH", "NOTIFY", "SUBSCRIBE",
+    "UNSUBSCRIBE", "PATCH", "PURGE", "MKCALENDAR", "LINK", "UNLINK", "SOURCE"};
+constexpr size_t MaxMethodLength = 11;
+constexpr absl::string_view Connect = "CONNECT";
+
+// A byte which may appear in a header name: a tchar from RFC 7230, section 3.2.6.
+constexpr bool isTokenChar(uint8_t c) {
+  if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+    return true;
+  }
+  switch (c) {
+  case '!':
+  case '#':
+  case '$':
+  case '%':
+  case '&':
+  case '\'':
+  case '*':
+  case '+':
+  case '-':
+  case '.':
+  case '^':
+  case '_':
+  case '`':
+  case '|':
+  case '~':
+    return true;
+  default:
+    return false;
+  }
+}
+
+constexpr std::array<bool, 256> makeTokenTable() {
+  std::array<bool, 256> table{};
+  for (size_t c = 0; c < table.size(); c++) {
+    table[c] = isTokenChar(c);
+  }
+  return table;
+}
+
+constexpr std::array<bool, 256> TokenTable = makeTokenTable();
+
+// A byte which may appear in a header value: anything but control characters other than horizontal
+// tab, like http-parser.
+constexpr bool isHeaderValueChar(uint8_t c) { return c == '\t' || (c >= 0x20 && c != 0x7f); }
+
+// A byte which may appear in a request target: anything but whitespace and control characters.
+constexpr bool isUrlChar(uint8_t c) { return c > 0x20 && c != 0x7f; }
+
+// Each scanner returns the length of the longest prefix of [begin, end) made of allowed bytes.
+using ScanFn = size_t (*)(const char* begin, const char* end);
+
+size_t scanTokenScalar(const char* begin, const char* end) {
+  const char* p = begin;
+  while (p < end && TokenTable[static_cast<uint8_t>(*p)]) {
+    p++;
+  }
+  return p - begin;
+}
+
+size_t scanHeaderValueScalar(const char* begin, const char* end) {
+  const char* p = begin;
+  while (p < end && isHeaderValueChar(*p)) {
+    p++;
+  }
+  return p - begin;
+}
+
+size_t scanUrlScalar(const char* begin, const char* end) {
+  const char* p = begin;
+  while (p < end && isUrlChar(*p)) {
+    p++;
+  }
+  return p - begin;
+}
+
+#ifdef ENVOY_HTTP1_PARSER_X86_SIMD
+// SSE4.2 compares 16 bytes at a time against up to 8 ranges of disallowed bytes. Bytes past the
+// last full block are scanned by the scalar loop so that no load reads past the end of the input.
+__attribute__((target("sse4.2"))) inline size_t
+scanRangesSse42(const char* begin, const char* end, __m128i ranges, int ranges_length,
+                ScanFn tail) {
+  const char* p = begin;
+  while (end - p >= 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const int index = _mm_cmpestri(ranges, ranges_length, block, 16,
+                                   _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_LEAST_SIGNIFICANT);
+    if (index != 16) {
+      return p - begin + index;
+    }
+    p += 16;
+  }
+  return p - begin + tail(p, end);
+}
+
+__attribute__((target("sse4.2"))) size_t scanTokenSse42(const char* begin, const char* end) {
+  // The complement of the tchar set.
+  alignas(16) static const char ranges[16] = {'\x00', ' ',  '"', '"', '(', ')', ',',    ',',
+                                              '/',    '/',  ':', '@', '[', ']', '{', '\xff'};
+  return scanRangesSse42(begin, end, _mm_load_si128(reinterpret_cast<const __m128i*>(ranges)), 16,
+                         scanTokenScalar);
+}
+
+__attribute__((target("sse4.2"))) size_t scanHeaderValueSse42(const char* begin,
+                                                              const char* end) {
+  alignas(16) static const char ranges[16] = {'\x00', '\x08', '\x0a', '\x1f', '\x7f', '\x7f'};
+  return scanRangesSse42(begin, end, _mm_load_si128(reinterpret_cast<const __m128i*>(ranges)), 6,
+                         scanHeaderValueScalar);
+}
+
+__attribute__((target("sse4.2"))) size_t scanUrlSse42(const char* begin, const char* end) {
+  alignas(16) static const char ranges[16] = {'\x00', ' ', '\x7f', '\x7f'};
+  return scanRangesSse42(begin, end, _mm_load_si128(reinterpret_cast<const __m128i*>(ranges)), 4,
+                         scanUrlScalar);
+}
+
+// AVX2 classifies 32 bytes at a time. A byte is a control character if it is unchanged by an
+// unsigned minimum with 0x1f.
+__attribute__((target("avx2"))) size_t scanHeaderValueAvx2(const char* begin, const char* end) {
+  const __m256i max_control = _mm256_set1_epi8(0x1f);
+  const __m256i tab = _mm256_set1_epi8('\t');
+  const __m256i del = _mm256_set1_epi8(0x7f);
+  const char* p = begin;
+  while (end - p >= 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(block, max_control), block);
+    const __m256i disallowed = _mm256_or_si256(
+        _mm256_andnot_si256(_mm256_cmpeq_epi8(block, tab), control), _mm256_cmpeq_epi8(block, del));
+    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(disallowed));
+    if (mask != 0) {
+      return p - begin + __builtin_ctz(mask);
+    }
+    p += 32;
+  }
+  return p - begin + scanHeaderValueScalar(p, end);
+}
+
+__attribute__((target("avx2"))) size_t scanUrlAvx2(const char* begin, const char* end) {
+  const __m256i max_control = _mm256_set1_epi8(' ');
+  const __m256i del = _mm256_set1_epi8(0x7f);
+  const char* p = begin;
+  while (end - p >= 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i disallowed =
+        _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(block, max_control), block),
+                        _mm256_cmpeq_epi8(block, del));
+    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(disallowed));
+    if (mask != 0) {
+      return p - begin + __builtin_ctz(mask);
+    }
+    p += 32;
+  }
+  return p - begin + scanUrlScalar(p, end);
+}
+#endif
+
+struct Scanners {
+  ScanFn token_;
+  ScanFn header_value_;
+  ScanFn url_;
+};
+
+// Chooses the scanners for the CPU once per process.
+const Scanners& scanners() {
+  static const Scanners scanners = []() -> Scanners {
+#ifdef ENVOY_HTTP1_PARSER_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+      return {scanTokenSse42, scanHeaderValueAvx2, scanUrlAvx2};
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+      return {scanTokenSse42, scanHeaderValueSse42, scanUrlSse42};
+    }
+#endif
+    return {scanTokenScalar, scanHeaderValueScalar, scanUrlScalar};
+  }();
+  return scanners;
+}
+
+// Collects one comma separated token of a header value, such as those of Connection and
+// Transfer-Encoding, to compare it with the few tokens the parser acts on. Longer tokens, and
+// tokens with whitespace inside them, never match.
+class ValueToken {
+public:
+  void add(char c) {
+    if (c == ' ' || c == '\t') {
+      ended_ = length_ > 0;
+      return;
+    }
+    if (ended_ || length_ == buffer_.size()) {
+      matchable_ = false;
+      return;
+    }
+    buffer_[length_++] = absl::ascii_tolower(c);
+  }
+
+  bool equals(absl::string_view token) const {
+    return matchable_ && absl::string_view(buffer_.data(), length_) == token;
+  }
+
+  void reset() {
+    length_ = 0;
+    ended_ = false;
+    matchable_ = true;
+  }
+
+private:
+  std::array<char, 10> buffer_;
+  size_t length_{};
+  bool ended_{};
+  bool matchable_{true};
+};
+
+} // namespace
+
+class VectorizedParserImpl::Impl {
+public:
+  Impl(MessageType type, ParserCallbacks* callbacks)
+      : type_(type), callbacks_(callbacks), scanners_(scanners()) {}
+
+  RcVal execute(const char* data, size_t length);
+
+  void resume() {
+    if (errno_ == Errno::Paused) {
+      errno_ = Errno::Ok;
+    }
+  }
+
+  ParserStatus pause() {
+    if (errno_ == Errno::Ok) {
+      errno_ = Errno::Paused;
+    }
+    return ParserStatus::Success;
+  }
+
+  Errno getErrno() const { return errno_; }
+  uint16_t statusCode() const { return status_code_; }
+  int httpMajor() const { return http_major_; }
+  int httpMinor() const { return http_minor_; }
+
+  absl::optional<uint64_t> contentLength() const {
+    if (!has_content_length_) {
+      return absl::nullopt;
+    }
+    return content_length_;
+  }
+
+  bool isChunked() const { return chunked_; }
+  absl::string_view methodName() const { return method_; }
+  bool hasTransferEncoding() const { return has_transfer_encoding_; }
+
+private:
+  enum class State {
+    // After a message which ends the connection. Only line breaks are allowed.
+    Dead,
+    StartMessage,
+    Method,
+    SpacesBeforeUrl,
+    Url,
+    SpacesBeforeVersion,
+    Version,
+    RequestLineEnd,
+    ResponseVersionEnd,
+    SpacesBeforeStatus,
+    Status,
+    Reason,
+    LineAlmostDone,
+    HeaderFieldStart,
+    HeaderField,
+    HeaderValueDiscardWs,
+    HeaderValue,
+    HeaderValueAlmostDone,
+    HeaderValueLws,
+    HeadersAlmostDone,
+    // At the LF which ends the headers, after onHeadersComplete().
+    HeadersDone,
+    BodyIdentity,
+    BodyIdentityEof,
+    ChunkSizeStart,
+    ChunkSize,
+    ChunkExtensions,
+    ChunkSizeAlmostDone,
+    ChunkData,
+    ChunkDataAlmostDone,
+    ChunkDataDone,
+  };
+
+  // Headers whose values the parser inspects.
+  enum class HeaderKind { Other, ContentLength, TransferEncoding, Connection, Upgrade };
+
+  RcVal executeEof();
+  void resetMessage();
+  bool findMethod();
+  HeaderKind headerKind() const;
+  void startHeaderValue();
+  bool inspectHeaderValue(const char* begin, const char* end);
+  bool finishHeaderValue(const char* at);
+  bool onHeadersEnd();
+  bool messageNeedsEof() const;
+  bool shouldKeepAlive() const;
+
+  // Each of these returns false if the callback failed or paused the parser, in which case
+  // execute() returns.
+  bool checkCallback(int rc) {
+    if (rc != 0) {
+      errno_ = Errno::Callback;
+    }
+    return errno_ == Errno::Ok;
+  }
+  bool onMessageComplete() {
+    state_ = shouldKeepAlive() ? State::StartMessage : State::Dead;
+    return checkCallback(callbacks_->setAndCheckCallbackStatusOr(callbacks_->onMessageComplete()));
+  }
+  bool onHeaderValue(const char* data, size_t length) {
+    header_value_seen_ = true;
+    return checkCallback(
+        callbacks_->setAndCheckCallbackStatus(callbacks_->onHeaderValue(data, length)));
+  }
+
+  RcVal error(Errno error) {
+    errno_ = error;
+    return {0, static_cast<int>(errno_)};
+  }
+  RcVal result(const char* data, const char* p) {
+    return {static_cast<size_t>(p - data), static_cast<int>(errno_)};
+  }
+
+  const MessageType type_;
+  ParserCallbacks* const callbacks_;
+  const Scanners scanners_;
+  State state_{State::StartMessage};
+  Errno errno_{Errno::Ok};
+
+  // The state of the current message.
+  absl::string_view method_;
+  std::array<char, MaxMethodLength> method_buffer_;
+  size_t method_length_{};
+  size_t version_index_{};
+  int http_major_{};
+  int http_minor_{};
+  uint16_t status_code_{};
+  uint64_t content_length_{};
+  bool has_content_length_{};
+  bool has_transfer_encoding_{};
+  bool chunked_{};
+  bool connection_close_{};
+  bool connection_keep_alive_{};
+  bool connection_upgrade_{};
+  bool has_upgrade_{};
+  bool upgrade_{};
+  bool skip_body_{};
+  bool trailers_{};
+
+  // The state of the current header.
+  std::array<char, 17> header_name_;
+  size_t header_name_length_{};
+  HeaderKind header_kind_{HeaderKind::Other};
+  bool header_value_seen_{};
+  ValueToken value_token_;
+  size_t content_length_digits_{};
+  bool content_length_ended_{};
+
+  // The body or chunk bytes still to come.
+  uint64_t remaining_{};
+  uint64_t chunk_size_{};
+};
+
+void VectorizedParserImpl::Impl::resetMessage() {
+  method_ = {};
+  method_length_ = 0;
+  version_index_ = 0;
+  http_major_ = 0;
+  http_minor_ = 0;
+  status_code_ = 0;
+  content_length_ = 0;
+  has_content_length_ = false;
+  has_transfer_encoding_ = false;
+  chunked_ = false;
+  connection_close_ = false;
+  connection_keep_alive_ = false;
+  connection_upgrade_ = false;
+  has_upgrade_ = false;
+  upgrade_ = false;
+  skip_body_ = false;
+  trailers_ = false;
+}
+
+bool VectorizedParserImpl::Impl::findMethod() {
+  const absl::string_view method(method_buffer_.data(), method_length_);
+  for (const absl::string_view known : Methods) {
+    if (method == known) {
+      method_ = known;
+      return true;
+    }
+  }
+  return false;
+}
+
+VectorizedParserImpl::Impl::HeaderKind VectorizedParserImpl::Impl::headerKind() const {
+  // Trailers do not affect framing.
+  if (trailers_ || header_name_length_ > header_name_.size()) {
+    return HeaderKind::Other;
+  }
+  const absl::string_view name(header_name_.data(), header_name_length_);
+  if (absl::EqualsIgnoreCase(name, "content-length")) {
+    return HeaderKind::ContentLength;
+  }
+  if (absl::EqualsIgnoreCase(name, "transfer-encoding")) {
+    return HeaderKind::TransferEncoding;
+  }
+  if (absl::EqualsIgnoreCase(name, "connection")) {
+    return HeaderKind::Connection;
+  }
+  if (absl::EqualsIgnoreCase(name, "upgrade")) {
+    return HeaderKind::Upgrade;
+  }
+  return HeaderKind::Other;
+}
+
+void VectorizedParserImpl::Impl::startHeaderValue() {
+  header_kind_ = headerKind();
+  header_value_seen_ = false;
+  value_token_.reset();
+  content_length_digits_ = 0;
+  content_length_ended_ = false;
+}
+
+bool VectorizedParserImpl::Impl::inspectHeaderValue(const char* begin, const char* end) {
+  for (const char* p = begin; p < end; p++) {
+    const char c = *p;
+    switch (header_kind_) {
+    case HeaderKind::ContentLength:
+      if (c == ' ' || c == '\t') {
+        content_length_ended_ = content_length_digits_ > 0;
+      } else if (absl::ascii_isdigit(c) && !content_length_ended_) {
+        const uint64_t digit = c - '0';
+        if (content_length_ > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+          errno_ = Errno::InvalidContentLength;
+          return false;
+        }
+        content_length_ = content_length_ * 10 + digit;
+        content_length_digits_++;
+      } else {
+        errno_ = Errno::InvalidContentLength;
+        return false;
+      }
+      break;
+    case HeaderKind::TransferEncoding:
+      // Only the last transfer coding matters.
+      if (c == ',') {
+        value_token_.reset();
+      } else {
+        value_token_.add(c);
+      }
+      break;
+    case HeaderKind::Connection:
+      if (c == ',') {
+        connection_close_ |= value_token_.equals("close");
+        connection_keep_alive_ |= value_token_.equals("keep-alive");
+        connection_upgrade_ |= value_token_.equals("upgrade");
+        value_token_.reset();
+      } else {
+        value_token_.add(c);
+      }
+      break;
+    case HeaderKind::Upgrade:
+    case HeaderKind::Other:
+      return true;
+    }
+  }
+  return true;
+}
+
+bool VectorizedParserImpl::Impl::finishHeaderValue(const char* at) {
+  if (!header_value_seen_ && !onHeaderValue(at, 0)) {
+    return false;
+  }
+  switch (header_kind_) {
+  case HeaderKind::ContentLength:
+    if (content_length_digits_ == 0) {
+      errno_ = Errno::InvalidContentLength;
+      return false;
+    }
+    break;
+  case HeaderKind::TransferEncoding:
+    chunked_ = value_token_.equals("chunked");
+    break;
+  case HeaderKind::Connection:
+    connection_close_ |= value_token_.equals("close");
+    connection_keep_alive_ |= value_token_.equals("keep-alive");
+    connection_upgrade_ |= value_token_.equals("upgrade");
+    break;
+  case HeaderKind::Upgrade:
+  case HeaderKind::Other:
+    break;
+  }
+  return true;
+}
+
+bool VectorizedParserImpl::Impl::onHeadersEnd() {
+  // A Content-Length with a Transfer-Encoding other than chunked is ambiguous. With chunked, the
+  // codec decides whether to accept it.
+  if (has_transfer_encoding_ && has_content_length_ && !chunked_) {
+    errno_ = Errno::UnexpectedContentLength;
+    return false;
+  }
+  if (has_upgrade_ && connection_upgrade_) {
+    // For responses the headers only announce support, unless the status is 101.
+    upgrade_ = type_ == MessageType::Request || status_code_ == 101;
+  } else {
+    upgrade_ = method_ == Connect;
+  }
+
+  const int rc =
+      callbacks_->setAndCheckCallbackStatusOr(callbacks_->onHeadersComplete());
+  switch (rc) {
+  case 0:
+    break;
+  case 2:
+    upgrade_ = true;
+    FALLTHRU;
+  case 1:
+    skip_body_ = true;
+    break;
+  default:
+    errno_ = Errno::Callback;
+    break;
+  }
+  state_ = State::HeadersDone;
+  return errno_ == Errno::Ok;
+}
+
+bool VectorizedParserImpl::Impl::messageNeedsEof() const {
+  if (type_ == MessageType::Request) {
+    return false;
+  }
+  if (status_code_ / 100 == 1 || status_code_ == 204 || status_code_ == 304 || skip_body_) {
+    return false;
+  }
+  if (has_transfer_encoding_ && !chunked_) {
+    return true;
+  }
+  return !chunked_ && !has_content_length_;
+}
+
+bool VectorizedParserImpl::Impl::shouldKeepAlive() const {
+  if (http_major_ > 0 && http_minor_ > 0) {
+    if (connection_close_) {
+      return false;
+    }
+  } else if (!connection_keep_alive_) {
+    return false;
+  }
+  return !messageNeedsEof();
+}
+
+VectorizedParserImpl::RcVal VectorizedParserImpl::Impl::executeEof() {
+  switch (state_) {
+  case State::BodyIdentityEof:
+    onMessageComplete();
+    return {0, static_cast<int>(errno_)};
+  case State::Dead:
+  case State::StartMessage:
+    return {0, static_cast<int>(errno_)};
+  default:
+    return error(Errno::InvalidEofState);
+  }
+}
+
+VectorizedParserImpl::RcVal VectorizedParserImpl::Impl::execute(const char* data, size_t length) {
+  if (errno_ != Errno::Ok) {
+    return {0, static_cast<int>(errno_)};
+  }
+  if (length == 0) {
+    return executeEof();
+  }
+
+  const char* p = data;
+  const char* const end = data + length;
+  while (p < end) {
+    switch (state_) {
+    case State::Dead:
+      if (*p != '\r' && *p != '\n') {
+        return error(Errno::ClosedConnection);
+      }
+      p++;
+      break;
+
+    case State::StartMessage:
+      // Line breaks between messages are ignored.
+      if (*p == '\r' || *p == '\n') {
+        p++;
+        break;
+      }
+      resetMessage();
+      if (type_ == MessageType::Request) {
+        if (!absl::ascii_isalpha(*p)) {
+          return error(Errno::InvalidMethod);
+        }
+        state_ = State::Method;
+      } else {
+        if (*p != 'H') {
+          return error(Errno::InvalidConstant);
+        }
+        state_ = State::Version;
+      }
+      if (!checkCallback(callbacks_->setAndCheckCallbackStatus(callbacks_->onMessageBegin()))) {
+        return result(data, p);
+      }
+      break;
+
+    case State::Method:
+      if (*p == ' ') {
+        if (!findMethod()) {
+          return error(Errno::InvalidMethod);
+        }
+        state_ = State::SpacesBeforeUrl;
+      } else if ((absl::ascii_isupper(*p) || *p == '-') && method_length_ < MaxMethodLength) {
+        method_buffer_[method_length_++] = *p;
+      } else {
+        return error(Errno::InvalidMethod);
+      }
+      p++;
+      break;
+
+    case State::SpacesBeforeUrl:
+      if (*p == ' ') {
+        p++;
+        break;
+      }
+      // CONNECT takes an authority, other methods an origin, absolute or asterisk form.
+      if (!isUrlChar(*p) ||
+          (method_ != Connect && *p != '/' && *p != '*' && !absl::ascii_isalpha(*p))) {
+        return error(Errno::InvalidUrl);
+      }
+      state_ = State::Url;
+      break;
+
+    case State::Url: {
+      const char* url_end = p + scanners_.url_(p, end);
+      if (url_end != p &&
+          !checkCallback(callbacks_->setAndCheckCallbackStatus(
+              callbacks_->onUrl(p, url_end - p)))) {
+        return result(data, url_end);
+      }
+      p = url_end;
+      if (p == end) {
+        break;
+      }
+      switch (*p) {
+      case ' ':
+        state_ = State::SpacesBeforeVersion;
+        break;
+      case '\r':
+      case '\n':
+        // A request line without a version is HTTP/0.9.
+        http_major_ = 0;
+        http_minor_ = 9;
+        state_ = *p == '\r' ? State::LineAlmostDone : State::HeaderFieldStart;
+        break;
+      default:
+        return error(Errno::InvalidUrl);
+      }
+      p++;
+      break;
+    }
+
+    case State::SpacesBeforeVersion:
+      if (*p == ' ') {
+        p++;
+      } else {
+        state_ = State::Version;
+      }
+      break;
+
+    case State::Version:
+      // "HTTP/" DIGIT "." DIGIT
+      if (version_index_ < 5) {
+        if (*p != "HTTP/"[version_index_]) {
+          return error(Errno::InvalidConstant);
+        }
+      } else if (version_index_ == 6) {
+        if (*p != '.') {
+          return error(Errno::InvalidVersion);
+        }
+      } else if (!absl::ascii_isdigit(*p)) {
+        return error(Errno::InvalidVersion);
+      } else if (version_index_ == 5) {
+        http_major_ = *p - '0';
+      } else {
+        http_minor_ = *p - '0';
+        state_ = type_ == MessageType::Request ? State::RequestLineEnd : State::ResponseVersionEnd;
+      }
+      version_index_++;
+      p++;
+      break;
+
+    case State::RequestLineEnd:
+      if (*p == '\r') {
+        state_ = State::LineAlmostDone;
+      } else if (*p == '\n') {
+        state_ = State::HeaderFieldStart;
+      } else {
+        return error(Errno::InvalidVersion);
+      }
+      p++;
+      break;
+
+    case State::ResponseVersionEnd:
+      if (*p != ' ') {
+        return error(Errno::InvalidVersion);
+      }
+      state_ = State::SpacesBeforeStatus;
+      p++;
+      break;
+
+    case State::SpacesBeforeStatus:
+      if (*p == ' ') {
+        p++;
+      } else if (absl::ascii_isdigit(*p)) {
+        state_ = State::Status;
+      } else {
+        return error(Errno::InvalidStatus);
+      }
+      break;
+
+    case State::Status:
+      if (absl::ascii_isdigit(*p)) {
+        status_code_ = status_code_ * 10 + (*p - '0');
+        if (status_code_ > 999) {
+          return error(Errno::InvalidStatus);
+        }
+      } else if (*p == ' ') {
+        state_ = State::Reason;
+      } else if (*p == '\r') {
+        state_ = State::LineAlmostDone;
+      } else if (*p == '\n') {
+        state_ = State::HeaderFieldStart;
+      } else {
+        return error(Errno::InvalidStatus);
+      }
+      p++;
+      break;
+
+    case State::Reason:
+      while (p < end && *p != '\r' && *p != '\n') {
+        p++;
+      }
+      if (p < end) {
+        state_ = *p == '\r' ? State::LineAlmostDone : State::HeaderFieldStart;
+        p++;
+      }
+      break;
+
+    case State::LineAlmostDone:
+      if (*p != '\n') {
+        return error(Errno::LfExpected);
+      }
+      state_ = State::HeaderFieldStart;
+      p++;
+      break;
+
+    case State::HeaderFieldStart:
+      if (*p == '\r') {
+        state_ = State::HeadersAlmostDone;
+        p++;
+        break;
+      }
+      if (*p == '\n') {
+        state_ = State::HeadersAlmostDone;
+        break;
+      }
+      if (!TokenTable[static_cast<uint8_t>(*p)]) {
+        return error(Errno::InvalidHeaderToken);
+      }
+      header_name_length_ = 0;
+      state_ = State::HeaderField;
+      break;
+
+    case State::HeaderField: {
+      const char* name_end = p + scanners_.token_(p, end);
+      const size_t name_length = name_end - p;
+      if (header_name_length_ + name_length <= header_name_.size()) {
+        std::copy(p, name_end, header_name_.data() + header_name_length_);
+      }
+      header_name_length_ += name_length;
+      if (name_length > 0 && !checkCallback(callbacks_->setAndCheckCallbackStatus(
+                                 callbacks_->onHeaderField(p, name_length)))) {
+        return result(data, name_end);
+      }
+      p = name_end;
+      if (p == end) {
+        break;
+      }
+      if (*p != ':') {
+        return error(Errno::InvalidHeaderToken);
+      }
+      startHeaderValue();
+      switch (header_kind_) {
+      case HeaderKind::ContentLength:
+        if (has_content_length_) {
+          return error(Errno::UnexpectedContentLength);
+        }
+        has_content_length_ = true;
+        break;
+      case HeaderKind::TransferEncoding:
+        has_transfer_encoding_ = true;
+        break;
+      case HeaderKind::Upgrade:
+        has_upgrade_ = true;
+        break;
+      case HeaderKind::Connection:
+      case HeaderKind::Other:
+        break;
+      }
+      state_ = State::HeaderValueDiscardWs;
+      p++;
+      break;
+    }
+
+    case State::HeaderValueDiscardWs:
+      if (*p == ' ' || *p == '\t') {
+        p++;
+      } else if (*p == '\r') {
+        state_ = State::HeaderValueAlmostDone;
+        p++;
+      } else if (*p == '\n') {
+        state_ = State::HeaderValueLws;
+        p++;
+      } else {
+        state_ = State::HeaderValue;
+      }
+      break;
+
+    case State::HeaderValue: {
+      const char* value_end = p + scanners_.header_value_(p, end);
+      if (!inspectHeaderValue(p, value_end)) {
+        return {0, static_cast<int>(errno_)};
+      }
+      if (value_end != p && !onHeaderValue(p, value_end - p)) {
+        return result(data, value_end);
+      }
+      p = value_end;
+      if (p == end) {
+        break;
+      }
+      if (*p == '\r') {
+        state_ = State::HeaderValueAlmostDone;
+      } else if (*p == '\n') {
+        state_ = State::HeaderValueLws;
+      } else {
+        return error(Errno::InvalidHeaderToken);
+      }
+      p++;
+      break;
+    }
+
+    case State::HeaderValueAlmostDone:
+      if (*p != '\n') {
+        return error(Errno::LfExpected);
+      }
+      state_ = State::HeaderValueLws;
+      p++;
+      break;
+
+    case State::HeaderValueLws:
+      if (*p == ' ' || *p == '\t') {
+        // Replace the obsolete line folding with a space, as RFC 7230, section 3.2.4 allows.
+        static const char space = ' ';
+        if (!inspectHeaderValue(&space, &space + 1)) {
+          return {0, static_cast<int>(errno_)};
+        }
+        if (!onHeaderValue(&space, 1)) {
+          return result(data, p + 1);
+        }
+        state_ = State::HeaderValueDiscardWs;
+        p++;
+        break;
+      }
+      if (!finishHeaderValue(p)) {
+        return result(data, p);
+      }
+      state_ = State::HeaderFieldStart;
+      break;
+
+    case State::HeadersAlmostDone:
+      if (*p != '\n') {
+        return error(Errno::LfExpected);
+      }
+      if (trailers_) {
+        p++;
+        if (!onMessageComplete()) {
+          return result(data, p);
+        }
+        break;
+      }
+      // As with http-parser, a pause in onHeadersComplete() leaves the LF to be parsed on resume.
+      if (!onHeadersEnd()) {
+        return result(data, p);
+      }
+      break;
+
+    case State::HeadersDone: {
+      p++;
+      const bool has_body = chunked_ || (has_content_length_ && content_length_ > 0);
+      if (upgrade_ && (method_ == Connect || skip_body_ || !has_body)) {
+        // The rest of the data belongs to another protocol.
+        onMessageComplete();
+        return result(data, p);
+      }
+      if (skip_body_) {
+        if (!onMessageComplete()) {
+          return result(data, p);
+        }
+      } else if (chunked_) {
+        state_ = State::ChunkSizeStart;
+      } else if (has_transfer_encoding_) {
+        // RFC 7230, section 3.3.3: a request with a final transfer coding other than chunked has no
+        // reliable length. A response is read until the connection closes.
+        if (type_ == MessageType::Request) {
+          return error(Errno::InvalidTransferEncoding);
+        }
+        state_ = State::BodyIdentityEof;
+      } else if (has_content_length_ && content_length_ > 0) {
+        remaining_ = content_length_;
+        state_ = State::BodyIdentity;
+      } else if (messageNeedsEof()) {
+        state_ = State::BodyIdentityEof;
+      } else if (!onMessageComplete()) {
+        return result(data, p);
+      }
+      break;
+    }
+
+    case State::BodyIdentity: {
+      const uint64_t body_length = std::min<uint64_t>(remaining_, end - p);
+      callbacks_->bufferBody(p, body_length);
+      p += body_length;
+      remaining_ -= body_length;
+      if (remaining_ == 0 && !onMessageComplete()) {
+        return result(data, p);
+      }
+      break;
+    }
+
+    case State::BodyIdentityEof:
+      callbacks_->bufferBody(p, end - p);
+      p = end;
+      break;
+
+    case State::ChunkSizeStart:
+      if (!absl::ascii_isxdigit(*p)) {
+        return error(Errno::InvalidChunkSize);
+      }
+      chunk_size_ = 0;
+      state_ = State::ChunkSize;
+      break;
+
+    case State::ChunkSize:
+      if (absl::ascii_isxdigit(*p)) {
+        if (chunk_size_ > std::numeric_limits<uint64_t>::max() >> 4) {
+          return error(Errno::InvalidChunkSize);
+        }
+        const uint8_t c = absl::ascii_tolower(*p);
+        chunk_size_ = (chunk_size_ << 4) | (absl::ascii_isdigit(c) ? c - '0' : c - 'a' + 10);
+      } else if (*p == ';' || *p == ' ' || *p == '\t') {
+        state_ = State::ChunkExtensions;
+      } else if (*p == '\r') {
+        state_ = State::ChunkSizeAlmostDone;
+      } else {
+        return error(Errno::InvalidChunkSize);
+      }
+      p++;
+      break;
+
+    case State::ChunkExtensions:
+      // Chunk extensions are ignored.
+      if (*p == '\r') {
+        state_ = State::ChunkSizeAlmostDone;
+      } else if (*p == '\n') {
+        return error(Errno::InvalidChunkSize);
+      }
+      p++;
+      break;
+
+    case State::ChunkSizeAlmostDone:
+      if (*p != '\n') {
+        return error(Errno::LfExpected);
+      }
+      p++;
+      callbacks_->onChunkHeader(chunk_size_ == 0);
+      if (chunk_size_ == 0) {
+        trailers_ = true;
+        state_ = State::HeaderFieldStart;
+      } else {
+        remaining_ = chunk_size_;
+        state_ = State::ChunkData;
+      }
+      break;
+
+    case State::ChunkData: {
+      const uint64_t chunk_length = std::min<uint64_t>(remaining_, end - p);
+      callbacks_->bufferBody(p, chunk_length);
+      p += chunk_length;
+      remaining_ -= chunk_length;
+      if (remaining_ == 0) {
+        state_ = State::ChunkDataAlmostDone;
+      }
+      break;
+    }
+
+    case State::ChunkDataAlmostDone:
+      if (*p != '\r') {
+        return error(Errno::LfExpected);
+      }
+      state_ = State::ChunkDataDone;
+      p++;
+      break;
+
+    case State::ChunkDataDone:
+      if (*p != '\n') {
+        return error(Errno::LfExpected);
+      }
+      state_ = State::ChunkSizeStart;
+      p++;
+      break;
+    }
+  }
+  return result(data, p);
+}
+
+VectorizedParserImpl::VectorizedParserImpl(MessageType type, ParserCallbacks* data)
+    : impl_(std::make_unique<Impl>(type, data)) {}
+
+VectorizedParserImpl::~VectorizedParserImpl() = default;
+
+VectorizedParserImpl::RcVal VectorizedParserImpl::execute(const char* data, int len) {
+  return impl_->execute(data, len);
+}
+
+void VectorizedParserImpl::resume() { impl_->resume(); }
+
+ParserStatus VectorizedParserImpl::pause() { return impl_->pause(); }
+
+ParserStatus VectorizedParserImpl::getStatus() {
+  switch (impl_->getErrno()) {
+  case Errno::Ok:
+    return ParserStatus::Success;
+  case Errno::Paused:
+    return ParserStatus::Paused;
+  default:
+    return ParserStatus::Error;
+  }
+}
+
+uint16_t VectorizedParserImpl::statusCode() const { return impl_->statusCode(); }
+
+int VectorizedParserImpl::httpMajor() const { return impl_->httpMajor(); }
+
+int VectorizedParserImpl::httpMinor() const { return impl_->httpMinor(); }
+
+absl::optional<uint64_t> VectorizedParserImpl::contentLength() const {
+  return impl_->contentLength();
+}
+
+bool VectorizedParserImpl::isChunked() const { return impl_->isChunked(); }
+
+absl::string_view VectorizedParserImpl::methodName() const { return impl_->methodName(); }
+
+absl::string_view VectorizedParserImpl::errnoName(int rc) const {
+  switch (static_cast<Errno>(rc)) {
+  case Errno::Ok:
+    return "HPE_OK";
+  case Errno::Callback:
+    return "HPE_USER";
+  case Errno::InvalidEofState:
+    return "HPE_INVALID_EOF_STATE";
+  case Errno::ClosedConnection:
+    return "HPE_CLOSED_CONNECTION";
+  case Errno::InvalidVersion:
+    return "HPE_INVALID_VERSION";
+  case Errno::InvalidStatus:
+    return "HPE_INVALID_STATUS";
+  case Errno::InvalidMethod:
+    return "HPE_INVALID_METHOD";
+  case Errno::InvalidUrl:
+    return "HPE_INVALID_URL";
+  case Errno::LfExpected:
+    return "HPE_LF_EXPECTED";
+  case Errno::InvalidHeaderToken:
+    return "HPE_INVALID_HEADER_TOKEN";
+  case Errno::InvalidContentLength:
+    return "HPE_INVALID_CONTENT_LENGTH";
+  case Errno::UnexpectedContentLength:
+    return "HPE_UNEXPECTED_CONTENT_LENGTH";
+  case Errno::InvalidChunkSize:
+    return "HPE_INVALID_CHUNK_SIZE";
+  case Errno::InvalidConstant:
+    return "HPE_INVALID_CONSTANT";
+  case Errno::InvalidTransferEncoding:
+    return "HPE_INVALID_TRANSFER_ENCODING";
+  case Errno::Paused:
+    return "HPE_PAUSED";
+  }
+  return "HPE_UNKNOWN";
+}
+
+int VectorizedParserImpl::hasTransferEncoding() const { return impl_->hasTransferEncoding(); }
+
+int VectorizedParserImpl::statusToInt(const ParserStatus code) const {
+  // The callback return codes match http-parser.
+  switch (code) {
+  case ParserStatus::Error:
+    return -1;
+  case ParserStatus::Success:
+    return 0;
+  case ParserStatus::NoBody:
+    return 1;
+  case ParserStatus::NoBodyData:
+    return 2;
+  case ParserStatus::Paused:
+    return static_cast<int>(Errno::Paused);
+  default:
+    NOT_REACHED_GCOVR_EXCL_LINE;
+  }
+}
+
+} // namespace Http1
+} // namespace Http
+} // namespace Envoy
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+
+#include "common/http/http1/parser.h"
+
+namespace Envoy {
+namespace Http {
+namespace Http1 {
+
+/**
+ * A parser which finds the end of request targets, header names and header values with SIMD
+ * instructions where the CPU supports them (AVX2 or SSE4.2), in the style of picohttpparser, and a
+ * scalar loop elsewhere. Framing, pausing and the results of callbacks follow http-parser, so the
+ * codec behaves the same with either parser, except that this parser is stricter: bare CR
+ * characters, whitespace in header names and chunk framing without CRLF are rejected, and folded
+ * header lines are unfolded by replacing the line break with a space.
+ */
+class VectorizedParserImpl : public Parser {
+public:
+  VectorizedParserImpl(MessageType type, ParserCallbacks* data);
+  ~VectorizedParserImpl() override;
+
+  // Http1::Parser
+  RcVal execute(const char* data, int len) override;
+  void resume() override;
+  ParserStatus pause() override;
+  ParserStatus getStatus() override;
+  uint16_t statusCode() const override;
+  int httpMajor() const override;
+  int httpMinor() const override;
+  absl::optional<uint64_t> contentLength() const override;
+  bool isChunked() const override;
+  absl::string_view methodName() const override;
+  absl::string_view errnoName(int rc) const override;
+  int hasTransferEncoding() const override;
+  int statusToInt(const ParserStatus code) const override;
+
+private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+} // namespace Http1
+} // namespace Http
+} // namespace Envoy
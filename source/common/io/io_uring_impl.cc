@@ -0,0 +1,297 @@
+#include "common/io/io_uring_impl.h"
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "common/common/assert.h"
+#include "common/common/fmt.h"
+#include "common/common/utility.h"
+
+namespace Envoy {
+namespace Io {
+
+namespace {
+
+int ioUringSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int ioUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int ioUringRegister(int ring_fd, unsigned opcode, const void* arg, unsigned nr_args) {
+  return static_cast<int>(::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+// The shared ring indices are written by the kernel concurrently, hence the explicit memory
+// ordering when accessing them.
+unsigned loadAcquire(const unsigned* p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+void storeRelease(unsigned* p, unsigned v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+
+template <class T> T* offsetPtr(void* base, uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<uint8_t*>(base) + offset);
+}
+
+} // namespace
+
+bool isIoUringSupported() {
+  struct io_uring_params p {};
+  const int fd = ioUringSetup(2, &p);
+  if (fd < 0) {
+    return false;
+  }
+  ::close(fd);
+  // IORING_FEAT_NODROP and IORING_FEAT_FAST_POLL make sure completions are never lost and that
+  // socket requests are driven by internal polling rather than blocking kernel workers.
+  return (p.features & IORING_FEAT_NODROP) && (p.features & IORING_FEAT_FAST_POLL);
+}
+
+IoUringImpl::IoUringImpl(uint32_t io_uring_size, bool use_submission_queue_polling)
+    : use_submission_queue_polling_(use_submission_queue_polling) {
+  struct io_uring_params p {};
+  if (use_submission_queue_polling_) {
+    p.flags |= IORING_SETUP_SQPOLL;
+  }
+  ring_fd_ = ioUringSetup(io_uring_size, &p);
+  RELEASE_ASSERT(ring_fd_ >= 0,
+                 fmt::format("unable to initialize io_uring: {}", errorDetails(errno)));
+
+  sq_ring_size_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  cq_ring_size_ = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  const bool single_mmap = p.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap) {
+    sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+  }
+
+  sq_ring_ptr_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        ring_fd_, IORING_OFF_SQ_RING);
+  RELEASE_ASSERT(sq_ring_ptr_ != MAP_FAILED,
+                 fmt::format("unable to map io_uring submission ring: {}", errorDetails(errno)));
+  if (single_mmap) {
+    cq_ring_ptr_ = sq_ring_ptr_;
+  } else {
+    cq_ring_ptr_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    RELEASE_ASSERT(cq_ring_ptr_ != MAP_FAILED,
+                   fmt::format("unable to map io_uring completion ring: {}", errorDetails(errno)));
+  }
+
+  sqes_size_ = p.sq_entries * sizeof(struct io_uring_sqe);
+  void* sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ring_fd_, IORING_OFF_SQES);
+  RELEASE_ASSERT(sqes != MAP_FAILED,
+                 fmt::format("unable to map io_uring submission entries: {}", errorDetails(errno)));
+  sqes_ = static_cast<struct io_uring_sqe*>(sqes);
+
+  sq_khead_ = offsetPtr<unsigned>(sq_ring_ptr_, p.sq_off.head);
+  sq_ktail_ = offsetPtr<unsigned>(sq_ring_ptr_, p.sq_off.tail);
+  sq_kflags_ = offsetPtr<unsigned>(sq_ring_ptr_, p.sq_off.flags);
+  sq_ring_mask_ = *offsetPtr<unsigned>(sq_ring_ptr_, p.sq_off.ring_mask);
+  sq_ring_entries_ = *offsetPtr<unsigned>(sq_ring_ptr_, p.sq_off.ring_entries);
+  sq_array_ = offsetPtr<unsigned>(sq_ring_ptr_, p.sq_off.array);
+  sqe_head_ = sqe_tail_ = *sq_ktail_;
+
+  cq_khead_ = offsetPtr<unsigned>(cq_ring_ptr_, p.cq_off.head);
+  cq_ktail_ = offsetPtr<unsigned>(cq_ring_ptr_, p.cq_off.tail);
+  cq_ring_mask_ = *offsetPtr<unsigned>(cq_ring_ptr_, p.cq_off.ring_mask);
+  cqes_ = offsetPtr<struct io_uring_cqe>(cq_ring_ptr_, p.cq_off.cqes);
+}
+
+IoUringImpl::~IoUringImpl() {
+  if (isEventfdRegistered()) {
+    unregisterEventfd();
+  }
+  ::munmap(sqes_, sqes_size_);
+  if (cq_ring_ptr_ != sq_ring_ptr_) {
+    ::munmap(cq_ring_ptr_, cq_ring_size_);
+  }
+  ::munmap(sq_ring_ptr_, sq_ring_size_);
+  ::close(ring_fd_);
+}
+
+os_fd_t IoUringImpl::registerEventfd() {
+  ASSERT(!isEventfdRegistered());
+  event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  RELEASE_ASSERT(event_fd_ >= 0, fmt::format("unable to create eventfd: {}", errorDetails(errno)));
+  const int ret = ioUringRegister(ring_fd_, IORING_REGISTER_EVENTFD, &event_fd_, 1);
+  RELEASE_ASSERT(ret == 0, fmt::format("unable to register eventfd: {}", errorDetails(errno)));
+  return event_fd_;
+}
+
+void IoUringImpl::unregisterEventfd() {
+  const int ret = ioUringRegister(ring_fd_, IORING_UNREGISTER_EVENTFD, nullptr, 0);
+  RELEASE_ASSERT(ret == 0, fmt::format("unable to unregister eventfd: {}", errorDetails(errno)));
+  ::close(event_fd_);
+  SET_SOCKET_INVALID(event_fd_);
+}
+
+bool IoUringImpl::isEventfdRegistered() const { return SOCKET_VALID(event_fd_); }
+
+void IoUringImpl::forEveryCompletion(CompletionCb completion_cb) {
+  ASSERT(SOCKET_VALID(event_fd_));
+
+  eventfd_t v;
+  // The eventfd only serves as a wakeup, its counter value is irrelevant.
+  ::eventfd_read(event_fd_, &v);
+
+  // Completions may be posted by the kernel while the callbacks run, so keep consuming until the
+  // queue is observed empty. The head is reloaded on every iteration because a callback may reap
+  // completions itself when it has to make room in the submission queue.
+  for (unsigned head = *cq_khead_; head != loadAcquire(cq_ktail_); head = *cq_khead_) {
+    const struct io_uring_cqe& cqe = cqes_[head & cq_ring_mask_];
+    void* user_data = reinterpret_cast<void*>(cqe.user_data);
+    const int32_t res = cqe.res;
+    // Release the entry before running the callback.
+    storeRelease(cq_khead_, head + 1);
+    completion_cb(user_data, res);
+  }
+}
+
+struct io_uring_sqe* IoUringImpl::getSqe() {
+  const unsigned head = use_submission_queue_polling_ ? loadAcquire(sq_khead_) : *sq_khead_;
+  if (sqe_tail_ - head >= sq_ring_entries_) {
+    return nullptr;
+  }
+  struct io_uring_sqe* sqe = &sqes_[sqe_tail_ & sq_ring_mask_];
+  memset(sqe, 0, sizeof(*sqe));
+  ++sqe_tail_;
+  return sqe;
+}
+
+IoUringResult IoUringImpl::prepareAccept(os_fd_t fd, struct sockaddr* remote_addr,
+                                         socklen_t* remote_addr_len, void* user_data) {
+  struct io_uring_sqe* sqe = getSqe();
+  if (sqe == nullptr) {
+    return IoUringResult::Failed;
+  }
+  sqe->opcode = IORING_OP_ACCEPT;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(remote_addr);
+  sqe->addr2 = reinterpret_cast<uint64_t>(remote_addr_len);
+  sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+  sqe->user_data = reinterpret_cast<uint64_t>(user_data);
+  return IoUringResult::Ok;
+}
+
+IoUringResult IoUringImpl::prepareConnect(os_fd_t fd,
+                                          const Network::Address::InstanceConstSharedPtr& address,
+                                          void* user_data) {
+  struct io_uring_sqe* sqe = getSqe();
+  if (sqe == nullptr) {
+    return IoUringResult::Failed;
+  }
+  sqe->opcode = IORING_OP_CONNECT;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(address->sockAddr());
+  sqe->off = address->sockAddrLen();
+  sqe->user_data = reinterpret_cast<uint64_t>(user_data);
+  return IoUringResult::Ok;
+}
+
+IoUringResult IoUringImpl::prepareReadv(os_fd_t fd, const struct iovec* iovecs, unsigned nr_vecs,
+                                        off_t offset, void* user_data) {
+  struct io_uring_sqe* sqe = getSqe();
+  if (sqe == nullptr) {
+    return IoUringResult::Failed;
+  }
+  sqe->opcode = IORING_OP_READV;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(iovecs);
+  sqe->len = nr_vecs;
+  sqe->off = offset;
+  sqe->user_data = reinterpret_cast<uint64_t>(user_data);
+  return IoUringResult::Ok;
+}
+
+IoUringResult IoUringImpl::prepareWritev(os_fd_t fd, const struct iovec* iovecs, unsigned nr_vecs,
+                                         off_t offset, void* user_data) {
+  struct io_uring_sqe* sqe = getSqe();
+  if (sqe == nullptr) {
+    return IoUringResult::Failed;
+  }
+  sqe->opcode = IORING_OP_WRITEV;
+  sqe->fd = fd;
+  sqe->addr = reinterpret_cast<uint64_t>(iovecs);
+  sqe->len = nr_vecs;
+  sqe->off = offset;
+  sqe->user_data = reinterpret_cast<uint64_t>(user_data);
+  return IoUringResult::Ok;
+}
+
+IoUringResult IoUringImpl::preparePoll(os_fd_t fd, uint32_t events, void* user_data) {
+  struct io_uring_sqe* sqe = getSqe();
+  if (sqe == nullptr) {
+    return IoUringResult::Failed;
+  }
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->poll32_events = events;
+  sqe->user_data = reinterpret_cast<uint64_t>(user_data);
+  return IoUringResult::Ok;
+}
+
+IoUringResult IoUringImpl::prepareCancel(void* cancelling_user_data, void* user_data) {
+  struct io_uring_sqe* sqe = getSqe();
+  if (sqe == nullptr) {
+    return IoUringResult::Failed;
+  }
+  sqe->opcode = IORING_OP_ASYNC_CANCEL;
+  sqe->fd = -1;
+  sqe->addr = reinterpret_cast<uint64_t>(cancelling_user_data);
+  sqe->user_data = reinterpret_cast<uint64_t>(user_data);
+  return IoUringResult::Ok;
+}
+
+IoUringResult IoUringImpl::prepareClose(os_fd_t fd, void* user_data) {
+  struct io_uring_sqe* sqe = getSqe();
+  if (sqe == nullptr) {
+    return IoUringResult::Failed;
+  }
+  sqe->opcode = IORING_OP_CLOSE;
+  sqe->fd = fd;
+  sqe->user_data = reinterpret_cast<uint64_t>(user_data);
+  return IoUringResult::Ok;
+}
+
+IoUringResult IoUringImpl::submit() {
+  // Publish the prepared entries to the kernel in one go.
+  unsigned ktail = *sq_ktail_;
+  if (sqe_head_ != sqe_tail_) {
+    for (; sqe_head_ != sqe_tail_; ++sqe_head_, ++ktail) {
+      sq_array_[ktail & sq_ring_mask_] = sqe_head_ & sq_ring_mask_;
+    }
+    storeRelease(sq_ktail_, ktail);
+  }
+  // This also covers entries left over by a previous submit() which returned Busy.
+  const unsigned to_submit = ktail - loadAcquire(sq_khead_);
+
+  unsigned flags = 0;
+  if (use_submission_queue_polling_) {
+    // The kernel side polling thread picks up new entries by itself unless it went idle.
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (!(__atomic_load_n(sq_kflags_, __ATOMIC_RELAXED) & IORING_SQ_NEED_WAKEUP)) {
+      return IoUringResult::Ok;
+    }
+    flags |= IORING_ENTER_SQ_WAKEUP;
+  } else if (to_submit == 0) {
+    return IoUringResult::Ok;
+  }
+
+  const int ret = ioUringEnter(ring_fd_, to_submit, 0, flags);
+  if (ret < 0) {
+    if (errno == EBUSY || errno == EAGAIN) {
+      return IoUringResult::Busy;
+    }
+    return IoUringResult::Failed;
+  }
+  return IoUringResult::Ok;
+}
+
+} // namespace Io
+} // namespace Envoy
@@ -0,0 +1,92 @@
+#pragma once
+
+#if !defined(__linux__)
+#error "Linux platform file is part of non-Linux build."
+#endif
+
+#include <linux/io_uring.h>
+
+#include "envoy/common/io/io_uring.h"
+
+#include "common/common/non_copyable.h"
+
+namespace Envoy {
+namespace Io {
+
+/**
+ * Returns true if the running kernel allows creating an io_uring instance with the request types
+ * used by IoUringImpl.
+ */
+bool isIoUringSupported();
+
+/**
+ * io_uring implementation which talks to the kernel through the raw io_uring_setup(2),
+ * io_uring_enter(2) and io_uring_register(2) system calls and manages the shared submission and
+ * completion rings itself.
+ */
+class IoUringImpl : public IoUring, NonCopyable {
+public:
+  IoUringImpl(uint32_t io_uring_size, bool use_submission_queue_polling);
+  ~IoUringImpl() override;
+
+  // Io::IoUring
+  os_fd_t registerEventfd() override;
+  void unregisterEventfd() override;
+  bool isEventfdRegistered() const override;
+  void forEveryCompletion(CompletionCb completion_cb) override;
+  IoUringResult prepareAccept(os_fd_t fd, struct sockaddr* remote_addr,
+                              socklen_t* remote_addr_len, void* user_data) override;
+  IoUringResult prepareConnect(os_fd_t fd, const Network::Address::InstanceConstSharedPtr& address,
+                               void* user_data) override;
+  IoUringResult prepareReadv(os_fd_t fd, const struct iovec* iovecs, unsigned nr_vecs,
+                             off_t offset, void* user_data) override;
+  IoUringResult prepareWritev(os_fd_t fd, const struct iovec* iovecs, unsigned nr_vecs,
+                              off_t offset, void* user_data) override;
+  IoUringResult preparePoll(os_fd_t fd, uint32_t events, void* user_data) override;
+  IoUringResult prepareCancel(void* cancelling_user_data, void* user_data) override;
+  IoUringResult prepareClose(os_fd_t fd, void* user_data) override;
+  IoUringResult submit() override;
+
+  /**
+   * @return the number of prepared requests which have not been submitted yet.
+   */
+  uint32_t pendingSubmissions() const { return sqe_tail_ - sqe_head_; }
+
+private:
+  // Returns a zeroed submission queue entry or nullptr if the submission queue is full.
+  struct io_uring_sqe* getSqe();
+
+  os_fd_t ring_fd_{INVALID_SOCKET};
+  os_fd_t event_fd_{INVALID_SOCKET};
+  const bool use_submission_queue_polling_;
+
+  // Memory mapped regions shared with the kernel. When the kernel supports
+  // IORING_FEAT_SINGLE_MMAP the submission and completion rings share one mapping.
+  void* sq_ring_ptr_{nullptr};
+  size_t sq_ring_size_{0};
+  void* cq_ring_ptr_{nullptr};
+  size_t cq_ring_size_{0};
+  struct io_uring_sqe* sqes_{nullptr};
+  size_t sqes_size_{0};
+
+  // Submission ring.
+  unsigned* sq_khead_{nullptr};
+  unsigned* sq_ktail_{nullptr};
+  unsigned* sq_kflags_{nullptr};
+  unsigned sq_ring_mask_{0};
+  unsigned sq_ring_entries_{0};
+  unsigned* sq_array_{nullptr};
+  // Entries between sqe_head_ and sqe_tail_ have been prepared but not yet published to the
+  // kernel.
+  unsigned sqe_head_{0};
+  unsigned sqe_tail_{0};
+
+  // Completion ring.
+  unsigned* cq_khead_{nullptr};
+  unsigned* cq_ktail_{nullptr};
+  unsigned cq_ring_mask_{0};
+  struct io_uring_cqe* cqes_{nullptr};
+};
+
+} // namespace Io
+} // namespace Envoy
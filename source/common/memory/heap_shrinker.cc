@@ -1,5 +1,6 @@
 #include "common/memory/heap_shrinker.h"
 
+#include "common/buffer/slice_allocator.h"
 #include "common/memory/utils.h"
 #include "common/stats/symbol_table_impl.h"
 
@@ -31,6 +32,9 @@ HeapShrinker::HeapShrinker(Event::Dispatcher& dispatcher, Server::OverloadManage
 
 void HeapShrinker::shrinkHeap() {
   if (active_) {
+    // Threads empty their buffer caches on their next buffer operation, so the memory they release
+    // is returned to the system on the next run at the latest.
+    Buffer::SliceAllocator::releaseFreeMemory();
     Utils::releaseFreeMemory();
     shrink_counter_->inc();
   }
@@ -21,6 +21,7 @@
 #include "common/network/listen_socket_impl.h"
 #include "common/network/raw_buffer_socket.h"
 #include "common/network/utility.h"
+#include "common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace Network {
@@ -77,10 +78,12 @@ ConnectionImpl::ConnectionImpl(Event::Dispatcher& dispatcher, ConnectionSocketPt
           [this]() -> void { this->onReadBufferLowWatermark(); },
           [this]() -> void { this->onReadBufferHighWatermark(); },
           []() -> void { /* TODO(adisuissa): Handle overflow watermark */ })),
+      read_size_controller_(
+          Runtime::runtimeFeatureEnabled("envoy.reloadable_features.adaptive_read_sizing")),
       write_buffer_above_high_watermark_(false), detect_early_close_(true),
       enable_half_close_(false), read_end_stream_raised_(false), read_end_stream_(false),
       write_end_stream_(false), current_write_end_stream_(false), dispatch_buffered_data_(false),
-      transport_wants_read_(false) {
+      transport_wants_read_(false), splice_read_blocked_(false) {
 
   if (!connected) {
     connecting_ = true;
@@ -94,6 +97,7 @@ ConnectionImpl::ConnectionImpl(Event::Dispatcher& dispatcher, ConnectionSocketPt
       dispatcher_, [this](uint32_t events) -> void { onFileEvent(events); }, trigger,
       Event::FileReadyType::Read | Event::FileReadyType::Write);
 
+  read_buffer_->setReadReservationPolicy(&read_size_controller_);
   transport_socket_->setTransportSocketCallbacks(*this);
 }
 
@@ -129,7 +133,7 @@ void ConnectionImpl::close(ConnectionCloseType type) {
     return;
   }
 
-  uint64_t data_to_write = write_buffer_->length();
+  uint64_t data_to_write = pendingWriteLength();
   ENVOY_CONN_LOG(debug, "closing data_to_write={} type={}", *this, data_to_write, enumToInt(type));
   const bool delayed_close_timeout_set = delayed_close_timeout_.count() > 0;
   if (data_to_write == 0 || type == ConnectionCloseType::NoFlush ||
@@ -137,7 +141,11 @@ void ConnectionImpl::close(ConnectionCloseType type) {
     if (data_to_write > 0) {
       // We aren't going to wait to flush, but try to write as much as we can if there is pending
       // data.
-      transport_socket_->doWrite(*write_buffer_, true);
+      if (splice_pipe_ != nullptr) {
+        spliceWrite(true);
+      } else {
+        transport_socket_->doWrite(*write_buffer_, true);
+      }
     }
 
     if (type == ConnectionCloseType::FlushWriteAndDelay && delayed_close_timeout_set) {
@@ -243,6 +251,14 @@ void ConnectionImpl::closeSocket(ConnectionEvent close_type) {
   ENVOY_CONN_LOG(debug, "closing socket: {}", *this, static_cast<uint32_t>(close_type));
   transport_socket_->closeSocket(close_type);
 
+  // The peer keeps the pipe holding the data this connection received for it, so that the data can
+  // still be flushed. The data received for this connection is dropped with the pipe.
+  if (splice_peer_ != nullptr) {
+    splice_peer_->splice_peer_ = nullptr;
+    splice_peer_ = nullptr;
+  }
+  splice_pipe_.reset();
+
   // Drain input and output buffers.
   updateReadBufferStats(0, 0);
   updateWriteBufferStats(0, 0);
@@ -487,6 +503,7 @@ void ConnectionImpl::write(Buffer::Instance& data, bool end_stream, bool through
 
 void ConnectionImpl::setBufferLimits(uint32_t limit) {
   read_buffer_limit_ = limit;
+  read_size_controller_.setBufferLimit(limit);
 
   // Due to the fact that writes to the connection and flushing data from the connection are done
   // asynchronously, we have the option of either setting the watermarks aggressively, and regularly
@@ -608,7 +625,8 @@ void ConnectionImpl::onReadReady() {
   // reading from the transport if the read buffer is above high watermark at the start of the
   // method.
   transport_wants_read_ = false;
-  IoResult result = transport_socket_->doRead(*read_buffer_);
+  IoResult result =
+      splice_peer_ != nullptr ? spliceRead() : transport_socket_->doRead(*read_buffer_);
   uint64_t new_buffer_size = read_buffer_->length();
   updateReadBufferStats(result.bytes_processed_, new_buffer_size);
 
@@ -677,9 +695,11 @@ void ConnectionImpl::onWriteReady() {
     }
   }
 
-  IoResult result = transport_socket_->doWrite(*write_buffer_, write_end_stream_);
+  IoResult result = splice_pipe_ != nullptr
+                        ? spliceWrite(write_end_stream_)
+                        : transport_socket_->doWrite(*write_buffer_, write_end_stream_);
   ASSERT(!result.end_stream_read_); // The interface guarantees that only read operations set this.
-  uint64_t new_buffer_size = write_buffer_->length();
+  uint64_t new_buffer_size = pendingWriteLength();
   updateWriteBufferStats(result.bytes_processed_, new_buffer_size);
 
   // NOTE: If the delayed_close_timer_ is set, it must only trigger after a delayed_close_timeout_
@@ -729,10 +749,15 @@ void ConnectionImpl::onWriteReady() {
 }
 
 void ConnectionImpl::updateReadBufferStats(uint64_t num_read, uint64_t new_size) {
+  const uint64_t num_read_calls = read_size_controller_.takeReads();
   if (!connection_stats_) {
     return;
   }
 
+  if (connection_stats_->read_calls_ != nullptr) {
+    connection_stats_->read_calls_->add(num_read_calls);
+  }
+
   ConnectionImplUtility::updateBufferStats(num_read, new_size, last_read_buffer_size_,
                                            connection_stats_->read_total_,
                                            connection_stats_->read_current_);
@@ -750,7 +775,11 @@ void ConnectionImpl::updateWriteBufferStats(uint64_t num_written, uint64_t new_s
 
 bool ConnectionImpl::bothSidesHalfClosed() {
   // If the write_buffer_ is not empty, then the end_stream has not been sent to the transport yet.
-  return read_end_stream_ && write_end_stream_ && write_buffer_->length() == 0;
+  return read_end_stream_ && write_end_stream_ && pendingWriteLength() == 0;
+}
+
+uint64_t ConnectionImpl::pendingWriteLength() const {
+  return write_buffer_->length() + (splice_pipe_ != nullptr ? splice_pipe_->length() : 0);
 }
 
 absl::string_view ConnectionImpl::transportFailureReason() const {
@@ -761,8 +790,124 @@ absl::optional<std::chrono::milliseconds> ConnectionImpl::lastRoundTripTime() co
   return socket_->lastRoundTripTime();
 };
 
+bool ConnectionImpl::startSplice(Connection& peer) {
+  ASSERT(dispatcher_.isThreadSafe());
+  auto* peer_impl = dynamic_cast<ConnectionImpl*>(&peer);
+  if (peer_impl == nullptr || peer_impl == this || &peer_impl->dispatcher_ != &dispatcher_ ||
+      !canSplice() || !peer_impl->canSplice()) {
+    return false;
+  }
+  SplicePipePtr pipe = SplicePipe::create();
+  SplicePipePtr peer_pipe = SplicePipe::create();
+  if (pipe == nullptr || peer_pipe == nullptr) {
+    return false;
+  }
+
+  ENVOY_CONN_LOG(debug, "splicing data with connection {}", *this, peer.id());
+  splice_pipe_ = std::move(pipe);
+  splice_peer_ = peer_impl;
+  peer_impl->splice_pipe_ = std::move(peer_pipe);
+  peer_impl->splice_peer_ = this;
+  // Edge triggered events are not raised again for data which is already waiting on the sockets.
+  ioHandle().activateFileEvents(Event::FileReadyType::Read);
+  peer_impl->ioHandle().activateFileEvents(Event::FileReadyType::Read);
+  return true;
+}
+
+bool ConnectionImpl::canSplice() const {
+  return state() == State::Open && !connecting_ && splice_peer_ == nullptr &&
+         splice_pipe_ == nullptr && transport_socket_->supportsSplice() &&
+         ioHandle().supportsSplice() && read_buffer_->length() == 0 &&
+         write_buffer_->length() == 0 && !read_end_stream_ && !write_end_stream_ &&
+         !filter_manager_.filtersNeedData();
+}
+
+IoResult ConnectionImpl::spliceRead() {
+  ConnectionImpl& peer = *splice_peer_;
+  SplicePipe& pipe = *peer.splice_pipe_;
+  // The data in the pipe counts against the buffer limit of the peer, like its write buffer.
+  const uint64_t limit = peer.read_buffer_limit_;
+  PostIoAction action = PostIoAction::KeepOpen;
+  uint64_t bytes_read = 0;
+  bool end_stream = false;
+  splice_read_blocked_ = false;
+  while (true) {
+    if (limit > 0 && pipe.length() >= limit) {
+      splice_read_blocked_ = true;
+      break;
+    }
+    Api::IoCallUint64Result result =
+        pipe.fill(ioHandle(), limit > 0 ? absl::make_optional(limit - pipe.length())
+                                        : absl::nullopt);
+    if (result.ok()) {
+      ENVOY_CONN_LOG(trace, "splice read returns: {}", *this, result.rc_);
+      if (result.rc_ == 0) {
+        end_stream = true;
+        break;
+      }
+      bytes_read += result.rc_;
+    } else {
+      ENVOY_CONN_LOG(trace, "splice read error: {}", *this, result.err_->getErrorDetails());
+      if (result.err_->getErrorCode() != Api::IoError::IoErrorCode::Again) {
+        action = PostIoAction::Close;
+      } else {
+        // The pipe may be full rather than the socket empty, which is not reported separately.
+        splice_read_blocked_ = pipe.length() > 0;
+      }
+      break;
+    }
+  }
+
+  if (bytes_read > 0) {
+    stream_info_.addBytesReceived(bytes_read);
+    peer.stream_info_.addBytesSent(bytes_read);
+    peer.updateWriteBufferStats(0, peer.pendingWriteLength());
+    peer.ioHandle().activateFileEvents(Event::FileReadyType::Write);
+  }
+  return {action, bytes_read, end_stream};
+}
+
+IoResult ConnectionImpl::spliceWrite(bool end_stream) {
+  PostIoAction action = PostIoAction::KeepOpen;
+  uint64_t bytes_written = 0;
+  while (splice_pipe_->length() > 0) {
+    Api::IoCallUint64Result result = splice_pipe_->drain(ioHandle());
+    if (result.ok()) {
+      ENVOY_CONN_LOG(trace, "splice write returns: {}", *this, result.rc_);
+      bytes_written += result.rc_;
+    } else {
+      ENVOY_CONN_LOG(trace, "splice write error: {}", *this, result.err_->getErrorDetails());
+      if (result.err_->getErrorCode() != Api::IoError::IoErrorCode::Again) {
+        action = PostIoAction::Close;
+      }
+      break;
+    }
+  }
+
+  if (bytes_written > 0 && splice_peer_ != nullptr) {
+    splice_peer_->onSplicePipeDrained();
+  }
+  if (action == PostIoAction::Close || splice_pipe_->length() > 0) {
+    return {action, bytes_written, false};
+  }
+  // Data written to the connection directly, and the end of stream, follow the spliced data.
+  IoResult result = transport_socket_->doWrite(*write_buffer_, end_stream);
+  result.bytes_processed_ += bytes_written;
+  return result;
+}
+
+void ConnectionImpl::onSplicePipeDrained() {
+  ASSERT(splice_peer_ != nullptr);
+  // Like the watermarks of a write buffer, reading resumes once the pipe is half empty.
+  const uint64_t limit = splice_peer_->read_buffer_limit_;
+  if (splice_read_blocked_ && (limit == 0 || splice_peer_->splice_pipe_->length() <= limit / 2)) {
+    splice_read_blocked_ = false;
+    ioHandle().activateFileEvents(Event::FileReadyType::Read);
+  }
+}
+
 void ConnectionImpl::flushWriteBuffer() {
-  if (state() == State::Open && write_buffer_->length() > 0) {
+  if (state() == State::Open && pendingWriteLength() > 0) {
     onWriteReady();
   }
 }
@@ -12,6 +12,8 @@
 #include "common/buffer/watermark_buffer.h"
 #include "common/event/libevent.h"
 #include "common/network/connection_impl_base.h"
+#include "common/network/read_size_controller.h"
+#include "common/network/splice_pipe.h"
 #include "common/stream_info/stream_info_impl.h"
 
 #include "absl/types/optional.h"
@@ -95,6 +97,7 @@ public:
   absl::string_view transportFailureReason() const override;
   bool startSecureTransport() override { return transport_socket_->startSecureTransport(); }
   absl::optional<std::chrono::milliseconds> lastRoundTripTime() const override;
+  bool startSplice(Connection& peer) override;
 
   // Network::FilterManagerConnection
   void rawWrite(Buffer::Instance& data, bool end_stream) override;
@@ -185,6 +188,18 @@ private:
   // Returns true iff end of stream has been both written and read.
   bool bothSidesHalfClosed();
 
+  // Returns the number of bytes waiting to be written to the socket.
+  uint64_t pendingWriteLength() const;
+
+  // Returns true if the connection can start exchanging data with a splice peer.
+  bool canSplice() const;
+  // Moves the data received on the socket into the pipe of the splice peer.
+  IoResult spliceRead();
+  // Writes the data in the splice pipe to the socket, followed by the write buffer.
+  IoResult spliceWrite(bool end_stream);
+  // Called by the splice peer after it has drained data this connection moved into its pipe.
+  void onSplicePipeDrained();
+
   static std::atomic<uint64_t> next_global_id_;
 
   std::list<BytesSentCb> bytes_sent_callbacks_;
@@ -195,6 +210,12 @@ private:
   uint64_t last_write_buffer_size_{};
   Buffer::Instance* current_write_buffer_{};
   uint32_t read_disable_count_{0};
+  // The connection the data received on the socket is moved to inside the kernel, if any.
+  ConnectionImpl* splice_peer_{};
+  // Holds the data the splice peer received for this connection until it is written to the socket.
+  SplicePipePtr splice_pipe_;
+  // Sizes the reads into read_buffer_ and counts them.
+  ReadSizeController read_size_controller_;
   bool write_buffer_above_high_watermark_ : 1;
   bool detect_early_close_ : 1;
   bool enable_half_close_ : 1;
@@ -209,6 +230,9 @@ private:
   // read_disable_count_ == 0 to ensure that read resumption happens when remaining bytes are held
   // in transport socket internal buffers.
   bool transport_wants_read_ : 1;
+  // True if reading from the socket stopped because the pipe of the splice peer was full. The peer
+  // resumes reading once it has drained its pipe.
+  bool splice_read_blocked_ : 1;
 };
 
 class ServerConnectionImpl : public ConnectionImpl, virtual public ServerConnection {
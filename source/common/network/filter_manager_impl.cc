@@ -37,6 +37,18 @@ void FilterManagerImpl::removeReadFilter(ReadFilterSharedPtr filter_to_remove) {
   }
 }
 
+bool FilterManagerImpl::filtersNeedData() const {
+  if (!downstream_filters_.empty()) {
+    return true;
+  }
+  for (const auto& filter : upstream_filters_) {
+    if (filter->filter_ && filter->filter_->needsData()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool FilterManagerImpl::initializeReadFilters() {
   if (upstream_filters_.empty()) {
     return false;
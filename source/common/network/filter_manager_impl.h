@@ -112,6 +112,11 @@ public:
   void onRead();
   FilterStatus onWrite();
 
+  /**
+   * @return bool whether any filter needs to see the data read from or written to the connection.
+   */
+  bool filtersNeedData() const;
+
 private:
   struct ActiveReadFilter : public ReadFilterCallbacks, LinkedObject<ActiveReadFilter> {
     ActiveReadFilter(FilterManagerImpl& parent, ReadFilterSharedPtr filter)
@@ -10,6 +10,10 @@
 #include "absl/container/fixed_array.h"
 #include "absl/types/optional.h"
 
+#if defined(__linux__)
+#include <linux/errqueue.h>
+#endif
+
 using Envoy::Api::SysCallIntResult;
 using Envoy::Api::SysCallSizeResult;
 
@@ -48,6 +52,16 @@ in_addr addressFromMessage(const cmsghdr& cmsg) {
 #endif
 }
 
+#if defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define ENVOY_ZERO_COPY_SUPPORTED 1
+#endif
+
+Api::IoCallUint64Result ioResultNoSupport() {
+  return Api::IoCallUint64Result(
+      0, Api::IoErrorPtr(new Network::IoSocketError(SOCKET_ERROR_NOT_SUP),
+                         Network::IoSocketError::deleteIoError));
+}
+
 constexpr int messageTruncatedOption() {
 #if defined(__APPLE__)
   // OSX does not support passing `MSG_TRUNC` to recvmsg and recvmmsg. This does not effect
@@ -179,6 +193,89 @@ Api::IoCallUint64Result IoSocketHandleImpl::write(Buffer::Instance& buffer) {
   return result;
 }
 
+Api::IoCallUint64Result IoSocketHandleImpl::writevZeroCopy(const Buffer::RawSlice* slices,
+                                                           uint64_t num_slice) {
+#ifdef ENVOY_ZERO_COPY_SUPPORTED
+  absl::FixedArray<iovec> iov(num_slice);
+  uint64_t num_slices_to_write = 0;
+  for (uint64_t i = 0; i < num_slice; i++) {
+    if (slices[i].mem_ != nullptr && slices[i].len_ != 0) {
+      iov[num_slices_to_write].iov_base = slices[i].mem_;
+      iov[num_slices_to_write].iov_len = slices[i].len_;
+      num_slices_to_write++;
+    }
+  }
+  if (num_slices_to_write == 0) {
+    return Api::ioCallUint64ResultNoError();
+  }
+
+  msghdr message{};
+  message.msg_iov = iov.begin();
+  message.msg_iovlen = num_slices_to_write;
+  const Api::SysCallSizeResult result =
+      Api::OsSysCallsSingleton::get().sendmsg(fd_, &message, MSG_ZEROCOPY);
+  if (result.rc_ < 0 && result.errno_ == ENOBUFS) {
+    // The socket ran out of option memory to track more pending notifications. The caller is
+    // expected to fall back to a copying write until some of them have been read.
+    return ioResultNoSupport();
+  }
+  auto io_result = sysCallResultToIoCallResult(result);
+  // Emulated edge events need to registered if the socket operation did not complete
+  // because the socket would block.
+  if constexpr (Event::PlatformDefaultTriggerType == Event::FileTriggerType::EmulatedEdge) {
+    if (io_result.wouldBlock() && file_event_) {
+      file_event_->registerEventIfEmulatedEdge(Event::FileReadyType::Write);
+    }
+  }
+  return io_result;
+#else
+  UNREFERENCED_PARAMETER(slices);
+  UNREFERENCED_PARAMETER(num_slice);
+  return ioResultNoSupport();
+#endif
+}
+
+Api::IoCallUint64Result
+IoSocketHandleImpl::readZeroCopyCompletions(const ZeroCopyCompletionCb& cb) {
+#ifdef ENVOY_ZERO_COPY_SUPPORTED
+  auto& os_syscalls = Api::OsSysCallsSingleton::get();
+  uint64_t num_completions = 0;
+  while (true) {
+    // The kernel appends the offending address to the extended error.
+    alignas(cmsghdr) char cbuf[CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in6))];
+    msghdr message{};
+    message.msg_control = cbuf;
+    message.msg_controllen = sizeof(cbuf);
+    const Api::SysCallSizeResult result = os_syscalls.recvmsg(fd_, &message, MSG_ERRQUEUE);
+    if (result.rc_ < 0) {
+      if (result.errno_ == SOCKET_ERROR_AGAIN) {
+        break;
+      }
+      return sysCallResultToIoCallResult(result);
+    }
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(&message, cmsg)) {
+      if (!(cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_RECVERR) &&
+          !(cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)) {
+        continue;
+      }
+      // Anything else on the error queue is only reported when IP_RECVERR is enabled, which
+      // Envoy never does for stream sockets.
+      const auto* error = reinterpret_cast<const sock_extended_err*>(CMSG_DATA(cmsg));
+      if (error->ee_errno != 0 || error->ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+        continue;
+      }
+      num_completions++;
+      cb({error->ee_info, error->ee_data, (error->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0});
+    }
+  }
+  return {num_completions, Api::IoErrorPtr(nullptr, IoSocketError::deleteIoError)};
+#else
+  UNREFERENCED_PARAMETER(cb);
+  return ioResultNoSupport();
+#endif
+}
+
 Api::IoCallUint64Result IoSocketHandleImpl::sendmsg(const Buffer::RawSlice* slices,
                                                     uint64_t num_slice, int flags,
                                                     const Address::Ip* self_ip,
@@ -275,6 +372,47 @@ Api::IoCallUint64Result IoSocketHandleImpl::sendmsg(const Buffer::RawSlice* slic
   }
 }
 
+Api::IoCallUint64Result IoSocketHandleImpl::sendmmsg(const Buffer::RawSlice* datagrams,
+                                                     uint64_t num_datagrams, int flags,
+                                                     const Address::Instance& peer_address) {
+  const auto* address_base = dynamic_cast<const Address::InstanceBase*>(&peer_address);
+  sockaddr* sock_addr = const_cast<sockaddr*>(address_base->sockAddr());
+  if (sock_addr == nullptr) {
+    // Unlikely to happen unless the wrong peer address is passed.
+    return IoSocketError::ioResultSocketInvalidAddress();
+  }
+  if (num_datagrams == 0) {
+    return Api::ioCallUint64ResultNoError();
+  }
+
+  absl::FixedArray<mmsghdr> mmsg_hdr(num_datagrams);
+  absl::FixedArray<iovec> iovs(num_datagrams);
+  for (uint64_t i = 0; i < num_datagrams; ++i) {
+    iovs[i].iov_base = datagrams[i].mem_;
+    iovs[i].iov_len = datagrams[i].len_;
+    msghdr& message = mmsg_hdr[i].msg_hdr;
+    message.msg_name = reinterpret_cast<void*>(sock_addr);
+    message.msg_namelen = address_base->sockAddrLen();
+    message.msg_iov = &iovs[i];
+    message.msg_iovlen = 1;
+    message.msg_control = nullptr;
+    message.msg_controllen = 0;
+    message.msg_flags = 0;
+    mmsg_hdr[i].msg_len = 0;
+  }
+  const Api::SysCallIntResult result =
+      Api::OsSysCallsSingleton::get().sendmmsg(fd_, mmsg_hdr.begin(), num_datagrams, flags);
+  auto io_result = sysCallResultToIoCallResult(result);
+  // Emulated edge events need to registered if the socket operation did not complete
+  // because the socket would block.
+  if constexpr (Event::PlatformDefaultTriggerType == Event::FileTriggerType::EmulatedEdge) {
+    if (io_result.wouldBlock() && file_event_) {
+      file_event_->registerEventIfEmulatedEdge(Event::FileReadyType::Write);
+    }
+  }
+  return io_result;
+}
+
 Address::InstanceConstSharedPtr getAddressFromSockAddrOrDie(const sockaddr_storage& ss,
                                                             socklen_t ss_len, os_fd_t fd) {
   // TODO(chaoqin-li1123): remove exception catching and make Address::addressFromSockAddr return
@@ -543,6 +681,14 @@ bool IoSocketHandleImpl::supportsUdpGro() const {
   return Api::OsSysCallsSingleton::get().supportsUdpGro();
 }
 
+bool IoSocketHandleImpl::supportsSplice() const {
+#if defined(__linux__)
+  return SOCKET_VALID(fd_);
+#else
+  return false;
+#endif
+}
+
 Api::SysCallIntResult IoSocketHandleImpl::bind(Address::InstanceConstSharedPtr address) {
   return Api::OsSysCallsSingleton::get().bind(fd_, address->sockAddr(), address->sockAddrLen());
 }
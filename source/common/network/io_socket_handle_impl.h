@@ -40,10 +40,18 @@ public:
 
   Api::IoCallUint64Result write(Buffer::Instance& buffer) override;
 
+  Api::IoCallUint64Result writevZeroCopy(const Buffer::RawSlice* slices,
+                                         uint64_t num_slice) override;
+
+  Api::IoCallUint64Result readZeroCopyCompletions(const ZeroCopyCompletionCb& cb) override;
+
   Api::IoCallUint64Result sendmsg(const Buffer::RawSlice* slices, uint64_t num_slice, int flags,
                                   const Address::Ip* self_ip,
                                   const Address::Instance& peer_address) override;
 
+  Api::IoCallUint64Result sendmmsg(const Buffer::RawSlice* datagrams, uint64_t num_datagrams,
+                                   int flags, const Address::Instance& peer_address) override;
+
   Api::IoCallUint64Result recvmsg(Buffer::RawSlice* slices, const uint64_t num_slice,
                                   uint32_t self_port, RecvMsgOutput& output) override;
 
@@ -53,6 +61,7 @@ public:
 
   bool supportsMmsg() const override;
   bool supportsUdpGro() const override;
+  bool supportsSplice() const override;
 
   Api::SysCallIntResult bind(Address::InstanceConstSharedPtr address) override;
   Api::SysCallIntResult listen(int backlog) override;
@@ -1,13 +1,122 @@
 #include "common/network/raw_buffer_socket.h"
 
+#include <chrono>
+
+#include "envoy/event/deferred_deletable.h"
+#include "envoy/event/dispatcher.h"
+#include "envoy/event/timer.h"
+
 #include "common/api/os_sys_calls_impl.h"
 #include "common/common/assert.h"
 #include "common/common/empty_string.h"
+#include "common/common/utility.h"
 #include "common/http/headers.h"
+#include "common/network/io_socket_handle_impl.h"
 
 namespace Envoy {
 namespace Network {
 
+namespace {
+
+// Upper bound on the number of slices handed to a single zero copy send.
+constexpr uint64_t MaxZeroCopySlices = 16;
+
+// How long the data of zero copy sends is kept alive after their connection has been closed.
+constexpr std::chrono::seconds ZeroCopyDrainTimeout(60);
+
+// Resets the connection on close, which discards the data queued on the socket.
+void resetOnClose(IoHandle& io_handle) {
+  const struct linger linger = {1, 0};
+  io_handle.setOption(SOL_SOCKET, SO_LINGER, &linger, sizeof(linger));
+}
+
+/**
+ * Keeps the data of zero copy sends alive which are still in flight when their connection is
+ * closed. Closing a socket does not stop the transmission of the data queued on it, so the drainer
+ * holds on to a duplicate of the socket to read the remaining completions and deletes itself once
+ * they are all in. Connections which are not drained in time are reset instead.
+ */
+class ZeroCopyDrainer : public Event::DeferredDeletable, Logger::Loggable<Logger::Id::connection> {
+public:
+  ZeroCopyDrainer(Event::Dispatcher& dispatcher, IoHandlePtr&& io_handle,
+                  ZeroCopySendQueue&& sends)
+      : dispatcher_(dispatcher), io_handle_(std::move(io_handle)), sends_(std::move(sends)),
+        timer_(dispatcher.createTimer([this]() {
+          ENVOY_LOG(debug, "resetting closed connection with {} zero copy sends in flight",
+                    sends_.size());
+          resetOnClose(*io_handle_);
+          finish();
+        })) {
+    io_handle_->initializeFileEvent(
+        dispatcher, [this](uint32_t) { onFileEvent(); }, Event::FileTriggerType::Edge,
+        Event::FileReadyType::Write);
+    timer_->enableTimer(ZeroCopyDrainTimeout);
+  }
+
+private:
+  void onFileEvent() {
+    if (!sends_.readCompletions(*io_handle_, [](uint64_t, bool) {})) {
+      resetOnClose(*io_handle_);
+      finish();
+    } else if (sends_.empty()) {
+      finish();
+    }
+  }
+
+  void finish() {
+    timer_->disableTimer();
+    io_handle_->close();
+    dispatcher_.deferredDelete(Event::DeferredDeletablePtr{this});
+  }
+
+  Event::Dispatcher& dispatcher_;
+  IoHandlePtr io_handle_;
+  ZeroCopySendQueue sends_;
+  Event::TimerPtr timer_;
+};
+
+} // namespace
+
+RawBufferZeroCopyConfig::RawBufferZeroCopyConfig(uint64_t min_write_size, Stats::Scope& scope)
+    : min_write_size_(min_write_size),
+      stats_({ALL_RAW_BUFFER_ZERO_COPY_STATS(POOL_COUNTER_PREFIX(scope, "raw_buffer."))}) {}
+
+Buffer::Instance& ZeroCopySendQueue::push(uint64_t length) {
+  sends_.emplace_back(next_sequence_++, length);
+  return sends_.back().pinned_;
+}
+
+bool ZeroCopySendQueue::readCompletions(IoHandle& io_handle, const ReleaseCb& cb) {
+  const Api::IoCallUint64Result result = io_handle.readZeroCopyCompletions(
+      [this](const IoHandle::ZeroCopyCompletion& completion) { onCompletion(completion); });
+  // Completions may arrive out of order, the data is released in order.
+  while (!sends_.empty() && sends_.front().completed_) {
+    cb(sends_.front().length_, sends_.front().copied_);
+    sends_.pop_front();
+  }
+  return result.ok();
+}
+
+void ZeroCopySendQueue::onCompletion(const IoHandle::ZeroCopyCompletion& completion) {
+  if (sends_.empty()) {
+    return;
+  }
+  // Sequence numbers wrap around, so positions are computed relative to the oldest send.
+  const uint32_t front_sequence = sends_.front().sequence_;
+  const uint64_t begin = static_cast<uint32_t>(completion.first_ - front_sequence);
+  const uint64_t end =
+      static_cast<uint64_t>(static_cast<uint32_t>(completion.last_ - front_sequence)) + 1;
+  for (uint64_t i = begin; i < std::min<uint64_t>(end, sends_.size()); i++) {
+    sends_[i].completed_ = true;
+    sends_[i].copied_ = completion.copied_;
+  }
+}
+
+RawBufferSocket::RawBufferSocket(RawBufferZeroCopyConfigSharedPtr zero_copy_config)
+    : zero_copy_config_(std::move(zero_copy_config)),
+      zero_copy_state_(zero_copy_config_ != nullptr ? ZeroCopyState::Unknown
+                                                    : ZeroCopyState::Disabled) {}
+
 void RawBufferSocket::setTransportSocketCallbacks(TransportSocketCallbacks& callbacks) {
   ASSERT(!callbacks_);
   callbacks_ = &callbacks;
@@ -50,6 +159,10 @@ IoResult RawBufferSocket::doWrite(Buffer::Instance& buffer, bool end_stream) {
   PostIoAction action;
   uint64_t bytes_written = 0;
   ASSERT(!shutdown_ || buffer.length() == 0);
+  // The kernel signals zero copy completions as a socket error, which wakes up the writer.
+  if (!zero_copy_sends_.empty()) {
+    readZeroCopyCompletions();
+  }
   do {
     if (buffer.length() == 0) {
       if (end_stream && !shutdown_) {
@@ -61,7 +174,9 @@ IoResult RawBufferSocket::doWrite(Buffer::Instance& buffer, bool end_stream) {
       action = PostIoAction::KeepOpen;
       break;
     }
-    Api::IoCallUint64Result result = callbacks_->ioHandle().write(buffer);
+    Api::IoCallUint64Result result = shouldWriteZeroCopy(buffer)
+                                         ? writeZeroCopy(buffer)
+                                         : callbacks_->ioHandle().write(buffer);
 
     if (result.ok()) {
       ENVOY_CONN_LOG(trace, "write returns: {}", callbacks_->connection(), result.rc_);
@@ -81,6 +196,112 @@ IoResult RawBufferSocket::doWrite(Buffer::Instance& buffer, bool end_stream) {
   return {action, bytes_written, false};
 }
 
+bool RawBufferSocket::shouldWriteZeroCopy(const Buffer::Instance& buffer) {
+  if (zero_copy_state_ == ZeroCopyState::Disabled ||
+      buffer.length() < zero_copy_config_->minWriteSize()) {
+    return false;
+  }
+  if (zero_copy_state_ == ZeroCopyState::Unknown) {
+#ifdef SO_ZEROCOPY
+    const int enable = 1;
+    const bool enabled =
+        callbacks_->ioHandle().setOption(SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)).rc_ ==
+        0;
+#else
+    const bool enabled = false;
+#endif
+    ENVOY_CONN_LOG(debug, "zero copy transmit {}", callbacks_->connection(),
+                   enabled ? "enabled" : "not supported");
+    zero_copy_state_ = enabled ? ZeroCopyState::Enabled : ZeroCopyState::Disabled;
+  }
+  return zero_copy_state_ == ZeroCopyState::Enabled;
+}
+
+Api::IoCallUint64Result RawBufferSocket::writeZeroCopy(Buffer::Instance& buffer) {
+  IoHandle& io_handle = callbacks_->ioHandle();
+  Buffer::RawSliceVector slices = buffer.getRawSlices(MaxZeroCopySlices);
+  Api::IoCallUint64Result result = io_handle.writevZeroCopy(slices.begin(), slices.size());
+  if (!result.ok() && result.err_->getErrorCode() == Api::IoError::IoErrorCode::NoSupport) {
+    result = io_handle.write(buffer);
+    if (result.ok()) {
+      onZeroCopyReleased(result.rc_, true);
+    }
+    return result;
+  }
+  if (!result.ok() || result.rc_ == 0) {
+    return result;
+  }
+
+  // The written slices move over to the send instead of being drained, so that their memory stays
+  // valid until the kernel is done with it. Moving whole slices into an empty buffer and
+  // prepending them never copies data.
+  Buffer::Instance& pinned = zero_copy_sends_.push(result.rc_);
+  uint64_t remaining = result.rc_;
+  while (remaining > 0) {
+    const uint64_t slice_length = buffer.frontSlice().len_;
+    Buffer::OwnedImpl slice;
+    slice.move(buffer, slice_length);
+    if (slice_length > remaining) {
+      // The kernel references the front of a partially written slice, so it is pinned as a whole
+      // and the unwritten tail is copied back for the next write.
+      Buffer::OwnedImpl tail;
+      tail.add(static_cast<const uint8_t*>(slice.frontSlice().mem_) + remaining,
+               slice_length - remaining);
+      buffer.prepend(tail);
+      remaining = slice_length;
+    }
+    pinned.prepend(slice);
+    remaining -= slice_length;
+  }
+  return result;
+}
+
+void RawBufferSocket::readZeroCopyCompletions() {
+  zero_copy_sends_.readCompletions(callbacks_->ioHandle(), [this](uint64_t length, bool copied) {
+    onZeroCopyReleased(length, copied);
+  });
+}
+
+void RawBufferSocket::onZeroCopyReleased(uint64_t length, bool copied) {
+  if (copied) {
+    zero_copy_fallback_bytes_ += length;
+    zero_copy_config_->stats().zero_copy_fallback_bytes_.add(length);
+  } else {
+    zero_copy_bytes_ += length;
+    zero_copy_config_->stats().zero_copy_bytes_.add(length);
+  }
+}
+
+void RawBufferSocket::closeSocket(Network::ConnectionEvent) {
+  if (zero_copy_sends_.empty()) {
+    return;
+  }
+  readZeroCopyCompletions();
+  if (zero_copy_sends_.empty()) {
+    return;
+  }
+
+  // The connection closes its descriptor next, while the kernel keeps transmitting the data queued
+  // on the socket. A duplicate keeps the socket and its error queue around, so the peer has to be
+  // sent the FIN explicitly. Only handles backed by a socket descriptor accept zero copy sends.
+  IoHandle& io_handle = callbacks_->ioHandle();
+  const Api::SysCallSocketResult result =
+      Api::OsSysCallsSingleton::get().duplicate(io_handle.fdDoNotUse());
+  if (!SOCKET_VALID(result.rc_)) {
+    ENVOY_CONN_LOG(debug, "unable to keep zero copy sends alive, resetting the connection: {}",
+                   callbacks_->connection(), errorDetails(result.errno_));
+    resetOnClose(io_handle);
+    return;
+  }
+  auto duplicate = std::make_unique<IoSocketHandleImpl>(result.rc_);
+  duplicate->shutdown(ENVOY_SHUT_WR);
+  ENVOY_CONN_LOG(debug, "draining {} zero copy sends after close", callbacks_->connection(),
+                 zero_copy_sends_.size());
+  // The drainer owns itself and is deleted once the sends have completed.
+  new ZeroCopyDrainer(callbacks_->connection().dispatcher(), std::move(duplicate),
+                      std::move(zero_copy_sends_));
+}
+
 std::string RawBufferSocket::protocol() const { return EMPTY_STRING; }
 absl::string_view RawBufferSocket::failureReason() const { return EMPTY_STRING; }
 
@@ -88,7 +309,7 @@ void RawBufferSocket::onConnected() { callbacks_->raiseEvent(ConnectionEvent::Co
 
 TransportSocketPtr
 RawBufferSocketFactory::createTransportSocket(TransportSocketOptionsSharedPtr) const {
-  return std::make_unique<RawBufferSocket>();
+  return std::make_unique<RawBufferSocket>(zero_copy_config_);
 }
 
 bool RawBufferSocketFactory::implementsSecureTransport() const { return false; }
@@ -1,39 +1,164 @@
 #pragma once
 
+#include <deque>
+
 #include "envoy/buffer/buffer.h"
 #include "envoy/network/connection.h"
 #include "envoy/network/transport_socket.h"
+#include "envoy/stats/scope.h"
+#include "envoy/stats/stats_macros.h"
 
+#include "common/buffer/buffer_impl.h"
 #include "common/common/logger.h"
 
 namespace Envoy {
 namespace Network {
 
+/**
+ * All zero copy transmit stats. @see stats_macros.h
+ */
+#define ALL_RAW_BUFFER_ZERO_COPY_STATS(COUNTER)                                                    \
+  COUNTER(zero_copy_bytes)                                                                         \
+  COUNTER(zero_copy_fallback_bytes)
+
+/**
+ * Struct definition for all zero copy transmit stats. @see stats_macros.h
+ */
+struct RawBufferZeroCopyStats {
+  ALL_RAW_BUFFER_ZERO_COPY_STATS(GENERATE_COUNTER_STRUCT)
+};
+
+/**
+ * Settings of the opt-in zero copy transmit mode, shared by the sockets of a factory.
+ */
+class RawBufferZeroCopyConfig {
+public:
+  RawBufferZeroCopyConfig(uint64_t min_write_size, Stats::Scope& scope);
+
+  /**
+   * @return the size from which on the data of a write is transmitted without copies. Smaller
+   * writes are cheaper to copy than to track until the kernel releases them.
+   */
+  uint64_t minWriteSize() const { return min_write_size_; }
+
+  RawBufferZeroCopyStats& stats() const { return stats_; }
+
+private:
+  const uint64_t min_write_size_;
+  mutable RawBufferZeroCopyStats stats_;
+};
+
+using RawBufferZeroCopyConfigSharedPtr = std::shared_ptr<const RawBufferZeroCopyConfig>;
+
+/**
+ * The zero copy sends of a socket which the kernel has not released yet, in the order they were
+ * issued. Each send owns the buffer slices holding its data so that the memory stays valid until
+ * the completion is read from the socket error queue.
+ */
+class ZeroCopySendQueue {
+public:
+  /**
+   * Called for every send that is released.
+   * @param length supplies the number of bytes of the send.
+   * @param copied is true if the kernel copied the data after all.
+   */
+  using ReleaseCb = std::function<void(uint64_t length, bool copied)>;
+
+  /**
+   * Starts tracking the next send.
+   * @param length supplies the number of bytes the send wrote.
+   * @return the buffer the slices of the send have to be moved to.
+   */
+  Buffer::Instance& push(uint64_t length);
+
+  /**
+   * Reads the completions queued for the io handle and releases the sends they cover.
+   * @return false if the completions could not be read.
+   */
+  bool readCompletions(IoHandle& io_handle, const ReleaseCb& cb);
+
+  bool empty() const { return sends_.empty(); }
+  size_t size() const { return sends_.size(); }
+
+private:
+  struct Send {
+    Send(uint32_t sequence, uint64_t length) : sequence_(sequence), length_(length) {}
+
+    const uint32_t sequence_;
+    const uint64_t length_;
+    bool completed_{};
+    bool copied_{};
+    Buffer::OwnedImpl pinned_;
+  };
+
+  void onCompletion(const IoHandle::ZeroCopyCompletion& completion);
+
+  std::deque<Send> sends_;
+  // The kernel numbers the zero copy sends of a socket from 0.
+  uint32_t next_sequence_{};
+};
+
 class RawBufferSocket : public TransportSocket, protected Logger::Loggable<Logger::Id::connection> {
 public:
+  /**
+   * @param zero_copy_config supplies the zero copy transmit settings, or nullptr to always copy
+   *        written data into the kernel.
+   */
+  explicit RawBufferSocket(RawBufferZeroCopyConfigSharedPtr zero_copy_config = nullptr);
+
   // Network::TransportSocket
   void setTransportSocketCallbacks(TransportSocketCallbacks& callbacks) override;
   std::string protocol() const override;
   absl::string_view failureReason() const override;
   bool canFlushClose() override { return true; }
-  void closeSocket(Network::ConnectionEvent) override {}
+  void closeSocket(Network::ConnectionEvent) override;
   void onConnected() override;
   IoResult doRead(Buffer::Instance& buffer) override;
   IoResult doWrite(Buffer::Instance& buffer, bool end_stream) override;
   Ssl::ConnectionInfoConstSharedPtr ssl() const override { return nullptr; }
   bool startSecureTransport() override { return false; }
+  bool supportsSplice() const override { return true; }
+
+  /**
+   * @return the bytes of the connection the kernel has transmitted straight from Envoy's buffers.
+   */
+  uint64_t zeroCopyBytes() const { return zero_copy_bytes_; }
+
+  /**
+   * @return the bytes of the connection which were large enough to be sent without copies but
+   * were copied after all, either by the kernel or because zero copy sends were not possible.
+   */
+  uint64_t zeroCopyFallbackBytes() const { return zero_copy_fallback_bytes_; }
 
 private:
+  enum class ZeroCopyState { Disabled, Unknown, Enabled };
+
+  bool shouldWriteZeroCopy(const Buffer::Instance& buffer);
+  Api::IoCallUint64Result writeZeroCopy(Buffer::Instance& buffer);
+  void readZeroCopyCompletions();
+  void onZeroCopyReleased(uint64_t length, bool copied);
+
   TransportSocketCallbacks* callbacks_{};
   bool shutdown_{};
+  const RawBufferZeroCopyConfigSharedPtr zero_copy_config_;
+  ZeroCopyState zero_copy_state_;
+  ZeroCopySendQueue zero_copy_sends_;
+  uint64_t zero_copy_bytes_{};
+  uint64_t zero_copy_fallback_bytes_{};
 };
 
 class RawBufferSocketFactory : public TransportSocketFactory {
 public:
+  explicit RawBufferSocketFactory(RawBufferZeroCopyConfigSharedPtr zero_copy_config = nullptr)
+      : zero_copy_config_(std::move(zero_copy_config)) {}
+
   // Network::TransportSocketFactory
   TransportSocketPtr createTransportSocket(TransportSocketOptionsSharedPtr options) const override;
   bool implementsSecureTransport() const override;
   bool usesProxyProtocolOptions() const override { return false; }
+
+private:
+  const RawBufferZeroCopyConfigSharedPtr zero_copy_config_;
 };
 
 } // namespace Network
@@ -0,0 +1,49 @@
+#include "common/network/read_size_controller.h"
+
+#include <algorithm>
+
+#include "common/common/utility.h"
+
+namespace Envoy {
+namespace Network {
+
+void ReadSizeController::setBufferLimit(uint32_t buffer_limit) {
+  if (buffer_limit == 0) {
+    max_read_size_ = Buffer::OwnedImpl::max_read_reservation_size_;
+  } else {
+    max_read_size_ = std::clamp<uint64_t>(
+        IntUtil::roundUpToMultiple(buffer_limit, Buffer::Slice::default_slice_size_),
+        Buffer::OwnedImpl::default_read_reservation_size_,
+        Buffer::OwnedImpl::max_read_reservation_size_);
+  }
+  read_size_ = std::min(read_size_, max_read_size_);
+}
+
+uint64_t ReadSizeController::takeReads() {
+  const uint64_t reads = reads_;
+  reads_ = 0;
+  return reads;
+}
+
+uint64_t ReadSizeController::readReservationLength() const {
+  return adaptive_ ? read_size_ : Buffer::OwnedImpl::default_read_reservation_size_;
+}
+
+void ReadSizeController::onReadCommitted(uint64_t reserved, uint64_t committed) {
+  reads_++;
+  // A read which returned no data, at the end of the stream or because the socket had none left,
+  // says nothing about the size reads should have.
+  if (!adaptive_ || committed == 0) {
+    return;
+  }
+
+  if (committed >= reserved) {
+    // More data may have been waiting than the read could take.
+    read_size_ = std::min(read_size_ * 2, max_read_size_);
+  } else if (committed <= read_size_ / 4) {
+    read_size_ = std::max(read_size_ / 2, MinReadSize);
+  }
+}
+
+} // namespace Network
+} // namespace Envoy
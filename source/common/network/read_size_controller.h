@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+#include "envoy/buffer/buffer.h"
+
+#include "common/buffer/buffer_impl.h"
+
+namespace Envoy {
+namespace Network {
+
+/**
+ * Sizes the reads of a connection. When adaptive, the size of each read grows while reads fill
+ * their reservation and shrinks while they only use a small part of it, in the spirit of TCP
+ * receive buffer autotuning. Bulk transfers then take fewer, larger reads, and small requests do
+ * not reserve slices they leave empty. Otherwise every read reserves the default length.
+ */
+class ReadSizeController : public Buffer::ReadReservationPolicy {
+public:
+  // The smallest and initial adaptive read sizes.
+  static constexpr uint64_t MinReadSize = Buffer::SliceAllocator::PageSize;
+  static constexpr uint64_t InitialReadSize = Buffer::Slice::default_slice_size_;
+
+  explicit ReadSizeController(bool adaptive) : adaptive_(adaptive) {}
+
+  /**
+   * Set the largest adaptive read size from the buffer limit of the connection. Reads larger than
+   * the default read reservation, which use large slices, are only made if the connection buffers
+   * enough data to make use of them.
+   * @param buffer_limit supplies the buffer limit of the connection, or 0 if it has none.
+   */
+  void setBufferLimit(uint32_t buffer_limit);
+
+  /**
+   * @return uint64_t the number of reads made since the previous call, including reads which
+   *   returned no data.
+   */
+  uint64_t takeReads();
+
+  // Buffer::ReadReservationPolicy
+  uint64_t readReservationLength() const override;
+  void onReadCommitted(uint64_t reserved, uint64_t committed) override;
+
+private:
+  const bool adaptive_;
+  uint64_t read_size_{InitialReadSize};
+  uint64_t max_read_size_{Buffer::OwnedImpl::max_read_reservation_size_};
+  uint64_t reads_{};
+};
+
+} // namespace Network
+} // namespace Envoy
@@ -0,0 +1,94 @@
+#include "common/network/splice_pipe.h"
+
+#include "common/api/os_sys_calls_impl.h"
+#include "common/common/assert.h"
+#include "common/common/logger.h"
+#include "common/common/utility.h"
+#include "common/network/io_socket_error_impl.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+
+#include "common/api/os_sys_calls_impl_linux.h"
+#endif
+
+namespace Envoy {
+namespace Network {
+
+namespace {
+
+#if defined(__linux__)
+Api::IoCallUint64Result spliceResultToIoCallResult(const Api::SysCallSizeResult& result) {
+  if (result.rc_ >= 0) {
+    return Api::IoCallUint64Result(result.rc_,
+                                   Api::IoErrorPtr(nullptr, IoSocketError::deleteIoError));
+  }
+  return Api::IoCallUint64Result(
+      0, result.errno_ == SOCKET_ERROR_AGAIN
+             ? Api::IoErrorPtr(IoSocketError::getIoSocketEagainInstance(),
+                               IoSocketError::deleteIoError)
+             : Api::IoErrorPtr(new IoSocketError(result.errno_), IoSocketError::deleteIoError));
+}
+
+// Upper bound on the bytes moved by a single splice. Pipes hold 64KiB by default.
+constexpr uint64_t MaxSpliceLength = 1024 * 1024;
+#endif
+
+} // namespace
+
+SplicePipePtr SplicePipe::create() {
+#if defined(__linux__)
+  int fds[2];
+  const Api::SysCallIntResult result =
+      Api::LinuxOsSysCallsSingleton::get().pipe2(fds, O_NONBLOCK | O_CLOEXEC);
+  if (result.rc_ != 0) {
+    ENVOY_LOG_MISC(debug, "unable to create splice pipe: {}", errorDetails(result.errno_));
+    return nullptr;
+  }
+  return SplicePipePtr{new SplicePipe(fds[0], fds[1])};
+#else
+  return nullptr;
+#endif
+}
+
+SplicePipe::~SplicePipe() {
+  auto& os_sys_calls = Api::OsSysCallsSingleton::get();
+  os_sys_calls.close(read_fd_);
+  os_sys_calls.close(write_fd_);
+}
+
+Api::IoCallUint64Result SplicePipe::fill(IoHandle& io_handle,
+                                         absl::optional<uint64_t> max_length) {
+#if defined(__linux__)
+  const uint64_t length = std::min(max_length.value_or(MaxSpliceLength), MaxSpliceLength);
+  const Api::SysCallSizeResult result = Api::LinuxOsSysCallsSingleton::get().splice(
+      io_handle.fdDoNotUse(), write_fd_, length, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+  if (result.rc_ > 0) {
+    length_ += result.rc_;
+  }
+  return spliceResultToIoCallResult(result);
+#else
+  UNREFERENCED_PARAMETER(io_handle);
+  UNREFERENCED_PARAMETER(max_length);
+  NOT_REACHED_GCOVR_EXCL_LINE;
+#endif
+}
+
+Api::IoCallUint64Result SplicePipe::drain(IoHandle& io_handle) {
+#if defined(__linux__)
+  ASSERT(length_ > 0);
+  const Api::SysCallSizeResult result = Api::LinuxOsSysCallsSingleton::get().splice(
+      read_fd_, io_handle.fdDoNotUse(), std::min(length_, MaxSpliceLength),
+      SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+  if (result.rc_ > 0) {
+    length_ -= result.rc_;
+  }
+  return spliceResultToIoCallResult(result);
+#else
+  UNREFERENCED_PARAMETER(io_handle);
+  NOT_REACHED_GCOVR_EXCL_LINE;
+#endif
+}
+
+} // namespace Network
+} // namespace Envoy
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "envoy/api/io_error.h"
+#include "envoy/common/platform.h"
+#include "envoy/network/io_handle.h"
+
+#include "absl/types/optional.h"
+
+namespace Envoy {
+namespace Network {
+
+class SplicePipe;
+using SplicePipePtr = std::unique_ptr<SplicePipe>;
+
+/**
+ * A kernel pipe through which data is moved from one socket to another with splice(), without
+ * being copied to user space.
+ */
+class SplicePipe {
+public:
+  /**
+   * @return SplicePipePtr a new pipe, or nullptr if the platform cannot splice data.
+   */
+  static SplicePipePtr create();
+
+  ~SplicePipe();
+
+  /**
+   * Moves data received on a socket into the pipe.
+   * @param io_handle supplies the socket to read from.
+   * @param max_length supplies the maximum number of bytes to move, if any.
+   * @return Api::IoCallUint64Result the number of bytes moved, 0 at the end of the stream. The
+   *         Again error is returned if the socket has no data or the pipe is full.
+   */
+  Api::IoCallUint64Result fill(IoHandle& io_handle, absl::optional<uint64_t> max_length);
+
+  /**
+   * Moves data from the pipe to a socket.
+   * @param io_handle supplies the socket to write to.
+   * @return Api::IoCallUint64Result the number of bytes moved.
+   */
+  Api::IoCallUint64Result drain(IoHandle& io_handle);
+
+  /**
+   * @return uint64_t the number of bytes in the pipe.
+   */
+  uint64_t length() const { return length_; }
+
+private:
+  SplicePipe(os_fd_t read_fd, os_fd_t write_fd) : read_fd_(read_fd), write_fd_(write_fd) {}
+
+  const os_fd_t read_fd_;
+  const os_fd_t write_fd_;
+  uint64_t length_{};
+};
+
+} // namespace Network
+} // namespace Envoy
@@ -53,6 +53,21 @@ public:
     }
     return io_handle_.write(buffer);
   }
+  Api::IoCallUint64Result writevZeroCopy(const Buffer::RawSlice* slices,
+                                         uint64_t num_slice) override {
+    if (closed_) {
+      return Api::IoCallUint64Result(0, Api::IoErrorPtr(new Network::IoSocketError(EBADF),
+                                                        Network::IoSocketError::deleteIoError));
+    }
+    return io_handle_.writevZeroCopy(slices, num_slice);
+  }
+  Api::IoCallUint64Result readZeroCopyCompletions(const ZeroCopyCompletionCb& cb) override {
+    if (closed_) {
+      return Api::IoCallUint64Result(0, Api::IoErrorPtr(new Network::IoSocketError(EBADF),
+                                                        Network::IoSocketError::deleteIoError));
+    }
+    return io_handle_.readZeroCopyCompletions(cb);
+  }
   Api::IoCallUint64Result sendmsg(const Buffer::RawSlice* slices, uint64_t num_slice, int flags,
                                   const Envoy::Network::Address::Ip* self_ip,
                                   const Network::Address::Instance& peer_address) override {
@@ -62,6 +77,15 @@ public:
     }
     return io_handle_.sendmsg(slices, num_slice, flags, self_ip, peer_address);
   }
+  Api::IoCallUint64Result sendmmsg(const Buffer::RawSlice* datagrams, uint64_t num_datagrams,
+                                   int flags,
+                                   const Network::Address::Instance& peer_address) override {
+    if (closed_) {
+      return Api::IoCallUint64Result(0, Api::IoErrorPtr(new Network::IoSocketError(EBADF),
+                                                        Network::IoSocketError::deleteIoError));
+    }
+    return io_handle_.sendmmsg(datagrams, num_datagrams, flags, peer_address);
+  }
   Api::IoCallUint64Result recvmsg(Buffer::RawSlice* slices, const uint64_t num_slice,
                                   uint32_t self_port, RecvMsgOutput& output) override {
     if (closed_) {
@@ -90,6 +114,7 @@ public:
   }
   bool supportsMmsg() const override { return io_handle_.supportsMmsg(); }
   bool supportsUdpGro() const override { return io_handle_.supportsUdpGro(); }
+  bool supportsSplice() const override { return false; }
   Api::SysCallIntResult bind(Network::Address::InstanceConstSharedPtr address) override {
     return io_handle_.bind(address);
   }
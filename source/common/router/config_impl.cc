@@ -1268,6 +1268,28 @@ VirtualHostImpl::VirtualHostImpl(
     }
   }
 
+  if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.route_path_index")) {
+    auto path_index = std::make_unique<RoutePathIndex>();
+    for (uint32_t i = 0; i < routes_.size(); i++) {
+      const RouteEntryImplBase& route = *routes_[i];
+      switch (route.matchType()) {
+      case PathMatchType::Prefix:
+        path_index->addPrefix(route.matcher(), route.caseSensitive(), i);
+        break;
+      case PathMatchType::Exact:
+        path_index->addPath(route.matcher(), route.caseSensitive(), i);
+        break;
+      default:
+        path_index->addUnindexed(i);
+        break;
+      }
+    }
+    // Scanning a short route table is cheaper than looking it up in the index.
+    if (path_index->indexedRoutes() >= MinRoutesForPathIndex) {
+      path_index_ = std::move(path_index);
+    }
+  }
+
   for (const auto& virtual_cluster : virtual_host.virtual_clusters()) {
     virtual_clusters_.push_back(
         VirtualClusterEntry(virtual_cluster, *vcluster_scope_,
@@ -1402,6 +1424,11 @@ RouteConstSharedPtr VirtualHostImpl::getRouteFromEntries(const RouteCallback& cb
     return SSL_REDIRECT_ROUTE;
   }
 
+  // The index does not know which routes follow the routes it finds, which the callback is told.
+  if (path_index_ != nullptr && !cb && headers.Path() != nullptr) {
+    return getRouteFromPathIndex(headers, stream_info, random_value);
+  }
+
   // Check for a route that matches the request.
   for (auto route = routes_.begin(); route != routes_.end(); ++route) {
     if (!headers.Path() && !(*route)->supportsPathlessHeaders()) {
@@ -1434,6 +1461,34 @@ RouteConstSharedPtr VirtualHostImpl::getRouteFromEntries(const RouteCallback& cb
   return nullptr;
 }
 
+RouteConstSharedPtr
+VirtualHostImpl::getRouteFromPathIndex(const Http::RequestHeaderMap& headers,
+                                       const StreamInfo::StreamInfo& stream_info,
+                                       uint64_t random_value) const {
+  // Only the routes whose path criterion matches the request and the routes which are not indexed
+  // can match. They are evaluated in the order of the route table, so that the first match wins.
+  const RoutePathIndex::Routes indexed_routes = path_index_->match(headers.getPathValue());
+  const std::vector<uint32_t>& unindexed_routes = path_index_->unindexedRoutes();
+  auto indexed = indexed_routes.begin();
+  auto unindexed = unindexed_routes.begin();
+  while (indexed != indexed_routes.end() || unindexed != unindexed_routes.end()) {
+    uint32_t route;
+    if (unindexed == unindexed_routes.end() ||
+        (indexed != indexed_routes.end() && *indexed < *unindexed)) {
+      route = *indexed++;
+    } else {
+      route = *unindexed++;
+    }
+
+    RouteConstSharedPtr route_entry = routes_[route]->matches(headers, stream_info, random_value);
+    if (route_entry != nullptr) {
+      return route_entry;
+    }
+  }
+
+  return nullptr;
+}
+
 const VirtualHostImpl* RouteMatcher::findVirtualHost(const Http::RequestHeaderMap& headers) const {
   // Fast path the case where we only have a default virtual host.
   if (virtual_hosts_.empty() && wildcard_virtual_host_suffixes_.empty() &&
@@ -27,6 +27,7 @@
 #include "common/router/header_formatter.h"
 #include "common/router/header_parser.h"
 #include "common/router/metadatamatchcriteria_impl.h"
+#include "common/router/route_path_index.h"
 #include "common/router/router_ratelimit.h"
 #include "common/router/tls_context_match_criteria_impl.h"
 #include "common/stats/symbol_table_impl.h"
@@ -210,6 +211,13 @@ public:
 private:
   enum class SslRequirements { None, ExternalOnly, All };
 
+  // The minimum number of prefix and path routes for which a virtual host indexes its routes.
+  static constexpr uint32_t MinRoutesForPathIndex = 16;
+
+  RouteConstSharedPtr getRouteFromPathIndex(const Http::RequestHeaderMap& headers,
+                                            const StreamInfo::StreamInfo& stream_info,
+                                            uint64_t random_value) const;
+
   struct StatNameProvider {
     StatNameProvider(absl::string_view name, Stats::SymbolTable& symbol_table)
         : stat_name_storage_(name, symbol_table) {}
@@ -250,6 +258,7 @@ private:
   const Stats::StatNameManagedStorage stat_name_storage_;
   Stats::ScopePtr vcluster_scope_;
   std::vector<RouteEntryImplBaseConstSharedPtr> routes_;
+  std::unique_ptr<const RoutePathIndex> path_index_;
   std::vector<VirtualClusterEntry> virtual_clusters_;
   SslRequirements ssl_requirements_;
   const RateLimitPolicyImpl rate_limit_policy_;
@@ -485,6 +494,8 @@ public:
            !prefix_rewrite_redirect_.empty() || regex_rewrite_redirect_ != nullptr;
   }
 
+  bool caseSensitive() const { return case_sensitive_; }
+
   bool matchRoute(const Http::RequestHeaderMap& headers, const StreamInfo::StreamInfo& stream_info,
                   uint64_t random_value) const;
   void validateClusters(const Upstream::ClusterManager::ClusterInfoMaps& cluster_info_maps) const;
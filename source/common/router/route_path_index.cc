@@ -0,0 +1,107 @@
+#include "common/router/route_path_index.h"
+
+#include <algorithm>
+
+#include "common/http/path_utility.h"
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+
+namespace Envoy {
+namespace Router {
+
+void RoutePathIndex::addPrefix(absl::string_view prefix, bool case_sensitive, uint32_t route) {
+  if (case_sensitive) {
+    case_sensitive_.add(prefix, true, route);
+  } else {
+    case_insensitive_.add(absl::AsciiStrToLower(prefix), true, route);
+    has_case_insensitive_routes_ = true;
+  }
+  indexed_routes_++;
+}
+
+void RoutePathIndex::addPath(absl::string_view path, bool case_sensitive, uint32_t route) {
+  if (case_sensitive) {
+    case_sensitive_.add(path, false, route);
+  } else {
+    case_insensitive_.add(absl::AsciiStrToLower(path), false, route);
+    has_case_insensitive_routes_ = true;
+  }
+  indexed_routes_++;
+}
+
+RoutePathIndex::Routes RoutePathIndex::match(absl::string_view path) const {
+  // Path matchers ignore the query string and the fragment.
+  path = Http::PathUtil::removeQueryAndFragment(path);
+
+  Routes routes;
+  case_sensitive_.match(path, routes);
+  if (has_case_insensitive_routes_) {
+    case_insensitive_.match(absl::AsciiStrToLower(path), routes);
+  }
+  // Routes are found from the shortest to the longest prefix rather than in route table order.
+  std::sort(routes.begin(), routes.end());
+  return routes;
+}
+
+void RoutePathIndex::RadixTree::add(absl::string_view key, bool prefix, uint32_t route) {
+  Node* node = &root_;
+  while (!key.empty()) {
+    auto edge = std::lower_bound(node->children_.begin(), node->children_.end(), key[0],
+                                 [](const Edge& edge, char c) { return edge.label_[0] < c; });
+    if (edge == node->children_.end() || edge->label_[0] != key[0]) {
+      edge = node->children_.insert(edge, Edge{std::string(key), std::make_unique<Node>()});
+      node = edge->node_.get();
+      break;
+    }
+
+    size_t common = 1;
+    while (common < edge->label_.size() && common < key.size() &&
+           edge->label_[common] == key[common]) {
+      common++;
+    }
+    if (common < edge->label_.size()) {
+      // Split the edge where the key diverges from its label.
+      auto middle = std::make_unique<Node>();
+      middle->children_.push_back(Edge{edge->label_.substr(common), std::move(edge->node_)});
+      edge->label_.resize(common);
+      edge->node_ = std::move(middle);
+    }
+    node = edge->node_.get();
+    key.remove_prefix(common);
+  }
+
+  if (prefix) {
+    node->prefix_routes_.push_back(route);
+  } else {
+    node->path_routes_.push_back(route);
+  }
+}
+
+void RoutePathIndex::RadixTree::match(absl::string_view path, Routes& routes) const {
+  const Node* node = &root_;
+  routes.insert(routes.end(), node->prefix_routes_.begin(), node->prefix_routes_.end());
+  while (!path.empty()) {
+    const Edge* edge = findChild(*node, path[0]);
+    if (edge == nullptr || !absl::StartsWith(path, edge->label_)) {
+      return;
+    }
+    path.remove_prefix(edge->label_.size());
+    node = edge->node_.get();
+    routes.insert(routes.end(), node->prefix_routes_.begin(), node->prefix_routes_.end());
+  }
+  routes.insert(routes.end(), node->path_routes_.begin(), node->path_routes_.end());
+}
+
+const RoutePathIndex::RadixTree::Edge* RoutePathIndex::RadixTree::findChild(const Node& node,
+                                                                            char c) {
+  auto edge = std::lower_bound(node.children_.begin(), node.children_.end(), c,
+                               [](const Edge& edge, char c) { return edge.label_[0] < c; });
+  if (edge == node.children_.end() || edge->label_[0] != c) {
+    return nullptr;
+  }
+  return &*edge;
+}
+
+} // namespace Router
+} // namespace Envoy
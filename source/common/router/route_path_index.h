@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/string_view.h"
+
+namespace Envoy {
+namespace Router {
+
+/**
+ * Index of the prefix and exact path routes of a virtual host, which finds the routes whose path
+ * criterion matches a request without comparing the request path to every route. Routes are
+ * identified by their position in the route table, and the index only narrows down the routes
+ * which need to be evaluated: a route returned by the index must still be fully matched, in order,
+ * to preserve the first match semantics of the route table.
+ *
+ * Each of the case sensitive and case insensitive routes are kept in a compressed radix tree, where
+ * the edges of the tree are labelled by the longest strings shared by the paths and prefixes below
+ * them.
+ */
+class RoutePathIndex {
+public:
+  using Routes = absl::InlinedVector<uint32_t, 8>;
+
+  /**
+   * Adds a route matching the paths which start with prefix. Routes must be added in the order of
+   * the route table.
+   */
+  void addPrefix(absl::string_view prefix, bool case_sensitive, uint32_t route);
+
+  /**
+   * Adds a route matching the paths equal to path. Routes must be added in the order of the route
+   * table.
+   */
+  void addPath(absl::string_view path, bool case_sensitive, uint32_t route);
+
+  /**
+   * Adds a route whose path criterion cannot be indexed, such as a regex. Such a route has to be
+   * evaluated for every request. Routes must be added in the order of the route table.
+   */
+  void addUnindexed(uint32_t route) { unindexed_routes_.push_back(route); }
+
+  /**
+   * @param path supplies the path of a request, which may include a query string and a fragment.
+   * @return the indexed routes matching path, in the order of the route table.
+   */
+  Routes match(absl::string_view path) const;
+
+  /**
+   * @return the routes which are not indexed, in the order of the route table.
+   */
+  const std::vector<uint32_t>& unindexedRoutes() const { return unindexed_routes_; }
+
+  /**
+   * @return the number of indexed routes.
+   */
+  uint32_t indexedRoutes() const { return indexed_routes_; }
+
+private:
+  class RadixTree {
+  public:
+    void add(absl::string_view key, bool prefix, uint32_t route);
+    void match(absl::string_view path, Routes& routes) const;
+
+  private:
+    struct Node;
+    struct Edge {
+      std::string label_;
+      std::unique_ptr<Node> node_;
+    };
+    struct Node {
+      // The routes whose prefix, or path, ends at this node.
+      absl::InlinedVector<uint32_t, 1> prefix_routes_;
+      absl::InlinedVector<uint32_t, 1> path_routes_;
+      // Sorted by the first character of their label, which is unique among the children.
+      std::vector<Edge> children_;
+    };
+
+    static const Edge* findChild(const Node& node, char c);
+
+    Node root_;
+  };
+
+  RadixTree case_sensitive_;
+  RadixTree case_insensitive_;
+  bool has_case_insensitive_routes_{};
+  std::vector<uint32_t> unindexed_routes_;
+  uint32_t indexed_routes_{};
+};
+
+} // namespace Router
+} // namespace Envoy
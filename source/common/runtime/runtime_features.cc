@@ -82,6 +82,7 @@ constexpr const char* runtime_features[] = {
     "envoy.reloadable_features.require_ocsp_response_for_must_staple_certs",
     "envoy.reloadable_features.require_strict_1xx_and_204_response_headers",
     "envoy.reloadable_features.return_502_for_upstream_protocol_errors",
+    "envoy.reloadable_features.route_path_index",
     "envoy.reloadable_features.send_strict_1xx_and_204_response_headers",
     "envoy.reloadable_features.strip_port_from_connect",
     "envoy.reloadable_features.treat_host_like_authority",
@@ -114,6 +115,12 @@ constexpr const char* disabled_runtime_features[] = {
     "envoy.reloadable_features.test_feature_false",
     // Allows the use of ExtensionWithMatcher to wrap a HTTP filter with a match tree.
     "envoy.reloadable_features.experimental_matching_api",
+    // Moves opaque TCP proxy data between sockets with splice(2) instead of user space buffers.
+    "envoy.reloadable_features.tcp_proxy_splice",
+    // Sizes the reads of connections from the sizes of their recent reads.
+    "envoy.reloadable_features.adaptive_read_sizing",
+    // Allocates the filter wrappers of HTTP streams from a per-stream arena.
+    "envoy.reloadable_features.http_stream_arena",
 };
 
 RuntimeFeatures::RuntimeFeatures() {
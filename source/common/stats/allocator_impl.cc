@@ -16,6 +16,7 @@
 #include "common/stats/symbol_table_impl.h"
 
 #include "absl/container/flat_hash_set.h"
+#include "absl/strings/match.h"
 
 namespace Envoy {
 namespace Stats {
@@ -39,6 +40,21 @@ void AllocatorImpl::debugPrint() {
 }
 #endif
 
+template <class StatType>
+void AllocatorImpl::addToNameIndexLockHeld(NameIndex<StatType>& index, StatType* stat) {
+  if (name_index_built_) {
+    index.emplace(symbol_table_.toString(stat->statName()), stat);
+  }
+}
+
+template <class StatType>
+void AllocatorImpl::removeFromNameIndexLockHeld(NameIndex<StatType>& index, StatType* stat) {
+  if (name_index_built_) {
+    const size_t count = index.erase({symbol_table_.toString(stat->statName()), stat});
+    ASSERT(count == 1);
+  }
+}
+
 // Counter, Gauge and TextReadout inherit from RefcountInterface and
 // Metric. MetricImpl takes care of most of the Metric API, but we need to cover
 // symbolTable() here, which we don't store directly, but get it via the alloc,
@@ -122,6 +138,7 @@ public:
       : StatsSharedImpl(name, alloc, tag_extracted_name, stat_name_tags) {}
 
   void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) override {
+    alloc_.removeFromNameIndexLockHeld<Counter>(alloc_.counter_index_, this);
     const size_t count = alloc_.counters_.erase(statName());
     ASSERT(count == 1);
   }
@@ -144,6 +161,75 @@ private:
   std::atomic<uint64_t> pending_increment_{0};
 };
 
+// Threads take consecutive indexes the first time they increment a striped counter, so that as
+// many threads as there are stripes each increment their own stripe.
+namespace {
+uint32_t threadStripeIndex() {
+  static std::atomic<uint32_t> next_index{0};
+  thread_local const uint32_t index = next_index++;
+  return index;
+}
+} // namespace
+
+// A counter whose value is split into stripes on their own cache lines, each of which is mostly
+// incremented by a single thread, so that the threads incrementing a hot counter do not bounce a
+// cache line between their cores. Reads sum the stripes.
+class StripedCounterImpl : public StatsSharedImpl<Counter> {
+public:
+  StripedCounterImpl(StatName name, AllocatorImpl& alloc, StatName tag_extracted_name,
+                     const StatNameTagVector& stat_name_tags, uint32_t num_stripes)
+      : StatsSharedImpl(name, alloc, tag_extracted_name, stat_name_tags),
+        stripes_(new Stripe[num_stripes]), stripe_mask_(num_stripes - 1) {
+    ASSERT(num_stripes > 0 && (num_stripes & stripe_mask_) == 0);
+  }
+
+  void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) override {
+    alloc_.removeFromNameIndexLockHeld<Counter>(alloc_.counter_index_, this);
+    const size_t count = alloc_.counters_.erase(statName());
+    ASSERT(count == 1);
+  }
+
+  // Stats::Counter
+  void add(uint64_t amount) override {
+    Stripe& stripe = stripes_[threadStripeIndex() & stripe_mask_];
+    stripe.value_.fetch_add(amount, std::memory_order_relaxed);
+    stripe.pending_increment_.fetch_add(amount, std::memory_order_relaxed);
+    // The flags share a cache line with the rest of the counter, so only write them once.
+    if (!(flags_.load(std::memory_order_relaxed) & Flags::Used)) {
+      flags_ |= Flags::Used;
+    }
+  }
+  void inc() override { add(1); }
+  uint64_t latch() override {
+    uint64_t pending_increment = 0;
+    for (uint32_t i = 0; i <= stripe_mask_; ++i) {
+      pending_increment += stripes_[i].pending_increment_.exchange(0);
+    }
+    return pending_increment;
+  }
+  void reset() override {
+    for (uint32_t i = 0; i <= stripe_mask_; ++i) {
+      stripes_[i].value_ = 0;
+    }
+  }
+  uint64_t value() const override {
+    uint64_t value = 0;
+    for (uint32_t i = 0; i <= stripe_mask_; ++i) {
+      value += stripes_[i].value_.load(std::memory_order_relaxed);
+    }
+    return value;
+  }
+
+private:
+  struct alignas(64) Stripe {
+    std::atomic<uint64_t> value_{0};
+    std::atomic<uint64_t> pending_increment_{0};
+  };
+
+  const std::unique_ptr<Stripe[]> stripes_;
+  const uint32_t stripe_mask_;
+};
+
 class GaugeImpl : public StatsSharedImpl<Gauge> {
 public:
   GaugeImpl(StatName name, AllocatorImpl& alloc, StatName tag_extracted_name,
@@ -166,6 +252,7 @@ public:
   }
 
   void removeFromSetLockHeld() override ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) {
+    alloc_.removeFromNameIndexLockHeld<Gauge>(alloc_.gauge_index_, this);
     const size_t count = alloc_.gauges_.erase(statName());
     ASSERT(count == 1);
   }
@@ -238,6 +325,7 @@ public:
       : StatsSharedImpl(name, alloc, tag_extracted_name, stat_name_tags) {}
 
   void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) override {
+    alloc_.removeFromNameIndexLockHeld<TextReadout>(alloc_.text_readout_index_, this);
     const size_t count = alloc_.text_readouts_.erase(statName());
     ASSERT(count == 1);
   }
@@ -269,6 +357,7 @@ CounterSharedPtr AllocatorImpl::makeCounter(StatName name, StatName tag_extracte
   }
   auto counter = CounterSharedPtr(makeCounterInternal(name, tag_extracted_name, stat_name_tags));
   counters_.insert(counter.get());
+  addToNameIndexLockHeld(counter_index_, counter.get());
   return counter;
 }
 
@@ -285,6 +374,7 @@ GaugeSharedPtr AllocatorImpl::makeGauge(StatName name, StatName tag_extracted_na
   auto gauge =
       GaugeSharedPtr(new GaugeImpl(name, *this, tag_extracted_name, stat_name_tags, import_mode));
   gauges_.insert(gauge.get());
+  addToNameIndexLockHeld(gauge_index_, gauge.get());
   return gauge;
 }
 
@@ -300,9 +390,57 @@ TextReadoutSharedPtr AllocatorImpl::makeTextReadout(StatName name, StatName tag_
   auto text_readout =
       TextReadoutSharedPtr(new TextReadoutImpl(name, *this, tag_extracted_name, stat_name_tags));
   text_readouts_.insert(text_readout.get());
+  addToNameIndexLockHeld(text_readout_index_, text_readout.get());
   return text_readout;
 }
 
+void AllocatorImpl::buildNameIndexLockHeld() {
+  name_index_built_ = true;
+  for (Counter* counter : counters_) {
+    addToNameIndexLockHeld(counter_index_, counter);
+  }
+  for (Gauge* gauge : gauges_) {
+    addToNameIndexLockHeld(gauge_index_, gauge);
+  }
+  for (TextReadout* text_readout : text_readouts_) {
+    addToNameIndexLockHeld(text_readout_index_, text_readout);
+  }
+}
+
+template <class StatType>
+std::vector<RefcountPtr<StatType>> AllocatorImpl::matching(NameIndex<StatType>& index,
+                                                           const StatNameFilter& filter) {
+  std::vector<RefcountPtr<StatType>> ret;
+  Thread::LockGuard lock(mutex_);
+  if (!name_index_built_) {
+    buildNameIndexLockHeld();
+  }
+  // Holding mutex_ keeps the stats from being freed until they are referenced here.
+  for (auto it = index.lower_bound({filter.prefix_, nullptr});
+       it != index.end() && absl::StartsWith(it->first, filter.prefix_); ++it) {
+    // The used flag is checked first, as it is cheaper than matching the name.
+    if ((filter.used_only_ && !it->second->used()) ||
+        (!filter.substring_.empty() && !absl::StrContains(it->first, filter.substring_))) {
+      continue;
+    }
+    ret.emplace_back(it->second);
+  }
+  return ret;
+}
+
+std::vector<CounterSharedPtr> AllocatorImpl::countersMatching(const StatNameFilter& filter) {
+  return matching(counter_index_, filter);
+}
+
+std::vector<GaugeSharedPtr> AllocatorImpl::gaugesMatching(const StatNameFilter& filter) {
+  return matching(gauge_index_, filter);
+}
+
+std::vector<TextReadoutSharedPtr>
+AllocatorImpl::textReadoutsMatching(const StatNameFilter& filter) {
+  return matching(text_readout_index_, filter);
+}
+
 bool AllocatorImpl::isMutexLockedForTest() {
   bool locked = mutex_.tryLock();
   if (locked) {
@@ -311,8 +449,33 @@ bool AllocatorImpl::isMutexLockedForTest() {
   return !locked;
 }
 
+void AllocatorImpl::setStripedCounters(const std::vector<std::string>& tag_extracted_names,
+                                       uint32_t num_stripes) {
+  Thread::LockGuard lock(mutex_);
+  striped_counter_names_.clear();
+  striped_counter_pool_.clear();
+  num_counter_stripes_ = 0;
+  if (num_stripes < 2) {
+    return;
+  }
+  num_counter_stripes_ = 1;
+  while (num_counter_stripes_ < num_stripes) {
+    num_counter_stripes_ <<= 1;
+  }
+  for (const std::string& tag_extracted_name : tag_extracted_names) {
+    striped_counter_names_.insert(striped_counter_pool_.add(tag_extracted_name));
+  }
+}
+
+// Called by makeCounter() with mutex_ held. The declaration is not annotated so that overrides,
+// which wrap the counters made here, do not need to name mutex_.
 Counter* AllocatorImpl::makeCounterInternal(StatName name, StatName tag_extracted_name,
-                                            const StatNameTagVector& stat_name_tags) {
+                                            const StatNameTagVector& stat_name_tags)
+    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+  if (num_counter_stripes_ > 0 && striped_counter_names_.contains(tag_extracted_name)) {
+    return new StripedCounterImpl(name, *this, tag_extracted_name, stat_name_tags,
+                                  num_counter_stripes_);
+  }
   return new CounterImpl(name, *this, tag_extracted_name, stat_name_tags);
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "envoy/stats/allocator.h"
@@ -8,7 +10,9 @@
 
 #include "common/common/thread_synchronizer.h"
 #include "common/stats/metric_impl.h"
+#include "common/stats/symbol_table_impl.h"
 
+#include "absl/container/btree_set.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/strings/string_view.h"
 
@@ -19,7 +23,8 @@ class AllocatorImpl : public Allocator {
 public:
   static const char DecrementToZeroSyncPoint[];
 
-  AllocatorImpl(SymbolTable& symbol_table) : symbol_table_(symbol_table) {}
+  AllocatorImpl(SymbolTable& symbol_table)
+      : symbol_table_(symbol_table), striped_counter_pool_(symbol_table) {}
   ~AllocatorImpl() override;
 
   // Allocator
@@ -32,6 +37,11 @@ public:
                                        const StatNameTagVector& stat_name_tags) override;
   SymbolTable& symbolTable() override { return symbol_table_; }
   const SymbolTable& constSymbolTable() const override { return symbol_table_; }
+  void setStripedCounters(const std::vector<std::string>& tag_extracted_names,
+                          uint32_t num_stripes) override;
+  std::vector<CounterSharedPtr> countersMatching(const StatNameFilter& filter) override;
+  std::vector<GaugeSharedPtr> gaugesMatching(const StatNameFilter& filter) override;
+  std::vector<TextReadoutSharedPtr> textReadoutsMatching(const StatNameFilter& filter) override;
 
 #ifndef ENVOY_CONFIG_COVERAGE
   void debugPrint();
@@ -54,10 +64,27 @@ protected:
 private:
   template <class BaseClass> friend class StatsSharedImpl;
   friend class CounterImpl;
+  friend class StripedCounterImpl;
   friend class GaugeImpl;
   friend class TextReadoutImpl;
   friend class NotifyingAllocatorImpl;
 
+  // The stats of one type, ordered by name so that the stats whose names share a prefix are
+  // adjacent. The stats are part of the key as a symbolic and a dynamic stat name may be the same
+  // string.
+  template <class StatType> using NameIndex = absl::btree_set<std::pair<std::string, StatType*>>;
+
+  void buildNameIndexLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  template <class StatType>
+  void addToNameIndexLockHeld(NameIndex<StatType>& index, StatType* stat)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  template <class StatType>
+  void removeFromNameIndexLockHeld(NameIndex<StatType>& index, StatType* stat)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  template <class StatType>
+  std::vector<RefcountPtr<StatType>> matching(NameIndex<StatType>& index,
+                                              const StatNameFilter& filter);
+
   void removeCounterFromSetLockHeld(Counter* counter) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
   void removeGaugeFromSetLockHeld(Gauge* gauge) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
   void removeTextReadoutFromSetLockHeld(Counter* counter) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
@@ -66,8 +93,21 @@ private:
   StatSet<Gauge> gauges_ ABSL_GUARDED_BY(mutex_);
   StatSet<TextReadout> text_readouts_ ABSL_GUARDED_BY(mutex_);
 
+  // Only maintained once name_index_built_ is set, by the first call to one of the *Matching()
+  // methods, so that the memory for the names is only used when stats are looked up by name.
+  bool name_index_built_ ABSL_GUARDED_BY(mutex_){false};
+  NameIndex<Counter> counter_index_ ABSL_GUARDED_BY(mutex_);
+  NameIndex<Gauge> gauge_index_ ABSL_GUARDED_BY(mutex_);
+  NameIndex<TextReadout> text_readout_index_ ABSL_GUARDED_BY(mutex_);
+
   SymbolTable& symbol_table_;
 
+  // The tag extracted names of the counters created as StripedCounterImpl, and their number of
+  // stripes, which is a power of 2.
+  StatNamePool striped_counter_pool_ ABSL_GUARDED_BY(mutex_);
+  StatNameHashSet striped_counter_names_ ABSL_GUARDED_BY(mutex_);
+  uint32_t num_counter_stripes_ ABSL_GUARDED_BY(mutex_){0};
+
   // A mutex is needed here to protect both the stats_ object from both
   // alloc() and free() operations. Although alloc() operations are called under existing locking,
   // free() operations are made from the destructors of the individual stat objects, which are not
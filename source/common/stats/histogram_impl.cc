@@ -12,7 +12,28 @@ namespace Stats {
 
 namespace {
 const ConstSupportedBuckets default_buckets{};
-}
+
+constexpr uint64_t PowersOf10[] = {1ULL,
+                                   10ULL,
+                                   100ULL,
+                                   1000ULL,
+                                   10000ULL,
+                                   100000ULL,
+                                   1000000ULL,
+                                   10000000ULL,
+                                   100000000ULL,
+                                   1000000000ULL,
+                                   10000000000ULL,
+                                   100000000000ULL,
+                                   1000000000000ULL,
+                                   10000000000000ULL,
+                                   100000000000000ULL,
+                                   1000000000000000ULL,
+                                   10000000000000000ULL,
+                                   100000000000000000ULL,
+                                   1000000000000000000ULL,
+                                   10000000000000000000ULL};
+} // namespace
 
 HistogramStatisticsImpl::HistogramStatisticsImpl()
     : supported_buckets_(default_buckets), computed_quantiles_(supportedQuantiles().size(), 0.0) {}
@@ -81,6 +102,77 @@ void HistogramStatisticsImpl::refresh(const histogram_t* new_histogram_ptr) {
   }
 }
 
+void LogLinearHistogram::recordValue(uint64_t value) {
+  if (value == 0) {
+    ++zero_count_;
+    return;
+  }
+  // floor(log10(value)), from floor(log2(value)) * log10(2) which is at most one below it.
+  uint32_t exponent = ((63 - __builtin_clzll(value)) * 1233) >> 12;
+  if (exponent + 1 < NumDecades && value >= PowersOf10[exponent + 1]) {
+    ++exponent;
+  }
+  // The two most significant digits of the value, as circllhist buckets values below 10 as 1.0
+  // to 9.0.
+  const uint64_t digits = exponent == 0 ? value * 10 : value / PowersOf10[exponent - 1];
+  ++decade(exponent)[digits - 10];
+}
+
+LogLinearHistogram::Decade& LogLinearHistogram::decade(uint32_t index) {
+  std::unique_ptr<Decade>& decade = decades_[index];
+  if (decade == nullptr) {
+    decade = std::make_unique<Decade>();
+    decade->fill(0);
+  }
+  used_decades_ |= 1 << index;
+  return *decade;
+}
+
+void LogLinearHistogram::merge(LogLinearHistogram& source) {
+  zero_count_ += source.zero_count_;
+  source.zero_count_ = 0;
+  for (uint32_t used = source.used_decades_; used != 0; used &= used - 1) {
+    const uint32_t index = __builtin_ctz(used);
+    Decade& source_decade = *source.decades_[index];
+    Decade& target_decade = decade(index);
+    // These loops are simple enough for the compiler to vectorize.
+    for (uint32_t i = 0; i < BucketsPerDecade; ++i) {
+      target_decade[i] += source_decade[i];
+    }
+    source_decade.fill(0);
+  }
+  source.used_decades_ = 0;
+}
+
+void LogLinearHistogram::moveTo(histogram_t* target) {
+  if (zero_count_ > 0) {
+    hist_insert_intscale(target, 0, 0, zero_count_);
+    zero_count_ = 0;
+  }
+  for (uint32_t used = used_decades_; used != 0; used &= used - 1) {
+    const uint32_t index = __builtin_ctz(used);
+    Decade& decade = *decades_[index];
+    for (uint32_t i = 0; i < BucketsPerDecade; ++i) {
+      if (decade[i] > 0) {
+        // The bucket with digits d in decade n counts values in [d * 10^(n-1), (d+1) * 10^(n-1)).
+        hist_insert_intscale(target, i + 10, static_cast<int>(index) - 1, decade[i]);
+        decade[i] = 0;
+      }
+    }
+  }
+  used_decades_ = 0;
+}
+
+uint64_t LogLinearHistogram::sampleCount() const {
+  uint64_t count = zero_count_;
+  for (uint32_t used = used_decades_; used != 0; used &= used - 1) {
+    for (uint64_t bucket_count : *decades_[__builtin_ctz(used)]) {
+      count += bucket_count;
+    }
+  }
+  return count;
+}
+
 HistogramSettingsImpl::HistogramSettingsImpl(const envoy::config::metrics::v3::StatsConfig& config)
     : configs_([&config]() {
         std::vector<Config> configs;
@@ -91,7 +183,8 @@ HistogramSettingsImpl::HistogramSettingsImpl(const envoy::config::metrics::v3::S
         }
 
         return configs;
-      }()) {}
+      }()),
+      dense_thread_local_histograms_(config.dense_thread_local_histograms()) {}
 
 const ConstSupportedBuckets& HistogramSettingsImpl::buckets(absl::string_view stat_name) const {
   for (const auto& config : configs_) {
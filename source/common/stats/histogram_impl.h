@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <memory>
 #include <string>
 
 #include "envoy/config/metrics/v3/stats.pb.h"
@@ -24,12 +26,14 @@ public:
 
   // HistogramSettings
   const ConstSupportedBuckets& buckets(absl::string_view stat_name) const override;
+  bool denseThreadLocalHistograms() const override { return dense_thread_local_histograms_; }
 
   static ConstSupportedBuckets& defaultBuckets();
 
 private:
   using Config = std::pair<Matchers::StringMatcherImpl, ConstSupportedBuckets>;
   const std::vector<Config> configs_{};
+  const bool dense_thread_local_histograms_{false};
 };
 
 /**
@@ -66,8 +70,51 @@ private:
   ConstSupportedBuckets& supported_buckets_;
   std::vector<double> computed_quantiles_;
   std::vector<uint64_t> computed_buckets_;
-  uint64_t sample_count_;
-  double sample_sum_;
+  uint64_t sample_count_{0};
+  double sample_sum_{0};
+};
+
+/**
+ * Histogram with the log-linear buckets of circllhist, whose counts are held in dense arrays
+ * rather than in a sorted array of buckets. The bucket of a value is given by its two most
+ * significant decimal digits and its decimal exponent, so there are 90 buckets per decade. The
+ * counts of a decade are allocated when a value in it is first recorded. Recording a value then
+ * increments an array element, and merging histograms adds arrays.
+ *
+ * This is not thread safe. ThreadLocalHistogramImpl records into one of these while the other one
+ * is merged.
+ */
+class LogLinearHistogram : NonCopyable {
+public:
+  void recordValue(uint64_t value);
+
+  /**
+   * Adds the counts of source to this histogram, and clears source.
+   */
+  void merge(LogLinearHistogram& source);
+
+  /**
+   * Inserts the counts of this histogram into target, and clears this histogram.
+   */
+  void moveTo(histogram_t* target);
+
+  /**
+   * @return the number of values recorded since this histogram was last cleared.
+   */
+  uint64_t sampleCount() const;
+
+private:
+  static constexpr uint32_t BucketsPerDecade = 90;
+  // Values from 1 to 9 are in the first decade and the largest 64 bit values in the 20th one.
+  static constexpr uint32_t NumDecades = 20;
+  using Decade = std::array<uint64_t, BucketsPerDecade>;
+
+  Decade& decade(uint32_t index);
+
+  uint64_t zero_count_{0};
+  // Bit i is set if decades_[i] may have non-zero counts, so that only those are merged.
+  uint32_t used_decades_{0};
+  std::array<std::unique_ptr<Decade>, NumDecades> decades_;
 };
 
 class HistogramImplHelper : public MetricImpl<Histogram> {
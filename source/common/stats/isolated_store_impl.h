@@ -187,6 +187,15 @@ public:
   std::vector<TextReadoutSharedPtr> textReadouts() const override {
     return text_readouts_.toVector();
   }
+  std::vector<CounterSharedPtr> countersMatching(const StatNameFilter& filter) override {
+    return alloc_.countersMatching(filter);
+  }
+  std::vector<GaugeSharedPtr> gaugesMatching(const StatNameFilter& filter) override {
+    return alloc_.gaugesMatching(filter);
+  }
+  std::vector<TextReadoutSharedPtr> textReadoutsMatching(const StatNameFilter& filter) override {
+    return alloc_.textReadoutsMatching(filter);
+  }
 
   Counter& counterFromString(const std::string& name) override {
     StatNameManagedStorage storage(name, symbolTable());
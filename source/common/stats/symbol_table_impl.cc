@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <tuple>
 #include <memory>
 #include <vector>
 
@@ -157,11 +158,8 @@ void SymbolTableImpl::Encoding::decodeTokens(
 std::vector<absl::string_view> SymbolTableImpl::decodeStrings(const SymbolTable::Storage array,
                                                               size_t size) const {
   std::vector<absl::string_view> strings;
-  Thread::LockGuard lock(lock_);
   Encoding::decodeTokens(
-      array, size,
-      [this, &strings](Symbol symbol)
-          ABSL_NO_THREAD_SAFETY_ANALYSIS { strings.push_back(fromSymbol(symbol)); },
+      array, size, [this, &strings](Symbol symbol) { strings.push_back(fromSymbol(symbol)); },
       [&strings](absl::string_view str) { strings.push_back(str); });
   return strings;
 }
@@ -182,9 +180,56 @@ void SymbolTableImpl::Encoding::appendToMemBlock(StatName stat_name,
   }
 }
 
-SymbolTableImpl::SymbolTableImpl()
-    // Have to be explicitly initialized, if we want to use the ABSL_GUARDED_BY macro.
-    : next_symbol_(FirstValidSymbol), monotonic_counter_(FirstValidSymbol) {}
+/**
+ * Holds the lock of one encode shard at a time while the tokens of a name are encoded or freed, so
+ * that consecutive tokens in the same shard, which is every token when there is a single shard,
+ * share one acquisition. With more than one shard, the symbol lock is also taken while allocating
+ * and releasing symbols, and is dropped along with the shard lock to preserve the lock order.
+ */
+class SymbolTableImpl::ShardLocker {
+public:
+  explicit ShardLocker(const SymbolTableImpl& table) : table_(table) {}
+  ~ShardLocker() { unlock(); }
+
+  EncodeShard& lockShard(absl::string_view token) ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    EncodeShard& shard = table_.encodeShard(token);
+    if (&shard != shard_) {
+      unlock();
+      shard.lock_.lock();
+      shard_ = &shard;
+    }
+    return shard;
+  }
+
+  void lockSymbols() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    ASSERT(shard_ != nullptr);
+    if (!symbols_locked_ && table_.encode_shard_bits_ != 0) {
+      table_.symbol_lock_.lock();
+      symbols_locked_ = true;
+    }
+  }
+
+private:
+  void unlock() ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    if (symbols_locked_) {
+      table_.symbol_lock_.unlock();
+      symbols_locked_ = false;
+    }
+    if (shard_ != nullptr) {
+      shard_->lock_.unlock();
+      shard_ = nullptr;
+    }
+  }
+
+  const SymbolTableImpl& table_;
+  EncodeShard* shard_{};
+  bool symbols_locked_{};
+};
+
+SymbolTableImpl::SymbolTableImpl(bool concurrent)
+    : encode_shard_bits_(concurrent ? ConcurrentEncodeShardBits : 0),
+      encode_shards_(std::make_unique<EncodeShard[]>(numEncodeShards())),
+      monotonic_counter_(FirstValidSymbol) {}
 
 SymbolTableImpl::~SymbolTableImpl() {
   // To avoid leaks into the symbol table, we expect all StatNames to be freed.
@@ -202,34 +247,43 @@ void SymbolTableImpl::addTokensToEncoding(const absl::string_view name, Encoding
     return;
   }
 
-  // We want to hold the lock for the minimum amount of time, so we do the
-  // string-splitting and prepare a temp vector of Symbol first.
   const std::vector<absl::string_view> tokens = absl::StrSplit(name, '.');
   std::vector<Symbol> symbols;
   symbols.reserve(tokens.size());
 
-  // Now take the lock and populate the Symbol objects, which involves bumping
-  // ref-counts in this.
-  {
-    Thread::LockGuard lock(lock_);
-    recent_lookups_.lookup(name);
-    for (auto& token : tokens) {
-      // TODO(jmarantz): consider using StatNameDynamicStorage for tokens with
-      // length below some threshold, say 4 bytes. It might be preferable not to
-      // reserve Symbols for every 3 digit number found (for example) in ipv4
-      // addresses.
-      symbols.push_back(toSymbol(token));
-    }
+  // Populate the Symbol objects, which involves bumping ref-counts in this. Each
+  // token only locks its own shard of the encode map.
+  recordLookup(name);
+  ShardLocker locker(*this);
+  for (auto& token : tokens) {
+    // TODO(jmarantz): consider using StatNameDynamicStorage for tokens with
+    // length below some threshold, say 4 bytes. It might be preferable not to
+    // reserve Symbols for every 3 digit number found (for example) in ipv4
+    // addresses.
+    symbols.push_back(toSymbol(token, locker));
   }
 
   // Now efficiently encode the array of 32-bit symbols into a uint8_t array.
   encoding.addSymbols(symbols);
 }
 
+void SymbolTableImpl::recordLookup(absl::string_view name) {
+  if (!track_recent_lookups_.load(std::memory_order_relaxed)) {
+    untracked_lookups_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  Thread::LockGuard lock(recent_lookups_lock_);
+  recent_lookups_.lookup(name);
+}
+
 uint64_t SymbolTableImpl::numSymbols() const {
-  Thread::LockGuard lock(lock_);
-  ASSERT(encode_map_.size() == decode_map_.size());
-  return encode_map_.size();
+  uint64_t num_symbols = 0;
+  for (uint32_t i = 0; i < numEncodeShards(); ++i) {
+    EncodeShard& shard = encode_shards_[i];
+    Thread::LockGuard lock(shard.lock_);
+    num_symbols += shard.encode_map_.size();
+  }
+  return num_symbols;
 }
 
 std::string SymbolTableImpl::toString(const StatName& stat_name) const {
@@ -240,16 +294,17 @@ void SymbolTableImpl::incRefCount(const StatName& stat_name) {
   // Before taking the lock, decode the array of symbols from the SymbolTable::Storage.
   const SymbolVec symbols = Encoding::decodeSymbols(stat_name.data(), stat_name.dataSize());
 
-  Thread::LockGuard lock(lock_);
+  ShardLocker locker(*this);
   for (Symbol symbol : symbols) {
-    auto decode_search = decode_map_.find(symbol);
-
-    ASSERT(decode_search != decode_map_.end(),
+    const InlineString* token = symbol_strings_.get(symbol);
+    ASSERT(token != nullptr,
            "Please see "
            "https://github.com/envoyproxy/envoy/blob/main/source/docs/stats.md#"
            "debugging-symbol-table-assertions");
-    auto encode_search = encode_map_.find(decode_search->second->toStringView());
-    ASSERT(encode_search != encode_map_.end(),
+
+    EncodeShard& shard = locker.lockShard(token->toStringView());
+    auto encode_search = shard.encode_map_.find(token->toStringView());
+    ASSERT(encode_search != shard.encode_map_.end(),
            "Please see "
            "https://github.com/envoyproxy/envoy/blob/main/source/docs/stats.md#"
            "debugging-symbol-table-assertions");
@@ -262,24 +317,26 @@ void SymbolTableImpl::free(const StatName& stat_name) {
   // Before taking the lock, decode the array of symbols from the SymbolTable::Storage.
   const SymbolVec symbols = Encoding::decodeSymbols(stat_name.data(), stat_name.dataSize());
 
-  Thread::LockGuard lock(lock_);
+  ShardLocker locker(*this);
   for (Symbol symbol : symbols) {
-    auto decode_search = decode_map_.find(symbol);
-    ASSERT(decode_search != decode_map_.end());
+    const InlineString* token = symbol_strings_.get(symbol);
+    ASSERT(token != nullptr);
 
-    auto encode_search = encode_map_.find(decode_search->second->toStringView());
-    ASSERT(encode_search != encode_map_.end());
+    EncodeShard& shard = locker.lockShard(token->toStringView());
+    auto encode_search = shard.encode_map_.find(token->toStringView());
+    ASSERT(encode_search != shard.encode_map_.end());
 
     // If that was the last remaining client usage of the symbol, erase the
-    // current mappings and add the now-unused symbol to the reuse pool.
+    // current mappings and add the now-unused symbol to the reuse pool. This
+    // is done with the shard lock held, so that the token cannot be encoded
+    // again until its symbol is released.
     //
     // The "if (--EXPR.ref_count_)" pattern speeds up BM_CreateRace by 20% in
     // symbol_table_speed_test.cc, relative to breaking out the decrement into a
     // separate step, likely due to the non-trivial dereferences in EXPR.
     if (--encode_search->second.ref_count_ == 0) {
-      decode_map_.erase(decode_search);
-      encode_map_.erase(encode_search);
-      pool_.push(symbol);
+      shard.encode_map_.erase(encode_search);
+      releaseSymbol(symbol, locker);
     }
   }
 }
@@ -288,15 +345,16 @@ uint64_t SymbolTableImpl::getRecentLookups(const RecentLookupsFn& iter) const {
   uint64_t total = 0;
   absl::flat_hash_map<std::string, uint64_t> name_count_map;
 
-  // We don't want to hold lock_ while calling the iterator, but we need it to
-  // access recent_lookups_, so we buffer in name_count_map.
+  // We don't want to hold recent_lookups_lock_ while calling the iterator, but we
+  // need it to access recent_lookups_, so we buffer in name_count_map.
   {
-    Thread::LockGuard lock(lock_);
+    Thread::LockGuard lock(recent_lookups_lock_);
     recent_lookups_.forEach(
         [&name_count_map](absl::string_view str, uint64_t count)
             ABSL_NO_THREAD_SAFETY_ANALYSIS { name_count_map[std::string(str)] += count; });
     total += recent_lookups_.total();
   }
+  total += untracked_lookups_.load(std::memory_order_relaxed);
 
   // Now we have the collated name-count map data: we need to vectorize and
   // sort. We define the pair with the count first as std::pair::operator<
@@ -341,17 +399,19 @@ DynamicSpans SymbolTableImpl::getDynamicSpans(StatName stat_name) const {
 }
 
 void SymbolTableImpl::setRecentLookupCapacity(uint64_t capacity) {
-  Thread::LockGuard lock(lock_);
+  Thread::LockGuard lock(recent_lookups_lock_);
   recent_lookups_.setCapacity(capacity);
+  track_recent_lookups_ = capacity > 0;
 }
 
 void SymbolTableImpl::clearRecentLookups() {
-  Thread::LockGuard lock(lock_);
+  Thread::LockGuard lock(recent_lookups_lock_);
   recent_lookups_.clear();
+  untracked_lookups_ = 0;
 }
 
 uint64_t SymbolTableImpl::recentLookupCapacity() const {
-  Thread::LockGuard lock(lock_);
+  Thread::LockGuard lock(recent_lookups_lock_);
   return recent_lookups_.capacity();
 }
 
@@ -361,48 +421,103 @@ StatNameSetPtr SymbolTableImpl::makeSet(absl::string_view name) {
   return stat_name_set;
 }
 
-Symbol SymbolTableImpl::toSymbol(absl::string_view sv) {
-  Symbol result;
-  auto encode_find = encode_map_.find(sv);
-  // If the string segment doesn't already exist,
-  if (encode_find == encode_map_.end()) {
-    // We create the actual string, place it in the decode_map_, and then insert
-    // a string_view pointing to it in the encode_map_. This allows us to only
-    // store the string once. We use unique_ptr so copies are not made as
-    // flat_hash_map moves values around.
-    InlineStringPtr str = InlineString::create(sv);
-    auto encode_insert = encode_map_.insert({str->toStringView(), SharedSymbol(next_symbol_)});
-    ASSERT(encode_insert.second);
-    auto decode_insert = decode_map_.insert({next_symbol_, std::move(str)});
-    ASSERT(decode_insert.second);
-
-    result = next_symbol_;
-    newSymbol();
-  } else {
-    // If the insertion didn't take place, return the actual value at that location and up the
-    // refcount at that location
-    result = encode_find->second.symbol_;
+Symbol SymbolTableImpl::toSymbol(absl::string_view sv, ShardLocker& locker) {
+  EncodeShard& shard = locker.lockShard(sv);
+  auto encode_find = shard.encode_map_.find(sv);
+  if (encode_find != shard.encode_map_.end()) {
+    // If the string segment already exists, return the actual value at that location and up the
+    // refcount at that location.
     ++(encode_find->second.ref_count_);
+    return encode_find->second.symbol_;
   }
-  return result;
+
+  // Otherwise allocate a symbol and store the actual string as its string, then insert a
+  // string_view pointing to it in the encode map. This allows us to only store the string once.
+  const Symbol symbol = newSymbol(sv, locker);
+  auto encode_insert =
+      shard.encode_map_.insert({symbol_strings_.get(symbol)->toStringView(), SharedSymbol(symbol)});
+  ASSERT(encode_insert.second);
+  return symbol;
 }
 
-absl::string_view SymbolTableImpl::fromSymbol(const Symbol symbol) const
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
-  auto search = decode_map_.find(symbol);
-  RELEASE_ASSERT(search != decode_map_.end(), "no such symbol");
-  return search->second->toStringView();
+absl::string_view SymbolTableImpl::fromSymbol(const Symbol symbol) const {
+  const InlineString* token = symbol_strings_.get(symbol);
+  RELEASE_ASSERT(token != nullptr, "no such symbol");
+  return token->toStringView();
 }
 
-void SymbolTableImpl::newSymbol() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+Symbol SymbolTableImpl::newSymbol(absl::string_view token, ShardLocker& locker) {
+  locker.lockSymbols();
+  Symbol symbol;
   if (pool_.empty()) {
-    next_symbol_ = ++monotonic_counter_;
+    symbol = monotonic_counter_++;
+    // This should catch integer overflow for the new symbol.
+    ASSERT(monotonic_counter_ != 0);
   } else {
-    next_symbol_ = pool_.top();
+    symbol = pool_.top();
     pool_.pop();
   }
-  // This should catch integer overflow for the new symbol.
-  ASSERT(monotonic_counter_ != 0);
+  symbol_strings_.set(symbol, InlineString::create(token));
+  return symbol;
+}
+
+void SymbolTableImpl::releaseSymbol(Symbol symbol, ShardLocker& locker) {
+  locker.lockSymbols();
+  symbol_strings_.release(symbol);
+  pool_.push(symbol);
+}
+
+SymbolTableImpl::SymbolStrings::~SymbolStrings() {
+  for (uint32_t segment = 0; segment < NumSegments; ++segment) {
+    Segment* strings = segments_[segment].load(std::memory_order_relaxed);
+    if (strings == nullptr) {
+      continue;
+    }
+    for (uint64_t i = 0; i < segmentSize(segment); ++i) {
+      delete strings[i].load(std::memory_order_relaxed);
+    }
+    delete[] strings;
+  }
+}
+
+std::pair<uint32_t, uint64_t> SymbolTableImpl::SymbolStrings::locate(Symbol symbol) {
+  // Segment n holds the symbols from 2^(n+FirstSegmentBits) - 2^FirstSegmentBits, so offsetting the
+  // symbol by the size of the first segment makes its segment the position of its top bit.
+  const uint64_t offset_symbol = uint64_t(symbol) + segmentSize(0);
+  const uint32_t segment = (63 - __builtin_clzll(offset_symbol)) - FirstSegmentBits;
+  return {segment, offset_symbol - segmentSize(segment)};
+}
+
+const InlineString* SymbolTableImpl::SymbolStrings::get(Symbol symbol) const {
+  const auto [segment, offset] = locate(symbol);
+  const Segment* strings = segments_[segment].load(std::memory_order_acquire);
+  if (strings == nullptr) {
+    return nullptr;
+  }
+  return strings[offset].load(std::memory_order_acquire);
+}
+
+void SymbolTableImpl::SymbolStrings::set(Symbol symbol, InlineStringPtr str) {
+  const auto [segment, offset] = locate(symbol);
+  Segment* strings = segments_[segment].load(std::memory_order_relaxed);
+  if (strings == nullptr) {
+    const uint64_t size = segmentSize(segment);
+    strings = new Segment[size];
+    for (uint64_t i = 0; i < size; ++i) {
+      strings[i].store(nullptr, std::memory_order_relaxed);
+    }
+    segments_[segment].store(strings, std::memory_order_release);
+  }
+  ASSERT(strings[offset].load(std::memory_order_relaxed) == nullptr);
+  strings[offset].store(str.release(), std::memory_order_release);
+}
+
+InlineStringPtr SymbolTableImpl::SymbolStrings::release(Symbol symbol) {
+  const auto [segment, offset] = locate(symbol);
+  Segment* strings = segments_[segment].load(std::memory_order_relaxed);
+  ASSERT(strings != nullptr);
+  return InlineStringPtr(
+      const_cast<InlineString*>(strings[offset].exchange(nullptr, std::memory_order_relaxed)));
 }
 
 bool SymbolTableImpl::lessThan(const StatName& a, const StatName& b) const {
@@ -424,16 +539,17 @@ bool SymbolTableImpl::lessThan(const StatName& a, const StatName& b) const {
 
 #ifndef ENVOY_CONFIG_COVERAGE
 void SymbolTableImpl::debugPrint() const {
-  Thread::LockGuard lock(lock_);
-  std::vector<Symbol> symbols;
-  for (const auto& p : decode_map_) {
-    symbols.push_back(p.first);
+  std::vector<std::tuple<Symbol, std::string, uint32_t>> symbols;
+  for (uint32_t i = 0; i < numEncodeShards(); ++i) {
+    EncodeShard& shard = encode_shards_[i];
+    Thread::LockGuard lock(shard.lock_);
+    for (const auto& p : shard.encode_map_) {
+      symbols.emplace_back(p.second.symbol_, std::string(p.first), p.second.ref_count_);
+    }
   }
   std::sort(symbols.begin(), symbols.end());
-  for (Symbol symbol : symbols) {
-    const InlineString& token = *decode_map_.find(symbol)->second;
-    const SharedSymbol& shared_symbol = encode_map_.find(token.toStringView())->second;
-    ENVOY_LOG_MISC(info, "{}: '{}' ({})", symbol, token.toStringView(), shared_symbol.ref_count_);
+  for (const auto& [symbol, token, ref_count] : symbols) {
+    ENVOY_LOG_MISC(info, "{}: '{}' ({})", symbol, token, ref_count);
   }
 }
 #endif
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstring>
 #include <memory>
 #include <stack>
@@ -173,7 +175,13 @@ public:
     MemBlockBuilder<uint8_t> mem_block_;
   };
 
-  SymbolTableImpl();
+  /**
+   * @param concurrent whether to shard the map from tokens to symbols, so that threads encoding
+   *        and freeing names concurrently mostly do not contend on a single lock. This costs a
+   *        lock per token, rather than per name, so it is only worth it when stat names are
+   *        created and freed from many threads at once.
+   */
+  explicit SymbolTableImpl(bool concurrent = false);
   ~SymbolTableImpl() override;
 
   // SymbolTable
@@ -210,8 +218,65 @@ private:
     uint32_t ref_count_;
   };
 
-  // This must be held during both encode() and free().
-  mutable Thread::MutexBasicLockable lock_;
+  /**
+   * The strings of the symbols, indexed by symbol, which are read without taking any lock. The
+   * strings are held in segments of doubling sizes, which are never moved nor freed before the
+   * table is destroyed. A symbol's string is only written while no StatName references the
+   * symbol, so a reader decoding a live StatName cannot race with a writer.
+   */
+  class SymbolStrings {
+  public:
+    ~SymbolStrings();
+
+    /**
+     * @return the string of symbol, or nullptr if the symbol is not allocated.
+     */
+    const InlineString* get(Symbol symbol) const;
+
+    /**
+     * Sets the string of a symbol which has none. Writers must be serialized by the caller.
+     */
+    void set(Symbol symbol, InlineStringPtr str);
+
+    /**
+     * Removes the string of a symbol. Writers must be serialized by the caller.
+     */
+    InlineStringPtr release(Symbol symbol);
+
+  private:
+    using Segment = std::atomic<const InlineString*>;
+
+    // The first segment holds 2^FirstSegmentBits symbols, and there are enough segments to hold
+    // every 32-bit symbol.
+    static constexpr uint32_t FirstSegmentBits = 10;
+    static constexpr uint32_t NumSegments = 33 - FirstSegmentBits;
+
+    /**
+     * @return the segment holding symbol, and the offset of the symbol in the segment.
+     */
+    static std::pair<uint32_t, uint64_t> locate(Symbol symbol);
+    static uint64_t segmentSize(uint32_t segment) {
+      return uint64_t(1) << (segment + FirstSegmentBits);
+    }
+
+    std::array<std::atomic<Segment*>, NumSegments> segments_{};
+  };
+
+  /**
+   * A shard of the map from strings to symbols. Encoding a token only locks the shard of the
+   * token. Shards are aligned to cache lines so that their locks do not share a line.
+   */
+  struct alignas(64) EncodeShard {
+    Thread::MutexBasicLockable lock_;
+    // The encode map stores both the symbol and the ref count of that symbol. Using
+    // absl::string_view lets us only store the complete string once, in symbol_strings_.
+    // Guarded by lock_, which is held through a ShardLocker.
+    absl::flat_hash_map<absl::string_view, SharedSymbol> encode_map_;
+  };
+  // The number of shards of a concurrent symbol table is 2^ConcurrentEncodeShardBits.
+  static constexpr uint32_t ConcurrentEncodeShardBits = 4;
+
+  class ShardLocker;
 
   /**
    * Decodes a uint8_t array into an array of period-delimited strings. Note
@@ -232,22 +297,43 @@ private:
    * Convenience function for encode(), symbolizing one string segment at a time.
    *
    * @param sv the individual string to be encoded as a symbol.
+   * @param locker holds the locks of the table.
    * @return Symbol the encoded string.
    */
-  Symbol toSymbol(absl::string_view sv) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  Symbol toSymbol(absl::string_view sv, ShardLocker& locker);
 
   /**
-   * Convenience function for decode(), decoding one symbol at a time.
+   * Convenience function for decode(), decoding one symbol at a time. This does not lock, and
+   * must only be called with symbols referenced by a live StatName.
    *
    * @param symbol the individual symbol to be decoded.
    * @return absl::string_view the decoded string.
    */
-  absl::string_view fromSymbol(Symbol symbol) const ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  absl::string_view fromSymbol(Symbol symbol) const;
 
   /**
-   * Stages a new symbol for use. To be called after a successful insertion.
+   * @return the shard of the encode map holding the token.
    */
-  void newSymbol();
+  EncodeShard& encodeShard(absl::string_view token) const {
+    if (encode_shard_bits_ == 0) {
+      return encode_shards_[0];
+    }
+    // The top bits of the hash are used, as the encode maps use the bottom ones.
+    return encode_shards_[absl::Hash<absl::string_view>{}(token) >> (64 - encode_shard_bits_)];
+  }
+  uint32_t numEncodeShards() const { return 1 << encode_shard_bits_; }
+
+  /**
+   * Allocates a symbol for a new token, and stores the token as its string. The symbols must be
+   * locked with locker.
+   */
+  Symbol newSymbol(absl::string_view token, ShardLocker& locker);
+
+  /**
+   * Frees the string of a symbol which is no longer referenced, and makes the symbol available
+   * for reuse. The symbols must be locked with locker.
+   */
+  void releaseSymbol(Symbol symbol, ShardLocker& locker);
 
   /**
    * Tokenizes name, finds or allocates symbols for each token, and adds them
@@ -258,31 +344,44 @@ private:
    */
   void addTokensToEncoding(absl::string_view name, Encoding& encoding);
 
+  /**
+   * Records the lookup of name for the recent lookups admin endpoint.
+   */
+  void recordLookup(absl::string_view name);
+
   Symbol monotonicCounter() {
-    Thread::LockGuard lock(lock_);
+    Thread::LockGuard shard_lock(encode_shards_[0].lock_);
+    Thread::LockGuard lock(symbol_lock_);
     return monotonic_counter_;
   }
 
-  // Stores the symbol to be used at next insertion. This should exist ahead of insertion time so
-  // that if insertion succeeds, the value written is the correct one.
-  Symbol next_symbol_ ABSL_GUARDED_BY(lock_);
+  // Shards of the map from tokens to symbols. A shard lock is held while the ref count of a symbol
+  // in the shard is changed, and while a symbol is added to or removed from the shard.
+  const uint32_t encode_shard_bits_;
+  const std::unique_ptr<EncodeShard[]> encode_shards_;
+
+  // The strings of the symbols, which are written while the symbols are locked.
+  SymbolStrings symbol_strings_;
+
+  // Held while allocating and releasing symbols, when there is more than one shard. This may be
+  // taken while holding a shard lock, but not the other way around. With a single shard, its lock
+  // serializes the allocation of symbols instead.
+  mutable Thread::MutexBasicLockable symbol_lock_;
 
   // If the free pool is exhausted, we monotonically increase this counter.
   Symbol monotonic_counter_;
 
-  // Bitmap implementation.
-  // The encode map stores both the symbol and the ref count of that symbol.
-  // Using absl::string_view lets us only store the complete string once, in the decode map.
-  using EncodeMap = absl::flat_hash_map<absl::string_view, SharedSymbol>;
-  using DecodeMap = absl::flat_hash_map<Symbol, InlineStringPtr>;
-  EncodeMap encode_map_ ABSL_GUARDED_BY(lock_);
-  DecodeMap decode_map_ ABSL_GUARDED_BY(lock_);
-
   // Free pool of symbols for re-use.
   // TODO(ambuc): There might be an optimization here relating to storing ranges of freed symbols
   // using an Envoy::IntervalSet.
-  std::stack<Symbol> pool_ ABSL_GUARDED_BY(lock_);
-  RecentLookups recent_lookups_ ABSL_GUARDED_BY(lock_);
+  std::stack<Symbol> pool_;
+
+  // Lookups are only recorded in recent_lookups_ while tracking is enabled, which is off by
+  // default, so that encoding does not take a table wide lock otherwise.
+  mutable Thread::MutexBasicLockable recent_lookups_lock_;
+  RecentLookups recent_lookups_ ABSL_GUARDED_BY(recent_lookups_lock_);
+  std::atomic<bool> track_recent_lookups_{false};
+  std::atomic<uint64_t> untracked_lookups_{0};
 };
 
 // Base class for holding the backing-storing for a StatName. The two derived
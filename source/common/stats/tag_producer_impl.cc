@@ -5,13 +5,16 @@
 #include "envoy/common/exception.h"
 #include "envoy/config/metrics/v3/stats.pb.h"
 
+#include "common/common/lock_guard.h"
 #include "common/common/utility.h"
 #include "common/stats/tag_extractor_impl.h"
 
 namespace Envoy {
 namespace Stats {
 
-TagProducerImpl::TagProducerImpl(const envoy::config::metrics::v3::StatsConfig& config) {
+TagProducerImpl::TagProducerImpl(const envoy::config::metrics::v3::StatsConfig& config,
+                                 uint32_t memo_capacity)
+    : memo_capacity_(memo_capacity) {
   // To check name conflict.
   reserveResources(config);
   absl::node_hash_set<std::string> names = addDefaultExtractors(config);
@@ -72,7 +75,6 @@ void TagProducerImpl::addExtractor(TagExtractorPtr extractor) {
 
 void TagProducerImpl::forEachExtractorMatching(
     absl::string_view stat_name, std::function<void(const TagExtractorPtr&)> f) const {
-  IntervalSetImpl<size_t> remove_characters;
   for (const TagExtractorPtr& tag_extractor : tag_extractors_without_prefix_) {
     f(tag_extractor);
   }
@@ -91,14 +93,34 @@ void TagProducerImpl::forEachExtractorMatching(
 std::string TagProducerImpl::produceTags(absl::string_view metric_name, TagVector& tags) const {
   // TODO(jmarantz): Skip the creation of string-based tags, creating a StatNameTagVector instead.
   tags.insert(tags.end(), default_tags_.begin(), default_tags_.end());
+  if (memo_capacity_ > 0) {
+    Thread::LockGuard lock(memo_mutex_);
+    const auto iter = memo_.find(metric_name);
+    if (iter != memo_.end()) {
+      tags.insert(tags.end(), iter->second.tags_.begin(), iter->second.tags_.end());
+      return iter->second.tag_extracted_name_;
+    }
+  }
+
+  const size_t first_extracted_tag = tags.size();
   IntervalSetImpl<size_t> remove_characters;
   TagExtractionContext tag_extraction_context(metric_name);
-  std::vector<absl::string_view> tokens;
   forEachExtractorMatching(metric_name, [&remove_characters, &tags, &tag_extraction_context](
                                             const TagExtractorPtr& tag_extractor) {
     tag_extractor->extractTag(tag_extraction_context, tags, remove_characters);
   });
-  return StringUtil::removeCharacters(metric_name, remove_characters);
+  std::string tag_extracted_name = StringUtil::removeCharacters(metric_name, remove_characters);
+
+  if (memo_capacity_ > 0) {
+    Thread::LockGuard lock(memo_mutex_);
+    if (memo_.size() >= memo_capacity_) {
+      memo_.clear();
+    }
+    memo_.emplace(std::string(metric_name),
+                  MemoizedTags{tag_extracted_name,
+                               TagVector(tags.begin() + first_extracted_tag, tags.end())});
+  }
+  return tag_extracted_name;
 }
 
 void TagProducerImpl::reserveResources(const envoy::config::metrics::v3::StatsConfig& config) {
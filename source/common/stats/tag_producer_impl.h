@@ -11,6 +11,8 @@
 #include "envoy/stats/tag_producer.h"
 
 #include "common/common/hash.h"
+#include "common/common/thread.h"
+#include "common/common/thread_annotations.h"
 #include "common/common/utility.h"
 #include "common/config/well_known_names.h"
 #include "common/protobuf/protobuf.h"
@@ -28,8 +30,20 @@ namespace Stats {
  */
 class TagProducerImpl : public TagProducer {
 public:
-  TagProducerImpl(const envoy::config::metrics::v3::StatsConfig& config);
-  TagProducerImpl() = default;
+  // The number of stat names whose extracted tags are remembered by default. Each entry holds
+  // the name, its tag-extracted name and its tags, so this bounds the memo to roughly 1MB.
+  static constexpr uint32_t DefaultMemoCapacity = 4096;
+
+  /**
+   * @param config the stats config supplying the tag specifiers.
+   * @param memo_capacity the number of stat names whose extraction results are remembered, so
+   *        that names which are re-created -- e.g. as clusters and listeners churn, or as each
+   *        worker instantiates its thread-local histograms -- do not run the extractors again.
+   *        The memo is cleared when full. Zero disables memoization.
+   */
+  TagProducerImpl(const envoy::config::metrics::v3::StatsConfig& config,
+                  uint32_t memo_capacity = DefaultMemoCapacity);
+  TagProducerImpl() : memo_capacity_(0) {}
 
   /**
    * Take a metric name and a vector then add proper tags into the vector and
@@ -42,6 +56,12 @@ public:
 private:
   friend class DefaultTagRegexTester;
 
+  // The result of running the extractors on a stat name, excluding default_tags_.
+  struct MemoizedTags {
+    std::string tag_extracted_name_;
+    TagVector tags_;
+  };
+
   /**
    * Adds a TagExtractor to the collection of tags, tracking prefixes to help make
    * produceTags run efficiently by trying only extractors that have a chance to match.
@@ -99,6 +119,12 @@ private:
   // implementation, may need make a copy of the prefix.
   absl::flat_hash_map<absl::string_view, std::vector<TagExtractorPtr>> tag_extractor_prefix_map_;
   TagVector default_tags_;
+
+  // produceTags() is called both on the main thread and, for thread-local histograms, on
+  // workers, so the memo is protected by its own mutex.
+  const uint32_t memo_capacity_;
+  mutable Thread::MutexBasicLockable memo_mutex_;
+  mutable absl::flat_hash_map<std::string, MemoizedTags> memo_ ABSL_GUARDED_BY(memo_mutex_);
 };
 
 } // namespace Stats
@@ -1,5 +1,6 @@
 #include "common/stats/thread_local_store.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <list>
@@ -158,6 +159,16 @@ std::vector<GaugeSharedPtr> ThreadLocalStoreImpl::gauges() const {
   return ret;
 }
 
+std::vector<GaugeSharedPtr> ThreadLocalStoreImpl::gaugesMatching(const StatNameFilter& filter) {
+  std::vector<GaugeSharedPtr> ret = alloc_.gaugesMatching(filter);
+  ret.erase(std::remove_if(ret.begin(), ret.end(),
+                           [](const GaugeSharedPtr& gauge) {
+                             return gauge->importMode() == Gauge::ImportMode::Uninitialized;
+                           }),
+            ret.end());
+  return ret;
+}
+
 std::vector<TextReadoutSharedPtr> ThreadLocalStoreImpl::textReadouts() const {
   // Handle de-dup due to overlapping scopes.
   std::vector<TextReadoutSharedPtr> ret;
@@ -617,9 +628,11 @@ Histogram& ThreadLocalStoreImpl::ScopeImpl::histogramFromStatNameWithTags(
       if (iter != parent_.histogram_set_.end()) {
         stat = RefcountPtr<ParentHistogramImpl>(*iter);
       } else {
-        stat = new ParentHistogramImpl(final_stat_name, unit, parent_,
-                                       tag_helper.tagExtractedName(), tag_helper.statNameTags(),
-                                       *buckets, parent_.next_histogram_id_++);
+        stat = new ParentHistogramImpl(
+            final_stat_name, unit, parent_, tag_helper.tagExtractedName(),
+            tag_helper.statNameTags(), *buckets,
+            parent_.histogram_settings_->denseThreadLocalHistograms(),
+            parent_.next_histogram_id_++);
         if (!parent_.shutting_down_) {
           parent_.histogram_set_.insert(stat.get());
         }
@@ -715,7 +728,8 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
 
   TlsHistogramSharedPtr hist_tls_ptr(
       new ThreadLocalHistogramImpl(parent.statName(), parent.unit(), tag_helper.tagExtractedName(),
-                                   tag_helper.statNameTags(), symbolTable()));
+                                   tag_helper.statNameTags(), symbolTable(),
+                                   parent.denseTlsHistograms()));
 
   parent.addTlsHistogram(hist_tls_ptr);
 
@@ -729,23 +743,34 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
 ThreadLocalHistogramImpl::ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit,
                                                    StatName tag_extracted_name,
                                                    const StatNameTagVector& stat_name_tags,
-                                                   SymbolTable& symbol_table)
+                                                   SymbolTable& symbol_table, bool dense)
     : HistogramImplHelper(name, tag_extracted_name, stat_name_tags, symbol_table), unit_(unit),
       current_active_(0), used_(false), created_thread_id_(std::this_thread::get_id()),
       symbol_table_(symbol_table) {
-  histograms_[0] = hist_alloc();
-  histograms_[1] = hist_alloc();
+  if (dense) {
+    log_linear_histograms_[0] = std::make_unique<LogLinearHistogram>();
+    log_linear_histograms_[1] = std::make_unique<LogLinearHistogram>();
+  } else {
+    histograms_[0] = hist_alloc();
+    histograms_[1] = hist_alloc();
+  }
 }
 
 ThreadLocalHistogramImpl::~ThreadLocalHistogramImpl() {
   MetricImpl::clear(symbol_table_);
-  hist_free(histograms_[0]);
-  hist_free(histograms_[1]);
+  if (histograms_[0] != nullptr) {
+    hist_free(histograms_[0]);
+    hist_free(histograms_[1]);
+  }
 }
 
 void ThreadLocalHistogramImpl::recordValue(uint64_t value) {
   ASSERT(std::this_thread::get_id() == created_thread_id_);
-  hist_insert_intscale(histograms_[current_active_], value, 0, 1);
+  if (log_linear_histograms_[0] != nullptr) {
+    log_linear_histograms_[current_active_]->recordValue(value);
+  } else {
+    hist_insert_intscale(histograms_[current_active_], value, 0, 1);
+  }
   used_ = true;
 }
 
@@ -755,14 +780,21 @@ void ThreadLocalHistogramImpl::merge(histogram_t* target) {
   hist_clear(*other_histogram);
 }
 
+void ThreadLocalHistogramImpl::merge(LogLinearHistogram& target) {
+  target.merge(*log_linear_histograms_[otherHistogramIndex()]);
+}
+
 ParentHistogramImpl::ParentHistogramImpl(StatName name, Histogram::Unit unit,
                                          ThreadLocalStoreImpl& thread_local_store,
                                          StatName tag_extracted_name,
                                          const StatNameTagVector& stat_name_tags,
-                                         ConstSupportedBuckets& supported_buckets, uint64_t id)
+                                         ConstSupportedBuckets& supported_buckets,
+                                         bool dense_tls_histograms, uint64_t id)
     : MetricImpl(name, tag_extracted_name, stat_name_tags, thread_local_store.symbolTable()),
       unit_(unit), thread_local_store_(thread_local_store), interval_histogram_(hist_alloc()),
       cumulative_histogram_(hist_alloc()),
+      interval_log_linear_(dense_tls_histograms ? std::make_unique<LogLinearHistogram>()
+                                                : nullptr),
       interval_statistics_(interval_histogram_, supported_buckets),
       cumulative_statistics_(cumulative_histogram_, supported_buckets), merged_(false), id_(id) {}
 
@@ -842,11 +874,22 @@ void ParentHistogramImpl::merge() {
     // then release the lock before we do the actual merge. However it is not a big deal
     // because the tls_histogram merge is not that expensive as it is a single histogram
     // merge and adding TLS histograms is rare.
-    for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
-      tls_histogram->merge(interval_histogram_);
+    if (interval_log_linear_ != nullptr) {
+      for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
+        tls_histogram->merge(*interval_log_linear_);
+      }
+    } else {
+      for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
+        tls_histogram->merge(interval_histogram_);
+      }
     }
     // Since TLS merge is done, we can release the lock here.
     lock.release();
+    if (interval_log_linear_ != nullptr) {
+      // The TLS histograms were merged by adding their arrays, so only the sum is inserted into
+      // the circllhist histogram from which statistics are computed.
+      interval_log_linear_->moveTo(interval_histogram_);
+    }
     hist_accumulate(cumulative_histogram_, &interval_histogram_, 1);
     cumulative_statistics_.refresh(cumulative_histogram_);
     interval_statistics_.refresh(interval_histogram_);
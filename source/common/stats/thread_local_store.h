@@ -35,10 +35,12 @@ namespace Stats {
 class ThreadLocalHistogramImpl : public HistogramImplHelper {
 public:
   ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit, StatName tag_extracted_name,
-                           const StatNameTagVector& stat_name_tags, SymbolTable& symbol_table);
+                           const StatNameTagVector& stat_name_tags, SymbolTable& symbol_table,
+                           bool dense);
   ~ThreadLocalHistogramImpl() override;
 
   void merge(histogram_t* target);
+  void merge(LogLinearHistogram& target);
 
   /**
    * Called in the beginning of merge process. Swaps the histogram used for collection so that we do
@@ -66,7 +68,10 @@ private:
   Histogram::Unit unit_;
   uint64_t otherHistogramIndex() const { return 1 - current_active_; }
   uint64_t current_active_;
-  histogram_t* histograms_[2];
+  // Values are recorded either into circllhist histograms, or into dense log-linear histograms,
+  // whose pointers are then null.
+  histogram_t* histograms_[2]{};
+  std::unique_ptr<LogLinearHistogram> log_linear_histograms_[2];
   std::atomic<bool> used_;
   std::thread::id created_thread_id_;
   SymbolTable& symbol_table_;
@@ -83,11 +88,17 @@ class ParentHistogramImpl : public MetricImpl<ParentHistogram> {
 public:
   ParentHistogramImpl(StatName name, Histogram::Unit unit, ThreadLocalStoreImpl& parent,
                       StatName tag_extracted_name, const StatNameTagVector& stat_name_tags,
-                      ConstSupportedBuckets& supported_buckets, uint64_t id);
+                      ConstSupportedBuckets& supported_buckets, bool dense_tls_histograms,
+                      uint64_t id);
   ~ParentHistogramImpl() override;
 
   void addTlsHistogram(const TlsHistogramSharedPtr& hist_ptr);
 
+  /**
+   * @return whether the TLS histograms of this histogram are LogLinearHistograms.
+   */
+  bool denseTlsHistograms() const { return interval_log_linear_ != nullptr; }
+
   // Stats::Histogram
   Histogram::Unit unit() const override;
   void recordValue(uint64_t value) override;
@@ -127,6 +138,8 @@ private:
   ThreadLocalStoreImpl& thread_local_store_;
   histogram_t* interval_histogram_;
   histogram_t* cumulative_histogram_;
+  // Set if the TLS histograms are dense, which are merged into this before interval_histogram_.
+  const std::unique_ptr<LogLinearHistogram> interval_log_linear_;
   HistogramStatisticsImpl interval_statistics_;
   HistogramStatisticsImpl cumulative_statistics_;
   mutable Thread::MutexBasicLockable merge_lock_;
@@ -243,6 +256,15 @@ public:
   std::vector<GaugeSharedPtr> gauges() const override;
   std::vector<TextReadoutSharedPtr> textReadouts() const override;
   std::vector<ParentHistogramSharedPtr> histograms() const override;
+  // These are answered by the allocator, so they also select the stats still referenced after their
+  // scope was deleted, which counters(), gauges() and textReadouts() leave out.
+  std::vector<CounterSharedPtr> countersMatching(const StatNameFilter& filter) override {
+    return alloc_.countersMatching(filter);
+  }
+  std::vector<GaugeSharedPtr> gaugesMatching(const StatNameFilter& filter) override;
+  std::vector<TextReadoutSharedPtr> textReadoutsMatching(const StatNameFilter& filter) override {
+    return alloc_.textReadoutsMatching(filter);
+  }
 
   // Stats::StoreRoot
   void addSink(Sink& sink) override { timer_sinks_.push_back(sink); }
@@ -251,6 +273,10 @@ public:
   }
   void setStatsMatcher(StatsMatcherPtr&& stats_matcher) override;
   void setHistogramSettings(HistogramSettingsConstPtr&& histogram_settings) override;
+  void setStripedCounters(const std::vector<std::string>& tag_extracted_names,
+                          uint32_t num_stripes) override {
+    alloc_.setStripedCounters(tag_extracted_names, num_stripes);
+  }
   void initializeThreading(Event::Dispatcher& main_thread_dispatcher,
                            ThreadLocal::Instance& tls) override;
   void shutdownThreading() override;
@@ -45,6 +45,8 @@ public:
       parent_.onUpstreamData(data, end_stream);
       return Network::FilterStatus::StopIteration;
     }
+    // The owner of the connection decides whether it needs to see the data.
+    bool needsData() const override { return false; }
     ActiveTcpClient& parent_;
   };
 
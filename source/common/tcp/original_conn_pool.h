@@ -89,6 +89,8 @@ protected:
       parent_.onUpstreamData(data, end_stream);
       return Network::FilterStatus::StopIteration;
     }
+    // The owner of the connection decides whether it needs to see the data.
+    bool needsData() const override { return false; }
 
     ActiveConn& parent_;
   };
@@ -29,6 +29,7 @@
 #include "common/network/upstream_server_name.h"
 #include "common/network/upstream_socket_options_filter_state.h"
 #include "common/router/metadatamatchcriteria_impl.h"
+#include "common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace TcpProxy {
@@ -262,7 +263,8 @@ void Filter::initialize(Network::ReadFilterCallbacks& callbacks, bool set_connec
         {config_->stats().downstream_cx_rx_bytes_total_,
          config_->stats().downstream_cx_rx_bytes_buffered_,
          config_->stats().downstream_cx_tx_bytes_total_,
-         config_->stats().downstream_cx_tx_bytes_buffered_, nullptr, nullptr});
+         config_->stats().downstream_cx_tx_bytes_buffered_, nullptr, nullptr,
+         &config_->stats().downstream_cx_rx_reads_total_});
   }
 }
 
@@ -677,6 +679,11 @@ void Filter::onUpstreamConnection() {
       });
     }
   }
+
+  if (upstream_ && Runtime::runtimeFeatureEnabled("envoy.reloadable_features.tcp_proxy_splice") &&
+      upstream_->startSplice(read_callbacks_->connection())) {
+    config_->stats().downstream_cx_splice_total_.inc();
+  }
 }
 
 void Filter::onIdleTimeout() {
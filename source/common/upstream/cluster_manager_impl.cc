@@ -29,6 +29,7 @@
 #include "common/http/http1/conn_pool.h"
 #include "common/http/http2/conn_pool.h"
 #include "common/http/mixed_conn_pool.h"
+#include "common/memory/stats.h"
 #include "common/network/resolver_impl.h"
 #include "common/network/utility.h"
 #include "common/protobuf/utility.h"
@@ -275,6 +276,9 @@ ClusterManagerImpl::ClusterManagerImpl(
       time_source_(main_thread_dispatcher.timeSource()), dispatcher_(main_thread_dispatcher),
       http_context_(http_context), router_context_(router_context),
       cluster_stat_names_(stats.symbolTable()),
+      cluster_config_update_stat_names_(stats.symbolTable()),
+      cluster_endpoint_stat_names_(stats.symbolTable()),
+      cluster_lb_stat_names_(stats.symbolTable()),
       cluster_load_report_stat_names_(stats.symbolTable()),
       cluster_circuit_breakers_stat_names_(stats.symbolTable()),
       cluster_request_response_size_stat_names_(stats.symbolTable()),
@@ -284,6 +288,20 @@ ClusterManagerImpl::ClusterManagerImpl(
   async_client_manager_ = std::make_unique<Grpc::AsyncClientManagerImpl>(
       *this, tls, time_source_, api, grpc_context.statNames());
   const auto& cm_config = bootstrap.cluster_manager();
+  if (cm_config.lazy_cluster_stats()) {
+    // The placeholder must exist before any cluster is loaded. Creating it, along with the load
+    // report stats of one cluster, measures the heap each idle cluster saves.
+    const uint64_t allocated = Memory::Stats::totalCurrentlyAllocated();
+    cluster_stats_placeholder_store_ =
+        std::make_unique<Stats::IsolatedStoreImpl>(stats.symbolTable());
+    cluster_stats_placeholder_ =
+        std::make_unique<ClusterStats>(cluster_stat_names_, *cluster_stats_placeholder_store_);
+    Stats::IsolatedStoreImpl load_report_stats_store(stats.symbolTable());
+    ClusterInfoImpl::generateLoadReportStats(load_report_stats_store,
+                                             cluster_load_report_stat_names_);
+    const uint64_t measured = Memory::Stats::totalCurrentlyAllocated();
+    lazy_cluster_stats_bytes_ = measured > allocated ? measured - allocated : 0;
+  }
   if (cm_config.has_outlier_detection()) {
     const std::string event_log_file_path = cm_config.outlier_detection().event_log_path();
     if (!event_log_file_path.empty()) {
@@ -515,6 +533,7 @@ void ClusterManagerImpl::onClusterInit(ClusterManagerCluster& cm_cluster) {
         //
         // See https://github.com/envoyproxy/envoy/pull/3941 for more context.
         bool scheduled = false;
+        bool merge_cancelled = false;
         const auto merge_timeout = PROTOBUF_GET_MS_OR_DEFAULT(
             cm_cluster.cluster().info()->lbConfig(), update_merge_window, 1000);
         // Remember: we only merge updates with no adds/removes — just hc/weight/metadata changes.
@@ -523,14 +542,18 @@ void ClusterManagerImpl::onClusterInit(ClusterManagerCluster& cm_cluster) {
         if (merge_timeout > 0) {
           // If this is not mergeable, we should cancel any scheduled updates since
           // we'll deliver it immediately.
-          scheduled = scheduleUpdate(cm_cluster, priority, is_mergeable, merge_timeout);
+          scheduled =
+              scheduleUpdate(cm_cluster, priority, is_mergeable, merge_timeout, merge_cancelled);
         }
 
         // If an update was not scheduled for later, deliver it immediately.
         if (!scheduled) {
           cm_stats_.cluster_updated_.inc();
-          postThreadLocalClusterUpdate(
-              cm_cluster, ThreadLocalClusterUpdateParams(priority, hosts_added, hosts_removed));
+          ThreadLocalClusterUpdateParams params(priority, hosts_added, hosts_removed);
+          // A cancelled merged update is delivered as part of this one, so the workers need to see
+          // the full update rather than a delta.
+          params.per_priority_update_params_[0].delta_allowed_ = !merge_cancelled;
+          postThreadLocalClusterUpdate(cm_cluster, std::move(params));
         }
       });
 
@@ -552,7 +575,8 @@ void ClusterManagerImpl::onClusterInit(ClusterManagerCluster& cm_cluster) {
 }
 
 bool ClusterManagerImpl::scheduleUpdate(ClusterManagerCluster& cluster, uint32_t priority,
-                                        bool mergeable, const uint64_t timeout) {
+                                        bool mergeable, const uint64_t timeout,
+                                        bool& merge_cancelled) {
   // Find pending updates for this cluster.
   auto& updates_by_prio = updates_map_[cluster.cluster().info()->name()];
   if (!updates_by_prio) {
@@ -588,6 +612,7 @@ bool ClusterManagerImpl::scheduleUpdate(ClusterManagerCluster& cluster, uint32_t
     // 2) Were there previous updates that we are cancelling (and delivering immediately)?
     if (updates->disableTimer()) {
       cm_stats_.update_merge_cancelled_.inc();
+      merge_cancelled = true;
     }
 
     updates->last_updated_ = time_source_.monotonicTime();
@@ -814,15 +839,15 @@ ClusterManagerImpl::loadCluster(const envoy::config::cluster::v3::Cluster& clust
   if (cluster_reference.info()->lbType() == LoadBalancerType::RingHash) {
     if (!cluster_reference.info()->lbSubsetInfo().isEnabled()) {
       cluster_entry_it->second->thread_aware_lb_ = std::make_unique<RingHashLoadBalancer>(
-          cluster_reference.prioritySet(), cluster_reference.info()->stats(),
+          cluster_reference.prioritySet(), cluster_reference.info()->lbStats(),
           cluster_reference.info()->statsScope(), runtime_, random_,
           cluster_reference.info()->lbRingHashConfig(), cluster_reference.info()->lbConfig());
     }
   } else if (cluster_reference.info()->lbType() == LoadBalancerType::Maglev) {
     if (!cluster_reference.info()->lbSubsetInfo().isEnabled()) {
       cluster_entry_it->second->thread_aware_lb_ = std::make_unique<MaglevLoadBalancer>(
-          cluster_reference.prioritySet(), cluster_reference.info()->stats(),
-          cluster_reference.info()->statsScope(), runtime_, random_,
+          cluster_reference.prioritySet(), cluster_reference.info()->lbStats(),
+          cluster_reference.info()->statsScope(), runtime_, random_, time_source_,
           cluster_reference.info()->lbMaglevConfig(), cluster_reference.info()->lbConfig());
     }
   } else if (cluster_reference.info()->lbType() == LoadBalancerType::ClusterProvided) {
@@ -966,6 +991,8 @@ void ClusterManagerImpl::postThreadLocalClusterUpdate(ClusterManagerCluster& cm_
     const auto& host_set =
         cm_cluster.cluster().prioritySet().hostSetsPerPriority()[per_priority.priority_];
     per_priority.update_hosts_params_ = HostSetImpl::updateHostsParams(*host_set);
+    per_priority.update_hosts_params_.delta_only =
+        per_priority.delta_allowed_ && host_set->deltaOnly();
     per_priority.locality_weights_ = host_set->localityWeights();
     per_priority.overprovisioning_factor_ = host_set->overprovisioningFactor();
   }
@@ -1334,30 +1361,30 @@ ClusterManagerImpl::ThreadLocalClusterManagerImpl::ClusterEntry::ClusterEntry(
   // benefit given the healthy panic, locality, and priority calculations that take place.
   if (cluster->lbSubsetInfo().isEnabled()) {
     lb_ = std::make_unique<SubsetLoadBalancer>(
-        cluster->lbType(), priority_set_, parent_.local_priority_set_, cluster->stats(),
+        cluster->lbType(), priority_set_, parent_.local_priority_set_, cluster->lbStats(),
         cluster->statsScope(), parent.parent_.runtime_, parent.parent_.random_,
-        cluster->lbSubsetInfo(), cluster->lbRingHashConfig(), cluster->lbMaglevConfig(),
-        cluster->lbLeastRequestConfig(), cluster->lbConfig());
+        parent.parent_.time_source_, cluster->lbSubsetInfo(), cluster->lbRingHashConfig(),
+        cluster->lbMaglevConfig(), cluster->lbLeastRequestConfig(), cluster->lbConfig());
   } else {
     switch (cluster->lbType()) {
     case LoadBalancerType::LeastRequest: {
       ASSERT(lb_factory_ == nullptr);
       lb_ = std::make_unique<LeastRequestLoadBalancer>(
-          priority_set_, parent_.local_priority_set_, cluster->stats(), parent.parent_.runtime_,
+          priority_set_, parent_.local_priority_set_, cluster->lbStats(), parent.parent_.runtime_,
           parent.parent_.random_, cluster->lbConfig(), cluster->lbLeastRequestConfig());
       break;
     }
     case LoadBalancerType::Random: {
       ASSERT(lb_factory_ == nullptr);
       lb_ = std::make_unique<RandomLoadBalancer>(priority_set_, parent_.local_priority_set_,
-                                                 cluster->stats(), parent.parent_.runtime_,
+                                                 cluster->lbStats(), parent.parent_.runtime_,
                                                  parent.parent_.random_, cluster->lbConfig());
       break;
     }
     case LoadBalancerType::RoundRobin: {
       ASSERT(lb_factory_ == nullptr);
       lb_ = std::make_unique<RoundRobinLoadBalancer>(priority_set_, parent_.local_priority_set_,
-                                                     cluster->stats(), parent.parent_.runtime_,
+                                                     cluster->lbStats(), parent.parent_.runtime_,
                                                      parent.parent_.random_, cluster->lbConfig());
       break;
     }
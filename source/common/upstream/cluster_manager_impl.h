@@ -30,6 +30,7 @@
 #include "common/config/grpc_mux_impl.h"
 #include "common/config/subscription_factory_impl.h"
 #include "common/http/async_client_impl.h"
+#include "common/stats/isolated_store_impl.h"
 #include "common/upstream/load_stats_reporter.h"
 #include "common/upstream/priority_conn_pool_map.h"
 #include "common/upstream/upstream_impl.h"
@@ -293,6 +294,13 @@ public:
   initializeSecondaryClusters(const envoy::config::bootstrap::v3::Bootstrap& bootstrap) override;
 
   const ClusterStatNames& clusterStatNames() const override { return cluster_stat_names_; }
+  const ClusterConfigUpdateStatNames& clusterConfigUpdateStatNames() const override {
+    return cluster_config_update_stat_names_;
+  }
+  const ClusterEndpointStatNames& clusterEndpointStatNames() const override {
+    return cluster_endpoint_stat_names_;
+  }
+  const ClusterLbStatNames& clusterLbStatNames() const override { return cluster_lb_stat_names_; }
   const ClusterLoadReportStatNames& clusterLoadReportStatNames() const override {
     return cluster_load_report_stat_names_;
   }
@@ -305,6 +313,10 @@ public:
   const ClusterTimeoutBudgetStatNames& clusterTimeoutBudgetStatNames() const override {
     return cluster_timeout_budget_stat_names_;
   }
+  const ClusterStats* clusterStatsPlaceholder() const override {
+    return cluster_stats_placeholder_.get();
+  }
+  uint64_t lazyClusterStatsBytes() const override { return lazy_cluster_stats_bytes_; }
 
 protected:
   virtual void postThreadLocalDrainConnections(const Cluster& cluster,
@@ -319,6 +331,9 @@ protected:
       const uint32_t priority_;
       const HostVector hosts_added_;
       const HostVector hosts_removed_;
+      // Whether the workers have seen every earlier update of the priority, so that they can apply
+      // this one as a delta if it only adds and removes hosts.
+      bool delta_allowed_{};
       PrioritySet::UpdateHostsParams update_hosts_params_;
       LocalityWeightsConstSharedPtr locality_weights_;
       uint32_t overprovisioning_factor_;
@@ -555,7 +570,7 @@ private:
 
   void applyUpdates(ClusterManagerCluster& cluster, uint32_t priority, PendingUpdates& updates);
   bool scheduleUpdate(ClusterManagerCluster& cluster, uint32_t priority, bool mergeable,
-                      const uint64_t timeout);
+                      const uint64_t timeout, bool& merge_cancelled);
   ProtobufTypes::MessagePtr dumpClusterConfigs();
   static ClusterManagerStats generateStats(Stats::Scope& scope);
 
@@ -605,10 +620,18 @@ private:
   Http::Context& http_context_;
   Router::Context& router_context_;
   ClusterStatNames cluster_stat_names_;
+  ClusterConfigUpdateStatNames cluster_config_update_stat_names_;
+  ClusterEndpointStatNames cluster_endpoint_stat_names_;
+  ClusterLbStatNames cluster_lb_stat_names_;
   ClusterLoadReportStatNames cluster_load_report_stat_names_;
   ClusterCircuitBreakersStatNames cluster_circuit_breakers_stat_names_;
   ClusterRequestResponseSizeStatNames cluster_request_response_size_stat_names_;
   ClusterTimeoutBudgetStatNames cluster_timeout_budget_stat_names_;
+  // With lazy_cluster_stats, the zero-valued traffic stats shared by the clusters which have not
+  // created theirs yet. These live in their own store so that they are never flushed.
+  std::unique_ptr<Stats::IsolatedStoreImpl> cluster_stats_placeholder_store_;
+  std::unique_ptr<ClusterStats> cluster_stats_placeholder_;
+  uint64_t lazy_cluster_stats_bytes_{};
 
   Config::SubscriptionFactoryImpl subscription_factory_;
   ClusterSet primary_clusters_;
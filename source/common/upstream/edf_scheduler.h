@@ -1,7 +1,9 @@
 #pragma once
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
-#include <queue>
+#include <list>
+#include <vector>
 
 #include "common/common/assert.h"
 
@@ -34,10 +36,10 @@ public:
   // will shrink.
   std::shared_ptr<C> peekAgain(std::function<double(const C&)> calculate_weight) {
     if (hasEntry()) {
-      prepick_list_.push_back(std::move(queue_.top().entry_));
+      prepick_list_.push_back(std::move(queue_.front().entry_));
       std::shared_ptr<C> ret{prepick_list_.back()};
+      pop();
       add(calculate_weight(*ret), ret);
-      queue_.pop();
       return ret;
     }
     return nullptr;
@@ -60,8 +62,8 @@ public:
       return ret;
     }
     if (hasEntry()) {
-      std::shared_ptr<C> ret{queue_.top().entry_};
-      queue_.pop();
+      std::shared_ptr<C> ret{queue_.front().entry_};
+      pop();
       add(calculate_weight(*ret), ret);
       return ret;
     }
@@ -78,8 +80,29 @@ public:
     const double deadline = current_time_ + 1.0 / weight;
     EDF_TRACE("Insertion {} in queue with deadline {} and weight {}.",
               static_cast<const void*>(entry.get()), deadline, weight);
-    queue_.push({deadline, order_offset_++, entry});
-    ASSERT(queue_.top().deadline_ >= current_time_);
+    queue_.push_back({deadline, order_offset_++, entry});
+    std::push_heap(queue_.begin(), queue_.end());
+    ASSERT(queue_.front().deadline_ >= current_time_);
+  }
+
+  /**
+   * Removes the entries for which predicate returns true, along with any expired entries. The
+   * remaining entries keep their deadlines. This takes O(n) time, so it is cheaper than building a
+   * new scheduler with the remaining entries.
+   * @param predicate called with each entry that has not expired.
+   */
+  template <class Predicate> void removeIf(Predicate predicate) {
+    const auto removed = [&predicate](const std::weak_ptr<C>& weak_entry) {
+      const std::shared_ptr<C> entry = weak_entry.lock();
+      return entry == nullptr || predicate(*entry);
+    };
+    queue_.erase(std::remove_if(queue_.begin(), queue_.end(),
+                                [&removed](const EdfEntry& edf_entry) {
+                                  return removed(edf_entry.entry_);
+                                }),
+                 queue_.end());
+    std::make_heap(queue_.begin(), queue_.end());
+    prepick_list_.remove_if(removed);
   }
 
   /**
@@ -99,11 +122,11 @@ private:
         EDF_TRACE("Queue is empty.");
         return false;
       }
-      const EdfEntry& edf_entry = queue_.top();
+      const EdfEntry& edf_entry = queue_.front();
       // Entry has been removed, let's see if there's another one.
       if (edf_entry.entry_.expired()) {
         EDF_TRACE("Entry has expired, repick.");
-        queue_.pop();
+        pop();
         continue;
       }
       std::shared_ptr<C> ret{edf_entry.entry_};
@@ -114,6 +137,11 @@ private:
     }
   }
 
+  void pop() {
+    std::pop_heap(queue_.begin(), queue_.end());
+    queue_.pop_back();
+  }
+
   struct EdfEntry {
     double deadline_;
     // Tie breaker for entries with the same deadline. This is used to provide FIFO behavior.
@@ -136,8 +164,8 @@ private:
   // Offset used during addition to break ties when entries have the same weight but should reflect
   // FIFO insertion order in picks.
   uint64_t order_offset_{};
-  // Min priority queue for EDF.
-  std::priority_queue<EdfEntry> queue_;
+  // Min priority queue for EDF, kept as a heap so that entries can be removed.
+  std::vector<EdfEntry> queue_;
   std::list<std::weak_ptr<C>> prepick_list_;
 };
 
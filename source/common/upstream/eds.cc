@@ -106,7 +106,7 @@ void EdsClusterImpl::BatchUpdateHelper::batchUpdate(PrioritySet::HostUpdateCb& h
   parent_.all_hosts_ = std::move(updated_hosts);
 
   if (!cluster_rebuilt) {
-    parent_.info_->stats().update_no_rebuild_.inc();
+    parent_.info_->configUpdateStats().update_no_rebuild_.inc();
   }
 
   // If we didn't setup to initialize when our first round of health checking is complete, just
@@ -139,7 +139,7 @@ void EdsClusterImpl::onConfigUpdate(const std::vector<Config::DecodedResourceRef
       PROTOBUF_GET_MS_OR_DEFAULT(cluster_load_assignment.policy(), endpoint_stale_after, 0);
   if (stale_after_ms > 0) {
     // Stat to track how often we receive valid assignment_timeout in response.
-    info_->stats().assignment_timeout_received_.inc();
+    info_->configUpdateStats().assignment_timeout_received_.inc();
     assignment_timeout_->enableTimer(std::chrono::milliseconds(stale_after_ms));
   }
 
@@ -159,7 +159,7 @@ void EdsClusterImpl::onConfigUpdate(const std::vector<Config::DecodedResourceRef
 bool EdsClusterImpl::validateUpdateSize(int num_resources) {
   if (num_resources == 0) {
     ENVOY_LOG(debug, "Missing ClusterLoadAssignment for {} in onConfigUpdate()", cluster_name_);
-    info_->stats().update_empty_.inc();
+    info_->configUpdateStats().update_empty_.inc();
     onPreInitComplete();
     return false;
   }
@@ -185,7 +185,7 @@ void EdsClusterImpl::onAssignmentTimeout() {
   std::vector<Config::DecodedResourceRef> resource_refs = {*decoded_resource};
   onConfigUpdate(resource_refs, "");
   // Stat to track how often we end up with stale assignments.
-  info_->stats().assignment_stale_.inc();
+  info_->configUpdateStats().assignment_stale_.inc();
 }
 
 void EdsClusterImpl::reloadHealthyHostsHelper(const HostSharedPtr& host) {
@@ -255,11 +255,13 @@ bool EdsClusterImpl::updateHostsPerLocality(
   // performance implications, since this has the knock on effect that we rebuild the load balancers
   // and locality scheduler. See the comment in BaseDynamicClusterImpl::updateDynamicHostList
   // about this. In the future we may need to do better here.
+  bool delta_only = false;
   const bool hosts_updated =
       updateDynamicHostList(new_hosts, *current_hosts_copy, hosts_added, hosts_removed,
-                            updated_hosts, all_hosts_, all_new_hosts);
-  if (hosts_updated || host_set.overprovisioningFactor() != overprovisioning_factor ||
-      locality_weights_map != new_locality_weights_map) {
+                            updated_hosts, all_hosts_, all_new_hosts, &delta_only);
+  const bool weights_updated = host_set.overprovisioningFactor() != overprovisioning_factor ||
+                               locality_weights_map != new_locality_weights_map;
+  if (hosts_updated || weights_updated) {
     ASSERT(std::all_of(current_hosts_copy->begin(), current_hosts_copy->end(),
                        [&](const auto& host) { return host->priority() == priority; }));
     locality_weights_map = new_locality_weights_map;
@@ -267,9 +269,11 @@ bool EdsClusterImpl::updateHostsPerLocality(
               "EDS hosts or locality weights changed for cluster: {} current hosts {} priority {}",
               info_->name(), host_set.hosts().size(), host_set.priority());
 
-    priority_state_manager.updateClusterPrioritySet(priority, std::move(current_hosts_copy),
-                                                    hosts_added, hosts_removed, absl::nullopt,
-                                                    overprovisioning_factor);
+    // When the update only adds and removes hosts, the load balancers can patch their state with
+    // the delta rather than rebuilding it.
+    priority_state_manager.updateClusterPrioritySet(
+        priority, std::move(current_hosts_copy), hosts_added, hosts_removed, absl::nullopt,
+        overprovisioning_factor, hosts_updated && delta_only && !weights_updated);
     return true;
   }
   return false;
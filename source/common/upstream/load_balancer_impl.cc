@@ -13,6 +13,7 @@
 #include "common/protobuf/utility.h"
 
 #include "absl/container/fixed_array.h"
+#include "absl/container/flat_hash_set.h"
 
 namespace Envoy {
 namespace Upstream {
@@ -105,7 +106,7 @@ LoadBalancerBase::choosePriority(uint64_t hash, const HealthyLoad& healthy_per_p
 }
 
 LoadBalancerBase::LoadBalancerBase(
-    const PrioritySet& priority_set, ClusterStats& stats, Runtime::Loader& runtime,
+    const PrioritySet& priority_set, ClusterLbStats& stats, Runtime::Loader& runtime,
     Random::RandomGenerator& random,
     const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config)
     : stats_(stats), runtime_(runtime), random_(random),
@@ -347,7 +348,7 @@ LoadBalancerBase::chooseHostSet(LoadBalancerContext* context, uint64_t hash) con
 }
 
 ZoneAwareLoadBalancerBase::ZoneAwareLoadBalancerBase(
-    const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterStats& stats,
+    const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterLbStats& stats,
     Runtime::Loader& runtime, Random::RandomGenerator& random,
     const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config)
     : LoadBalancerBase(priority_set, stats, runtime, random, common_config),
@@ -693,19 +694,25 @@ const HostVector& ZoneAwareLoadBalancerBase::hostSourceToHosts(HostsSource hosts
 }
 
 EdfLoadBalancerBase::EdfLoadBalancerBase(
-    const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterStats& stats,
+    const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterLbStats& stats,
     Runtime::Loader& runtime, Random::RandomGenerator& random,
     const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config)
     : ZoneAwareLoadBalancerBase(priority_set, local_priority_set, stats, runtime, random,
                                 common_config),
       seed_(random_.random()) {
   // We fully recompute the schedulers for a given host set here on membership change, which is
-  // consistent with what other LB implementations do (e.g. thread aware).
-  // The downside of a full recompute is that time complexity is O(n * log n),
-  // so we will need to do better at delta tracking to scale (see
+  // consistent with what other LB implementations do (e.g. thread aware). The time complexity of
+  // a full recompute is O(n * log n), so when an update only adds and removes hosts we instead
+  // patch the existing schedulers with the delta (see
   // https://github.com/envoyproxy/envoy/issues/2874).
   priority_update_cb_ = priority_set.addPriorityUpdateCb(
-      [this](uint32_t priority, const HostVector&, const HostVector&) { refresh(priority); });
+      [this](uint32_t priority, const HostVector& hosts_added, const HostVector& hosts_removed) {
+        if (priority_set_.hostSetsPerPriority()[priority]->deltaOnly()) {
+          applyHostsDelta(priority, hosts_added, hosts_removed);
+        } else {
+          refresh(priority);
+        }
+      });
 }
 
 void EdfLoadBalancerBase::initialize() {
@@ -714,65 +721,112 @@ void EdfLoadBalancerBase::initialize() {
   }
 }
 
+void EdfLoadBalancerBase::forEachHostsSource(
+    uint32_t priority, const std::function<void(const HostsSource&, const HostVector&)>& cb) {
+  const auto& host_set = priority_set_.hostSetsPerPriority()[priority];
+  cb(HostsSource(priority, HostsSource::SourceType::AllHosts), host_set->hosts());
+  cb(HostsSource(priority, HostsSource::SourceType::HealthyHosts), host_set->healthyHosts());
+  cb(HostsSource(priority, HostsSource::SourceType::DegradedHosts), host_set->degradedHosts());
+  for (uint32_t locality_index = 0;
+       locality_index < host_set->healthyHostsPerLocality().get().size(); ++locality_index) {
+    cb(HostsSource(priority, HostsSource::SourceType::LocalityHealthyHosts, locality_index),
+       host_set->healthyHostsPerLocality().get()[locality_index]);
+  }
+  for (uint32_t locality_index = 0;
+       locality_index < host_set->degradedHostsPerLocality().get().size(); ++locality_index) {
+    cb(HostsSource(priority, HostsSource::SourceType::LocalityDegradedHosts, locality_index),
+       host_set->degradedHostsPerLocality().get()[locality_index]);
+  }
+}
+
+void EdfLoadBalancerBase::addHostsSource(const HostsSource& source, const HostVector& hosts) {
+  // Nuke existing scheduler if it exists.
+  auto& scheduler = scheduler_[source] = Scheduler{};
+  refreshHostSource(source);
+
+  // Check if the original host weights are equal and skip EDF creation if they are. When all
+  // original weights are equal we can rely on unweighted host pick to do optimal round robin and
+  // least-loaded host selection with lower memory and CPU overhead.
+  if (hostWeightsAreEqual(hosts)) {
+    // Skip edf creation.
+    return;
+  }
+
+  scheduler.edf_ = std::make_unique<EdfScheduler<const Host>>();
+
+  // Populate scheduler with host list.
+  // TODO(mattklein123): We must build the EDF schedule even if all of the hosts are currently
+  // weighted 1. This is because currently we don't refresh host sets if only weights change.
+  // We should probably change this to refresh at all times. See the comment in
+  // BaseDynamicClusterImpl::updateDynamicHostList about this.
+  for (const auto& host : hosts) {
+    // We use a fixed weight here. While the weight may change without
+    // notification, this will only be stale until this host is next picked,
+    // at which point it is reinserted into the EdfScheduler with its new
+    // weight in chooseHost().
+    scheduler.edf_->add(hostWeight(*host), host);
+  }
+
+  // Cycle through hosts to achieve the intended offset behavior.
+  // TODO(htuch): Consider how we can avoid biasing towards earlier hosts in the schedule across
+  // refreshes for the weighted case.
+  if (!hosts.empty()) {
+    for (uint32_t i = 0; i < seed_ % hosts.size(); ++i) {
+      auto host =
+          scheduler.edf_->pickAndAdd([this](const Host& host) { return hostWeight(host); });
+    }
+  }
+}
+
 void EdfLoadBalancerBase::refresh(uint32_t priority) {
-  const auto add_hosts_source = [this](HostsSource source, const HostVector& hosts) {
-    // Nuke existing scheduler if it exists.
-    auto& scheduler = scheduler_[source] = Scheduler{};
-    refreshHostSource(source);
+  // Populate EdfSchedulers for each valid HostsSource value for the host set at this priority.
+  forEachHostsSource(priority, [this](const HostsSource& source, const HostVector& hosts) {
+    addHostsSource(source, hosts);
+  });
+}
 
-    // Check if the original host weights are equal and skip EDF creation if they are. When all
-    // original weights are equal we can rely on unweighted host pick to do optimal round robin and
-    // least-loaded host selection with lower memory and CPU overhead.
-    if (hostWeightsAreEqual(hosts)) {
-      // Skip edf creation.
+void EdfLoadBalancerBase::applyHostsDelta(uint32_t priority, const HostVector& hosts_added,
+                                          const HostVector& hosts_removed) {
+  absl::flat_hash_set<const Host*> added;
+  added.reserve(hosts_added.size());
+  for (const auto& host : hosts_added) {
+    added.insert(host.get());
+  }
+  absl::flat_hash_set<const Host*> removed;
+  removed.reserve(hosts_removed.size());
+  for (const auto& host : hosts_removed) {
+    removed.insert(host.get());
+  }
+
+  // The health of the hosts that were neither added nor removed is unchanged, so each source only
+  // gains the added hosts that belong to it and loses the removed hosts. The schedules of the
+  // remaining hosts carry on where they were, rather than restarting.
+  forEachHostsSource(priority, [&](const HostsSource& source, const HostVector& hosts) {
+    auto scheduler_it = scheduler_.find(source);
+    if (scheduler_it == scheduler_.end() ||
+        (scheduler_it->second.edf_ != nullptr) == hostWeightsAreEqual(hosts)) {
+      // Either the source is new or the delta changed whether it needs an EDF schedule.
+      addHostsSource(source, hosts);
       return;
     }
+    refreshHostSource(source);
 
-    scheduler.edf_ = std::make_unique<EdfScheduler<const Host>>();
-
-    // Populate scheduler with host list.
-    // TODO(mattklein123): We must build the EDF schedule even if all of the hosts are currently
-    // weighted 1. This is because currently we don't refresh host sets if only weights change.
-    // We should probably change this to refresh at all times. See the comment in
-    // BaseDynamicClusterImpl::updateDynamicHostList about this.
-    for (const auto& host : hosts) {
-      // We use a fixed weight here. While the weight may change without
-      // notification, this will only be stale until this host is next picked,
-      // at which point it is reinserted into the EdfScheduler with its new
-      // weight in chooseHost().
-      scheduler.edf_->add(hostWeight(*host), host);
+    // Unweighted picks index the host vector directly, so there is nothing else to patch.
+    auto& edf = scheduler_it->second.edf_;
+    if (edf == nullptr) {
+      return;
     }
-
-    // Cycle through hosts to achieve the intended offset behavior.
-    // TODO(htuch): Consider how we can avoid biasing towards earlier hosts in the schedule across
-    // refreshes for the weighted case.
-    if (!hosts.empty()) {
-      for (uint32_t i = 0; i < seed_ % hosts.size(); ++i) {
-        auto host =
-            scheduler.edf_->pickAndAdd([this](const Host& host) { return hostWeight(host); });
+    if (!removed.empty()) {
+      edf->removeIf([&removed](const Host& host) { return removed.contains(&host); });
+    }
+    if (!added.empty()) {
+      for (const auto& host : hosts) {
+        if (added.contains(host.get())) {
+          edf->add(hostWeight(*host), host);
+        }
       }
     }
-  };
-
-  // Populate EdfSchedulers for each valid HostsSource value for the host set at this priority.
-  const auto& host_set = priority_set_.hostSetsPerPriority()[priority];
-  add_hosts_source(HostsSource(priority, HostsSource::SourceType::AllHosts), host_set->hosts());
-  add_hosts_source(HostsSource(priority, HostsSource::SourceType::HealthyHosts),
-                   host_set->healthyHosts());
-  add_hosts_source(HostsSource(priority, HostsSource::SourceType::DegradedHosts),
-                   host_set->degradedHosts());
-  for (uint32_t locality_index = 0;
-       locality_index < host_set->healthyHostsPerLocality().get().size(); ++locality_index) {
-    add_hosts_source(
-        HostsSource(priority, HostsSource::SourceType::LocalityHealthyHosts, locality_index),
-        host_set->healthyHostsPerLocality().get()[locality_index]);
-  }
-  for (uint32_t locality_index = 0;
-       locality_index < host_set->degradedHostsPerLocality().get().size(); ++locality_index) {
-    add_hosts_source(
-        HostsSource(priority, HostsSource::SourceType::LocalityDegradedHosts, locality_index),
-        host_set->degradedHostsPerLocality().get()[locality_index]);
-  }
+  });
 }
 
 HostConstSharedPtr EdfLoadBalancerBase::peekAnotherHost(LoadBalancerContext* context) {
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <queue>
 #include <set>
@@ -72,7 +73,7 @@ protected:
    */
   void recalculateLoadInTotalPanic();
 
-  LoadBalancerBase(const PrioritySet& priority_set, ClusterStats& stats, Runtime::Loader& runtime,
+  LoadBalancerBase(const PrioritySet& priority_set, ClusterLbStats& stats, Runtime::Loader& runtime,
                    Random::RandomGenerator& random,
                    const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config);
 
@@ -107,7 +108,7 @@ protected:
     }
   }
 
-  ClusterStats& stats_;
+  ClusterLbStats& stats_;
   Runtime::Loader& runtime_;
   std::deque<uint64_t> stashed_random_;
   Random::RandomGenerator& random_;
@@ -197,7 +198,7 @@ class ZoneAwareLoadBalancerBase : public LoadBalancerBase {
 protected:
   // Both priority_set and local_priority_set if non-null must have at least one host set.
   ZoneAwareLoadBalancerBase(
-      const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterStats& stats,
+      const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterLbStats& stats,
       Runtime::Loader& runtime, Random::RandomGenerator& random,
       const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config);
 
@@ -377,7 +378,7 @@ private:
 class EdfLoadBalancerBase : public ZoneAwareLoadBalancerBase {
 public:
   EdfLoadBalancerBase(const PrioritySet& priority_set, const PrioritySet* local_priority_set,
-                      ClusterStats& stats, Runtime::Loader& runtime,
+                      ClusterLbStats& stats, Runtime::Loader& runtime,
                       Random::RandomGenerator& random,
                       const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config);
 
@@ -395,7 +396,12 @@ protected:
 
   void initialize();
 
+  // Rebuilds the schedulers of a priority.
   virtual void refresh(uint32_t priority);
+  // Patches the schedulers of a priority whose host set was updated with a delta, see
+  // HostSet::deltaOnly().
+  virtual void applyHostsDelta(uint32_t priority, const HostVector& hosts_added,
+                               const HostVector& hosts_removed);
 
   // Seed to allow us to desynchronize load balancers across a fleet. If we don't
   // do this, multiple Envoys that receive an update at the same time (or even
@@ -405,6 +411,10 @@ protected:
   const uint64_t seed_;
 
 private:
+  void forEachHostsSource(uint32_t priority,
+                          const std::function<void(const HostsSource&, const HostVector&)>& cb);
+  void addHostsSource(const HostsSource& source, const HostVector& hosts);
+
   virtual void refreshHostSource(const HostsSource& source) PURE;
   virtual double hostWeight(const Host& host) PURE;
   virtual HostConstSharedPtr unweightedHostPeek(const HostVector& hosts_to_use,
@@ -424,7 +434,7 @@ private:
 class RoundRobinLoadBalancer : public EdfLoadBalancerBase {
 public:
   RoundRobinLoadBalancer(const PrioritySet& priority_set, const PrioritySet* local_priority_set,
-                         ClusterStats& stats, Runtime::Loader& runtime,
+                         ClusterLbStats& stats, Runtime::Loader& runtime,
                          Random::RandomGenerator& random,
                          const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config)
       : EdfLoadBalancerBase(priority_set, local_priority_set, stats, runtime, random,
@@ -489,7 +499,7 @@ class LeastRequestLoadBalancer : public EdfLoadBalancerBase,
                                  Logger::Loggable<Logger::Id::upstream> {
 public:
   LeastRequestLoadBalancer(
-      const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterStats& stats,
+      const PrioritySet& priority_set, const PrioritySet* local_priority_set, ClusterLbStats& stats,
       Runtime::Loader& runtime, Random::RandomGenerator& random,
       const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config,
       const absl::optional<envoy::config::cluster::v3::Cluster::LeastRequestLbConfig>
@@ -510,6 +520,17 @@ public:
 
 protected:
   void refresh(uint32_t priority) override {
+    refreshActiveRequestBias();
+    EdfLoadBalancerBase::refresh(priority);
+  }
+  void applyHostsDelta(uint32_t priority, const HostVector& hosts_added,
+                       const HostVector& hosts_removed) override {
+    refreshActiveRequestBias();
+    EdfLoadBalancerBase::applyHostsDelta(priority, hosts_added, hosts_removed);
+  }
+
+private:
+  void refreshActiveRequestBias() {
     active_request_bias_ =
         active_request_bias_runtime_ != nullptr ? active_request_bias_runtime_->value() : 1.0;
 
@@ -518,11 +539,7 @@ protected:
                 active_request_bias_runtime_->runtimeKey());
       active_request_bias_ = 1.0;
     }
-
-    EdfLoadBalancerBase::refresh(priority);
   }
-
-private:
   void refreshHostSource(const HostsSource&) override {}
   double hostWeight(const Host& host) override {
     // This method is called to calculate the dynamic weight as following when all load balancing
@@ -574,7 +591,8 @@ private:
 class RandomLoadBalancer : public ZoneAwareLoadBalancerBase {
 public:
   RandomLoadBalancer(const PrioritySet& priority_set, const PrioritySet* local_priority_set,
-                     ClusterStats& stats, Runtime::Loader& runtime, Random::RandomGenerator& random,
+                     ClusterLbStats& stats, Runtime::Loader& runtime,
+                     Random::RandomGenerator& random,
                      const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config)
       : ZoneAwareLoadBalancerBase(priority_set, local_priority_set, stats, runtime, random,
                                   common_config) {}
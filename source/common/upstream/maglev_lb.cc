@@ -18,16 +18,18 @@ MaglevTable::MaglevTable(const NormalizedHostWeightVector& normalized_host_weigh
   // Implementation of pseudocode listing 1 in the paper (see header file for more info).
   std::vector<TableBuildEntry> table_build_entries;
   table_build_entries.reserve(normalized_host_weights.size());
+  hosts_.reserve(normalized_host_weights.size());
   for (const auto& host_weight : normalized_host_weights) {
     const auto& host = host_weight.first;
     const absl::string_view key_to_hash = hashKey(host, use_hostname_for_hashing);
     ASSERT(!key_to_hash.empty());
-    table_build_entries.emplace_back(host, HashUtil::xxHash64(key_to_hash) % table_size_,
+    table_build_entries.emplace_back(HashUtil::xxHash64(key_to_hash) % table_size_,
                                      (HashUtil::xxHash64(key_to_hash, 1) % (table_size_ - 1)) + 1,
                                      host_weight.second);
+    hosts_.push_back(host);
   }
 
-  table_.resize(table_size_);
+  table_.resize(table_size_, EmptySlot);
 
   // Iterate through the table build entries as many times as it takes to fill up the table.
   uint64_t table_index = 0;
@@ -42,14 +44,12 @@ MaglevTable::MaglevTable(const NormalizedHostWeightVector& normalized_host_weigh
         continue;
       }
       entry.target_weight_ += max_normalized_weight;
-      uint64_t c = permutation(entry);
-      while (table_[c] != nullptr) {
-        entry.next_++;
-        c = permutation(entry);
+      while (table_[entry.next_] != EmptySlot) {
+        advance(entry);
       }
 
-      table_[c] = entry.host_;
-      entry.next_++;
+      table_[entry.next_] = static_cast<uint32_t>(i);
+      advance(entry);
       entry.count_++;
       table_index++;
     }
@@ -66,8 +66,9 @@ MaglevTable::MaglevTable(const NormalizedHostWeightVector& normalized_host_weigh
 
   if (ENVOY_LOG_CHECK_LEVEL(trace)) {
     for (uint64_t i = 0; i < table_.size(); i++) {
-      const absl::string_view key_to_hash = hashKey(table_[i], use_hostname_for_hashing);
-      ENVOY_LOG(trace, "maglev: i={} address={} host={}", i, table_[i]->address()->asString(),
+      const HostConstSharedPtr& host = hosts_[table_[i]];
+      const absl::string_view key_to_hash = hashKey(host, use_hostname_for_hashing);
+      ENVOY_LOG(trace, "maglev: i={} address={} host={}", i, host->address()->asString(),
                 key_to_hash);
     }
   }
@@ -85,20 +86,26 @@ HostConstSharedPtr MaglevTable::chooseHost(uint64_t hash, uint32_t attempt) cons
     hash ^= ~0ULL - attempt + 1;
   }
 
-  return table_[hash % table_size_];
+  return hosts_[table_[hash % table_size_]];
 }
 
-uint64_t MaglevTable::permutation(const TableBuildEntry& entry) {
-  return (entry.offset_ + (entry.skip_ * entry.next_)) % table_size_;
+void MaglevTable::advance(TableBuildEntry& entry) const {
+  // Both the position and the skip are smaller than the table size, so stepping the permutation
+  // only needs a subtraction rather than a division.
+  entry.next_ += entry.skip_;
+  if (entry.next_ >= table_size_) {
+    entry.next_ -= table_size_;
+  }
 }
 
 MaglevLoadBalancer::MaglevLoadBalancer(
-    const PrioritySet& priority_set, ClusterStats& stats, Stats::Scope& scope,
-    Runtime::Loader& runtime, Random::RandomGenerator& random,
+    const PrioritySet& priority_set, ClusterLbStats& stats, Stats::Scope& scope,
+    Runtime::Loader& runtime, Random::RandomGenerator& random, TimeSource& time_source,
     const absl::optional<envoy::config::cluster::v3::Cluster::MaglevLbConfig>& config,
     const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config)
     : ThreadAwareLoadBalancerBase(priority_set, stats, runtime, random, common_config),
       scope_(scope.createScope("maglev_lb.")), stats_(generateStats(*scope_)),
+      time_source_(time_source),
       table_size_(config ? PROTOBUF_GET_WRAPPED_OR_DEFAULT(config.value(), table_size,
                                                            MaglevTable::DefaultTableSize)
                          : MaglevTable::DefaultTableSize),
@@ -116,7 +123,7 @@ MaglevLoadBalancer::MaglevLoadBalancer(
 }
 
 MaglevLoadBalancerStats MaglevLoadBalancer::generateStats(Stats::Scope& scope) {
-  return {ALL_MAGLEV_LOAD_BALANCER_STATS(POOL_GAUGE(scope))};
+  return {ALL_MAGLEV_LOAD_BALANCER_STATS(POOL_GAUGE(scope), POOL_HISTOGRAM(scope))};
 }
 
 } // namespace Upstream
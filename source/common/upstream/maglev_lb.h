@@ -1,10 +1,16 @@
 #pragma once
 
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include "envoy/common/random_generator.h"
+#include "envoy/common/time.h"
 #include "envoy/config/cluster/v3/cluster.pb.h"
 #include "envoy/stats/scope.h"
 #include "envoy/stats/stats_macros.h"
 
+#include "common/stats/timespan_impl.h"
 #include "common/upstream/thread_aware_lb_impl.h"
 #include "common/upstream/upstream_impl.h"
 
@@ -14,15 +20,16 @@ namespace Upstream {
 /**
  * All Maglev load balancer stats. @see stats_macros.h
  */
-#define ALL_MAGLEV_LOAD_BALANCER_STATS(GAUGE)                                                      \
+#define ALL_MAGLEV_LOAD_BALANCER_STATS(GAUGE, HISTOGRAM)                                           \
   GAUGE(max_entries_per_host, Accumulate)                                                          \
-  GAUGE(min_entries_per_host, Accumulate)
+  GAUGE(min_entries_per_host, Accumulate)                                                          \
+  HISTOGRAM(table_build_time_us, Microseconds)
 
 /**
  * Struct definition for all Maglev load balancer stats. @see stats_macros.h
  */
 struct MaglevLoadBalancerStats {
-  ALL_MAGLEV_LOAD_BALANCER_STATS(GENERATE_GAUGE_STRUCT)
+  ALL_MAGLEV_LOAD_BALANCER_STATS(GENERATE_GAUGE_STRUCT, GENERATE_HISTOGRAM_STRUCT)
 };
 
 /**
@@ -46,22 +53,29 @@ public:
 
 private:
   struct TableBuildEntry {
-    TableBuildEntry(const HostConstSharedPtr& host, uint64_t offset, uint64_t skip, double weight)
-        : host_(host), offset_(offset), skip_(skip), weight_(weight) {}
+    TableBuildEntry(uint64_t offset, uint64_t skip, double weight)
+        : skip_(skip), weight_(weight), next_(offset) {}
 
-    HostConstSharedPtr host_;
-    const uint64_t offset_;
     const uint64_t skip_;
     const double weight_;
     double target_weight_{};
-    uint64_t next_{};
+    // The next position of the host's permutation, i.e. (offset + skip * j) % table size for the
+    // number j of positions already tried.
+    uint64_t next_;
     uint64_t count_{};
   };
 
-  uint64_t permutation(const TableBuildEntry& entry);
+  // Marks the table slots that are not yet filled while building the table.
+  static constexpr uint32_t EmptySlot = std::numeric_limits<uint32_t>::max();
+
+  void advance(TableBuildEntry& entry) const;
 
   const uint64_t table_size_;
-  std::vector<HostConstSharedPtr> table_;
+  // The table holds indexes into hosts_ rather than the hosts themselves, which makes it 4 times
+  // smaller and spares an atomic reference count update per slot when the table is built and
+  // destroyed.
+  std::vector<HostConstSharedPtr> hosts_;
+  std::vector<uint32_t> table_;
   MaglevLoadBalancerStats& stats_;
 };
 
@@ -72,8 +86,8 @@ class MaglevLoadBalancer : public ThreadAwareLoadBalancerBase,
                            Logger::Loggable<Logger::Id::upstream> {
 public:
   MaglevLoadBalancer(
-      const PrioritySet& priority_set, ClusterStats& stats, Stats::Scope& scope,
-      Runtime::Loader& runtime, Random::RandomGenerator& random,
+      const PrioritySet& priority_set, ClusterLbStats& stats, Stats::Scope& scope,
+      Runtime::Loader& runtime, Random::RandomGenerator& random, TimeSource& time_source,
       const absl::optional<envoy::config::cluster::v3::Cluster::MaglevLbConfig>& config,
       const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config);
 
@@ -85,9 +99,11 @@ private:
   HashingLoadBalancerSharedPtr
   createLoadBalancer(const NormalizedHostWeightVector& normalized_host_weights,
                      double /* min_normalized_weight */, double max_normalized_weight) override {
+    Stats::HistogramCompletableTimespanImpl build_timer(stats_.table_build_time_us_, time_source_);
     HashingLoadBalancerSharedPtr maglev_lb =
         std::make_shared<MaglevTable>(normalized_host_weights, max_normalized_weight, table_size_,
                                       use_hostname_for_hashing_, stats_);
+    build_timer.complete();
 
     if (hash_balance_factor_ == 0) {
       return maglev_lb;
@@ -101,6 +117,7 @@ private:
 
   Stats::ScopePtr scope_;
   MaglevLoadBalancerStats stats_;
+  TimeSource& time_source_;
   const uint64_t table_size_;
   const bool use_hostname_for_hashing_;
   const uint32_t hash_balance_factor_;
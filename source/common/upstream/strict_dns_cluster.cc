@@ -106,7 +106,7 @@ StrictDnsClusterImpl::ResolveTarget::~ResolveTarget() {
 
 void StrictDnsClusterImpl::ResolveTarget::startResolve() {
   ENVOY_LOG(trace, "starting async DNS resolution for {}", dns_address_);
-  parent_.info_->stats().update_attempt_.inc();
+  parent_.info_->configUpdateStats().update_attempt_.inc();
 
   active_query_ = parent_.dns_resolver_->resolve(
       dns_address_, parent_.dns_lookup_family_,
@@ -118,7 +118,7 @@ void StrictDnsClusterImpl::ResolveTarget::startResolve() {
         std::chrono::milliseconds final_refresh_rate = parent_.dns_refresh_rate_ms_;
 
         if (status == Network::DnsResolver::ResolutionStatus::Success) {
-          parent_.info_->stats().update_success_.inc();
+          parent_.info_->configUpdateStats().update_success_.inc();
 
           HostMap updated_hosts;
           HostVector new_hosts;
@@ -152,7 +152,7 @@ void StrictDnsClusterImpl::ResolveTarget::startResolve() {
             }));
             parent_.updateAllHosts(hosts_added, hosts_removed, locality_lb_endpoints_.priority());
           } else {
-            parent_.info_->stats().update_no_rebuild_.inc();
+            parent_.info_->configUpdateStats().update_no_rebuild_.inc();
           }
 
           all_hosts_ = std::move(updated_hosts);
@@ -169,7 +169,7 @@ void StrictDnsClusterImpl::ResolveTarget::startResolve() {
           ENVOY_LOG(debug, "DNS refresh rate reset for {}, refresh rate {} ms", dns_address_,
                     final_refresh_rate.count());
         } else {
-          parent_.info_->stats().update_failure_.inc();
+          parent_.info_->configUpdateStats().update_failure_.inc();
 
           final_refresh_rate =
               std::chrono::milliseconds(parent_.failure_backoff_strategy_->nextBackOffMs());
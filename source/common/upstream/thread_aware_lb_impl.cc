@@ -95,13 +95,20 @@ void ThreadAwareLoadBalancerBase::initialize() {
   // complicated initialization as the load balancer would need its own initialized callback. I
   // think the synchronous/asynchronous split is probably the best option.
   priority_update_cb_ = priority_set_.addPriorityUpdateCb(
-      [this](uint32_t, const HostVector&, const HostVector&) -> void { refresh(); });
+      [this](uint32_t priority, const HostVector&, const HostVector&) -> void {
+        refresh(priority);
+      });
 
   refresh();
 }
 
-void ThreadAwareLoadBalancerBase::refresh() {
-  auto per_priority_state_vector = std::make_shared<std::vector<PerPriorityStatePtr>>(
+void ThreadAwareLoadBalancerBase::refresh(absl::optional<uint32_t> updated_priority) {
+  std::shared_ptr<std::vector<PerPriorityStateSharedPtr>> previous_state_vector;
+  if (updated_priority.has_value()) {
+    absl::ReaderMutexLock lock(&factory_->mutex_);
+    previous_state_vector = factory_->per_priority_state_;
+  }
+  auto per_priority_state_vector = std::make_shared<std::vector<PerPriorityStateSharedPtr>>(
       priority_set_.hostSetsPerPriority().size());
   auto healthy_per_priority_load =
       std::make_shared<HealthyLoad>(per_priority_load_.healthy_priority_load_);
@@ -110,7 +117,15 @@ void ThreadAwareLoadBalancerBase::refresh() {
 
   for (const auto& host_set : priority_set_.hostSetsPerPriority()) {
     const uint32_t priority = host_set->priority();
-    (*per_priority_state_vector)[priority] = std::make_unique<PerPriorityState>();
+    // Each host set update is delivered separately, so the hosts of other priorities are as they
+    // were when their load balancers were built.
+    if (updated_priority.has_value() && priority != updated_priority.value() &&
+        previous_state_vector != nullptr && priority < previous_state_vector->size() &&
+        (*previous_state_vector)[priority]->global_panic_ == per_priority_panic_[priority]) {
+      (*per_priority_state_vector)[priority] = (*previous_state_vector)[priority];
+      continue;
+    }
+    (*per_priority_state_vector)[priority] = std::make_shared<PerPriorityState>();
     const auto& per_priority_state = (*per_priority_state_vector)[priority];
     // Copy panic flag from LoadBalancerBase. It is calculated when there is a change
     // in hosts set or hosts' health.
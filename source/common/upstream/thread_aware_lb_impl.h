@@ -10,6 +10,7 @@
 
 #include "absl/strings/string_view.h"
 #include "absl/synchronization/mutex.h"
+#include "absl/types/optional.h"
 
 namespace Envoy {
 namespace Upstream {
@@ -96,7 +97,7 @@ public:
 
 protected:
   ThreadAwareLoadBalancerBase(
-      const PrioritySet& priority_set, ClusterStats& stats, Runtime::Loader& runtime,
+      const PrioritySet& priority_set, ClusterLbStats& stats, Runtime::Loader& runtime,
       Random::RandomGenerator& random,
       const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config)
       : LoadBalancerBase(priority_set, stats, runtime, random, common_config),
@@ -107,10 +108,11 @@ private:
     std::shared_ptr<HashingLoadBalancer> current_lb_;
     bool global_panic_{};
   };
-  using PerPriorityStatePtr = std::unique_ptr<PerPriorityState>;
+  // Shared so that the state of priorities that did not change can be reused after an update.
+  using PerPriorityStateSharedPtr = std::shared_ptr<PerPriorityState>;
 
   struct LoadBalancerImpl : public LoadBalancer {
-    LoadBalancerImpl(ClusterStats& stats, Random::RandomGenerator& random)
+    LoadBalancerImpl(ClusterLbStats& stats, Random::RandomGenerator& random)
         : stats_(stats), random_(random) {}
 
     // Upstream::LoadBalancer
@@ -118,24 +120,25 @@ private:
     // Preconnect not implemented for hash based load balancing
     HostConstSharedPtr peekAnotherHost(LoadBalancerContext*) override { return nullptr; }
 
-    ClusterStats& stats_;
+    ClusterLbStats& stats_;
     Random::RandomGenerator& random_;
-    std::shared_ptr<std::vector<PerPriorityStatePtr>> per_priority_state_;
+    std::shared_ptr<std::vector<PerPriorityStateSharedPtr>> per_priority_state_;
     std::shared_ptr<HealthyLoad> healthy_per_priority_load_;
     std::shared_ptr<DegradedLoad> degraded_per_priority_load_;
   };
 
   struct LoadBalancerFactoryImpl : public LoadBalancerFactory {
-    LoadBalancerFactoryImpl(ClusterStats& stats, Random::RandomGenerator& random)
+    LoadBalancerFactoryImpl(ClusterLbStats& stats, Random::RandomGenerator& random)
         : stats_(stats), random_(random) {}
 
     // Upstream::LoadBalancerFactory
     LoadBalancerPtr create() override;
 
-    ClusterStats& stats_;
+    ClusterLbStats& stats_;
     Random::RandomGenerator& random_;
     absl::Mutex mutex_;
-    std::shared_ptr<std::vector<PerPriorityStatePtr>> per_priority_state_ ABSL_GUARDED_BY(mutex_);
+    std::shared_ptr<std::vector<PerPriorityStateSharedPtr>> per_priority_state_
+        ABSL_GUARDED_BY(mutex_);
     // This is split out of PerPriorityState so LoadBalancerBase::ChoosePriority can be reused.
     std::shared_ptr<HealthyLoad> healthy_per_priority_load_ ABSL_GUARDED_BY(mutex_);
     std::shared_ptr<DegradedLoad> degraded_per_priority_load_ ABSL_GUARDED_BY(mutex_);
@@ -144,7 +147,9 @@ private:
   virtual HashingLoadBalancerSharedPtr
   createLoadBalancer(const NormalizedHostWeightVector& normalized_host_weights,
                      double min_normalized_weight, double max_normalized_weight) PURE;
-  void refresh();
+  // Rebuilds the load balancers of all priorities, or only of updated_priority if it is set. The
+  // load balancers of other priorities are then reused unless their panic state changed.
+  void refresh(absl::optional<uint32_t> updated_priority = absl::nullopt);
 
   std::shared_ptr<LoadBalancerFactoryImpl> factory_;
   Common::CallbackHandlePtr priority_update_cb_;
@@ -222,6 +222,24 @@ bool updateHealthFlag(const Host& updated_host, Host& existing_host, Host::Healt
   return false;
 }
 
+// @return bool whether two HostsPerLocality are known to have the same localities, in the same
+// order. Empty localities can't be identified, so they never compare the same.
+bool sameLocalities(const HostsPerLocality& hosts, const HostsPerLocality& other_hosts) {
+  if (hosts.hasLocalLocality() != other_hosts.hasLocalLocality() ||
+      hosts.get().size() != other_hosts.get().size()) {
+    return false;
+  }
+  for (size_t i = 0; i < hosts.get().size(); ++i) {
+    const HostVector& locality_hosts = hosts.get()[i];
+    const HostVector& other_locality_hosts = other_hosts.get()[i];
+    if (locality_hosts.empty() || other_locality_hosts.empty() ||
+        !LocalityEqualTo()(locality_hosts[0]->locality(), other_locality_hosts[0]->locality())) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // Converts a set of hosts into a HostVector, excluding certain hosts.
 // @param hosts hosts to convert
 // @param excluded_hosts hosts to exclude from the resulting vector.
@@ -402,6 +420,7 @@ void HostSetImpl::updateHosts(PrioritySet::UpdateHostsParams&& update_hosts_para
   healthy_hosts_per_locality_ = std::move(update_hosts_params.healthy_hosts_per_locality);
   degraded_hosts_per_locality_ = std::move(update_hosts_params.degraded_hosts_per_locality);
   excluded_hosts_per_locality_ = std::move(update_hosts_params.excluded_hosts_per_locality);
+  delta_only_ = update_hosts_params.delta_only;
   locality_weights_ = std::move(locality_weights);
 
   rebuildLocalityScheduler(healthy_locality_scheduler_, healthy_locality_entries_,
@@ -615,6 +634,35 @@ ClusterStats ClusterInfoImpl::generateStats(Stats::Scope& scope,
   return ClusterStats(stat_names, scope);
 }
 
+ClusterStats& ClusterInfoImpl::createStats() const {
+  return *stats_.get([this]() { return new ClusterStats(stat_names_, *stats_scope_); });
+}
+
+ClusterLoadReportStats& ClusterInfoImpl::createLoadReportStats() const {
+  return load_report_stats_
+      .get([this]() {
+        return new LoadReportStats(stats_scope_->symbolTable(), load_report_stat_names_);
+      })
+      ->stats_;
+}
+
+ClusterConfigUpdateStats
+ClusterInfoImpl::generateConfigUpdateStats(Stats::Scope& scope,
+                                           const ClusterConfigUpdateStatNames& stat_names) {
+  return ClusterConfigUpdateStats(stat_names, scope);
+}
+
+ClusterEndpointStats
+ClusterInfoImpl::generateEndpointStats(Stats::Scope& scope,
+                                       const ClusterEndpointStatNames& stat_names) {
+  return ClusterEndpointStats(stat_names, scope);
+}
+
+ClusterLbStats ClusterInfoImpl::generateLbStats(Stats::Scope& scope,
+                                                const ClusterLbStatNames& stat_names) {
+  return ClusterLbStats(stat_names, scope);
+}
+
 ClusterRequestResponseSizeStats ClusterInfoImpl::generateRequestResponseSizeStats(
     Stats::Scope& scope, const ClusterRequestResponseSizeStatNames& stat_names) {
   return ClusterRequestResponseSizeStats(stat_names, scope);
@@ -750,10 +798,15 @@ ClusterInfoImpl::ClusterInfoImpl(
       per_connection_buffer_limit_bytes_(
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, per_connection_buffer_limit_bytes, 1024 * 1024)),
       socket_matcher_(std::move(socket_matcher)), stats_scope_(std::move(stats_scope)),
-      stats_(generateStats(*stats_scope_, factory_context.clusterManager().clusterStatNames())),
-      load_report_stats_store_(stats_scope_->symbolTable()),
-      load_report_stats_(generateLoadReportStats(
-          load_report_stats_store_, factory_context.clusterManager().clusterLoadReportStatNames())),
+      stat_names_(factory_context.clusterManager().clusterStatNames()),
+      load_report_stat_names_(factory_context.clusterManager().clusterLoadReportStatNames()),
+      stats_placeholder_(factory_context.clusterManager().clusterStatsPlaceholder()),
+      config_update_stats_(generateConfigUpdateStats(
+          *stats_scope_, factory_context.clusterManager().clusterConfigUpdateStatNames())),
+      endpoint_stats_(generateEndpointStats(
+          *stats_scope_, factory_context.clusterManager().clusterEndpointStatNames())),
+      lb_stats_(
+          generateLbStats(*stats_scope_, factory_context.clusterManager().clusterLbStatNames())),
       optional_cluster_stats_((config.has_track_cluster_stats() || config.track_timeout_budgets())
                                   ? std::make_unique<OptionalClusterStats>(
                                         config, *stats_scope_, factory_context.clusterManager())
@@ -789,6 +842,11 @@ ClusterInfoImpl::ClusterInfoImpl(
               : absl::nullopt),
       factory_context_(
           std::make_unique<FactoryContextImpl>(*stats_scope_, runtime, factory_context)) {
+  if (stats_placeholder_ == nullptr) {
+    createStats();
+    createLoadReportStats();
+  }
+
   switch (config.lb_policy()) {
   case envoy::config::cluster::v3::Cluster::ROUND_ROBIN:
     lb_type_ = LoadBalancerType::RoundRobin;
@@ -995,7 +1053,7 @@ ClusterImplBase::ClusterImplBase(
   priority_update_cb_ = priority_set_.addPriorityUpdateCb(
       [this](uint32_t, const HostVector& hosts_added, const HostVector& hosts_removed) {
         if (!hosts_added.empty() || !hosts_removed.empty()) {
-          info_->stats().membership_change_.inc();
+          info_->endpointStats().membership_change_.inc();
         }
 
         uint32_t healthy_hosts = 0;
@@ -1008,10 +1066,10 @@ ClusterImplBase::ClusterImplBase(
           degraded_hosts += host_set->degradedHosts().size();
           excluded_hosts += host_set->excludedHosts().size();
         }
-        info_->stats().membership_total_.set(hosts);
-        info_->stats().membership_healthy_.set(healthy_hosts);
-        info_->stats().membership_degraded_.set(degraded_hosts);
-        info_->stats().membership_excluded_.set(excluded_hosts);
+        info_->endpointStats().membership_total_.set(hosts);
+        info_->endpointStats().membership_healthy_.set(healthy_hosts);
+        info_->endpointStats().membership_degraded_.set(degraded_hosts);
+        info_->endpointStats().membership_excluded_.set(excluded_hosts);
       });
 }
 
@@ -1389,7 +1447,7 @@ void PriorityStateManager::updateClusterPrioritySet(
     const uint32_t priority, HostVectorSharedPtr&& current_hosts,
     const absl::optional<HostVector>& hosts_added, const absl::optional<HostVector>& hosts_removed,
     const absl::optional<Upstream::Host::HealthFlag> health_checker_flag,
-    absl::optional<uint32_t> overprovisioning_factor) {
+    absl::optional<uint32_t> overprovisioning_factor, bool delta_only) {
   // If local locality is not defined then skip populating per locality hosts.
   const auto& local_locality = local_info_node_.locality();
   ENVOY_LOG(trace, "Local locality: {}", local_locality.DebugString());
@@ -1450,17 +1508,26 @@ void PriorityStateManager::updateClusterPrioritySet(
   auto per_locality_shared =
       std::make_shared<HostsPerLocalityImpl>(std::move(per_locality), non_empty_local_locality);
 
+  PrioritySet::UpdateHostsParams update_hosts_params =
+      HostSetImpl::partitionHosts(hosts, per_locality_shared);
+  // Load balancers refer to localities by their index, so the update can only be applied as a delta
+  // if it leaves the localities and their order as they were.
+  const auto& host_sets = parent_.prioritySet().hostSetsPerPriority();
+  update_hosts_params.delta_only =
+      delta_only && host_sets.size() > priority &&
+      sameLocalities(host_sets[priority]->hostsPerLocality(), *per_locality_shared);
+
   // If a batch update callback was provided, use that. Otherwise directly update
   // the PrioritySet.
   if (update_cb_ != nullptr) {
-    update_cb_->updateHosts(priority, HostSetImpl::partitionHosts(hosts, per_locality_shared),
-                            std::move(locality_weights), hosts_added.value_or(*hosts),
-                            hosts_removed.value_or<HostVector>({}), overprovisioning_factor);
+    update_cb_->updateHosts(priority, std::move(update_hosts_params), std::move(locality_weights),
+                            hosts_added.value_or(*hosts), hosts_removed.value_or<HostVector>({}),
+                            overprovisioning_factor);
   } else {
-    parent_.prioritySet().updateHosts(
-        priority, HostSetImpl::partitionHosts(hosts, per_locality_shared),
-        std::move(locality_weights), hosts_added.value_or(*hosts),
-        hosts_removed.value_or<HostVector>({}), overprovisioning_factor);
+    parent_.prioritySet().updateHosts(priority, std::move(update_hosts_params),
+                                      std::move(locality_weights), hosts_added.value_or(*hosts),
+                                      hosts_removed.value_or<HostVector>({}),
+                                      overprovisioning_factor);
   }
 }
 
@@ -1468,7 +1535,7 @@ bool BaseDynamicClusterImpl::updateDynamicHostList(
     const HostVector& new_hosts, HostVector& current_priority_hosts,
     HostVector& hosts_added_to_current_priority, HostVector& hosts_removed_from_current_priority,
     HostMap& updated_hosts, const HostMap& all_hosts,
-    const absl::flat_hash_set<std::string>& all_new_hosts) {
+    const absl::flat_hash_set<std::string>& all_new_hosts, bool* delta_only) {
   uint64_t max_host_weight = 1;
 
   // Did hosts change?
@@ -1484,6 +1551,10 @@ bool BaseDynamicClusterImpl::updateDynamicHostList(
   // updates to the Cluster object. This will probably make sense to do in
   // conjunction with https://github.com/envoyproxy/envoy/issues/2874.
   bool hosts_changed = false;
+  // Whether the health or metadata of a host that stays in the priority changed. Weight changes are
+  // tracked separately, since they only cause a rebuild when the runtime feature below is enabled.
+  bool existing_hosts_changed = false;
+  bool existing_host_weights_changed = false;
 
   // Go through and see if the list we have is different from what we just got. If it is, we make a
   // new host list and raise a change notification. We also check for duplicates here. It's
@@ -1531,6 +1602,7 @@ bool BaseDynamicClusterImpl::updateDynamicHostList(
       }
       if (existing_host->second->weight() != host->weight()) {
         existing_host->second->weight(host->weight());
+        existing_host_weights_changed = true;
         if (Runtime::runtimeFeatureEnabled(
                 "envoy.reloadable_features.upstream_host_weight_change_causes_rebuild")) {
           // We do full host set rebuilds so that load balancers can do pre-computation of data
@@ -1541,9 +1613,9 @@ bool BaseDynamicClusterImpl::updateDynamicHostList(
         }
       }
 
-      hosts_changed |=
+      existing_hosts_changed |=
           updateHealthFlag(*host, *existing_host->second, Host::HealthFlag::FAILED_EDS_HEALTH);
-      hosts_changed |=
+      existing_hosts_changed |=
           updateHealthFlag(*host, *existing_host->second, Host::HealthFlag::DEGRADED_EDS_HEALTH);
 
       // Did metadata change?
@@ -1566,7 +1638,7 @@ bool BaseDynamicClusterImpl::updateDynamicHostList(
         existing_host->second->canary(host->canary());
 
         // If metadata changed, we need to rebuild. See github issue #3810.
-        hosts_changed = true;
+        existing_hosts_changed = true;
       }
 
       // Did the priority change?
@@ -1665,7 +1737,7 @@ bool BaseDynamicClusterImpl::updateDynamicHostList(
 
   // At this point we've accounted for all the new hosts as well the hosts that previously
   // existed in this priority.
-  info_->stats().max_host_weight_.set(max_host_weight);
+  info_->endpointStats().max_host_weight_.set(max_host_weight);
 
   // Whatever remains in current_priority_hosts should be removed.
   if (!hosts_added_to_current_priority.empty() || !current_priority_hosts.empty()) {
@@ -1676,6 +1748,10 @@ bool BaseDynamicClusterImpl::updateDynamicHostList(
   // During the update we populated final_hosts with all the hosts that should remain
   // in the current priority, so move them back into current_priority_hosts.
   current_priority_hosts = std::move(final_hosts);
+  if (delta_only != nullptr) {
+    *delta_only = !existing_hosts_changed && !existing_host_weights_changed;
+  }
+  hosts_changed |= existing_hosts_changed;
   // We return false here in the absence of EDS health status or metadata changes, because we
   // have no changes to host vector status (modulo weights). When we have EDS
   // health status or metadata changed, we return true, causing updateHosts() to fire in the
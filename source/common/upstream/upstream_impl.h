@@ -357,6 +357,7 @@ public:
   absl::optional<uint32_t> chooseDegradedLocality() override;
   uint32_t priority() const override { return priority_; }
   uint32_t overprovisioningFactor() const override { return overprovisioning_factor_; }
+  bool deltaOnly() const override { return delta_only_; }
 
   static PrioritySet::UpdateHostsParams
   updateHostsParams(HostVectorConstSharedPtr hosts,
@@ -393,6 +394,7 @@ private:
 
   uint32_t priority_;
   uint32_t overprovisioning_factor_;
+  bool delta_only_{};
   HostVectorConstSharedPtr hosts_;
   HealthyHostVectorConstSharedPtr healthy_hosts_;
   DegradedHostVectorConstSharedPtr degraded_hosts_;
@@ -546,6 +548,11 @@ public:
 
   static ClusterStats generateStats(Stats::Scope& scope,
                                     const ClusterStatNames& cluster_stat_names);
+  static ClusterConfigUpdateStats
+  generateConfigUpdateStats(Stats::Scope& scope, const ClusterConfigUpdateStatNames& stat_names);
+  static ClusterEndpointStats generateEndpointStats(Stats::Scope& scope,
+                                                    const ClusterEndpointStatNames& stat_names);
+  static ClusterLbStats generateLbStats(Stats::Scope& scope, const ClusterLbStatNames& stat_names);
   static ClusterLoadReportStats
   generateLoadReportStats(Stats::Scope& scope, const ClusterLoadReportStatNames& stat_names);
   static ClusterCircuitBreakersStats
@@ -619,7 +626,17 @@ public:
   const std::string& observabilityName() const override { return observability_name_; }
   ResourceManager& resourceManager(ResourcePriority priority) const override;
   TransportSocketMatcher& transportSocketMatcher() const override { return *socket_matcher_; }
-  ClusterStats& stats() const override { return stats_; }
+  ClusterStats& stats() const override {
+    ClusterStats* stats = stats_.getExisting();
+    return stats != nullptr ? *stats : createStats();
+  }
+  const ClusterStats& readOnlyStats() const override {
+    const ClusterStats* stats = stats_.getExisting();
+    return stats != nullptr ? *stats : *stats_placeholder_;
+  }
+  ClusterConfigUpdateStats& configUpdateStats() const override { return config_update_stats_; }
+  ClusterEndpointStats& endpointStats() const override { return endpoint_stats_; }
+  ClusterLbStats& lbStats() const override { return lb_stats_; }
   Stats::Scope& statsScope() const override { return *stats_scope_; }
 
   ClusterRequestResponseSizeStatsOptRef requestResponseSizeStats() const override {
@@ -631,7 +648,10 @@ public:
     return std::ref(*(optional_cluster_stats_->request_response_size_stats_));
   }
 
-  ClusterLoadReportStats& loadReportStats() const override { return load_report_stats_; }
+  ClusterLoadReportStats& loadReportStats() const override {
+    LoadReportStats* stats = load_report_stats_.getExisting();
+    return stats != nullptr ? stats->stats_ : createLoadReportStats();
+  }
 
   ClusterTimeoutBudgetStatsOptRef timeoutBudgetStats() const override {
     if (optional_cluster_stats_ == nullptr ||
@@ -702,6 +722,21 @@ private:
     const ClusterRequestResponseSizeStatsPtr request_response_size_stats_;
   };
 
+  // The load report stats are kept in their own store, as they are latched by the
+  // LoadStatsReporter rather than flushed to stats sinks.
+  struct LoadReportStats {
+    LoadReportStats(Stats::SymbolTable& symbol_table, const ClusterLoadReportStatNames& stat_names)
+        : store_(symbol_table), stats_(generateLoadReportStats(store_, stat_names)) {}
+
+    Stats::IsolatedStoreImpl store_;
+    ClusterLoadReportStats stats_;
+  };
+
+  // Create the traffic and load report stats of this cluster, which are created on first use
+  // with lazy_cluster_stats.
+  ClusterStats& createStats() const;
+  ClusterLoadReportStats& createLoadReportStats() const;
+
   Runtime::Loader& runtime_;
   const std::string name_;
   const std::string observability_name_;
@@ -718,9 +753,15 @@ private:
   const uint32_t per_connection_buffer_limit_bytes_;
   TransportSocketMatcherPtr socket_matcher_;
   Stats::ScopePtr stats_scope_;
-  mutable ClusterStats stats_;
-  Stats::IsolatedStoreImpl load_report_stats_store_;
-  mutable ClusterLoadReportStats load_report_stats_;
+  const ClusterStatNames& stat_names_;
+  const ClusterLoadReportStatNames& load_report_stat_names_;
+  const ClusterStats* const stats_placeholder_;
+  mutable Thread::AtomicPtr<ClusterStats, Thread::AtomicPtrAllocMode::DeleteOnDestruct> stats_;
+  mutable Thread::AtomicPtr<LoadReportStats, Thread::AtomicPtrAllocMode::DeleteOnDestruct>
+      load_report_stats_;
+  mutable ClusterConfigUpdateStats config_update_stats_;
+  mutable ClusterEndpointStats endpoint_stats_;
+  mutable ClusterLbStats lb_stats_;
   const std::unique_ptr<OptionalClusterStats> optional_cluster_stats_;
   const uint64_t features_;
   mutable ResourceManagers resource_managers_;
@@ -912,7 +953,8 @@ public:
                            const absl::optional<HostVector>& hosts_added,
                            const absl::optional<HostVector>& hosts_removed,
                            const absl::optional<Upstream::Host::HealthFlag> health_checker_flag,
-                           absl::optional<uint32_t> overprovisioning_factor = absl::nullopt);
+                           absl::optional<uint32_t> overprovisioning_factor = absl::nullopt,
+                           bool delta_only = false);
 
   // Returns the saved priority state.
   PriorityState& priorityState() { return priority_state_; }
@@ -947,13 +989,17 @@ protected:
    * be updated with the hosts that remain in this priority after the update.
    * @param all_hosts all known hosts prior to this host update across all priorities.
    * @param all_new_hosts addresses of all hosts in the new configuration across all priorities.
+   * @param delta_only if not null, will be set to whether the only changes to the priority are the
+   * hosts added to and removed from it, i.e. no host that stays in the priority changed its health,
+   * weight or metadata.
    * @return whether the hosts for the priority changed.
    */
   bool updateDynamicHostList(const HostVector& new_hosts, HostVector& current_priority_hosts,
                              HostVector& hosts_added_to_current_priority,
                              HostVector& hosts_removed_from_current_priority,
                              HostMap& updated_hosts, const HostMap& all_hosts,
-                             const absl::flat_hash_set<std::string>& all_new_hosts);
+                             const absl::flat_hash_set<std::string>& all_new_hosts,
+                             bool* delta_only = nullptr);
 };
 
 /**
@@ -51,7 +51,8 @@ MainCommonBase::MainCommonBase(const Server::Options& options, Event::TimeSystem
                                std::unique_ptr<Random::RandomGenerator>&& random_generator,
                                std::unique_ptr<ProcessContext> process_context)
     : platform_impl_(std::move(platform_impl)), options_(options),
-      component_factory_(component_factory), stats_allocator_(symbol_table_) {
+      component_factory_(component_factory),
+      symbol_table_(options.concurrentSymbolTableEnabled()), stats_allocator_(symbol_table_) {
   // Process the option to disable extensions as early as possible,
   // before we do any configuration loading.
   OptionsImpl::disableExtensions(options.disabledExtensions());
@@ -147,7 +147,7 @@ void HealthCheckFilter::onComplete() {
 
           break;
         }
-        const auto& stats = cluster->info()->stats();
+        const auto& stats = cluster->info()->endpointStats();
         const uint64_t membership_total = stats.membership_total_.value();
         if (membership_total == 0) {
           // If the cluster exists but is empty, consider the service unhealthy unless
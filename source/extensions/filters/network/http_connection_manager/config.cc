@@ -530,6 +530,7 @@ HttpConnectionManagerConfig::HttpConnectionManagerConfig(
   if (!status.ok()) {
     throw EnvoyException(std::string(status.message()));
   }
+  frozen_filter_factories_ = freezeFilterFactories(filter_factories_);
 
   for (const auto& upgrade_config : config.upgrade_configs()) {
     const std::string& name = upgrade_config.upgrade_type();
@@ -553,8 +554,9 @@ HttpConnectionManagerConfig::HttpConnectionManagerConfig(
         throw EnvoyException(std::string(status.message()));
       }
 
-      upgrade_filter_factories_.emplace(
-          std::make_pair(name, FilterConfig{std::move(factories), enabled}));
+      absl::optional<FrozenFilterFactories> frozen_factories = freezeFilterFactories(*factories);
+      upgrade_filter_factories_.emplace(std::make_pair(
+          name, FilterConfig{std::move(factories), enabled, std::move(frozen_factories)}));
     } else {
       std::unique_ptr<FilterFactoriesList> factories(nullptr);
       upgrade_filter_factories_.emplace(
@@ -666,8 +668,36 @@ HttpConnectionManagerConfig::createCodec(Network::Connection& connection,
   NOT_REACHED_GCOVR_EXCL_LINE;
 }
 
+absl::optional<HttpConnectionManagerConfig::FrozenFilterFactories>
+HttpConnectionManagerConfig::freezeFilterFactories(const FilterFactoriesList& filter_factories) {
+  FrozenFilterFactories frozen_filter_factories;
+  frozen_filter_factories.reserve(filter_factories.size());
+  for (const auto& filter_config_provider : filter_factories) {
+    // The config of a dynamic filter may be missing or updated at any time.
+    if (dynamic_cast<const Filter::Http::DynamicFilterConfigProvider*>(
+            filter_config_provider.get()) != nullptr) {
+      return absl::nullopt;
+    }
+    auto config = filter_config_provider->config();
+    if (!config.has_value()) {
+      return absl::nullopt;
+    }
+    frozen_filter_factories.push_back(std::move(config.value()));
+  }
+  return frozen_filter_factories;
+}
+
 void HttpConnectionManagerConfig::createFilterChainForFactories(
-    Http::FilterChainFactoryCallbacks& callbacks, const FilterFactoriesList& filter_factories) {
+    Http::FilterChainFactoryCallbacks& callbacks, const FilterFactoriesList& filter_factories,
+    const absl::optional<FrozenFilterFactories>& frozen_filter_factories) {
+  if (frozen_filter_factories.has_value()) {
+    // Run the factory callbacks in place rather than copying them out of their providers.
+    for (const Http::FilterFactoryCb& factory : frozen_filter_factories.value()) {
+      factory(callbacks);
+    }
+    return;
+  }
+
   bool added_missing_config_filter = false;
   for (const auto& filter_config_provider : filter_factories) {
     auto config = filter_config_provider->config();
@@ -689,7 +719,7 @@ void HttpConnectionManagerConfig::createFilterChainForFactories(
 }
 
 void HttpConnectionManagerConfig::createFilterChain(Http::FilterChainFactoryCallbacks& callbacks) {
-  createFilterChainForFactories(callbacks, filter_factories_);
+  createFilterChainForFactories(callbacks, filter_factories_, frozen_filter_factories_);
 }
 
 bool HttpConnectionManagerConfig::createUpgradeFilterChain(
@@ -715,12 +745,12 @@ bool HttpConnectionManagerConfig::createUpgradeFilterChain(
     // or neither is configured for this upgrade.
     return false;
   }
-  FilterFactoriesList* filters_to_use = &filter_factories_;
   if (it != upgrade_filter_factories_.end() && it->second.filter_factories != nullptr) {
-    filters_to_use = it->second.filter_factories.get();
+    createFilterChainForFactories(callbacks, *it->second.filter_factories,
+                                  it->second.frozen_filter_factories);
+  } else {
+    createFilterChainForFactories(callbacks, filter_factories_, frozen_filter_factories_);
   }
-
-  createFilterChainForFactories(callbacks, *filters_to_use);
   return true;
 }
 
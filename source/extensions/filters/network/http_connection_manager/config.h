@@ -6,6 +6,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "envoy/config/config_provider_manager.h"
 #include "envoy/config/core/v3/extension.pb.h"
@@ -99,9 +100,13 @@ public:
   // Http::FilterChainFactory
   void createFilterChain(Http::FilterChainFactoryCallbacks& callbacks) override;
   using FilterFactoriesList = std::list<Filter::Http::FilterConfigProviderPtr>;
+  // The factory callbacks of a filter chain whose filters are all configured statically, resolved
+  // when the chain is configured as they never change.
+  using FrozenFilterFactories = std::vector<Http::FilterFactoryCb>;
   struct FilterConfig {
     std::unique_ptr<FilterFactoriesList> filter_factories;
     bool allow_upgrade;
+    absl::optional<FrozenFilterFactories> frozen_filter_factories;
   };
   bool createUpgradeFilterChain(absl::string_view upgrade_type,
                                 const Http::FilterChainFactory::UpgradeMap* per_route_upgrade_map,
@@ -201,8 +206,16 @@ private:
                              FilterFactoriesList& filter_factories,
                              const std::string& filter_chain_type,
                              bool last_filter_in_current_config);
-  void createFilterChainForFactories(Http::FilterChainFactoryCallbacks& callbacks,
-                                     const FilterFactoriesList& filter_factories);
+  void createFilterChainForFactories(
+      Http::FilterChainFactoryCallbacks& callbacks, const FilterFactoriesList& filter_factories,
+      const absl::optional<FrozenFilterFactories>& frozen_filter_factories);
+
+  /**
+   * @return the factory callbacks of the filter chain if none of its filters is configured through
+   *         filter config discovery, or absl::nullopt otherwise.
+   */
+  static absl::optional<FrozenFilterFactories>
+  freezeFilterFactories(const FilterFactoriesList& filter_factories);
 
   /**
    * Determines what tracing provider to use for a given
@@ -215,6 +228,7 @@ private:
   Http::RequestIDExtensionSharedPtr request_id_extension_;
   Server::Configuration::FactoryContext& context_;
   FilterFactoriesList filter_factories_;
+  absl::optional<FrozenFilterFactories> frozen_filter_factories_;
   std::map<std::string, FilterConfig> upgrade_filter_factories_;
   std::list<AccessLog::InstanceSharedPtr> access_logs_;
   const std::string stats_prefix_;
@@ -0,0 +1,67 @@
+#include "extensions/io_socket/io_uring/config.h"
+
+#include "envoy/extensions/network/socket_interface/v3/io_uring_socket_interface.pb.validate.h"
+#include "envoy/registry/registry.h"
+
+#include "common/io/io_uring_impl.h"
+#include "common/protobuf/utility.h"
+
+#include "extensions/io_socket/io_uring/io_uring_socket_handle_impl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace IoSocket {
+namespace IoUring {
+
+namespace {
+
+constexpr uint32_t DefaultIoUringSize = 300;
+constexpr uint32_t DefaultReadBufferSize = 8192;
+
+} // namespace
+
+Server::BootstrapExtensionPtr
+IoUringSocketInterface::createBootstrapExtension(const Protobuf::Message& message,
+                                                 Server::Configuration::ServerFactoryContext& context) {
+  const auto& config = MessageUtil::downcastAndValidate<
+      const envoy::extensions::network::socket_interface::v3::IoUringSocketInterface&>(
+      message, context.messageValidationVisitor());
+
+  if (Io::isIoUringSupported()) {
+    factory_ = std::make_shared<IoUringWorkerFactoryImpl>(
+        PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, io_uring_size, DefaultIoUringSize),
+        config.enable_submission_queue_polling(),
+        PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, read_buffer_size, DefaultReadBufferSize),
+        context.threadLocal());
+  } else {
+    ENVOY_LOG_MISC(warn, "io_uring is not supported by the kernel, falling back to system calls");
+    factory_ = nullptr;
+  }
+  return std::make_unique<IoUringSocketInterfaceExtension>(*this, factory_);
+}
+
+ProtobufTypes::MessagePtr IoUringSocketInterface::createEmptyConfigProto() {
+  return std::make_unique<
+      envoy::extensions::network::socket_interface::v3::IoUringSocketInterface>();
+}
+
+Network::IoHandlePtr IoUringSocketInterface::makeSocket(int socket_fd, bool socket_v6only,
+                                                        absl::optional<int> domain) const {
+  if (factory_ == nullptr) {
+    return Network::SocketInterfaceImpl::makeSocket(socket_fd, socket_v6only, domain);
+  }
+  return std::make_unique<IoUringSocketHandleImpl>(factory_, socket_fd, socket_v6only, domain);
+}
+
+void IoUringSocketInterfaceExtension::onServerInitialized() {
+  if (factory_ != nullptr) {
+    factory_->onServerInitialized();
+  }
+}
+
+REGISTER_FACTORY(IoUringSocketInterface, Server::Configuration::BootstrapExtensionFactory);
+
+} // namespace IoUring
+} // namespace IoSocket
+} // namespace Extensions
+} // namespace Envoy
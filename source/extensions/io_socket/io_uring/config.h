@@ -0,0 +1,55 @@
+#pragma once
+
+#include "envoy/extensions/network/socket_interface/v3/io_uring_socket_interface.pb.h"
+
+#include "common/network/socket_interface_impl.h"
+
+#include "extensions/io_socket/io_uring/io_uring_worker_impl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace IoSocket {
+namespace IoUring {
+
+/**
+ * Socket interface which creates IoUringSocketHandleImpl handles once configured as bootstrap
+ * extension. Until then, and on kernels lacking the required io_uring features, it behaves like
+ * the default socket interface.
+ */
+class IoUringSocketInterface : public Network::SocketInterfaceImpl {
+public:
+  // Server::Configuration::BootstrapExtensionFactory
+  Server::BootstrapExtensionPtr
+  createBootstrapExtension(const Protobuf::Message& config,
+                           Server::Configuration::ServerFactoryContext& context) override;
+  ProtobufTypes::MessagePtr createEmptyConfigProto() override;
+  std::string name() const override { return "envoy.io_socket.io_uring"; }
+
+protected:
+  // Network::SocketInterfaceImpl
+  Network::IoHandlePtr makeSocket(int socket_fd, bool socket_v6only,
+                                  absl::optional<int> domain) const override;
+
+private:
+  std::shared_ptr<IoUringWorkerFactoryImpl> factory_;
+};
+
+class IoUringSocketInterfaceExtension : public Network::SocketInterfaceExtension {
+public:
+  IoUringSocketInterfaceExtension(Network::SocketInterface& sock_interface,
+                                  std::shared_ptr<IoUringWorkerFactoryImpl> factory)
+      : Network::SocketInterfaceExtension(sock_interface), factory_(std::move(factory)) {}
+
+  // Server::BootstrapExtension
+  void onServerInitialized() override;
+
+private:
+  const std::shared_ptr<IoUringWorkerFactoryImpl> factory_;
+};
+
+DECLARE_FACTORY(IoUringSocketInterface);
+
+} // namespace IoUring
+} // namespace IoSocket
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,582 @@
+#include "extensions/io_socket/io_uring/io_uring_socket_handle_impl.h"
+
+#include <sys/socket.h>
+
+#include "envoy/api/os_sys_calls.h"
+
+#include "common/api/os_sys_calls_impl.h"
+#include "common/common/assert.h"
+#include "common/network/io_socket_error_impl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace IoSocket {
+namespace IoUring {
+
+namespace {
+
+// Upper bound on the number of slices handed to a single writev request, further data is written
+// once the request completes.
+constexpr uint64_t MaxWriteSlices = 16;
+
+Api::IoCallUint64Result ioErrorResult(int error) {
+  return Api::IoCallUint64Result(
+      0, error == SOCKET_ERROR_AGAIN
+             ? Api::IoErrorPtr(Network::IoSocketError::getIoSocketEagainInstance(),
+                               Network::IoSocketError::deleteIoError)
+             : Api::IoErrorPtr(new Network::IoSocketError(error),
+                               Network::IoSocketError::deleteIoError));
+}
+
+} // namespace
+
+class IoUringSocketHandleImpl::ReadRequest : public Request {
+public:
+  ReadRequest(IoUringSocketHandleImpl& parent, uint64_t length)
+      : parent_(&parent), reservation_(buf_.reserveSingleSlice(length)) {
+    iov_.iov_base = reservation_.slice().mem_;
+    iov_.iov_len = reservation_.slice().len_;
+  }
+
+  // Request
+  void onCompletion(int32_t result) override {
+    if (result > 0) {
+      reservation_.commit(result);
+    }
+    if (parent_ != nullptr) {
+      parent_->onReadCompleted(buf_, result);
+    }
+  }
+
+  IoUringSocketHandleImpl* parent_;
+  Buffer::OwnedImpl buf_;
+  Buffer::ReservationSingleSlice reservation_;
+  struct iovec iov_;
+};
+
+class IoUringSocketHandleImpl::WriteRequest : public Request {
+public:
+  WriteRequest(IoUringSocketHandleImpl* parent, IoUringWorker& worker, os_fd_t fd)
+      : parent_(parent), worker_(worker), fd_(fd) {}
+
+  static void submit(std::unique_ptr<WriteRequest>&& request) {
+    WriteRequest& req = *request;
+    Buffer::RawSliceVector slices = req.data_.getRawSlices(MaxWriteSlices);
+    req.iovecs_.resize(slices.size());
+    for (uint64_t i = 0; i < slices.size(); i++) {
+      req.iovecs_[i].iov_base = slices[i].mem_;
+      req.iovecs_[i].iov_len = slices[i].len_;
+    }
+    if (req.parent_ != nullptr) {
+      req.parent_->write_request_ = &req;
+    }
+    req.worker_.submitRequest(std::move(request), [&req](Io::IoUring& ring, void* user_data) {
+      return ring.prepareWritev(req.fd_, req.iovecs_.data(), req.iovecs_.size(), 0, user_data);
+    });
+  }
+
+  // Request
+  void onCompletion(int32_t result) override {
+    if (result > 0) {
+      data_.drain(result);
+    }
+    if ((result > 0 && data_.length() > 0) || result == -EAGAIN || result == -EINTR) {
+      // Short write, continue with the remaining data. The request object is released by the
+      // worker once this returns, so the data moves on to a new one.
+      auto next = std::make_unique<WriteRequest>(parent_, worker_, fd_);
+      next->data_.move(data_);
+      next->close_on_completion_ = close_on_completion_;
+      submit(std::move(next));
+      return;
+    }
+    if (parent_ != nullptr) {
+      parent_->onWriteCompleted(result < 0 ? result : 0);
+    } else if (close_on_completion_) {
+      worker_.submitRequestWithoutCompletion(
+          [fd = fd_](Io::IoUring& ring, void* user_data) { return ring.prepareClose(fd, user_data); });
+    }
+  }
+
+  IoUringSocketHandleImpl* parent_;
+  IoUringWorker& worker_;
+  const os_fd_t fd_;
+  Buffer::OwnedImpl data_;
+  std::vector<struct iovec> iovecs_;
+  // Set when the handle has been closed while the write was in flight, the descriptor is closed
+  // once all data has been handed to the kernel.
+  bool close_on_completion_{false};
+};
+
+class IoUringSocketHandleImpl::AcceptRequest : public Request {
+public:
+  explicit AcceptRequest(IoUringSocketHandleImpl& parent) : parent_(&parent) {
+    socket_.fd_ = INVALID_SOCKET;
+    socket_.remote_addr_len_ = sizeof(socket_.remote_addr_);
+  }
+
+  // Request
+  void onCompletion(int32_t result) override {
+    if (parent_ != nullptr) {
+      socket_.fd_ = result;
+      parent_->onAcceptCompleted(socket_, result);
+    } else if (result >= 0) {
+      // The listener went away while the connection was being accepted.
+      Api::OsSysCallsSingleton::get().close(result);
+    }
+  }
+
+  IoUringSocketHandleImpl* parent_;
+  AcceptedSocket socket_;
+};
+
+class IoUringSocketHandleImpl::ConnectRequest : public Request {
+public:
+  ConnectRequest(IoUringSocketHandleImpl& parent, Network::Address::InstanceConstSharedPtr address)
+      : parent_(&parent), address_(std::move(address)) {}
+
+  // Request
+  void onCompletion(int32_t result) override {
+    if (parent_ != nullptr) {
+      parent_->onConnectCompleted(result);
+    }
+  }
+
+  IoUringSocketHandleImpl* parent_;
+  const Network::Address::InstanceConstSharedPtr address_;
+};
+
+IoUringFileEventImpl::IoUringFileEventImpl(Event::Dispatcher& dispatcher, Event::FileReadyCb cb,
+                                           uint32_t events, IoUringSocketHandleImpl& io_handle)
+    : schedulable_(dispatcher.createSchedulableCallback([this, cb]() {
+        const uint32_t events = std::exchange(ephemeral_events_, 0);
+        ENVOY_LOG(trace, "io_uring event {} invokes callbacks on events = {}",
+                  static_cast<void*>(this), events);
+        cb(events);
+      })),
+      io_handle_(io_handle) {
+  setEnabled(events);
+}
+
+void IoUringFileEventImpl::activate(uint32_t events) {
+  ASSERT((events & (Event::FileReadyType::Read | Event::FileReadyType::Write |
+                    Event::FileReadyType::Closed)) == events);
+  ephemeral_events_ |= events;
+  schedulable_->scheduleCallbackNextIteration();
+}
+
+void IoUringFileEventImpl::setEnabled(uint32_t events) {
+  ASSERT((events & (Event::FileReadyType::Read | Event::FileReadyType::Write |
+                    Event::FileReadyType::Closed)) == events);
+  // Align with Event::FileEventImpl. Clear pending events on updates to the event mask to avoid
+  // delivering events that are no longer relevant.
+  ephemeral_events_ = 0;
+  enabled_events_ = events;
+  const uint32_t ready_events = io_handle_.readyEvents() & events;
+  if (ready_events != 0) {
+    activate(ready_events);
+  } else {
+    schedulable_->cancel();
+  }
+}
+
+void IoUringFileEventImpl::activateIfEnabled(uint32_t events) {
+  const uint32_t filtered_events = events & enabled_events_;
+  if (filtered_events != 0) {
+    activate(filtered_events);
+  }
+}
+
+IoUringSocketHandleImpl::IoUringSocketHandleImpl(IoUringWorkerFactorySharedPtr factory, os_fd_t fd,
+                                                 bool socket_v6only,
+                                                 absl::optional<int> domain, bool connected)
+    : IoSocketHandleImpl(fd, socket_v6only, domain), factory_(std::move(factory)),
+      state_(connected ? State::Connected : State::Created) {}
+
+IoUringSocketHandleImpl::~IoUringSocketHandleImpl() {
+  if (SOCKET_VALID(fd_)) {
+    IoUringSocketHandleImpl::close();
+  }
+}
+
+Api::IoCallUint64Result IoUringSocketHandleImpl::close() {
+  if (worker_ == nullptr) {
+    return IoSocketHandleImpl::close();
+  }
+
+  ASSERT(SOCKET_VALID(fd_));
+  file_event_.reset();
+  // Pending requests hold on to their resources until the kernel posts their completion, all they
+  // need to know is that nobody is interested in the result anymore.
+  const auto cancel = [this](Request* request) {
+    worker_->submitRequestWithoutCompletion([request](Io::IoUring& ring, void* user_data) {
+      return ring.prepareCancel(request, user_data);
+    });
+  };
+  if (read_request_ != nullptr) {
+    read_request_->parent_ = nullptr;
+    cancel(std::exchange(read_request_, nullptr));
+  }
+  if (accept_request_ != nullptr) {
+    accept_request_->parent_ = nullptr;
+    cancel(std::exchange(accept_request_, nullptr));
+  }
+  if (connect_request_ != nullptr) {
+    connect_request_->parent_ = nullptr;
+    cancel(std::exchange(connect_request_, nullptr));
+  }
+  for (const AcceptedSocket& socket : accepted_sockets_) {
+    Api::OsSysCallsSingleton::get().close(socket.fd_);
+  }
+  accepted_sockets_.clear();
+
+  if (write_request_ != nullptr) {
+    // Closing now would drop data the caller considers written, defer it to the completion.
+    write_request_->parent_ = nullptr;
+    write_request_->close_on_completion_ = true;
+    write_request_ = nullptr;
+  } else {
+    worker_->submitRequestWithoutCompletion(
+        [fd = fd_](Io::IoUring& ring, void* user_data) { return ring.prepareClose(fd, user_data); });
+  }
+  SET_SOCKET_INVALID(fd_);
+  return Api::ioCallUint64ResultNoError();
+}
+
+Api::IoCallUint64Result IoUringSocketHandleImpl::readv(uint64_t max_length,
+                                                       Buffer::RawSlice* slices,
+                                                       uint64_t num_slice) {
+  if (worker_ == nullptr) {
+    return IoSocketHandleImpl::readv(max_length, slices, num_slice);
+  }
+
+  uint64_t bytes_read = 0;
+  for (uint64_t i = 0; i < num_slice && bytes_read < max_length && read_buf_.length() > 0; i++) {
+    const uint64_t length =
+        std::min({static_cast<uint64_t>(slices[i].len_), max_length - bytes_read,
+                  read_buf_.length()});
+    read_buf_.copyOut(0, length, slices[i].mem_);
+    read_buf_.drain(length);
+    bytes_read += length;
+  }
+  return readResult(bytes_read);
+}
+
+bool IoUringSocketHandleImpl::supportsSplice() const {
+  // The ring keeps reads and writes in flight on the descriptor.
+  return worker_ == nullptr && IoSocketHandleImpl::supportsSplice();
+}
+
+Api::IoCallUint64Result IoUringSocketHandleImpl::read(Buffer::Instance& buffer,
+                                                      absl::optional<uint64_t> max_length_opt) {
+  if (worker_ == nullptr) {
+    return IoSocketHandleImpl::read(buffer, max_length_opt);
+  }
+
+  const uint64_t max_length = max_length_opt.value_or(UINT64_MAX);
+  if (max_length == 0) {
+    return Api::ioCallUint64ResultNoError();
+  }
+  const uint64_t bytes_read = std::min(max_length, read_buf_.length());
+  // Moves the slices filled by the kernel without copying them.
+  buffer.move(read_buf_, bytes_read);
+  return readResult(bytes_read);
+}
+
+Api::IoCallUint64Result IoUringSocketHandleImpl::recv(void* buffer, size_t length, int flags) {
+  if (worker_ == nullptr) {
+    return IoSocketHandleImpl::recv(buffer, length, flags);
+  }
+
+  const uint64_t bytes_read = std::min(static_cast<uint64_t>(length), read_buf_.length());
+  read_buf_.copyOut(0, bytes_read, buffer);
+  if (!(flags & MSG_PEEK)) {
+    read_buf_.drain(bytes_read);
+  }
+  return readResult(bytes_read);
+}
+
+Api::IoCallUint64Result IoUringSocketHandleImpl::readResult(uint64_t bytes_read) {
+  if (bytes_read > 0) {
+    maybeSubmitRead();
+    return Api::IoCallUint64Result(bytes_read,
+                                   Api::IoErrorPtr(nullptr, Network::IoSocketError::deleteIoError));
+  }
+  if (read_error_ != 0) {
+    return ioErrorResult(read_error_);
+  }
+  if (read_eof_) {
+    return Api::ioCallUint64ResultNoError();
+  }
+  return ioErrorResult(SOCKET_ERROR_AGAIN);
+}
+
+Api::IoCallUint64Result IoUringSocketHandleImpl::writev(const Buffer::RawSlice* slices,
+                                                        uint64_t num_slice) {
+  if (worker_ == nullptr) {
+    return IoSocketHandleImpl::writev(slices, num_slice);
+  }
+  if (write_error_ == 0 && (write_request_ != nullptr || state_ != State::Connected)) {
+    return ioErrorResult(SOCKET_ERROR_AGAIN);
+  }
+
+  // The caller keeps ownership of the slices, so they have to be copied for the asynchronous
+  // write.
+  Buffer::OwnedImpl buffer;
+  for (uint64_t i = 0; i < num_slice; i++) {
+    buffer.add(slices[i].mem_, slices[i].len_);
+  }
+  return write(buffer);
+}
+
+Api::IoCallUint64Result IoUringSocketHandleImpl::writevZeroCopy(const Buffer::RawSlice* slices,
+                                                                uint64_t num_slice) {
+  if (worker_ == nullptr) {
+    return IoSocketHandleImpl::writevZeroCopy(slices, num_slice);
+  }
+  // Writes submitted to the ring copy the data into a buffer owned by the request instead.
+  return ioErrorResult(SOCKET_ERROR_NOT_SUP);
+}
+
+Api::IoCallUint64Result IoUringSocketHandleImpl::write(Buffer::Instance& buffer) {
+  if (worker_ == nullptr) {
+    return IoSocketHandleImpl::write(buffer);
+  }
+  if (write_error_ != 0) {
+    return ioErrorResult(write_error_);
+  }
+  if (write_request_ != nullptr || state_ != State::Connected) {
+    return ioErrorResult(SOCKET_ERROR_AGAIN);
+  }
+
+  const uint64_t length = buffer.length();
+  if (length == 0) {
+    return Api::ioCallUint64ResultNoError();
+  }
+  auto request = std::make_unique<WriteRequest>(this, *worker_, fd_);
+  request->data_.move(buffer);
+  WriteRequest::submit(std::move(request));
+  return Api::IoCallUint64Result(length,
+                                 Api::IoErrorPtr(nullptr, Network::IoSocketError::deleteIoError));
+}
+
+Api::SysCallIntResult IoUringSocketHandleImpl::listen(int backlog) {
+  const Api::SysCallIntResult result = IoSocketHandleImpl::listen(backlog);
+  if (result.rc_ == 0 && state_ == State::Created) {
+    state_ = State::Listening;
+  }
+  return result;
+}
+
+Network::IoHandlePtr IoUringSocketHandleImpl::accept(struct sockaddr* addr, socklen_t* addrlen) {
+  if (worker_ == nullptr) {
+    const Api::SysCallSocketResult result =
+        Api::OsSysCallsSingleton::get().accept(fd_, addr, addrlen);
+    if (SOCKET_INVALID(result.rc_)) {
+      return nullptr;
+    }
+    return std::make_unique<IoUringSocketHandleImpl>(factory_, result.rc_, socket_v6only_, domain_,
+                                                     true);
+  }
+
+  if (accepted_sockets_.empty()) {
+    return nullptr;
+  }
+  const AcceptedSocket socket = accepted_sockets_.front();
+  accepted_sockets_.pop_front();
+  maybeSubmitAccept();
+
+  memcpy(addr, &socket.remote_addr_, std::min(*addrlen, socket.remote_addr_len_));
+  *addrlen = socket.remote_addr_len_;
+  return std::make_unique<IoUringSocketHandleImpl>(factory_, socket.fd_, socket_v6only_, domain_,
+                                                   true);
+}
+
+Api::SysCallIntResult IoUringSocketHandleImpl::connect(Network::Address::InstanceConstSharedPtr address) {
+  if (worker_ == nullptr || state_ != State::Created) {
+    state_ = State::Unsupported;
+    return IoSocketHandleImpl::connect(address);
+  }
+
+  auto request = std::make_unique<ConnectRequest>(*this, std::move(address));
+  connect_request_ = request.get();
+  state_ = State::Connecting;
+  worker_->submitRequest(std::move(request),
+                         [fd = fd_, request = connect_request_](Io::IoUring& ring, void* user_data) {
+                           return ring.prepareConnect(fd, request->address_, user_data);
+                         });
+  return {-1, SOCKET_ERROR_IN_PROGRESS};
+}
+
+Api::SysCallIntResult IoUringSocketHandleImpl::getOption(int level, int optname, void* optval,
+                                                         socklen_t* optlen) {
+  // The kernel reports the outcome of the connect request through its completion rather than the
+  // socket error, which is what callers use to check if a non-blocking connect succeeded.
+  if (worker_ != nullptr && level == SOL_SOCKET && optname == SO_ERROR &&
+      *optlen >= sizeof(int)) {
+    *static_cast<int*>(optval) = connect_error_;
+    *optlen = sizeof(int);
+    return {0, 0};
+  }
+  return IoSocketHandleImpl::getOption(level, optname, optval, optlen);
+}
+
+void IoUringSocketHandleImpl::initializeFileEvent(Event::Dispatcher& dispatcher,
+                                                  Event::FileReadyCb cb,
+                                                  Event::FileTriggerType trigger, uint32_t events) {
+  ASSERT(file_event_ == nullptr, "Attempting to initialize two `file_event_` for the same "
+                                 "file descriptor. This is not allowed.");
+  if (worker_ == nullptr &&
+      (state_ == State::Listening ||
+       (trigger == Event::FileTriggerType::Edge &&
+        (state_ == State::Connected || (state_ == State::Created && isStreamSocket()))))) {
+    OptRef<IoUringWorker> worker = factory_->getIoUringWorker();
+    if (worker.has_value() && &worker->dispatcher() == &dispatcher) {
+      worker_ = worker.ptr();
+    }
+  }
+  if (worker_ == nullptr) {
+    IoSocketHandleImpl::initializeFileEvent(dispatcher, cb, trigger, events);
+    return;
+  }
+
+  file_event_ = std::make_unique<IoUringFileEventImpl>(dispatcher, cb, events, *this);
+  maybeSubmitAccept();
+  maybeSubmitRead();
+}
+
+Network::IoHandlePtr IoUringSocketHandleImpl::duplicate() {
+  auto result = Api::OsSysCallsSingleton::get().duplicate(fd_);
+  RELEASE_ASSERT(result.rc_ != -1, fmt::format("duplicate failed for '{}': ({}) {}", fd_,
+                                               result.errno_, errorDetails(result.errno_)));
+  return std::make_unique<IoUringSocketHandleImpl>(factory_, result.rc_, socket_v6only_, domain_);
+}
+
+Api::SysCallIntResult IoUringSocketHandleImpl::shutdown(int how) {
+  if (worker_ != nullptr && write_request_ != nullptr && how != SHUT_RD) {
+    // Shutting down the write side now would cut off the data of the pending write.
+    pending_shutdown_ = how;
+    return {0, 0};
+  }
+  return IoSocketHandleImpl::shutdown(how);
+}
+
+uint32_t IoUringSocketHandleImpl::readyEvents() const {
+  uint32_t events = 0;
+  if (state_ == State::Listening) {
+    if (!accepted_sockets_.empty()) {
+      events |= Event::FileReadyType::Read;
+    }
+    return events;
+  }
+  if (read_buf_.length() > 0 || read_eof_ || read_error_ != 0) {
+    events |= Event::FileReadyType::Read;
+  }
+  if (read_eof_ || read_error_ != 0) {
+    events |= Event::FileReadyType::Closed;
+  }
+  if ((state_ == State::Connected && write_request_ == nullptr) || connect_error_ != 0) {
+    events |= Event::FileReadyType::Write;
+  }
+  return events;
+}
+
+void IoUringSocketHandleImpl::maybeSubmitRead() {
+  // Only one buffer is read ahead, further reads wait for the data to be consumed. That keeps
+  // memory bounded for connections with reads disabled.
+  if (worker_ == nullptr || state_ != State::Connected || read_request_ != nullptr || read_eof_ ||
+      read_error_ != 0 || read_buf_.length() >= factory_->readBufferSize()) {
+    return;
+  }
+  auto request = std::make_unique<ReadRequest>(*this, factory_->readBufferSize());
+  read_request_ = request.get();
+  worker_->submitRequest(std::move(request),
+                         [fd = fd_, request = read_request_](Io::IoUring& ring, void* user_data) {
+                           return ring.prepareReadv(fd, &request->iov_, 1, 0, user_data);
+                         });
+}
+
+void IoUringSocketHandleImpl::maybeSubmitAccept() {
+  if (worker_ == nullptr || state_ != State::Listening || accept_request_ != nullptr) {
+    return;
+  }
+  auto request = std::make_unique<AcceptRequest>(*this);
+  accept_request_ = request.get();
+  worker_->submitRequest(std::move(request),
+                         [fd = fd_, request = accept_request_](Io::IoUring& ring, void* user_data) {
+                           return ring.prepareAccept(
+                               fd, reinterpret_cast<struct sockaddr*>(&request->socket_.remote_addr_),
+                               &request->socket_.remote_addr_len_, user_data);
+                         });
+}
+
+void IoUringSocketHandleImpl::onReadCompleted(Buffer::Instance& data, int32_t result) {
+  ASSERT(read_request_ != nullptr);
+  read_request_ = nullptr;
+  if (result > 0) {
+    read_buf_.move(data);
+  } else if (result == 0) {
+    read_eof_ = true;
+  } else if (result != -EAGAIN && result != -EINTR) {
+    read_error_ = -result;
+  }
+  maybeSubmitRead();
+  if (result > 0 || result == 0 || read_error_ != 0) {
+    activateIfEnabled(readyEvents() & (Event::FileReadyType::Read | Event::FileReadyType::Closed));
+  }
+}
+
+void IoUringSocketHandleImpl::onWriteCompleted(int32_t result) {
+  ASSERT(write_request_ != nullptr);
+  write_request_ = nullptr;
+  if (result < 0) {
+    write_error_ = -result;
+  }
+  if (pending_shutdown_.has_value()) {
+    IoSocketHandleImpl::shutdown(*std::exchange(pending_shutdown_, absl::nullopt));
+  }
+  activateIfEnabled(Event::FileReadyType::Write);
+}
+
+void IoUringSocketHandleImpl::onAcceptCompleted(const AcceptedSocket& socket, int32_t result) {
+  ASSERT(accept_request_ != nullptr);
+  accept_request_ = nullptr;
+  if (result >= 0) {
+    accepted_sockets_.push_back(socket);
+  } else {
+    ENVOY_LOG(debug, "io_uring accept failed: {}", errorDetails(-result));
+  }
+  maybeSubmitAccept();
+  if (!accepted_sockets_.empty()) {
+    activateIfEnabled(Event::FileReadyType::Read);
+  }
+}
+
+void IoUringSocketHandleImpl::onConnectCompleted(int32_t result) {
+  ASSERT(connect_request_ != nullptr);
+  connect_request_ = nullptr;
+  if (result == 0) {
+    state_ = State::Connected;
+    maybeSubmitRead();
+  } else {
+    connect_error_ = -result;
+  }
+  activateIfEnabled(Event::FileReadyType::Write);
+}
+
+void IoUringSocketHandleImpl::activateIfEnabled(uint32_t events) {
+  if (file_event_ != nullptr && events != 0) {
+    static_cast<IoUringFileEventImpl&>(*file_event_).activateIfEnabled(events);
+  }
+}
+
+bool IoUringSocketHandleImpl::isStreamSocket() {
+  int type = 0;
+  socklen_t type_len = sizeof(type);
+  return IoSocketHandleImpl::getOption(SOL_SOCKET, SO_TYPE, &type, &type_len).rc_ == 0 &&
+         type == SOCK_STREAM;
+}
+
+} // namespace IoUring
+} // namespace IoSocket
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <deque>
+
+#include "envoy/event/file_event.h"
+
+#include "common/buffer/buffer_impl.h"
+#include "common/network/io_socket_handle_impl.h"
+
+#include "extensions/io_socket/io_uring/io_uring_worker_impl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace IoSocket {
+namespace IoUring {
+
+class IoUringSocketHandleImpl;
+
+/**
+ * FileEvent driven by the completions of the requests a IoUringSocketHandleImpl submits instead
+ * of by epoll readiness. Events are delivered on the next event loop iteration and always behave
+ * as edge triggered: an event fires once per activation and again when setEnabled() finds the
+ * handle ready.
+ */
+class IoUringFileEventImpl final : public Event::FileEvent, Logger::Loggable<Logger::Id::io> {
+public:
+  IoUringFileEventImpl(Event::Dispatcher& dispatcher, Event::FileReadyCb cb, uint32_t events,
+                       IoUringSocketHandleImpl& io_handle);
+
+  // Event::FileEvent
+  void activate(uint32_t events) override;
+  void setEnabled(uint32_t events) override;
+  void unregisterEventIfEmulatedEdge(uint32_t) override {}
+  void registerEventIfEmulatedEdge(uint32_t) override {}
+
+  // Activates the given events only if they are enabled.
+  void activateIfEnabled(uint32_t events);
+
+private:
+  Event::SchedulableCallbackPtr schedulable_;
+  IoUringSocketHandleImpl& io_handle_;
+  uint32_t enabled_events_{};
+  uint32_t ephemeral_events_{};
+};
+
+/**
+ * IoHandle for stream sockets which submits accepts, connects, reads and writes to the io_uring
+ * owned by the IoUringWorker of the current thread instead of issuing a system call per operation.
+ * The socket is switched over to io_uring when its file event is initialized as edge triggered
+ * (connections) or after listen() (listeners). Datagram sockets, level triggered users such as
+ * listener filters and threads without a worker keep using the IoSocketHandleImpl system calls.
+ *
+ * Reads are issued ahead of time into a buffer owned by the request and handed out by
+ * read()/readv(). A write takes ownership of the data and completes asynchronously, so it always
+ * reports the whole buffer as written and signals Write readiness once the kernel is done.
+ */
+class IoUringSocketHandleImpl final : public Network::IoSocketHandleImpl {
+public:
+  IoUringSocketHandleImpl(IoUringWorkerFactorySharedPtr factory, os_fd_t fd = INVALID_SOCKET,
+                          bool socket_v6only = false, absl::optional<int> domain = absl::nullopt,
+                          bool connected = false);
+  ~IoUringSocketHandleImpl() override;
+
+  // Network::IoHandle
+  Api::IoCallUint64Result close() override;
+  Api::IoCallUint64Result readv(uint64_t max_length, Buffer::RawSlice* slices,
+                                uint64_t num_slice) override;
+  Api::IoCallUint64Result read(Buffer::Instance& buffer,
+                               absl::optional<uint64_t> max_length) override;
+  Api::IoCallUint64Result writev(const Buffer::RawSlice* slices, uint64_t num_slice) override;
+  Api::IoCallUint64Result writevZeroCopy(const Buffer::RawSlice* slices,
+                                         uint64_t num_slice) override;
+  Api::IoCallUint64Result write(Buffer::Instance& buffer) override;
+  Api::IoCallUint64Result recv(void* buffer, size_t length, int flags) override;
+  bool supportsSplice() const override;
+  Api::SysCallIntResult listen(int backlog) override;
+  Network::IoHandlePtr accept(struct sockaddr* addr, socklen_t* addrlen) override;
+  Api::SysCallIntResult connect(Network::Address::InstanceConstSharedPtr address) override;
+  Api::SysCallIntResult getOption(int level, int optname, void* optval,
+                                  socklen_t* optlen) override;
+  void initializeFileEvent(Event::Dispatcher& dispatcher, Event::FileReadyCb cb,
+                           Event::FileTriggerType trigger, uint32_t events) override;
+  Network::IoHandlePtr duplicate() override;
+  Api::SysCallIntResult shutdown(int how) override;
+
+  /**
+   * @return the events the handle is ready for, used by IoUringFileEventImpl.
+   */
+  uint32_t readyEvents() const;
+
+  /**
+   * @return true if the socket has been switched over to io_uring.
+   */
+  bool usesIoUring() const { return worker_ != nullptr; }
+
+private:
+  class ReadRequest;
+  class WriteRequest;
+  class AcceptRequest;
+  class ConnectRequest;
+
+  // Unsupported marks sockets which have been connected through a system call and therefore have
+  // to stay on the epoll based path.
+  enum class State { Created, Listening, Connecting, Connected, Unsupported };
+
+  struct AcceptedSocket {
+    os_fd_t fd_;
+    sockaddr_storage remote_addr_;
+    socklen_t remote_addr_len_;
+  };
+
+  void maybeSubmitRead();
+  void maybeSubmitAccept();
+  void onReadCompleted(Buffer::Instance& data, int32_t result);
+  void onWriteCompleted(int32_t result);
+  void onAcceptCompleted(const AcceptedSocket& socket, int32_t result);
+  void onConnectCompleted(int32_t result);
+  void activateIfEnabled(uint32_t events);
+  bool isStreamSocket();
+  Api::IoCallUint64Result readResult(uint64_t bytes_read);
+
+  const IoUringWorkerFactorySharedPtr factory_;
+  IoUringWorker* worker_{nullptr};
+  State state_;
+
+  ReadRequest* read_request_{nullptr};
+  WriteRequest* write_request_{nullptr};
+  AcceptRequest* accept_request_{nullptr};
+  ConnectRequest* connect_request_{nullptr};
+
+  // Data read ahead of the read()/readv() calls which consume it.
+  Buffer::OwnedImpl read_buf_;
+  bool read_eof_{false};
+  int read_error_{0};
+  int write_error_{0};
+  int connect_error_{0};
+  absl::optional<int> pending_shutdown_;
+  std::deque<AcceptedSocket> accepted_sockets_;
+};
+
+} // namespace IoUring
+} // namespace IoSocket
+} // namespace Extensions
+} // namespace Envoy
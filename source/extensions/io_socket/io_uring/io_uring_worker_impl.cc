@@ -0,0 +1,75 @@
+#include "extensions/io_socket/io_uring/io_uring_worker_impl.h"
+
+#include "common/io/io_uring_impl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace IoSocket {
+namespace IoUring {
+
+IoUringWorker::IoUringWorker(Io::IoUringPtr&& io_uring, Event::Dispatcher& dispatcher)
+    : io_uring_(std::move(io_uring)), dispatcher_(dispatcher),
+      submit_cb_(dispatcher_.createSchedulableCallback([this]() { submit(); })) {
+  const os_fd_t event_fd = io_uring_->registerEventfd();
+  // The eventfd is only drained by forEveryCompletion(), so edge triggering is sufficient and
+  // avoids re-arming the event on every loop iteration.
+  file_event_ = dispatcher_.createFileEvent(
+      event_fd, [this](uint32_t) { onCompletionsReady(); }, Event::FileTriggerType::Edge,
+      Event::FileReadyType::Read);
+}
+
+IoUringWorker::~IoUringWorker() {
+  ENVOY_LOG(debug, "destroying io_uring worker with {} pending requests", requests_.size());
+  file_event_.reset();
+  io_uring_->unregisterEventfd();
+  // Completions of the remaining requests are never going to be reaped. Tear the ring down before
+  // the requests so that the kernel drops its references to their buffers first.
+  io_uring_.reset();
+}
+
+void IoUringWorker::submit() {
+  while (io_uring_->submit() == Io::IoUringResult::Busy) {
+    // The kernel refuses to take more requests until some completions have been reaped.
+    onCompletionsReady();
+  }
+}
+
+void IoUringWorker::onCompletionsReady() {
+  io_uring_->forEveryCompletion([this](void* user_data, int32_t result) {
+    if (user_data == nullptr) {
+      return;
+    }
+    Request* request = static_cast<Request*>(user_data);
+    request->onCompletion(result);
+    request->removeFromList(requests_);
+  });
+}
+
+IoUringWorkerFactoryImpl::IoUringWorkerFactoryImpl(uint32_t io_uring_size,
+                                                   bool use_submission_queue_polling,
+                                                   uint32_t read_buffer_size,
+                                                   ThreadLocal::SlotAllocator& tls)
+    : io_uring_size_(io_uring_size), use_submission_queue_polling_(use_submission_queue_polling),
+      read_buffer_size_(read_buffer_size), tls_(tls) {}
+
+OptRef<IoUringWorker> IoUringWorkerFactoryImpl::getIoUringWorker() {
+  if (!tls_.currentThreadRegistered()) {
+    return {};
+  }
+  return tls_.get();
+}
+
+void IoUringWorkerFactoryImpl::onServerInitialized() {
+  tls_.set([io_uring_size = io_uring_size_,
+            use_submission_queue_polling = use_submission_queue_polling_](
+               Event::Dispatcher& dispatcher) {
+    return std::make_shared<IoUringWorker>(
+        std::make_unique<Io::IoUringImpl>(io_uring_size, use_submission_queue_polling),
+        dispatcher);
+  });
+}
+
+} // namespace IoUring
+} // namespace IoSocket
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <list>
+
+#include "envoy/common/io/io_uring.h"
+#include "envoy/common/pure.h"
+#include "envoy/event/dispatcher.h"
+#include "envoy/event/file_event.h"
+#include "envoy/event/schedulable_cb.h"
+#include "envoy/thread_local/thread_local.h"
+#include "envoy/thread_local/thread_local_object.h"
+
+#include "common/common/assert.h"
+#include "common/common/linked_object.h"
+#include "common/common/logger.h"
+#include "common/common/non_copyable.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace IoSocket {
+namespace IoUring {
+
+/**
+ * A request submitted to the ring. The address of the request is used as the user data of the
+ * submission, so the completion can be routed back to it. Requests own every resource the kernel
+ * accesses until the completion is posted, which lets them outlive the socket handle that
+ * submitted them.
+ */
+class Request : public LinkedObject<Request> {
+public:
+  virtual ~Request() = default;
+
+  /**
+   * Called once the completion for the request has been reaped. The request is destroyed right
+   * after this returns.
+   * @param result supplies the result of the operation, a negated errno value on failure.
+   */
+  virtual void onCompletion(int32_t result) PURE;
+};
+
+using RequestPtr = std::unique_ptr<Request>;
+
+/**
+ * Per-thread owner of an io_uring instance. The completion queue is hooked into the thread's
+ * dispatcher through the ring's eventfd, so completions are processed as regular file events.
+ * Requests prepared while handling an event loop iteration are handed to the kernel in one batch
+ * at the end of that iteration, which is where the system call savings over one readv()/writev()
+ * per ready socket come from.
+ */
+class IoUringWorker : public ThreadLocal::ThreadLocalObject,
+                      protected Logger::Loggable<Logger::Id::io>,
+                      NonCopyable {
+public:
+  IoUringWorker(Io::IoUringPtr&& io_uring, Event::Dispatcher& dispatcher);
+  ~IoUringWorker() override;
+
+  Event::Dispatcher& dispatcher() { return dispatcher_; }
+
+  /**
+   * Takes ownership of a request, puts it into the submission queue with the given function and
+   * schedules the submission queue to be flushed at the end of the current event loop iteration.
+   * @param request supplies the request which is notified upon completion.
+   * @param prepare_fn supplies a function taking the ring and the user data of the request, which
+   *        calls one of the Io::IoUring::prepare*() methods.
+   * @return the request, which stays valid until its onCompletion() returns.
+   */
+  template <class PrepareFn> Request& submitRequest(RequestPtr&& request, PrepareFn prepare_fn) {
+    Request& ret = *request;
+    prepare(prepare_fn, &ret);
+    LinkedList::moveIntoListBack(std::move(request), requests_);
+    return ret;
+  }
+
+  /**
+   * Same as submitRequest() for requests whose completion is of no interest, e.g. cancellations.
+   */
+  template <class PrepareFn> void submitRequestWithoutCompletion(PrepareFn prepare_fn) {
+    prepare(prepare_fn, nullptr);
+  }
+
+  /**
+   * Flushes the submission queue to the kernel.
+   */
+  void submit();
+
+  /**
+   * @return the number of requests waiting for their completion.
+   */
+  uint64_t numPendingRequests() const { return requests_.size(); }
+
+private:
+  template <class PrepareFn> void prepare(PrepareFn& prepare_fn, void* user_data) {
+    if (prepare_fn(*io_uring_, user_data) == Io::IoUringResult::Failed) {
+      // The submission queue is full, make room by submitting what has been prepared so far.
+      submit();
+      const Io::IoUringResult result = prepare_fn(*io_uring_, user_data);
+      RELEASE_ASSERT(result == Io::IoUringResult::Ok, "unable to prepare io_uring request");
+    }
+    if (!submit_cb_->enabled()) {
+      submit_cb_->scheduleCallbackCurrentIteration();
+    }
+  }
+
+  void onCompletionsReady();
+
+  Io::IoUringPtr io_uring_;
+  Event::Dispatcher& dispatcher_;
+  Event::FileEventPtr file_event_;
+  Event::SchedulableCallbackPtr submit_cb_;
+  std::list<RequestPtr> requests_;
+};
+
+/**
+ * Provides the IoUringWorker of the calling thread to socket handles.
+ */
+class IoUringWorkerFactory {
+public:
+  virtual ~IoUringWorkerFactory() = default;
+
+  /**
+   * @return the worker owned by the calling thread or an empty OptRef if the thread has none, e.g.
+   *         because the server has not been initialized yet.
+   */
+  virtual OptRef<IoUringWorker> getIoUringWorker() PURE;
+
+  /**
+   * @return the size of the buffer a socket reads into. The buffer is reserved for as long as a
+   *         read request is pending, which for idle connections is most of their lifetime.
+   */
+  virtual uint32_t readBufferSize() const PURE;
+};
+
+using IoUringWorkerFactorySharedPtr = std::shared_ptr<IoUringWorkerFactory>;
+
+class IoUringWorkerFactoryImpl : public IoUringWorkerFactory {
+public:
+  IoUringWorkerFactoryImpl(uint32_t io_uring_size, bool use_submission_queue_polling,
+                           uint32_t read_buffer_size, ThreadLocal::SlotAllocator& tls);
+
+  // IoUringWorkerFactory
+  OptRef<IoUringWorker> getIoUringWorker() override;
+  uint32_t readBufferSize() const override { return read_buffer_size_; }
+
+  /**
+   * Creates a worker on every thread registered with the thread local instance.
+   */
+  void onServerInitialized();
+
+private:
+  const uint32_t io_uring_size_;
+  const bool use_submission_queue_polling_;
+  const uint32_t read_buffer_size_;
+  ThreadLocal::TypedSlot<IoUringWorker> tls_;
+};
+
+} // namespace IoUring
+} // namespace IoSocket
+} // namespace Extensions
+} // namespace Envoy
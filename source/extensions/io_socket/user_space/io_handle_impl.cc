@@ -223,12 +223,28 @@ Api::IoCallUint64Result IoHandleImpl::write(Buffer::Instance& buffer) {
   return {total_bytes_to_write, Api::IoErrorPtr(nullptr, Network::IoSocketError::deleteIoError)};
 }
 
+Api::IoCallUint64Result IoHandleImpl::writevZeroCopy(const Buffer::RawSlice*, uint64_t) {
+  // The data is always copied into the peer buffer.
+  return {0, Api::IoErrorPtr(new Network::IoSocketError(SOCKET_ERROR_NOT_SUP),
+                             Network::IoSocketError::deleteIoError)};
+}
+
+Api::IoCallUint64Result IoHandleImpl::readZeroCopyCompletions(const ZeroCopyCompletionCb&) {
+  return {0, Api::IoErrorPtr(new Network::IoSocketError(SOCKET_ERROR_NOT_SUP),
+                             Network::IoSocketError::deleteIoError)};
+}
+
 Api::IoCallUint64Result IoHandleImpl::sendmsg(const Buffer::RawSlice*, uint64_t, int,
                                               const Network::Address::Ip*,
                                               const Network::Address::Instance&) {
   return Network::IoSocketError::ioResultSocketInvalidAddress();
 }
 
+Api::IoCallUint64Result IoHandleImpl::sendmmsg(const Buffer::RawSlice*, uint64_t, int,
+                                               const Network::Address::Instance&) {
+  return Network::IoSocketError::ioResultSocketInvalidAddress();
+}
+
 Api::IoCallUint64Result IoHandleImpl::recvmsg(Buffer::RawSlice*, const uint64_t, uint32_t,
                                               RecvMsgOutput&) {
   return Network::IoSocketError::ioResultSocketInvalidAddress();
@@ -265,6 +281,8 @@ bool IoHandleImpl::supportsMmsg() const { return false; }
 
 bool IoHandleImpl::supportsUdpGro() const { return false; }
 
+bool IoHandleImpl::supportsSplice() const { return false; }
+
 Api::SysCallIntResult IoHandleImpl::bind(Network::Address::InstanceConstSharedPtr) {
   return makeInvalidSyscallResult();
 }
@@ -56,9 +56,15 @@ public:
                                absl::optional<uint64_t> max_length_opt) override;
   Api::IoCallUint64Result writev(const Buffer::RawSlice* slices, uint64_t num_slice) override;
   Api::IoCallUint64Result write(Buffer::Instance& buffer) override;
+  Api::IoCallUint64Result writevZeroCopy(const Buffer::RawSlice* slices,
+                                         uint64_t num_slice) override;
+  Api::IoCallUint64Result readZeroCopyCompletions(const ZeroCopyCompletionCb& cb) override;
   Api::IoCallUint64Result sendmsg(const Buffer::RawSlice* slices, uint64_t num_slice, int flags,
                                   const Network::Address::Ip* self_ip,
                                   const Network::Address::Instance& peer_address) override;
+  Api::IoCallUint64Result sendmmsg(const Buffer::RawSlice* datagrams, uint64_t num_datagrams,
+                                   int flags,
+                                   const Network::Address::Instance& peer_address) override;
   Api::IoCallUint64Result recvmsg(Buffer::RawSlice* slices, const uint64_t num_slice,
                                   uint32_t self_port, RecvMsgOutput& output) override;
   Api::IoCallUint64Result recvmmsg(RawSliceArrays& slices, uint32_t self_port,
@@ -66,6 +72,7 @@ public:
   Api::IoCallUint64Result recv(void* buffer, size_t length, int flags) override;
   bool supportsMmsg() const override;
   bool supportsUdpGro() const override;
+  bool supportsSplice() const override;
   Api::SysCallIntResult bind(Network::Address::InstanceConstSharedPtr address) override;
   Api::SysCallIntResult listen(int backlog) override;
   Network::IoHandlePtr accept(struct sockaddr* addr, socklen_t* addrlen) override;
@@ -21,6 +21,7 @@
 #include "common/network/utility.h"
 #include "common/stats/symbol_table_impl.h"
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 
 namespace Envoy {
@@ -44,12 +45,33 @@ void UdpStatsdSink::WriterImpl::writeBuffer(Buffer::Instance& data) {
   Network::Utility::writeToSocket(*io_handle_, data, nullptr, *parent_.server_address_);
 }
 
+void UdpStatsdSink::WriterImpl::writeDatagrams(absl::Span<const Buffer::RawSlice> datagrams) {
+  if (!io_handle_->supportsMmsg()) {
+    for (const Buffer::RawSlice& datagram : datagrams) {
+      Buffer::RawSlice slice = datagram;
+      Network::Utility::writeToSocket(*io_handle_, &slice, 1, nullptr, *parent_.server_address_);
+    }
+    return;
+  }
+
+  while (!datagrams.empty()) {
+    const Api::IoCallUint64Result result =
+        io_handle_->sendmmsg(datagrams.data(), datagrams.size(), 0, *parent_.server_address_);
+    // As for a single datagram, the remaining ones are dropped if the socket is not writable.
+    if (!result.ok() || result.rc_ == 0) {
+      return;
+    }
+    datagrams.remove_prefix(result.rc_);
+  }
+}
+
 UdpStatsdSink::UdpStatsdSink(ThreadLocal::SlotAllocator& tls,
                              Network::Address::InstanceConstSharedPtr address, const bool use_tag,
-                             const std::string& prefix, absl::optional<uint64_t> buffer_size)
+                             const std::string& prefix, absl::optional<uint64_t> buffer_size,
+                             const bool batch_datagrams)
     : tls_(tls.allocateSlot()), server_address_(std::move(address)), use_tag_(use_tag),
       prefix_(prefix.empty() ? Statsd::getDefaultPrefix() : prefix),
-      buffer_size_(buffer_size.value_or(0)) {
+      buffer_size_(buffer_size.value_or(0)), batch_datagrams_(batch_datagrams) {
   tls_->set([this](Event::Dispatcher&) -> ThreadLocal::ThreadLocalObjectSharedPtr {
     return std::make_shared<WriterImpl>(*this);
   });
@@ -57,6 +79,10 @@ UdpStatsdSink::UdpStatsdSink(ThreadLocal::SlotAllocator& tls,
 
 void UdpStatsdSink::flush(Stats::MetricSnapshot& snapshot) {
   Writer& writer = tls_->getTyped<Writer>();
+  if (batch_datagrams_) {
+    flushBatched(snapshot, writer);
+    return;
+  }
   Buffer::OwnedImpl buffer;
 
   for (const auto& counter : snapshot.counters()) {
@@ -108,6 +134,99 @@ void UdpStatsdSink::flushBuffer(Buffer::OwnedImpl& buffer, Writer& writer) const
   buffer.drain(buffer.length());
 }
 
+void UdpStatsdSink::flushBatched(Stats::MetricSnapshot& snapshot, Writer& writer) {
+  ++flush_count_;
+  cached_metrics_flushed_ = 0;
+
+  for (const auto& counter : snapshot.counters()) {
+    if (counter.counter_.get().used()) {
+      addBatchedLine(cachedMetric(counter.counter_.get()), counter.delta_, "|c", writer);
+    }
+  }
+
+  for (const auto& gauge : snapshot.gauges()) {
+    if (gauge.get().used()) {
+      addBatchedLine(cachedMetric(gauge.get()), gauge.get().value(), "|g", writer);
+    }
+  }
+
+  closeDatagram();
+  writeBatchedDatagrams(writer);
+
+  // Release the metrics which were not part of this flush, e.g. as they were deleted from the
+  // store since the previous one.
+  if (cached_metrics_.size() > cached_metrics_flushed_) {
+    for (auto it = cached_metrics_.begin(); it != cached_metrics_.end();) {
+      if (it->second.flush_count_ != flush_count_) {
+        cached_metrics_.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+const UdpStatsdSink::CachedMetric& UdpStatsdSink::cachedMetric(const Stats::Metric& metric) {
+  CachedMetric& cached = cached_metrics_[&metric];
+  if (cached.metric_ == nullptr) {
+    // The metric is only referenced to extend its lifetime, the reference count being mutable.
+    cached.metric_ = Stats::RefcountPtr<Stats::Metric>(const_cast<Stats::Metric*>(&metric));
+    cached.name_ = absl::StrCat(prefix_, ".", getName(metric), ":");
+    cached.tags_ = buildTagStr(metric.tags());
+  }
+  if (cached.flush_count_ != flush_count_) {
+    cached.flush_count_ = flush_count_;
+    ++cached_metrics_flushed_;
+  }
+  return cached;
+}
+
+void UdpStatsdSink::addBatchedLine(const CachedMetric& metric, uint64_t value,
+                                   absl::string_view type, Writer& writer) {
+  const absl::AlphaNum value_str(value);
+  const uint64_t line_size =
+      metric.name_.size() + value_str.size() + type.size() + metric.tags_.size();
+  const uint64_t open_datagram_size = datagram_bytes_.size() - openDatagramStart();
+  // The lines are packed into datagrams as writeBuffer() does: a line which does not fit in the
+  // open datagram starts a new one, and one larger than the buffer size is a datagram of its own.
+  if (line_size >= buffer_size_ || open_datagram_size + line_size + 1 > buffer_size_) {
+    closeDatagram();
+    if (datagram_ends_.size() >= DATAGRAMS_PER_BATCH) {
+      writeBatchedDatagrams(writer);
+    }
+  } else if (open_datagram_size > 0) {
+    datagram_bytes_.push_back('\n');
+  }
+  absl::StrAppend(&datagram_bytes_, metric.name_, value_str, type, metric.tags_);
+}
+
+uint64_t UdpStatsdSink::openDatagramStart() const {
+  return datagram_ends_.empty() ? 0 : datagram_ends_.back();
+}
+
+void UdpStatsdSink::closeDatagram() {
+  if (datagram_bytes_.size() > openDatagramStart()) {
+    datagram_ends_.push_back(datagram_bytes_.size());
+  }
+}
+
+void UdpStatsdSink::writeBatchedDatagrams(Writer& writer) {
+  if (datagram_ends_.empty()) {
+    return;
+  }
+  std::vector<Buffer::RawSlice> datagrams;
+  datagrams.reserve(datagram_ends_.size());
+  uint64_t start = 0;
+  for (const uint64_t end : datagram_ends_) {
+    datagrams.push_back({datagram_bytes_.data() + start, end - start});
+    start = end;
+  }
+  writer.writeDatagrams(datagrams);
+  // Keep the open datagram, if any, for the lines that follow.
+  datagram_bytes_.erase(0, start);
+  datagram_ends_.clear();
+}
+
 void UdpStatsdSink::onHistogramComplete(const Stats::Histogram& histogram, uint64_t value) {
   // For statsd histograms are all timers in milliseconds, Envoy histograms are however
   // not necessarily timers in milliseconds, for Envoy histograms suffixed with their corresponding
@@ -302,7 +421,8 @@ void TcpStatsdSink::TlsSink::write(Buffer::Instance& buffer) {
                                      parent_.cluster_info_->stats().upstream_cx_rx_bytes_buffered_,
                                      parent_.cluster_info_->stats().upstream_cx_tx_bytes_total_,
                                      parent_.cluster_info_->stats().upstream_cx_tx_bytes_buffered_,
-                                     &parent_.cluster_info_->stats().bind_errors_, nullptr});
+                                     &parent_.cluster_info_->stats().bind_errors_, nullptr,
+                                     &parent_.cluster_info_->stats().upstream_cx_rx_reads_total_});
     connection_->connect();
   }
 
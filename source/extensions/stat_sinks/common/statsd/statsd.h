@@ -5,6 +5,7 @@
 #include "envoy/local_info/local_info.h"
 #include "envoy/network/connection.h"
 #include "envoy/stats/histogram.h"
+#include "envoy/stats/refcount_ptr.h"
 #include "envoy/stats/scope.h"
 #include "envoy/stats/sink.h"
 #include "envoy/stats/stats.h"
@@ -16,7 +17,9 @@
 #include "common/common/macros.h"
 #include "common/network/io_socket_handle_impl.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/types/optional.h"
+#include "absl/types/span.h"
 
 namespace Envoy {
 namespace Extensions {
@@ -38,18 +41,25 @@ public:
   public:
     virtual void write(const std::string& message) PURE;
     virtual void writeBuffer(Buffer::Instance& data) PURE;
+    /**
+     * Writes each of the slices as a datagram of its own, with as few system calls as the
+     * platform allows.
+     */
+    virtual void writeDatagrams(absl::Span<const Buffer::RawSlice> datagrams) PURE;
   };
 
   UdpStatsdSink(ThreadLocal::SlotAllocator& tls, Network::Address::InstanceConstSharedPtr address,
                 const bool use_tag, const std::string& prefix = getDefaultPrefix(),
-                absl::optional<uint64_t> buffer_size = absl::nullopt);
+                absl::optional<uint64_t> buffer_size = absl::nullopt,
+                const bool batch_datagrams = false);
   // For testing.
   UdpStatsdSink(ThreadLocal::SlotAllocator& tls, const std::shared_ptr<Writer>& writer,
                 const bool use_tag, const std::string& prefix = getDefaultPrefix(),
-                absl::optional<uint64_t> buffer_size = absl::nullopt)
+                absl::optional<uint64_t> buffer_size = absl::nullopt,
+                const bool batch_datagrams = false)
       : tls_(tls.allocateSlot()), use_tag_(use_tag),
         prefix_(prefix.empty() ? getDefaultPrefix() : prefix),
-        buffer_size_(buffer_size.value_or(0)) {
+        buffer_size_(buffer_size.value_or(0)), batch_datagrams_(batch_datagrams) {
     tls_->set(
         [writer](Event::Dispatcher&) -> ThreadLocal::ThreadLocalObjectSharedPtr { return writer; });
   }
@@ -60,6 +70,7 @@ public:
 
   bool getUseTagForTest() { return use_tag_; }
   uint64_t getBufferSizeForTest() { return buffer_size_; }
+  bool getBatchDatagramsForTest() { return batch_datagrams_; }
   const std::string& getPrefix() { return prefix_; }
 
 private:
@@ -73,15 +84,42 @@ private:
     // Writer
     void write(const std::string& message) override;
     void writeBuffer(Buffer::Instance& data) override;
+    void writeDatagrams(absl::Span<const Buffer::RawSlice> datagrams) override;
 
   private:
     UdpStatsdSink& parent_;
     const Network::IoHandlePtr io_handle_;
   };
 
+  /**
+   * The serialized parts of the statsd lines of a metric which only depend on its name and tags.
+   * The metric is referenced, so that it is not freed and its address reused by another metric
+   * while it is cached.
+   */
+  struct CachedMetric {
+    Stats::RefcountPtr<Stats::Metric> metric_;
+    // "<prefix>.<name>:"
+    std::string name_;
+    // "|#<tag>:<value>,..." if tags are used, otherwise empty.
+    std::string tags_;
+    // The last flush the metric was part of.
+    uint64_t flush_count_{};
+  };
+
+  // The number of datagrams written at once in batched mode. Linux caps a sendmmsg() call at 1024.
+  static constexpr uint64_t DATAGRAMS_PER_BATCH = 64;
+
   void flushBuffer(Buffer::OwnedImpl& buffer, Writer& writer) const;
   void writeBuffer(Buffer::OwnedImpl& buffer, Writer& writer, const std::string& data) const;
 
+  void flushBatched(Stats::MetricSnapshot& snapshot, Writer& writer);
+  const CachedMetric& cachedMetric(const Stats::Metric& metric);
+  void addBatchedLine(const CachedMetric& metric, uint64_t value, absl::string_view type,
+                      Writer& writer);
+  uint64_t openDatagramStart() const;
+  void closeDatagram();
+  void writeBatchedDatagrams(Writer& writer);
+
   const std::string getName(const Stats::Metric& metric) const;
   const std::string buildTagStr(const std::vector<Stats::Tag>& tags) const;
 
@@ -91,6 +129,16 @@ private:
   // Prefix for all flushed stats.
   const std::string prefix_;
   const uint64_t buffer_size_;
+  const bool batch_datagrams_{};
+
+  // Batched mode state, only used by flush() on the main thread.
+  absl::flat_hash_map<const Stats::Metric*, CachedMetric> cached_metrics_;
+  uint64_t flush_count_{};
+  uint64_t cached_metrics_flushed_{};
+  // The lines of the datagrams not written yet. The datagrams are delimited by datagram_ends_,
+  // except for the last one, which is still open for more lines.
+  std::string datagram_bytes_;
+  std::vector<uint64_t> datagram_ends_;
 };
 
 /**
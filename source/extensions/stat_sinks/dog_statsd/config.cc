@@ -32,7 +32,8 @@ DogStatsdSinkFactory::createStatsSink(const Protobuf::Message& config,
     max_bytes = sink_config.max_bytes_per_datagram().value();
   }
   return std::make_unique<Common::Statsd::UdpStatsdSink>(server.threadLocal(), std::move(address),
-                                                         true, sink_config.prefix(), max_bytes);
+                                                         true, sink_config.prefix(), max_bytes,
+                                                         sink_config.batch_datagrams());
 }
 
 ProtobufTypes::MessagePtr DogStatsdSinkFactory::createEmptyConfigProto() {
@@ -6,21 +6,46 @@
 #include "envoy/extensions/transport_sockets/raw_buffer/v3/raw_buffer.pb.validate.h"
 
 #include "common/network/raw_buffer_socket.h"
+#include "common/protobuf/utility.h"
 
 namespace Envoy {
 namespace Extensions {
 namespace TransportSockets {
 namespace RawBuffer {
 
+namespace {
+
+// Writes below this size are cheaper to copy than to track until the kernel releases them.
+constexpr uint32_t DefaultZeroCopyMinWriteSize = 16384;
+
+Network::TransportSocketFactoryPtr
+createRawBufferSocketFactory(const Protobuf::Message& message,
+                             Server::Configuration::TransportSocketFactoryContext& context) {
+  const auto& config = MessageUtil::downcastAndValidate<
+      const envoy::extensions::transport_sockets::raw_buffer::v3::RawBuffer&>(
+      message, context.messageValidationVisitor());
+  if (!config.has_zero_copy()) {
+    return std::make_unique<Network::RawBufferSocketFactory>();
+  }
+  return std::make_unique<Network::RawBufferSocketFactory>(
+      std::make_shared<Network::RawBufferZeroCopyConfig>(
+          PROTOBUF_GET_WRAPPED_OR_DEFAULT(config.zero_copy(), min_write_size,
+                                          DefaultZeroCopyMinWriteSize),
+          context.scope()));
+}
+
+} // namespace
+
 Network::TransportSocketFactoryPtr UpstreamRawBufferSocketFactory::createTransportSocketFactory(
-    const Protobuf::Message&, Server::Configuration::TransportSocketFactoryContext&) {
-  return std::make_unique<Network::RawBufferSocketFactory>();
+    const Protobuf::Message& message,
+    Server::Configuration::TransportSocketFactoryContext& context) {
+  return createRawBufferSocketFactory(message, context);
 }
 
 Network::TransportSocketFactoryPtr DownstreamRawBufferSocketFactory::createTransportSocketFactory(
-    const Protobuf::Message&, Server::Configuration::TransportSocketFactoryContext&,
+    const Protobuf::Message& message, Server::Configuration::TransportSocketFactoryContext& context,
     const std::vector<std::string>&) {
-  return std::make_unique<Network::RawBufferSocketFactory>();
+  return createRawBufferSocketFactory(message, context);
 }
 
 ProtobufTypes::MessagePtr RawBufferSocketFactory::createEmptyConfigProto() {
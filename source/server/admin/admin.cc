@@ -407,6 +407,8 @@ Http::Code AdminImpl::request(absl::string_view path_and_query, absl::string_vie
   Buffer::OwnedImpl response;
 
   Http::Code code = runCallback(path_and_query, response_headers, response, filter);
+  while (filter.nextResponseChunk(response)) {
+  }
   Utility::populateFallbackResponseHeaders(code, response_headers);
   body = response.toString();
   return code;
@@ -38,6 +38,11 @@ Http::FilterTrailersStatus AdminFilter::decodeTrailers(Http::RequestTrailerMap&)
 }
 
 void AdminFilter::onDestroy() {
+  if (response_chunks_ != nullptr && next_chunk_ != nullptr) {
+    decoder_callbacks_->removeDownstreamWatermarkCallbacks(*this);
+  }
+  response_chunks_ = nullptr;
+  next_chunk_.reset();
   for (const auto& callback : on_destroy_callbacks_) {
     callback();
   }
@@ -70,14 +75,61 @@ void AdminFilter::onComplete() {
   RELEASE_ASSERT(request_headers_, "");
   Http::Code code = admin_server_callback_func_(path, *header_map, response, *this);
   Utility::populateFallbackResponseHeaders(code, *header_map);
-  decoder_callbacks_->encodeHeaders(std::move(header_map),
-                                    end_stream_on_complete_ && response.length() == 0,
+  const bool end_stream = end_stream_on_complete_ && response_chunks_ == nullptr;
+  decoder_callbacks_->encodeHeaders(std::move(header_map), end_stream && response.length() == 0,
                                     StreamInfo::ResponseCodeDetails::get().AdminFilterResponse);
 
   if (response.length() > 0) {
-    decoder_callbacks_->encodeData(response, end_stream_on_complete_);
+    decoder_callbacks_->encodeData(response, end_stream);
+  }
+
+  if (response_chunks_ != nullptr) {
+    // The rest of the response is encoded a chunk per iteration of the event loop, so that the
+    // main thread is not held up by large responses, and paused while the downstream connection is
+    // backed up, so that the response is not buffered in its entirety.
+    next_chunk_ = decoder_callbacks_->dispatcher().createSchedulableCallback(
+        [this]() { encodeNextChunk(); });
+    decoder_callbacks_->addDownstreamWatermarkCallbacks(*this);
+    scheduleNextChunk();
+  }
+}
+
+bool AdminFilter::nextResponseChunk(Buffer::Instance& response) {
+  if (response_chunks_ == nullptr) {
+    return false;
+  }
+  if (!response_chunks_(response)) {
+    response_chunks_ = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void AdminFilter::encodeNextChunk() {
+  Buffer::OwnedImpl chunk;
+  const bool more = nextResponseChunk(chunk);
+  if (!more) {
+    decoder_callbacks_->removeDownstreamWatermarkCallbacks(*this);
+  }
+  const bool end_stream = !more && end_stream_on_complete_;
+  if (chunk.length() > 0 || end_stream) {
+    // This may raise the high watermark, or reset the stream, before returning.
+    decoder_callbacks_->encodeData(chunk, end_stream);
+  }
+  scheduleNextChunk();
+}
+
+void AdminFilter::scheduleNextChunk() {
+  if (response_chunks_ != nullptr && high_watermark_count_ == 0) {
+    next_chunk_->scheduleCallbackNextIteration();
   }
 }
 
+void AdminFilter::onBelowWriteBufferLowWatermark() {
+  ASSERT(high_watermark_count_ > 0);
+  high_watermark_count_--;
+  scheduleNextChunk();
+}
+
 } // namespace Server
 } // namespace Envoy
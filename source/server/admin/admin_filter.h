@@ -3,6 +3,8 @@
 #include <functional>
 #include <list>
 
+#include "envoy/event/schedulable_cb.h"
+#include "envoy/http/codec.h"
 #include "envoy/http/filter.h"
 #include "envoy/server/admin.h"
 
@@ -23,6 +25,7 @@ namespace Server {
  */
 class AdminFilter : public Http::PassThroughFilter,
                     public AdminStream,
+                    public Http::DownstreamWatermarkCallbacks,
                     Logger::Loggable<Logger::Id::admin> {
 public:
   using AdminServerCallbackFunction = std::function<Http::Code(
@@ -45,6 +48,9 @@ public:
 
   // AdminStream
   void setEndStreamOnComplete(bool end_stream) override { end_stream_on_complete_ = end_stream; }
+  void setResponseChunks(ResponseChunkFn next_chunk) override {
+    response_chunks_ = std::move(next_chunk);
+  }
   void addOnDestroyCallback(std::function<void()> cb) override;
   Http::StreamDecoderFilterCallbacks& getDecoderFilterCallbacks() const override;
   const Buffer::Instance* getRequestBody() const override;
@@ -53,15 +59,35 @@ public:
     return encoder_callbacks_->http1StreamEncoderOptions();
   }
 
+  // Http::DownstreamWatermarkCallbacks
+  void onAboveWriteBufferHighWatermark() override { high_watermark_count_++; }
+  void onBelowWriteBufferLowWatermark() override;
+
+  /**
+   * Appends the next chunk of a response set with setResponseChunks() to the buffer, for callers
+   * which run the handler without a downstream stream.
+   * @return bool true if there are more chunks to come.
+   */
+  bool nextResponseChunk(Buffer::Instance& response);
+
 private:
   /**
    * Called when an admin request has been completely received.
    */
   void onComplete();
+  /**
+   * Encodes the next chunk of the response, and schedules the one after on the next iteration of
+   * the event loop unless the downstream is over its high watermark.
+   */
+  void encodeNextChunk();
+  void scheduleNextChunk();
   AdminServerCallbackFunction admin_server_callback_func_;
   Http::RequestHeaderMap* request_headers_{};
   std::list<std::function<void()>> on_destroy_callbacks_;
   bool end_stream_on_complete_ = true;
+  ResponseChunkFn response_chunks_;
+  Event::SchedulableCallbackPtr next_chunk_;
+  uint32_t high_watermark_count_{};
 };
 
 } // namespace Server
@@ -1,9 +1,12 @@
 #include "server/admin/prometheus_stats.h"
 
+#include <limits>
+
 #include "common/common/empty_string.h"
 #include "common/common/macros.h"
 #include "common/stats/histogram_impl.h"
 
+#include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
 
 namespace Envoy {
@@ -11,19 +14,41 @@ namespace Server {
 
 namespace {
 
-const std::regex& promRegex() { CONSTRUCT_ON_FIRST_USE(std::regex, "[^a-zA-Z0-9_]"); }
 const std::regex& namespaceRegex() {
   CONSTRUCT_ON_FIRST_USE(std::regex, "^[a-zA-Z_][a-zA-Z0-9]*$");
 }
 
+// The sanitized form of the tag-extracted names and tag names seen by previous scrapes. There are
+// far fewer of these than metrics, and they rarely change between scrapes, so they are kept rather
+// than sanitized again for each scrape. The cache is only accessed from the main thread, and is
+// reset when it grows past MaxSanitizedNames to bound the memory held by names of deleted stats.
+constexpr size_t MaxSanitizedNames = 64 * 1024;
+using SanitizedNameMap = absl::flat_hash_map<std::string, std::string>;
+SanitizedNameMap& sanitizedNames() { MUTABLE_CONSTRUCT_ON_FIRST_USE(SanitizedNameMap); }
+
 /**
  * Take a string and sanitize it according to Prometheus conventions.
  */
-std::string sanitizeName(const std::string& name) {
+const std::string& sanitizeName(absl::string_view name) {
+  auto& sanitized_names = sanitizedNames();
+  auto it = sanitized_names.find(name);
+  if (it != sanitized_names.end()) {
+    return it->second;
+  }
+  if (sanitized_names.size() >= MaxSanitizedNames) {
+    sanitized_names.clear();
+  }
+
   // The name must match the regex [a-zA-Z_][a-zA-Z0-9_]* as required by
   // prometheus. Refer to https://prometheus.io/docs/concepts/data_model/.
   // The initial [a-zA-Z_] constraint is always satisfied by the namespace prefix.
-  return std::regex_replace(name, promRegex(), "_");
+  std::string sanitized(name);
+  for (char& c : sanitized) {
+    if (!absl::ascii_isalnum(c) && c != '_') {
+      c = '_';
+    }
+  }
+  return sanitized_names.emplace(std::string(name), std::move(sanitized)).first->second;
 }
 
 /*
@@ -48,88 +73,6 @@ struct MetricLessThan {
   }
 };
 
-/**
- * Processes a stat type (counter, gauge, histogram) by generating all output lines, sorting
- * them by tag-extracted metric name, and then outputting them in the correct sorted order into
- * response.
- *
- * @param response The buffer to put the output into.
- * @param used_only Whether to only output stats that are used.
- * @param regex A filter on which stats to output.
- * @param metrics The metrics to output stats for. This must contain all stats of the given type
- *        to be included in the same output.
- * @param generate_output A function which returns the output text for this metric.
- * @param type The name of the prometheus metric type for used in TYPE annotations.
- */
-template <class StatType>
-uint64_t outputStatType(
-    Buffer::Instance& response, const bool used_only, const absl::optional<std::regex>& regex,
-    const std::vector<Stats::RefcountPtr<StatType>>& metrics,
-    const std::function<std::string(
-        const StatType& metric, const std::string& prefixed_tag_extracted_name)>& generate_output,
-    absl::string_view type) {
-
-  /*
-   * From
-   * https:*github.com/prometheus/docs/blob/master/content/docs/instrumenting/exposition_formats.md#grouping-and-sorting:
-   *
-   * All lines for a given metric must be provided as one single group, with the optional HELP and
-   * TYPE lines first (in no particular order). Beyond that, reproducible sorting in repeated
-   * expositions is preferred but not required, i.e. do not sort if the computational cost is
-   * prohibitive.
-   */
-
-  // This is an unsorted collection of dumb-pointers (no need to increment then decrement every
-  // refcount; ownership is held throughout by `metrics`). It is unsorted for efficiency, but will
-  // be sorted before producing the final output to satisfy the "preferred" ordering from the
-  // prometheus spec: metrics will be sorted by their tags' textual representation, which will be
-  // consistent across calls.
-  using StatTypeUnsortedCollection = std::vector<const StatType*>;
-
-  // Return early to avoid crashing when getting the symbol table from the first metric.
-  if (metrics.empty()) {
-    return 0;
-  }
-
-  // There should only be one symbol table for all of the stats in the admin
-  // interface. If this assumption changes, the name comparisons in this function
-  // will have to change to compare to convert all StatNames to strings before
-  // comparison.
-  const Stats::SymbolTable& global_symbol_table = metrics.front()->constSymbolTable();
-
-  // Sorted collection of metrics sorted by their tagExtractedName, to satisfy the requirements
-  // of the exposition format.
-  std::map<Stats::StatName, StatTypeUnsortedCollection, Stats::StatNameLessThan> groups(
-      global_symbol_table);
-
-  for (const auto& metric : metrics) {
-    ASSERT(&global_symbol_table == &metric->constSymbolTable());
-
-    if (!shouldShowMetric(*metric, used_only, regex)) {
-      continue;
-    }
-
-    groups[metric->tagExtractedStatName()].push_back(metric.get());
-  }
-
-  for (auto& group : groups) {
-    const std::string prefixed_tag_extracted_name =
-        PrometheusStatsFormatter::metricName(global_symbol_table.toString(group.first));
-    response.add(fmt::format("# TYPE {0} {1}\n", prefixed_tag_extracted_name, type));
-
-    // Sort before producing the final output to satisfy the "preferred" ordering from the
-    // prometheus spec: metrics will be sorted by their tags' textual representation, which will
-    // be consistent across calls.
-    std::sort(group.second.begin(), group.second.end(), MetricLessThan());
-
-    for (const auto& metric : group.second) {
-      response.add(generate_output(*metric, prefixed_tag_extracted_name));
-    }
-    response.add("\n");
-  }
-  return groups.size();
-}
-
 /*
  * Return the prometheus output for a numeric Stat (Counter or Gauge).
  */
@@ -176,6 +119,21 @@ std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
   return output;
 };
 
+std::string generateOutput(const Stats::Counter& counter,
+                           const std::string& prefixed_tag_extracted_name) {
+  return generateNumericOutput(counter, prefixed_tag_extracted_name);
+}
+
+std::string generateOutput(const Stats::Gauge& gauge,
+                           const std::string& prefixed_tag_extracted_name) {
+  return generateNumericOutput(gauge, prefixed_tag_extracted_name);
+}
+
+std::string generateOutput(const Stats::ParentHistogram& histogram,
+                           const std::string& prefixed_tag_extracted_name) {
+  return generateHistogramOutput(histogram, prefixed_tag_extracted_name);
+}
+
 absl::flat_hash_set<std::string>& prometheusNamespaces() {
   MUTABLE_CONSTRUCT_ON_FIRST_USE(absl::flat_hash_set<std::string>);
 }
@@ -213,18 +171,13 @@ uint64_t PrometheusStatsFormatter::statsAsPrometheus(
     const std::vector<Stats::GaugeSharedPtr>& gauges,
     const std::vector<Stats::ParentHistogramSharedPtr>& histograms, Buffer::Instance& response,
     const bool used_only, const absl::optional<std::regex>& regex) {
-
-  uint64_t metric_name_count = 0;
-  metric_name_count += outputStatType<Stats::Counter>(
-      response, used_only, regex, counters, generateNumericOutput<Stats::Counter>, "counter");
-
-  metric_name_count += outputStatType<Stats::Gauge>(response, used_only, regex, gauges,
-                                                    generateNumericOutput<Stats::Gauge>, "gauge");
-
-  metric_name_count += outputStatType<Stats::ParentHistogram>(
-      response, used_only, regex, histograms, generateHistogramOutput, "histogram");
-
-  return metric_name_count;
+  PrometheusStatsRenderer renderer(std::vector<Stats::CounterSharedPtr>(counters),
+                                   std::vector<Stats::GaugeSharedPtr>(gauges),
+                                   std::vector<Stats::ParentHistogramSharedPtr>(histograms),
+                                   used_only, regex);
+  while (renderer.nextChunk(response, std::numeric_limits<uint64_t>::max())) {
+  }
+  return renderer.metricNameCount();
 }
 
 bool PrometheusStatsFormatter::registerPrometheusNamespace(absl::string_view prometheus_namespace) {
@@ -245,5 +198,104 @@ bool PrometheusStatsFormatter::unregisterPrometheusNamespace(
   return true;
 }
 
+PrometheusStatsRenderer::PrometheusStatsRenderer(
+    std::vector<Stats::CounterSharedPtr>&& counters, std::vector<Stats::GaugeSharedPtr>&& gauges,
+    std::vector<Stats::ParentHistogramSharedPtr>&& histograms, const bool used_only,
+    const absl::optional<std::regex>& regex) {
+  counters_.metrics_ = std::move(counters);
+  gauges_.metrics_ = std::move(gauges);
+  histograms_.metrics_ = std::move(histograms);
+  groupMetrics(counters_, used_only, regex);
+  groupMetrics(gauges_, used_only, regex);
+  groupMetrics(histograms_, used_only, regex);
+}
+
+bool PrometheusStatsRenderer::nextChunk(Buffer::Instance& response, uint64_t chunk_size) {
+  const uint64_t start_length = response.length();
+  const auto remaining = [&]() -> uint64_t {
+    const uint64_t added = response.length() - start_length;
+    return added < chunk_size ? chunk_size - added : 0;
+  };
+
+  renderGroups(counters_, "counter", response, remaining());
+  renderGroups(gauges_, "gauge", response, remaining());
+  renderGroups(histograms_, "histogram", response, remaining());
+  return histograms_.next_group_ < histograms_.groups_.size();
+}
+
+template <class StatType>
+void PrometheusStatsRenderer::groupMetrics(MetricGroups<StatType>& metrics, const bool used_only,
+                                           const absl::optional<std::regex>& regex) {
+  /*
+   * From
+   * https:*github.com/prometheus/docs/blob/master/content/docs/instrumenting/exposition_formats.md#grouping-and-sorting:
+   *
+   * All lines for a given metric must be provided as one single group, with the optional HELP and
+   * TYPE lines first (in no particular order). Beyond that, reproducible sorting in repeated
+   * expositions is preferred but not required, i.e. do not sort if the computational cost is
+   * prohibitive.
+   */
+
+  // Return early to avoid crashing when getting the symbol table from the first metric.
+  if (metrics.metrics_.empty()) {
+    return;
+  }
+
+  // There should only be one symbol table for all of the stats in the admin
+  // interface. If this assumption changes, the name comparisons in this function
+  // will have to change to compare to convert all StatNames to strings before
+  // comparison.
+  const Stats::SymbolTable& global_symbol_table = metrics.metrics_.front()->constSymbolTable();
+
+  // Collection of metrics sorted by their tagExtractedName, to satisfy the requirements of the
+  // exposition format. The metrics of each group are dumb-pointers (no need to increment then
+  // decrement every refcount; ownership is held throughout by `metrics_`), which are only sorted
+  // when the group is rendered.
+  std::map<Stats::StatName, std::vector<const StatType*>, Stats::StatNameLessThan> groups(
+      global_symbol_table);
+  for (const auto& metric : metrics.metrics_) {
+    ASSERT(&global_symbol_table == &metric->constSymbolTable());
+
+    if (!shouldShowMetric(*metric, used_only, regex)) {
+      continue;
+    }
+
+    groups[metric->tagExtractedStatName()].push_back(metric.get());
+  }
+
+  metrics.groups_.reserve(groups.size());
+  for (auto& group : groups) {
+    metrics.groups_.emplace_back(group.first, std::move(group.second));
+  }
+}
+
+template <class StatType>
+void PrometheusStatsRenderer::renderGroups(MetricGroups<StatType>& metrics,
+                                           absl::string_view type, Buffer::Instance& response,
+                                           uint64_t chunk_size) {
+  const uint64_t start_length = response.length();
+  while (metrics.next_group_ < metrics.groups_.size() &&
+         response.length() - start_length < chunk_size) {
+    auto& group = metrics.groups_[metrics.next_group_++];
+    const std::string prefixed_tag_extracted_name = PrometheusStatsFormatter::metricName(
+        group.second.front()->constSymbolTable().toString(group.first));
+    response.add(fmt::format("# TYPE {0} {1}\n", prefixed_tag_extracted_name, type));
+
+    // Sort before producing the final output to satisfy the "preferred" ordering from the
+    // prometheus spec: metrics will be sorted by their tags' textual representation, which will
+    // be consistent across calls.
+    std::sort(group.second.begin(), group.second.end(), MetricLessThan());
+
+    for (const StatType* metric : group.second) {
+      response.add(generateOutput(*metric, prefixed_tag_extracted_name));
+    }
+    response.add("\n");
+
+    // The metrics of a rendered group are no longer needed.
+    std::vector<const StatType*>().swap(group.second);
+    metric_name_count_++;
+  }
+}
+
 } // namespace Server
 } // namespace Envoy
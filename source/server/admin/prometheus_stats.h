@@ -7,6 +7,8 @@
 #include "envoy/stats/histogram.h"
 #include "envoy/stats/stats.h"
 
+#include "absl/types/optional.h"
+
 namespace Envoy {
 namespace Server {
 /**
@@ -55,5 +57,53 @@ public:
   static bool unregisterPrometheusNamespace(absl::string_view prometheus_namespace);
 };
 
+/**
+ * Renders stats in the Prometheus exposition format a chunk at a time, so that a scrape of a large
+ * number of stats does not have to be held in memory, nor written in a single pass of the main
+ * thread. The renderer holds references to the stats being rendered, which keeps them alive until
+ * the response is complete, and groups them by tag-extracted name up front; the text of each group
+ * is only formatted when its chunk is rendered.
+ */
+class PrometheusStatsRenderer {
+public:
+  PrometheusStatsRenderer(std::vector<Stats::CounterSharedPtr>&& counters,
+                          std::vector<Stats::GaugeSharedPtr>&& gauges,
+                          std::vector<Stats::ParentHistogramSharedPtr>&& histograms,
+                          const bool used_only, const absl::optional<std::regex>& regex);
+
+  /**
+   * Appends the next groups of metrics to the response, until at least chunk_size bytes have been
+   * appended or every metric has been rendered. A group of metrics sharing a tag-extracted name is
+   * never split across chunks.
+   * @return bool true if there are more metrics to render.
+   */
+  bool nextChunk(Buffer::Instance& response, uint64_t chunk_size);
+
+  /**
+   * @return uint64_t the number of metric types rendered so far.
+   */
+  uint64_t metricNameCount() const { return metric_name_count_; }
+
+private:
+  template <class StatType> struct MetricGroups {
+    std::vector<Stats::RefcountPtr<StatType>> metrics_;
+    // The metrics to render by tag-extracted name, sorted by name.
+    std::vector<std::pair<Stats::StatName, std::vector<const StatType*>>> groups_;
+    size_t next_group_{};
+  };
+
+  template <class StatType>
+  static void groupMetrics(MetricGroups<StatType>& metrics, const bool used_only,
+                           const absl::optional<std::regex>& regex);
+  template <class StatType>
+  void renderGroups(MetricGroups<StatType>& metrics, absl::string_view type,
+                        Buffer::Instance& response, uint64_t chunk_size);
+
+  MetricGroups<Stats::Counter> counters_;
+  MetricGroups<Stats::Gauge> gauges_;
+  MetricGroups<Stats::ParentHistogram> histograms_;
+  uint64_t metric_name_count_{};
+};
+
 } // namespace Server
 } // namespace Envoy
@@ -1,6 +1,7 @@
 #include "server/admin/server_info_handler.h"
 
 #include "envoy/admin/v3/memory.pb.h"
+#include "envoy/upstream/cluster_manager.h"
 
 #include "common/memory/stats.h"
 #include "common/version/version.h"
@@ -52,6 +53,28 @@ Http::Code ServerInfoHandler::handlerMemory(absl::string_view,
   memory.set_pageheap_unmapped(Memory::Stats::totalPageHeapUnmapped());
   memory.set_pageheap_free(Memory::Stats::totalPageHeapFree());
   memory.set_total_physical_bytes(Memory::Stats::totalPhysicalBytes());
+  const Upstream::ClusterStats* placeholder = server_.clusterManager().clusterStatsPlaceholder();
+  if (placeholder != nullptr) {
+    // A cluster whose traffic stats are still the shared placeholder has not materialized them.
+    uint64_t idle_clusters = 0;
+    auto count_idle = [placeholder, &idle_clusters](
+                          const Upstream::ClusterManager::ClusterInfoMap& cluster_map) {
+      for (const auto& [name, cluster_ref] : cluster_map) {
+        UNREFERENCED_PARAMETER(name);
+        if (&cluster_ref.get().info()->readOnlyStats() == placeholder) {
+          ++idle_clusters;
+        }
+      }
+    };
+    auto all_clusters = server_.clusterManager().clusters();
+    count_idle(all_clusters.active_clusters_);
+    count_idle(all_clusters.warming_clusters_);
+    const uint64_t bytes_per_cluster = server_.clusterManager().lazyClusterStatsBytes();
+    envoy::admin::v3::Memory::LazyClusterStats& lazy_stats = *memory.mutable_lazy_cluster_stats();
+    lazy_stats.set_idle_clusters(idle_clusters);
+    lazy_stats.set_bytes_per_cluster(bytes_per_cluster);
+    lazy_stats.set_bytes_saved(idle_clusters * bytes_per_cluster);
+  }
   response.add(MessageUtil::getJsonStringFromMessageOrError(memory, true, true)); // pretty-print
   return Http::Code::OK;
 }
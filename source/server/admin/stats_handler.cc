@@ -15,6 +15,55 @@ namespace Server {
 
 const uint64_t RecentLookupsCapacity = 100;
 
+// Stats output larger than this is written to the admin response in chunks of about this size.
+const uint64_t StatsChunkSize = 64 * 1024;
+
+namespace {
+
+/**
+ * Renders the plain text stats output a chunk at a time.
+ */
+class TextStatsRenderer {
+public:
+  TextStatsRenderer(std::map<std::string, std::string>&& text_readouts,
+                    std::map<std::string, uint64_t>&& stats,
+                    std::map<std::string, std::string>&& histograms)
+      : text_readouts_(std::move(text_readouts)), stats_(std::move(stats)),
+        histograms_(std::move(histograms)), next_text_readout_(text_readouts_.begin()),
+        next_stat_(stats_.begin()), next_histogram_(histograms_.begin()) {}
+
+  /**
+   * Appends the next lines of the output to the response, until at least chunk_size bytes have
+   * been appended or the output is complete.
+   * @return bool true if there is more output to render.
+   */
+  bool nextChunk(Buffer::Instance& response, uint64_t chunk_size) {
+    const uint64_t end = response.length() + chunk_size;
+    for (; next_text_readout_ != text_readouts_.end() && response.length() < end;
+         ++next_text_readout_) {
+      response.add(fmt::format("{}: \"{}\"\n", next_text_readout_->first,
+                               Html::Utility::sanitize(next_text_readout_->second)));
+    }
+    for (; next_stat_ != stats_.end() && response.length() < end; ++next_stat_) {
+      response.add(fmt::format("{}: {}\n", next_stat_->first, next_stat_->second));
+    }
+    for (; next_histogram_ != histograms_.end() && response.length() < end; ++next_histogram_) {
+      response.add(fmt::format("{}: {}\n", next_histogram_->first, next_histogram_->second));
+    }
+    return next_histogram_ != histograms_.end();
+  }
+
+private:
+  const std::map<std::string, std::string> text_readouts_;
+  const std::map<std::string, uint64_t> stats_;
+  const std::map<std::string, std::string> histograms_;
+  std::map<std::string, std::string>::const_iterator next_text_readout_;
+  std::map<std::string, uint64_t>::const_iterator next_stat_;
+  std::map<std::string, std::string>::const_iterator next_histogram_;
+};
+
+} // namespace
+
 StatsHandler::StatsHandler(Server::Instance& server) : HandlerContextBase(server) {}
 
 Http::Code StatsHandler::handlerResetCounters(absl::string_view, Http::ResponseHeaderMap&,
@@ -84,14 +133,19 @@ Http::Code StatsHandler::handlerStats(absl::string_view url,
     return Http::Code::BadRequest;
   }
 
+  Stats::StatNameFilter name_filter;
+  const bool indexed = indexedFilter(params, used_only, name_filter);
+  Stats::Store& store = server_.stats();
   std::map<std::string, uint64_t> all_stats;
-  for (const Stats::CounterSharedPtr& counter : server_.stats().counters()) {
+  for (const Stats::CounterSharedPtr& counter :
+       indexed ? store.countersMatching(name_filter) : store.counters()) {
     if (shouldShowMetric(*counter, used_only, regex)) {
       all_stats.emplace(counter->name(), counter->value());
     }
   }
 
-  for (const Stats::GaugeSharedPtr& gauge : server_.stats().gauges()) {
+  for (const Stats::GaugeSharedPtr& gauge :
+       indexed ? store.gaugesMatching(name_filter) : store.gauges()) {
     if (shouldShowMetric(*gauge, used_only, regex)) {
       ASSERT(gauge->importMode() != Stats::Gauge::ImportMode::Uninitialized);
       all_stats.emplace(gauge->name(), gauge->value());
@@ -99,7 +153,8 @@ Http::Code StatsHandler::handlerStats(absl::string_view url,
   }
 
   std::map<std::string, std::string> text_readouts;
-  for (const auto& text_readout : server_.stats().textReadouts()) {
+  for (const auto& text_readout :
+       indexed ? store.textReadoutsMatching(name_filter) : store.textReadouts()) {
     if (shouldShowMetric(*text_readout, used_only, regex)) {
       text_readouts.emplace(text_readout->name(), text_readout->value());
     }
@@ -118,13 +173,6 @@ Http::Code StatsHandler::handlerStats(absl::string_view url,
       rc = Http::Code::NotFound;
     }
   } else { // Display plain stats if format query param is not there.
-    for (const auto& text_readout : text_readouts) {
-      response.add(fmt::format("{}: \"{}\"\n", text_readout.first,
-                               Html::Utility::sanitize(text_readout.second)));
-    }
-    for (const auto& stat : all_stats) {
-      response.add(fmt::format("{}: {}\n", stat.first, stat.second));
-    }
     std::map<std::string, std::string> all_histograms;
     for (const Stats::ParentHistogramSharedPtr& histogram : server_.stats().histograms()) {
       if (shouldShowMetric(*histogram, used_only, regex)) {
@@ -132,8 +180,12 @@ Http::Code StatsHandler::handlerStats(absl::string_view url,
         ASSERT(insert.second); // No duplicates expected.
       }
     }
-    for (const auto& histogram : all_histograms) {
-      response.add(fmt::format("{}: {}\n", histogram.first, histogram.second));
+    auto renderer = std::make_shared<TextStatsRenderer>(
+        std::move(text_readouts), std::move(all_stats), std::move(all_histograms));
+    if (renderer->nextChunk(response, StatsChunkSize)) {
+      admin_stream.setResponseChunks([renderer](Buffer::Instance& chunk) {
+        return renderer->nextChunk(chunk, StatsChunkSize);
+      });
     }
   }
   return rc;
@@ -141,7 +193,8 @@ Http::Code StatsHandler::handlerStats(absl::string_view url,
 
 Http::Code StatsHandler::handlerPrometheusStats(absl::string_view path_and_query,
                                                 Http::ResponseHeaderMap&,
-                                                Buffer::Instance& response, AdminStream&) {
+                                                Buffer::Instance& response,
+                                                AdminStream& admin_stream) {
   const Http::Utility::QueryParams params =
       Http::Utility::parseAndDecodeQueryString(path_and_query);
   const bool used_only = params.find("usedonly") != params.end();
@@ -149,12 +202,32 @@ Http::Code StatsHandler::handlerPrometheusStats(absl::string_view path_and_query
   if (!Utility::filterParam(params, response, regex)) {
     return Http::Code::BadRequest;
   }
-  PrometheusStatsFormatter::statsAsPrometheus(server_.stats().counters(), server_.stats().gauges(),
-                                              server_.stats().histograms(), response, used_only,
-                                              regex);
+  Stats::StatNameFilter name_filter;
+  const bool indexed = indexedFilter(params, used_only, name_filter);
+  Stats::Store& store = server_.stats();
+  auto renderer = std::make_shared<PrometheusStatsRenderer>(
+      indexed ? store.countersMatching(name_filter) : store.counters(),
+      indexed ? store.gaugesMatching(name_filter) : store.gauges(), store.histograms(), used_only,
+      regex);
+  if (renderer->nextChunk(response, StatsChunkSize)) {
+    admin_stream.setResponseChunks([renderer](Buffer::Instance& chunk) {
+      return renderer->nextChunk(chunk, StatsChunkSize);
+    });
+  }
   return Http::Code::OK;
 }
 
+bool StatsHandler::indexedFilter(const Http::Utility::QueryParams& params, bool used_only,
+                                 Stats::StatNameFilter& name_filter) {
+  // Without a filter every stat is visited anyway, so there is no point in building the index.
+  const auto filter = params.find("filter");
+  if (filter == params.end() || !Utility::statNameFilter(filter->second, name_filter)) {
+    return false;
+  }
+  name_filter.used_only_ = used_only;
+  return true;
+}
+
 // TODO(ambuc) Export this as a server (?) stat for monitoring.
 Http::Code StatsHandler::handlerContention(absl::string_view,
                                            Http::ResponseHeaderMap& response_headers,
@@ -9,6 +9,7 @@
 #include "envoy/server/admin.h"
 #include "envoy/server/instance.h"
 
+#include "common/http/utility.h"
 #include "common/stats/histogram_impl.h"
 
 #include "server/admin/handler_ctx.h"
@@ -56,6 +57,13 @@ private:
             (!regex.has_value() || std::regex_search(metric.name(), regex.value())));
   }
 
+  // Sets name_filter to select the counters, gauges and text readouts a stats request may show, if
+  // they can be looked up in the store's index of stat names rather than by matching the filter
+  // regex against every stat. The regex must still be applied to the selected stats.
+  // @return whether the stats can be looked up in the index.
+  static bool indexedFilter(const Http::Utility::QueryParams& params, bool used_only,
+                            Stats::StatNameFilter& name_filter);
+
   friend class AdminStatsTest;
 
   static std::string statsAsJson(const std::map<std::string, uint64_t>& all_stats,
@@ -3,6 +3,8 @@
 #include "common/common/enum_to_int.h"
 #include "common/http/headers.h"
 
+#include "absl/strings/strip.h"
+
 namespace Envoy {
 namespace Server {
 namespace Utility {
@@ -56,6 +58,75 @@ bool filterParam(Http::Utility::QueryParams params, Buffer::Instance& response,
   return true;
 }
 
+namespace {
+
+// The characters with a special meaning in ECMAScript regexes, outside of brackets.
+bool isRegexSpecial(char c) {
+  return absl::string_view("^$\\.*+?()[]{}|").find(c) != absl::string_view::npos;
+}
+
+// The quantifiers, which make the preceding atom optional or repeated.
+bool isRegexQuantifier(char c) { return c == '*' || c == '+' || c == '?' || c == '{'; }
+
+// Whether the pattern has an alternation outside of any group, which could match names that do
+// not contain the literal at the start of the pattern.
+bool hasTopLevelAlternation(absl::string_view pattern) {
+  int depth = 0;
+  bool in_brackets = false;
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    const char c = pattern[i];
+    if (c == '\\') {
+      ++i;
+    } else if (in_brackets) {
+      in_brackets = c != ']';
+    } else if (c == '[') {
+      in_brackets = true;
+    } else if (c == '(') {
+      ++depth;
+    } else if (c == ')') {
+      --depth;
+    } else if (c == '|' && depth == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+bool statNameFilter(absl::string_view pattern, Stats::StatNameFilter& filter) {
+  if (hasTopLevelAlternation(pattern)) {
+    return false;
+  }
+  const bool anchored = absl::ConsumePrefix(&pattern, "^");
+  std::string literal;
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    char c = pattern[i];
+    if (c == '\\') {
+      // Only escaped special characters stand for themselves. Others, such as \d, are classes.
+      if (i + 1 == pattern.size() || !isRegexSpecial(pattern[i + 1])) {
+        break;
+      }
+      c = pattern[++i];
+    } else if (isRegexSpecial(c)) {
+      break;
+    }
+    if (i + 1 < pattern.size() && isRegexQuantifier(pattern[i + 1])) {
+      break;
+    }
+    literal.push_back(c);
+  }
+  if (literal.empty()) {
+    return false;
+  }
+  if (anchored) {
+    filter.prefix_ = std::move(literal);
+  } else {
+    filter.substring_ = std::move(literal);
+  }
+  return true;
+}
+
 // Helper method to get the format parameter.
 absl::optional<std::string> formatParam(const Http::Utility::QueryParams& params) {
   return queryParam(params, "format");
@@ -4,6 +4,7 @@
 
 #include "envoy/admin/v3/server_info.pb.h"
 #include "envoy/init/manager.h"
+#include "envoy/stats/stats.h"
 
 #include "common/http/codes.h"
 #include "common/http/header_map_impl.h"
@@ -21,6 +22,13 @@ void populateFallbackResponseHeaders(Http::Code code, Http::ResponseHeaderMap& h
 bool filterParam(Http::Utility::QueryParams params, Buffer::Instance& response,
                  absl::optional<std::regex>& regex);
 
+// Derives from a stats filter regex a name filter selecting a superset of the stats the regex
+// matches, so that the stats can be looked up in the store's index of stat names rather than by
+// matching the regex against every stat. This works for regexes which are anchored with '^' and
+// begin with a literal, and for regexes which begin with a literal and have no alternation.
+// Returns false for other regexes.
+bool statNameFilter(absl::string_view pattern, Stats::StatNameFilter& filter);
+
 absl::optional<std::string> formatParam(const Http::Utility::QueryParams& params);
 
 absl::optional<std::string> queryParam(const Http::Utility::QueryParams& params,
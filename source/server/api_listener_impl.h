@@ -144,6 +144,7 @@ protected:
       absl::string_view transportFailureReason() const override { return EMPTY_STRING; }
       bool startSecureTransport() override { NOT_IMPLEMENTED_GCOVR_EXCL_LINE; }
       absl::optional<std::chrono::milliseconds> lastRoundTripTime() const override { return {}; };
+      bool startSplice(Connection&) override { return false; }
 
       SyntheticReadCallbacks& parent_;
       Network::SocketAddressSetterSharedPtr address_provider_;
@@ -53,6 +53,8 @@ public:
   const std::list<Stats::SinkPtr>& sinks() const override { return sinks_; }
   std::chrono::milliseconds flushInterval() const override { return flush_interval_; }
   bool flushOnAdmin() const override { return flush_on_admin_; }
+  bool flushSnapshotOnThread() const override { return flush_snapshot_on_thread_; }
+  bool flushDeltasOnly() const override { return flush_deltas_only_; }
 
   void addSink(Stats::SinkPtr sink) { sinks_.emplace_back(std::move(sink)); }
 
@@ -60,6 +62,8 @@ private:
   std::list<Stats::SinkPtr> sinks_;
   std::chrono::milliseconds flush_interval_;
   bool flush_on_admin_{false};
+  const bool flush_snapshot_on_thread_;
+  const bool flush_deltas_only_;
 };
 
 /**
@@ -144,6 +144,9 @@ OptionsImpl::OptionsImpl(std::vector<std::string> args,
                                        "Disable hot restart functionality", cmd, false);
   TCLAP::SwitchArg enable_mutex_tracing(
       "", "enable-mutex-tracing", "Enable mutex contention tracing functionality", cmd, false);
+  TCLAP::SwitchArg concurrent_symbol_table(
+      "", "concurrent-symbol-table",
+      "Shard the stats symbol table for stat names created from many threads", cmd, false);
   TCLAP::SwitchArg cpuset_threads(
       "", "cpuset-threads", "Get the default # of worker threads from cpuset size", cmd, false);
 
@@ -181,6 +184,7 @@ OptionsImpl::OptionsImpl(std::vector<std::string> args,
 
   hot_restart_disabled_ = disable_hot_restart.getValue();
   mutex_tracing_enabled_ = enable_mutex_tracing.getValue();
+  concurrent_symbol_table_enabled_ = concurrent_symbol_table.getValue();
   core_dump_enabled_ = enable_core_dump.getValue();
 
   cpuset_threads_ = cpuset_threads.getValue();
@@ -146,6 +146,7 @@ public:
   bool hotRestartDisabled() const override { return hot_restart_disabled_; }
   bool signalHandlingEnabled() const override { return signal_handling_enabled_; }
   bool mutexTracingEnabled() const override { return mutex_tracing_enabled_; }
+  bool concurrentSymbolTableEnabled() const override { return concurrent_symbol_table_enabled_; }
   bool coreDumpEnabled() const override { return core_dump_enabled_; }
   Server::CommandLineOptionsPtr toCommandLineOptions() const override;
   void parseComponentLogLevels(const std::string& component_log_levels);
@@ -200,6 +201,7 @@ private:
   bool hot_restart_disabled_{false};
   bool signal_handling_enabled_{true};
   bool mutex_tracing_enabled_{false};
+  bool concurrent_symbol_table_enabled_{false};
   bool core_dump_enabled_{false};
   bool cpuset_threads_{false};
   std::vector<std::string> disabled_extensions_;
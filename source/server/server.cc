@@ -26,6 +26,7 @@
 
 #include "common/api/api_impl.h"
 #include "common/api/os_sys_calls_impl.h"
+#include "common/buffer/slice_allocator.h"
 #include "common/common/enum_to_int.h"
 #include "common/common/mutex_tracer_impl.h"
 #include "common/common/utility.h"
@@ -164,30 +165,76 @@ void InstanceImpl::failHealthcheck(bool fail) {
   server_stats_->live_.set(live_.load());
 }
 
-MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source) {
+MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source)
+    : MetricSnapshotImpl(store, time_source, nullptr) {}
+
+MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source,
+                                       FlushedValues& flushed_values)
+    : MetricSnapshotImpl(store, time_source, &flushed_values) {}
+
+MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source,
+                                       FlushedValues* flushed_values) {
   snapped_counters_ = store.counters();
   counters_.reserve(snapped_counters_.size());
   for (const auto& counter : snapped_counters_) {
-    counters_.push_back({counter->latch(), *counter});
+    // Every counter is latched, so that the next delta of those left out is still correct.
+    const uint64_t delta = counter->latch();
+    if (flushed_values == nullptr || delta > 0) {
+      counters_.push_back({delta, *counter});
+    }
   }
 
   snapped_gauges_ = store.gauges();
   gauges_.reserve(snapped_gauges_.size());
+  absl::flat_hash_map<const Stats::Gauge*, uint64_t> gauge_values;
+  if (flushed_values != nullptr) {
+    gauge_values.reserve(snapped_gauges_.size());
+  }
   for (const auto& gauge : snapped_gauges_) {
     ASSERT(gauge->importMode() != Stats::Gauge::ImportMode::Uninitialized);
-    gauges_.push_back(*gauge);
+    if (flushed_values == nullptr) {
+      gauges_.push_back(*gauge);
+      continue;
+    }
+    const uint64_t value = gauge->value();
+    gauge_values.emplace(gauge.get(), value);
+    auto it = flushed_values->gauge_values_.find(gauge.get());
+    if (it == flushed_values->gauge_values_.end() || it->second != value) {
+      gauges_.push_back(*gauge);
+    }
   }
 
   snapped_histograms_ = store.histograms();
   histograms_.reserve(snapped_histograms_.size());
   for (const auto& histogram : snapped_histograms_) {
-    histograms_.push_back(*histogram);
+    if (flushed_values == nullptr || histogram->intervalStatistics().sampleCount() > 0) {
+      histograms_.push_back(*histogram);
+    }
   }
 
   snapped_text_readouts_ = store.textReadouts();
   text_readouts_.reserve(snapped_text_readouts_.size());
+  absl::flat_hash_map<const Stats::TextReadout*, std::string> text_readout_values;
   for (const auto& text_readout : snapped_text_readouts_) {
-    text_readouts_.push_back(*text_readout);
+    if (flushed_values == nullptr) {
+      text_readouts_.push_back(*text_readout);
+      continue;
+    }
+    std::string value = text_readout->value();
+    auto it = flushed_values->text_readout_values_.find(text_readout.get());
+    if (it == flushed_values->text_readout_values_.end() || it->second != value) {
+      text_readouts_.push_back(*text_readout);
+    }
+    text_readout_values.emplace(text_readout.get(), std::move(value));
+  }
+
+  if (flushed_values != nullptr) {
+    // Metrics deleted from the store since the previous snapshot are dropped here. Holding
+    // references to the flushed metrics keeps their addresses from being reused in the meantime.
+    flushed_values->gauges_ = snapped_gauges_;
+    flushed_values->gauge_values_ = std::move(gauge_values);
+    flushed_values->text_readouts_ = snapped_text_readouts_;
+    flushed_values->text_readout_values_ = std::move(text_readout_values);
   }
 
   snapshot_time_ = time_source.systemTime();
@@ -257,8 +304,40 @@ void InstanceImpl::updateServerStats() {
 
 void InstanceImpl::flushStatsInternal() {
   updateServerStats();
+  if (stats_flush_dispatcher_ == nullptr) {
+    flushStatsSnapshot(*createStatsSnapshot());
+    return;
+  }
+
+  // Walking every metric in the store is the bulk of a flush on a large deployment, so it is done
+  // on the stats flush thread. The sinks are still called on the main thread, as some of them
+  // (e.g. the gRPC metrics service and the TLS backed statsd writer) are bound to it.
+  stats_flush_dispatcher_->post([this]() -> void {
+    std::shared_ptr<MetricSnapshotImpl> snapshot = createStatsSnapshot();
+    dispatcher_->post([this, snapshot]() -> void { flushStatsSnapshot(*snapshot); });
+  });
+}
+
+std::unique_ptr<MetricSnapshotImpl> InstanceImpl::createStatsSnapshot() {
+  // NOTE: Even if there are no sinks, creating the snapshot has the important property that it
+  //       latches all counters on a periodic basis. The hot restart code assumes this is being
+  //       done so this should not be removed.
+  std::unique_ptr<MetricSnapshotImpl> snapshot =
+      config_.statsConfig().flushDeltasOnly()
+          ? std::make_unique<MetricSnapshotImpl>(stats_store_, timeSource(), flushed_values_)
+          : std::make_unique<MetricSnapshotImpl>(stats_store_, timeSource());
+  if (shared_memory_stats_ != nullptr) {
+    shared_memory_stats_->update(snapshot->snappedCounters(), snapshot->snappedGauges(),
+                                 snapshot->snapshotTime());
+  }
+  return snapshot;
+}
+
+void InstanceImpl::flushStatsSnapshot(MetricSnapshotImpl& snapshot) {
   auto& stats_config = config_.statsConfig();
-  InstanceUtil::flushMetricsToSinks(stats_config.sinks(), stats_store_, timeSource());
+  for (const auto& sink : stats_config.sinks()) {
+    sink->flush(snapshot);
+  }
   // TODO(ramaraochavali): consider adding different flush interval for histograms.
   if (stat_flush_timer_ != nullptr) {
     stat_flush_timer_->enableTimer(stats_config.flushInterval());
@@ -267,6 +346,19 @@ void InstanceImpl::flushStatsInternal() {
   stats_flush_in_progress_ = false;
 }
 
+void InstanceImpl::stopStatsFlushThread() {
+  if (stats_flush_thread_ == nullptr) {
+    return;
+  }
+  stats_flush_dispatcher_->exit();
+  stats_flush_thread_->join();
+  stats_flush_thread_.reset();
+  stats_flush_dispatcher_.reset();
+  // A snapshot taken on the thread may not have been handed back to the sinks yet. Any further
+  // flush is done synchronously on the main thread.
+  stats_flush_in_progress_ = false;
+}
+
 bool InstanceImpl::healthCheckFailed() { return !live_.load(); }
 
 ProcessContextOptRef InstanceImpl::processContext() {
@@ -354,6 +446,8 @@ void InstanceImpl::initialize(const Options& options,
     // setPrefix has a release assert verifying that setPrefix() is not called after prefix()
     ThreadSafeSingleton<Http::PrefixValue>::get().setPrefix(bootstrap_.header_prefix().c_str());
   }
+  Buffer::SliceAllocator::setMaxCachedBytes(PROTOBUF_GET_WRAPPED_OR_DEFAULT(
+      bootstrap_, per_thread_buffer_cache_bytes, Buffer::SliceAllocator::DefaultMaxCachedBytes));
   // TODO(mattklein123): Custom O(1) headers can be registered at this point for creating/finalizing
   // any header maps.
   ENVOY_LOG(info, "HTTP header map info:");
@@ -367,6 +461,18 @@ void InstanceImpl::initialize(const Options& options,
   stats_store_.setTagProducer(Config::Utility::createTagProducer(bootstrap_));
   stats_store_.setStatsMatcher(Config::Utility::createStatsMatcher(bootstrap_));
   stats_store_.setHistogramSettings(Config::Utility::createHistogramSettings(bootstrap_));
+  const auto& striped_counters = bootstrap_.stats_config().striped_counters();
+  if (!striped_counters.empty()) {
+    // One stripe for each worker and one for the main thread.
+    stats_store_.setStripedCounters({striped_counters.begin(), striped_counters.end()},
+                                    options_.concurrency() + 1);
+  }
+  if (bootstrap_.stats_config().has_shared_memory_export()) {
+    const auto& shared_memory_export = bootstrap_.stats_config().shared_memory_export();
+    shared_memory_stats_ = std::make_unique<SharedMemoryStats>(
+        shared_memory_export.name(),
+        PROTOBUF_GET_WRAPPED_OR_DEFAULT(shared_memory_export, max_stats, 65536));
+  }
 
   const std::string server_stats_prefix = "server.";
   const std::string server_compilation_settings_stats_prefix = "server.compilation_settings";
@@ -588,6 +694,14 @@ void InstanceImpl::initialize(const Options& options,
     // Just setup the timer.
     stat_flush_timer_ = dispatcher_->createTimer([this]() -> void { flushStats(); });
     stat_flush_timer_->enableTimer(stats_config.flushInterval());
+    if (stats_config.flushSnapshotOnThread()) {
+      stats_flush_dispatcher_ = api_->allocateDispatcher("stats_flush");
+      stats_flush_thread_ = api_->threadFactory().createThread(
+          [this]() -> void {
+            stats_flush_dispatcher_->run(Event::Dispatcher::RunType::RunUntilExit);
+          },
+          Thread::Options{"stats_flush"});
+    }
   }
 
   // Now that we are initialized, notify the bootstrap extensions.
@@ -787,6 +901,9 @@ void InstanceImpl::terminate() {
   }
   terminated_ = true;
 
+  // Stop taking stats snapshots concurrently with the shutdown of the main thread.
+  stopStatsFlushThread();
+
   // Before starting to shutdown anything else, stop slot destruction updates.
   thread_local_.shutdownGlobalThreading();
 
@@ -43,8 +43,10 @@
 #include "server/listener_hooks.h"
 #include "server/listener_manager_impl.h"
 #include "server/overload_manager_impl.h"
+#include "server/shared_memory_stats.h"
 #include "server/worker_impl.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/types/optional.h"
 
@@ -215,6 +217,72 @@ private:
   Stats::ScopePtr server_scope_;
 };
 
+// Local implementation of Stats::MetricSnapshot used to flush metrics to sinks. We could
+// potentially have a single class instance held in a static and have a clear() method to avoid some
+// vector constructions and reservations, but I'm not sure it's worth the extra complexity until it
+// shows up in perf traces.
+// TODO(mattklein123): One thing we probably want to do is switch from returning vectors of metrics
+//                     to a lambda based callback iteration API. This would require less vector
+//                     copying and probably be a cleaner API in general.
+class MetricSnapshotImpl : public Stats::MetricSnapshot {
+public:
+  /**
+   * The values of the gauges and text readouts in the store when the previous delta snapshot was
+   * taken. The metrics are referenced, so that their addresses are not reused by other metrics.
+   */
+  class FlushedValues {
+  private:
+    friend class MetricSnapshotImpl;
+
+    std::vector<Stats::GaugeSharedPtr> gauges_;
+    absl::flat_hash_map<const Stats::Gauge*, uint64_t> gauge_values_;
+    std::vector<Stats::TextReadoutSharedPtr> text_readouts_;
+    absl::flat_hash_map<const Stats::TextReadout*, std::string> text_readout_values_;
+  };
+
+  explicit MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source);
+
+  /**
+   * Takes a delta snapshot, of the counters incremented, the gauges and text readouts changed and
+   * the histograms recorded into since flushed_values was taken, which is then updated. All the
+   * counters are latched, whether they are included or not.
+   */
+  MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source, FlushedValues& flushed_values);
+
+  // Stats::MetricSnapshot
+  const std::vector<CounterSnapshot>& counters() override { return counters_; }
+  const std::vector<std::reference_wrapper<const Stats::Gauge>>& gauges() override {
+    return gauges_;
+  };
+  const std::vector<std::reference_wrapper<const Stats::ParentHistogram>>& histograms() override {
+    return histograms_;
+  }
+  const std::vector<std::reference_wrapper<const Stats::TextReadout>>& textReadouts() override {
+    return text_readouts_;
+  }
+  SystemTime snapshotTime() const override { return snapshot_time_; }
+
+  /**
+   * @return all the counters and gauges in the store when the snapshot was taken, including those
+   *         left out of a delta snapshot.
+   */
+  const std::vector<Stats::CounterSharedPtr>& snappedCounters() const { return snapped_counters_; }
+  const std::vector<Stats::GaugeSharedPtr>& snappedGauges() const { return snapped_gauges_; }
+
+private:
+  MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source, FlushedValues* flushed_values);
+
+  std::vector<Stats::CounterSharedPtr> snapped_counters_;
+  std::vector<CounterSnapshot> counters_;
+  std::vector<Stats::GaugeSharedPtr> snapped_gauges_;
+  std::vector<std::reference_wrapper<const Stats::Gauge>> gauges_;
+  std::vector<Stats::ParentHistogramSharedPtr> snapped_histograms_;
+  std::vector<std::reference_wrapper<const Stats::ParentHistogram>> histograms_;
+  std::vector<Stats::TextReadoutSharedPtr> snapped_text_readouts_;
+  std::vector<std::reference_wrapper<const Stats::TextReadout>> text_readouts_;
+  SystemTime snapshot_time_;
+};
+
 /**
  * This is the actual full standalone server which stitches together various common components.
  */
@@ -299,6 +367,9 @@ public:
 private:
   ProtobufTypes::MessagePtr dumpBootstrapConfig();
   void flushStatsInternal();
+  std::unique_ptr<MetricSnapshotImpl> createStatsSnapshot();
+  void flushStatsSnapshot(MetricSnapshotImpl& snapshot);
+  void stopStatsFlushThread();
   void updateServerStats();
   void initialize(const Options& options, Network::Address::InstanceConstSharedPtr local_address,
                   ComponentFactory& component_factory, ListenerHooks& hooks);
@@ -387,6 +458,13 @@ private:
   ServerFactoryContextImpl server_contexts_;
 
   bool stats_flush_in_progress_ : 1;
+  // Set if stats snapshots are taken on a dedicated thread, which runs stats_flush_dispatcher_.
+  Event::DispatcherPtr stats_flush_dispatcher_;
+  Thread::ThreadPtr stats_flush_thread_;
+  // Only used by one snapshot at a time, as a flush does not start while another is in progress.
+  MetricSnapshotImpl::FlushedValues flushed_values_;
+  // Set if the counters and gauges are exported to shared memory, on each snapshot.
+  std::unique_ptr<SharedMemoryStats> shared_memory_stats_;
 
   template <class T>
   class LifecycleCallbackHandle : public ServerLifecycleNotifier::Handle, RaiiListElement<T> {
@@ -396,41 +474,5 @@ private:
   };
 };
 
-// Local implementation of Stats::MetricSnapshot used to flush metrics to sinks. We could
-// potentially have a single class instance held in a static and have a clear() method to avoid some
-// vector constructions and reservations, but I'm not sure it's worth the extra complexity until it
-// shows up in perf traces.
-// TODO(mattklein123): One thing we probably want to do is switch from returning vectors of metrics
-//                     to a lambda based callback iteration API. This would require less vector
-//                     copying and probably be a cleaner API in general.
-class MetricSnapshotImpl : public Stats::MetricSnapshot {
-public:
-  explicit MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source);
-
-  // Stats::MetricSnapshot
-  const std::vector<CounterSnapshot>& counters() override { return counters_; }
-  const std::vector<std::reference_wrapper<const Stats::Gauge>>& gauges() override {
-    return gauges_;
-  };
-  const std::vector<std::reference_wrapper<const Stats::ParentHistogram>>& histograms() override {
-    return histograms_;
-  }
-  const std::vector<std::reference_wrapper<const Stats::TextReadout>>& textReadouts() override {
-    return text_readouts_;
-  }
-  SystemTime snapshotTime() const override { return snapshot_time_; }
-
-private:
-  std::vector<Stats::CounterSharedPtr> snapped_counters_;
-  std::vector<CounterSnapshot> counters_;
-  std::vector<Stats::GaugeSharedPtr> snapped_gauges_;
-  std::vector<std::reference_wrapper<const Stats::Gauge>> gauges_;
-  std::vector<Stats::ParentHistogramSharedPtr> snapped_histograms_;
-  std::vector<std::reference_wrapper<const Stats::ParentHistogram>> histograms_;
-  std::vector<Stats::TextReadoutSharedPtr> snapped_text_readouts_;
-  std::vector<std::reference_wrapper<const Stats::TextReadout>> text_readouts_;
-  SystemTime snapshot_time_;
-};
-
 } // namespace Server
 } // namespace Envoy
@@ -0,0 +1,179 @@
+#include "server/shared_memory_stats.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+#include "envoy/common/exception.h"
+
+#include "common/api/os_sys_calls_impl.h"
+#include "common/common/assert.h"
+#include "common/common/fmt.h"
+#include "common/common/utility.h"
+
+#ifdef ENVOY_HOT_RESTART
+#include "common/api/os_sys_calls_impl_hot_restart.h"
+#endif
+
+namespace Envoy {
+namespace Server {
+
+namespace {
+
+// The name bytes reserved per stat. Names longer than this are fine as long as the average fits.
+constexpr uint64_t NameBytesPerStat = 128;
+
+} // namespace
+
+SharedMemoryStats::SharedMemoryStats(const std::string& name, uint32_t max_stats)
+    : name_(name), region_size_(0), header_(nullptr) {
+#ifdef ENVOY_HOT_RESTART
+  Api::OsSysCalls& os_sys_calls = Api::OsSysCallsSingleton::get();
+  Api::HotRestartOsSysCalls& hot_restart_os_sys_calls = Api::HotRestartOsSysCallsSingleton::get();
+
+  const uint64_t entries_offset = sizeof(SharedMemoryStatsHeader);
+  const uint64_t names_offset =
+      entries_offset + static_cast<uint64_t>(max_stats) * sizeof(SharedMemoryStatsEntry);
+  const uint64_t names_size = static_cast<uint64_t>(max_stats) * NameBytesPerStat;
+  region_size_ = names_offset + names_size;
+
+  // A region left behind by a previous Envoy that did not exit cleanly is replaced, rather than
+  // shared, so that collectors never see two writers.
+  hot_restart_os_sys_calls.shmUnlink(name_.c_str());
+  const Api::SysCallIntResult open_result = hot_restart_os_sys_calls.shmOpen(
+      name_.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP);
+  if (open_result.rc_ == -1) {
+    throw EnvoyException(fmt::format("cannot open shared memory stats region {}: {}", name_,
+                                     errorDetails(open_result.errno_)));
+  }
+
+  const Api::SysCallIntResult truncate_result =
+      os_sys_calls.ftruncate(open_result.rc_, region_size_);
+  Api::SysCallPtrResult mmap_result{MAP_FAILED, 0};
+  if (truncate_result.rc_ != -1) {
+    mmap_result = os_sys_calls.mmap(nullptr, region_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                                    open_result.rc_, 0);
+  }
+  os_sys_calls.close(open_result.rc_);
+  if (mmap_result.rc_ == MAP_FAILED) {
+    hot_restart_os_sys_calls.shmUnlink(name_.c_str());
+    throw EnvoyException(fmt::format(
+        "cannot map shared memory stats region {} of {} bytes: {}", name_, region_size_,
+        errorDetails(truncate_result.rc_ == -1 ? truncate_result.errno_ : mmap_result.errno_)));
+  }
+
+  // The freshly truncated region is zero-filled, so only the non-zero fields need writing.
+  header_ = new (mmap_result.rc_) SharedMemoryStatsHeader();
+  header_->magic_ = SHARED_MEMORY_STATS_MAGIC;
+  header_->version_ = SHARED_MEMORY_STATS_VERSION;
+  header_->header_size_ = sizeof(SharedMemoryStatsHeader);
+  header_->region_size_ = region_size_;
+  header_->entries_offset_ = entries_offset;
+  header_->max_entries_ = max_stats;
+  header_->entry_size_ = sizeof(SharedMemoryStatsEntry);
+  header_->names_offset_ = names_offset;
+  header_->names_size_ = names_size;
+  header_->pid_ = getpid();
+#else
+  UNREFERENCED_PARAMETER(max_stats);
+  throw EnvoyException("shared memory stats export is not supported on this platform");
+#endif
+}
+
+SharedMemoryStats::~SharedMemoryStats() {
+#ifdef ENVOY_HOT_RESTART
+  ::munmap(header_, region_size_);
+  Api::HotRestartOsSysCallsSingleton::get().shmUnlink(name_.c_str());
+#endif
+}
+
+SharedMemoryStatsEntry* SharedMemoryStats::entries() const {
+  return reinterpret_cast<SharedMemoryStatsEntry*>(reinterpret_cast<char*>(header_) +
+                                                   header_->entries_offset_);
+}
+
+char* SharedMemoryStats::names() const {
+  return reinterpret_cast<char*>(header_) + header_->names_offset_;
+}
+
+bool SharedMemoryStats::sameMetrics(const std::vector<Stats::CounterSharedPtr>& counters,
+                                    const std::vector<Stats::GaugeSharedPtr>& gauges) const {
+  return counters == counters_ && gauges == gauges_;
+}
+
+void SharedMemoryStats::writeNames() {
+  SharedMemoryStatsEntry* entry = entries();
+  char* names_base = names();
+  uint64_t num_entries = 0;
+  uint64_t names_used = 0;
+  const auto write = [&](const Stats::Metric& metric, SharedMemoryStatsType type) -> bool {
+    const std::string name = metric.name();
+    if (num_entries == header_->max_entries_ || names_used + name.size() > header_->names_size_) {
+      return false;
+    }
+    memcpy(names_base + names_used, name.data(), name.size());
+    entry[num_entries].name_offset_ = names_used;
+    entry[num_entries].name_length_ = name.size();
+    entry[num_entries].type_ = static_cast<uint32_t>(type);
+    names_used += name.size();
+    ++num_entries;
+    return true;
+  };
+
+  // Counters are written first and the first stat that does not fit ends the export, so that the
+  // exported stats are always a prefix of counters_ followed by gauges_.
+  bool fits = true;
+  for (const Stats::CounterSharedPtr& counter : counters_) {
+    if (!(fits = write(*counter, SharedMemoryStatsType::Counter))) {
+      break;
+    }
+  }
+  for (const Stats::GaugeSharedPtr& gauge : gauges_) {
+    if (!fits || !(fits = write(*gauge, SharedMemoryStatsType::Gauge))) {
+      break;
+    }
+  }
+
+  header_->num_entries_ = num_entries;
+  header_->dropped_ = counters_.size() + gauges_.size() - num_entries;
+}
+
+void SharedMemoryStats::update(const std::vector<Stats::CounterSharedPtr>& counters,
+                               const std::vector<Stats::GaugeSharedPtr>& gauges, SystemTime time) {
+  const bool metrics_changed = !sameMetrics(counters, gauges);
+  if (metrics_changed) {
+    counters_ = counters;
+    gauges_ = gauges;
+  }
+
+  // Make the sequence odd before touching the entries, and make that visible before any of the
+  // writes below.
+  const uint64_t sequence = header_->sequence_.load(std::memory_order_relaxed);
+  header_->sequence_.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  if (metrics_changed) {
+    writeNames();
+  }
+  SharedMemoryStatsEntry* entry = entries();
+  const uint64_t num_entries = header_->num_entries_;
+  const uint64_t num_counters = std::min<uint64_t>(num_entries, counters_.size());
+  for (uint64_t i = 0; i < num_counters; ++i) {
+    entry[i].value_ = counters_[i]->value();
+  }
+  for (uint64_t i = num_counters; i < num_entries; ++i) {
+    entry[i].value_ = gauges_[i - num_counters]->value();
+  }
+  header_->update_time_ms_ =
+      std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+
+  header_->sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+} // namespace Server
+} // namespace Envoy
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "envoy/common/time.h"
+#include "envoy/stats/stats.h"
+
+#include "common/common/non_copyable.h"
+
+namespace Envoy {
+namespace Server {
+
+// "ENVOYSTS" read as a little-endian integer, identifying a shared memory stats region.
+constexpr uint64_t SHARED_MEMORY_STATS_MAGIC = 0x535453594f564e45;
+
+// Increment this whenever the layout below changes incompatibly. Collectors must check it before
+// interpreting anything but the magic_ and version_ fields.
+constexpr uint32_t SHARED_MEMORY_STATS_VERSION = 1;
+
+/**
+ * The header at the start of a shared memory stats region. The region is laid out as:
+ *
+ *   [SharedMemoryStatsHeader][max_entries_ x SharedMemoryStatsEntry][names_size_ bytes of names]
+ *
+ * All integers are in host byte order, and offsets are in bytes from the start of the region.
+ * The fields above sequence_ are written once, when the region is created.
+ *
+ * The entries and names are rewritten on each stats flush, under a seqlock. A collector reads a
+ * consistent copy of the stats by:
+ *   1. Loading sequence_ with acquire semantics. If it is odd an update is in progress, so the
+ *      collector retries.
+ *   2. Copying num_entries_, the entries and the names it needs.
+ *   3. Issuing an acquire fence and loading sequence_ again. If it changed, the copy may be torn,
+ *      so the collector discards it and retries.
+ * The values in a copy are those of a single flush.
+ */
+struct SharedMemoryStatsHeader {
+  uint64_t magic_;          // SHARED_MEMORY_STATS_MAGIC.
+  uint32_t version_;        // SHARED_MEMORY_STATS_VERSION.
+  uint32_t header_size_;    // sizeof(SharedMemoryStatsHeader).
+  uint64_t region_size_;    // The size of the whole region.
+  uint64_t entries_offset_; // The offset of the first SharedMemoryStatsEntry.
+  uint32_t max_entries_;    // The number of SharedMemoryStatsEntry slots.
+  uint32_t entry_size_;     // sizeof(SharedMemoryStatsEntry).
+  uint64_t names_offset_;   // The offset of the names, which are not NUL-terminated.
+  uint64_t names_size_;     // The number of bytes available for names.
+  uint64_t pid_;            // The process id of the Envoy writing the region.
+
+  std::atomic<uint64_t> sequence_; // Odd while an update is in progress.
+  uint64_t num_entries_;           // The number of entries holding stats.
+  uint64_t dropped_;               // The number of stats left out for lack of space.
+  uint64_t update_time_ms_;        // The time of the latest update, in ms since the epoch.
+};
+
+enum class SharedMemoryStatsType : uint32_t { Counter = 0, Gauge = 1 };
+
+/**
+ * An exported counter or gauge.
+ */
+struct SharedMemoryStatsEntry {
+  uint64_t value_;       // The counter's total or the gauge's value.
+  uint32_t name_offset_; // The offset of the stat's name, relative to names_offset_.
+  uint32_t name_length_; // The length of the stat's name.
+  uint32_t type_;        // A SharedMemoryStatsType.
+  uint32_t reserved_;
+};
+
+static_assert(sizeof(SharedMemoryStatsHeader) == 96, "SharedMemoryStatsHeader layout changed");
+static_assert(sizeof(SharedMemoryStatsEntry) == 24, "SharedMemoryStatsEntry layout changed");
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "the seqlock requires a lock-free sequence counter");
+
+/**
+ * Mirrors the values of counters and gauges into a POSIX shared memory region with the layout
+ * above, so that local collectors can read them without making requests to the admin endpoint.
+ */
+class SharedMemoryStats : NonCopyable {
+public:
+  /**
+   * Creates and maps the region, replacing any region left behind under the same name.
+   * @param name the name of the shared memory object, as passed to shm_open(3).
+   * @param max_stats the number of stats the region is sized for.
+   * @throw EnvoyException if the region cannot be created.
+   */
+  SharedMemoryStats(const std::string& name, uint32_t max_stats);
+
+  /**
+   * Unmaps and unlinks the region, so that collectors do not read stale values from it.
+   */
+  ~SharedMemoryStats();
+
+  /**
+   * Rewrites the stats in the region. The names are only rewritten when the set of metrics
+   * differs from the previous update's. Must not be called concurrently with itself.
+   * @param counters the counters to export.
+   * @param gauges the gauges to export.
+   * @param time the time of the update.
+   */
+  void update(const std::vector<Stats::CounterSharedPtr>& counters,
+              const std::vector<Stats::GaugeSharedPtr>& gauges, SystemTime time);
+
+  /**
+   * @return const SharedMemoryStatsHeader& the header of the region.
+   */
+  const SharedMemoryStatsHeader& header() const { return *header_; }
+
+private:
+  SharedMemoryStatsEntry* entries() const;
+  char* names() const;
+  bool sameMetrics(const std::vector<Stats::CounterSharedPtr>& counters,
+                   const std::vector<Stats::GaugeSharedPtr>& gauges) const;
+  void writeNames();
+
+  const std::string name_;
+  size_t region_size_;
+  SharedMemoryStatsHeader* header_;
+
+  // The metrics exported by the previous update. Holding references keeps their addresses from
+  // being reused by other metrics, so an unchanged set of metrics is detected by comparing
+  // pointers.
+  std::vector<Stats::CounterSharedPtr> counters_;
+  std::vector<Stats::GaugeSharedPtr> gauges_;
+};
+
+} // namespace Server
+} // namespace Envoy
@@ -157,6 +157,8 @@ public:
     return reservation;
   }
 
+  void setReadReservationPolicy(Buffer::ReadReservationPolicy*) override {}
+
   Buffer::ReservationSingleSlice reserveSingleSlice(uint64_t length, bool separate_slice) override {
     ASSERT(!separate_slice);
     FUZZ_ASSERT(start_ + size_ + length <= data_.size());
@@ -7,6 +7,7 @@
 
 #include "test/common/buffer/utility.h"
 #include "test/mocks/api/mocks.h"
+#include "test/mocks/buffer/mocks.h"
 #include "test/test_common/logging.h"
 #include "test/test_common/threadsafe_singleton_injector.h"
 #include "test/test_common/utility.h"
@@ -17,6 +18,7 @@
 
 using testing::_;
 using testing::Return;
+using testing::StrictMock;
 
 namespace Envoy {
 namespace Buffer {
@@ -938,7 +940,7 @@ TEST_F(OwnedImplTest, ReserveSingleOverCommit) {
       "length <= slice_.len_. Details: commit() length must be <= size of the Reservation");
 }
 
-// Test functionality of the `freelist` (a performance optimization)
+// Test functionality of the thread local slice storage cache (a performance optimization)
 TEST_F(OwnedImplTest, SliceFreeList) {
   Buffer::OwnedImpl b1, b2;
   std::vector<void*> slices;
@@ -962,15 +964,17 @@ TEST_F(OwnedImplTest, SliceFreeList) {
   EXPECT_EQ(0, b1.getRawSlices().size());
   {
     auto r = b2.reserveForRead();
-    // slices()[0] is the partially used slice that is already part of this buffer.
-    EXPECT_EQ(slices[2], r.slices()[1].mem_);
+    // slices()[0] is the partially used slice that is already part of this buffer. The storage of
+    // the slice drained from b1 is reused first.
+    EXPECT_EQ(slices[0], r.slices()[1].mem_);
+    EXPECT_EQ(slices[2], r.slices()[2].mem_);
   }
   {
     auto r = b1.reserveForRead();
-    EXPECT_EQ(slices[2], r.slices()[0].mem_);
+    EXPECT_EQ(slices[0], r.slices()[0].mem_);
   }
   {
-    // This causes an underflow in the `freelist` on creation, and overflows it on deletion.
+    // This takes more storage than is cached on creation, and caches all of it on deletion.
     auto r1 = b1.reserveForRead();
     auto r2 = b2.reserveForRead();
     for (auto& r1_slice : absl::MakeSpan(r1.slices(), r1.numSlices())) {
@@ -984,6 +988,53 @@ TEST_F(OwnedImplTest, SliceFreeList) {
   }
 }
 
+TEST_F(OwnedImplTest, ReadReservationPolicy) {
+  StrictMock<MockReadReservationPolicy> policy;
+
+  {
+    // Reads smaller than a slice only take the pages they need.
+    Buffer::OwnedImpl buffer;
+    buffer.setReadReservationPolicy(&policy);
+    EXPECT_CALL(policy, readReservationLength()).WillOnce(Return(4096));
+    auto reservation = buffer.reserveForRead();
+    EXPECT_EQ(1, reservation.numSlices());
+    EXPECT_EQ(4096, reservation.length());
+    EXPECT_CALL(policy, onReadCommitted(4096, 100));
+    reservation.commit(100);
+    EXPECT_EQ(100, buffer.length());
+  }
+
+  {
+    // Reads larger than the default reservation take large slices, up to the largest reservation.
+    Buffer::OwnedImpl buffer;
+    buffer.setReadReservationPolicy(&policy);
+    EXPECT_CALL(policy, readReservationLength()).WillOnce(Return(UINT64_MAX));
+    auto reservation = buffer.reserveForRead();
+    EXPECT_EQ(Reservation::MAX_SLICES_, reservation.numSlices());
+    EXPECT_EQ(OwnedImpl::large_read_slice_size_, reservation.slices()[0].len_);
+    EXPECT_EQ(OwnedImpl::max_read_reservation_size_, reservation.length());
+    // Reads which return no data are reported too.
+    EXPECT_CALL(policy, onReadCommitted(OwnedImpl::max_read_reservation_size_, 0));
+    reservation.commit(0);
+  }
+
+  {
+    // Other reservations are not reported, and reads use the default length once the policy is
+    // removed.
+    Buffer::OwnedImpl buffer;
+    buffer.setReadReservationPolicy(&policy);
+    auto single_reservation = buffer.reserveSingleSlice(100);
+    single_reservation.commit(100);
+    buffer.drain(100);
+
+    buffer.setReadReservationPolicy(nullptr);
+    auto reservation = buffer.reserveForRead();
+    EXPECT_EQ(Reservation::MAX_SLICES_, reservation.numSlices());
+    EXPECT_EQ(Slice::default_slice_size_, reservation.slices()[0].len_);
+    reservation.commit(1);
+  }
+}
+
 TEST_F(OwnedImplTest, Search) {
   // Populate a buffer with a string split across many small slices, to
   // exercise edge cases in the search implementation.
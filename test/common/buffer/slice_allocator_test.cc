@@ -0,0 +1,162 @@
+#include "common/buffer/slice_allocator.h"
+#include "common/stats/isolated_store_impl.h"
+
+#include "test/test_common/thread_factory_for_test.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Buffer {
+namespace {
+
+class SliceAllocatorTest : public testing::Test {
+protected:
+  SliceAllocatorTest() { releaseCache(); }
+
+  ~SliceAllocatorTest() override {
+    SliceAllocator::clearStats(stats_.get());
+    SliceAllocator::setMaxCachedBytes(SliceAllocator::DefaultMaxCachedBytes);
+    releaseCache();
+  }
+
+  // Empties the cache of the calling thread. Storage larger than MaxCachedSize is never cached, so
+  // allocating it only applies the release.
+  static void releaseCache() {
+    SliceAllocator::releaseFreeMemory();
+    SliceAllocator::allocate(2 * SliceAllocator::MaxCachedSize);
+    ASSERT_EQ(0, SliceAllocator::cachedBytes());
+  }
+
+  void setStats() {
+    stats_ = std::make_unique<SliceAllocatorStats>(SliceAllocatorStats{ALL_SLICE_ALLOCATOR_STATS(
+        POOL_COUNTER_PREFIX(store_, "slice_allocator."),
+        POOL_GAUGE_PREFIX(store_, "slice_allocator."))});
+    SliceAllocator::setStats(stats_.get());
+  }
+
+  Stats::IsolatedStoreImpl store_;
+  SliceAllocatorStatsPtr stats_;
+};
+
+// Freed storage is reused by allocations of the same size only, most recently freed first.
+TEST_F(SliceAllocatorTest, ReuseBySize) {
+  SliceAllocator::StoragePtr a = SliceAllocator::allocate(4096);
+  SliceAllocator::StoragePtr b = SliceAllocator::allocate(4096);
+  SliceAllocator::StoragePtr c = SliceAllocator::allocate(16384);
+  const uint8_t* a_mem = a.get();
+  const uint8_t* b_mem = b.get();
+  const uint8_t* c_mem = c.get();
+
+  SliceAllocator::deallocate(std::move(a), 4096);
+  SliceAllocator::deallocate(std::move(b), 4096);
+  SliceAllocator::deallocate(std::move(c), 16384);
+  EXPECT_EQ(4096 + 4096 + 16384, SliceAllocator::cachedBytes());
+
+  c = SliceAllocator::allocate(16384);
+  b = SliceAllocator::allocate(4096);
+  EXPECT_EQ(c_mem, c.get());
+  EXPECT_EQ(b_mem, b.get());
+  EXPECT_EQ(4096, SliceAllocator::cachedBytes());
+
+  SliceAllocator::StoragePtr d = SliceAllocator::allocate(8192);
+  EXPECT_NE(a_mem, d.get());
+  EXPECT_EQ(4096, SliceAllocator::cachedBytes());
+  EXPECT_EQ(a_mem, SliceAllocator::allocate(4096).get());
+  EXPECT_EQ(0, SliceAllocator::cachedBytes());
+}
+
+// Storage larger than MaxCachedSize is freed immediately.
+TEST_F(SliceAllocatorTest, LargeStorageNotCached) {
+  SliceAllocator::deallocate(SliceAllocator::allocate(SliceAllocator::MaxCachedSize),
+                             SliceAllocator::MaxCachedSize);
+  EXPECT_EQ(SliceAllocator::MaxCachedSize, SliceAllocator::cachedBytes());
+
+  const uint64_t size = SliceAllocator::MaxCachedSize + SliceAllocator::PageSize;
+  SliceAllocator::deallocate(SliceAllocator::allocate(size), size);
+  EXPECT_EQ(SliceAllocator::MaxCachedSize, SliceAllocator::cachedBytes());
+}
+
+TEST_F(SliceAllocatorTest, MaxCachedBytes) {
+  setStats();
+  SliceAllocator::setMaxCachedBytes(8192);
+
+  std::vector<SliceAllocator::StoragePtr> storage;
+  for (uint32_t i = 0; i < 3; i++) {
+    storage.push_back(SliceAllocator::allocate(4096));
+  }
+  EXPECT_EQ(3, store_.counterFromString("slice_allocator.cache_miss").value());
+
+  for (auto& s : storage) {
+    SliceAllocator::deallocate(std::move(s), 4096);
+  }
+  EXPECT_EQ(8192, SliceAllocator::cachedBytes());
+  EXPECT_EQ(8192, store_.gaugeFromString("slice_allocator.cached_bytes",
+                                         Stats::Gauge::ImportMode::NeverImport)
+                      .value());
+  EXPECT_EQ(1, store_.counterFromString("slice_allocator.cache_overflow").value());
+
+  // A cap of zero disables the cache.
+  SliceAllocator::setMaxCachedBytes(0);
+  SliceAllocator::deallocate(SliceAllocator::allocate(4096), 4096);
+  EXPECT_EQ(1, store_.counterFromString("slice_allocator.cache_hit").value());
+  EXPECT_EQ(4096, SliceAllocator::cachedBytes());
+  EXPECT_EQ(2, store_.counterFromString("slice_allocator.cache_overflow").value());
+}
+
+TEST_F(SliceAllocatorTest, ReleaseFreeMemory) {
+  setStats();
+  SliceAllocator::deallocate(SliceAllocator::allocate(4096), 4096);
+  EXPECT_EQ(4096, SliceAllocator::cachedBytes());
+
+  // The cache is released on its next use.
+  SliceAllocator::releaseFreeMemory();
+  EXPECT_EQ(4096, SliceAllocator::cachedBytes());
+  SliceAllocator::StoragePtr storage = SliceAllocator::allocate(4096);
+  EXPECT_EQ(0, SliceAllocator::cachedBytes());
+  EXPECT_EQ(0, store_.gaugeFromString("slice_allocator.cached_bytes",
+                                      Stats::Gauge::ImportMode::NeverImport)
+                   .value());
+  EXPECT_EQ(1, store_.counterFromString("slice_allocator.cache_release").value());
+  EXPECT_EQ(0, store_.counterFromString("slice_allocator.cache_hit").value());
+  EXPECT_EQ(2, store_.counterFromString("slice_allocator.cache_miss").value());
+
+  // Releasing an empty cache is not counted.
+  SliceAllocator::releaseFreeMemory();
+  SliceAllocator::deallocate(std::move(storage), 4096);
+  EXPECT_EQ(4096, SliceAllocator::cachedBytes());
+  EXPECT_EQ(1, store_.counterFromString("slice_allocator.cache_release").value());
+}
+
+TEST_F(SliceAllocatorTest, ClearStats) {
+  setStats();
+  SliceAllocatorStats other_stats{
+      ALL_SLICE_ALLOCATOR_STATS(POOL_COUNTER_PREFIX(store_, "other."),
+                                POOL_GAUGE_PREFIX(store_, "other."))};
+
+  // Stats which are not set are not cleared.
+  SliceAllocator::clearStats(&other_stats);
+  SliceAllocator::deallocate(SliceAllocator::allocate(4096), 4096);
+  EXPECT_EQ(1, store_.counterFromString("slice_allocator.cache_miss").value());
+
+  SliceAllocator::clearStats(stats_.get());
+  SliceAllocator::allocate(4096);
+  EXPECT_EQ(1, store_.counterFromString("slice_allocator.cache_miss").value());
+  EXPECT_EQ(0, store_.counterFromString("other.cache_miss").value());
+}
+
+// Each thread has its own cache.
+TEST_F(SliceAllocatorTest, PerThreadCache) {
+  SliceAllocator::StoragePtr storage = SliceAllocator::allocate(4096);
+  Thread::ThreadPtr thread = Thread::threadFactoryForTest().createThread([&storage]() {
+    // Storage freed on another thread is cached by the freeing thread.
+    SliceAllocator::deallocate(std::move(storage), 4096);
+    EXPECT_EQ(4096, SliceAllocator::cachedBytes());
+  });
+  thread->join();
+
+  EXPECT_EQ(0, SliceAllocator::cachedBytes());
+}
+
+} // namespace
+} // namespace Buffer
+} // namespace Envoy
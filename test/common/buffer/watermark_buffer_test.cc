@@ -6,6 +6,7 @@
 #include "common/network/io_socket_handle_impl.h"
 
 #include "test/common/buffer/utility.h"
+#include "test/mocks/buffer/mocks.h"
 #include "test/test_common/test_runtime.h"
 
 #include "gtest/gtest.h"
@@ -137,6 +138,21 @@ TEST_F(WatermarkBufferTest, Commit) {
   EXPECT_EQ(30, buffer_.length());
 }
 
+// Read reservations sized by a policy are still capped by the space below the high watermark.
+TEST_F(WatermarkBufferTest, ReadReservationPolicy) {
+  testing::NiceMock<MockReadReservationPolicy> policy;
+  buffer_.setReadReservationPolicy(&policy);
+  buffer_.setWatermarks(32 * 1024);
+
+  EXPECT_CALL(policy, readReservationLength())
+      .WillOnce(testing::Return(OwnedImpl::max_read_reservation_size_));
+  auto reservation = buffer_.reserveForRead();
+  EXPECT_EQ(2, reservation.numSlices());
+  EXPECT_EQ(32 * 1024, reservation.length());
+  EXPECT_CALL(policy, onReadCommitted(32 * 1024, 10));
+  reservation.commit(10);
+}
+
 TEST_F(WatermarkBufferTest, Drain) {
   // Draining from above to below the low watermark does nothing if the high
   // watermark never got hit.
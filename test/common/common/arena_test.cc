@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/common/arena.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace {
+
+TEST(ArenaTest, NoBlocksUntilFirstAllocation) {
+  Arena arena;
+  EXPECT_EQ(0, arena.blocks());
+  EXPECT_EQ(0, arena.bytesReserved());
+
+  arena.allocate(1, 1);
+  EXPECT_EQ(1, arena.blocks());
+  EXPECT_EQ(Arena::DefaultInitialBlockSize, arena.bytesReserved());
+}
+
+TEST(ArenaTest, Alignment) {
+  Arena arena;
+  for (size_t alignment = 1; alignment <= alignof(std::max_align_t); alignment *= 2) {
+    arena.allocate(1, 1);
+    void* p = arena.allocate(3, alignment);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(p) % alignment);
+  }
+  EXPECT_EQ(1, arena.blocks());
+}
+
+TEST(ArenaTest, AllocationsDoNotOverlap) {
+  Arena arena(64);
+  std::vector<char*> allocations;
+  for (size_t i = 0; i < 100; ++i) {
+    char* p = static_cast<char*>(arena.allocate(24, 8));
+    std::fill(p, p + 24, static_cast<char>(i));
+    allocations.push_back(p);
+  }
+  for (size_t i = 0; i < allocations.size(); ++i) {
+    for (size_t j = 0; j < 24; ++j) {
+      ASSERT_EQ(static_cast<char>(i), allocations[i][j]);
+    }
+  }
+}
+
+TEST(ArenaTest, BlocksGrow) {
+  Arena arena(64);
+  while (arena.blocks() < 3) {
+    arena.allocate(16, 1);
+  }
+  EXPECT_EQ(64 + 128 + 256, arena.bytesReserved());
+
+  // Block growth is capped.
+  while (arena.bytesReserved() < 4 * Arena::MaxBlockSize) {
+    arena.allocate(16, 1);
+  }
+  const size_t blocks = arena.blocks();
+  const size_t bytes_reserved = arena.bytesReserved();
+  while (arena.blocks() == blocks) {
+    arena.allocate(16, 1);
+  }
+  EXPECT_EQ(bytes_reserved + Arena::MaxBlockSize, arena.bytesReserved());
+}
+
+TEST(ArenaTest, LargeAllocationGetsOwnBlock) {
+  Arena arena(64);
+  char* small = static_cast<char*>(arena.allocate(8, 8));
+  arena.allocate(1000, 8);
+  EXPECT_EQ(2, arena.blocks());
+  EXPECT_EQ(64 + 1000, arena.bytesReserved());
+
+  // The current block is still used for small allocations.
+  char* next = static_cast<char*>(arena.allocate(8, 8));
+  EXPECT_EQ(small + 8, next);
+  EXPECT_EQ(2, arena.blocks());
+}
+
+class Counted {
+public:
+  Counted(int& live) : live_(live) { ++live_; }
+  virtual ~Counted() { --live_; }
+
+private:
+  int& live_;
+};
+
+class DerivedCounted : public Counted {
+public:
+  DerivedCounted(int& live, std::string value) : Counted(live), value_(std::move(value)) {}
+
+  const std::string value_;
+};
+
+TEST(ArenaTest, ArenaPtr) {
+  int live = 0;
+  {
+    Arena arena;
+    ArenaPtr<Counted> in_arena = makeArenaPtr<DerivedCounted>(&arena, live, "in arena");
+    ArenaPtr<Counted> on_heap = makeArenaPtr<DerivedCounted>(nullptr, live, "on heap");
+    EXPECT_EQ(2, live);
+    EXPECT_EQ(1, arena.blocks());
+    EXPECT_EQ("in arena", dynamic_cast<DerivedCounted&>(*in_arena).value_);
+    EXPECT_EQ("on heap", dynamic_cast<DerivedCounted&>(*on_heap).value_);
+
+    in_arena.reset();
+    on_heap.reset();
+    EXPECT_EQ(0, live);
+  }
+  EXPECT_EQ(0, live);
+}
+
+TEST(ArenaTest, Allocator) {
+  Arena arena;
+  std::list<std::string, ArenaAllocator<std::string>> list{ArenaAllocator<std::string>(&arena)};
+  for (int i = 0; i < 10; ++i) {
+    list.emplace_back(std::to_string(i));
+  }
+  list.pop_front();
+  EXPECT_EQ(9, list.size());
+  EXPECT_EQ("1", list.front());
+  EXPECT_EQ(1, arena.blocks());
+
+  std::list<std::string, ArenaAllocator<std::string>> heap_list{
+      ArenaAllocator<std::string>(nullptr)};
+  heap_list.emplace_back("heap");
+  heap_list.pop_back();
+  EXPECT_TRUE(heap_list.empty());
+
+  EXPECT_TRUE(ArenaAllocator<int>(&arena) == ArenaAllocator<std::string>(&arena));
+  EXPECT_TRUE(ArenaAllocator<int>(&arena) != ArenaAllocator<int>(nullptr));
+}
+
+} // namespace
+} // namespace Envoy
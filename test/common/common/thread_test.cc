@@ -167,6 +167,16 @@ TEST_F(ThreadAsyncPtrTest, Null) {
   EXPECT_EQ(3, calls); // allocator was not called this last time.
 }
 
+// Tests that getExisting() never calls an allocator.
+TEST_F(ThreadAsyncPtrTest, GetExisting) {
+  AtomicPtr<std::string, AtomicPtrAllocMode::DeleteOnDestruct> str;
+  EXPECT_EQ(nullptr, str.getExisting());
+  EXPECT_EQ(nullptr, str.getExisting());
+  std::string* allocated = str.get([]() { return new std::string("x"); });
+  EXPECT_EQ(allocated, str.getExisting());
+  EXPECT_EQ("x", *str.getExisting());
+}
+
 // Tests array semantics. Note that AtomicPtr is implemented a 1-element
 // AtomicPtrArray, so there's no need to repeat the complex thread-race test
 // from AtomicPtr.
@@ -0,0 +1,124 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include "envoy/http/filter.h"
+
+#include "common/http/filter_manager.h"
+#include "common/http/header_map_impl.h"
+#include "common/stream_info/filter_state_impl.h"
+
+#include "test/mocks/event/mocks.h"
+#include "test/mocks/http/mocks.h"
+#include "test/mocks/local_reply/mocks.h"
+#include "test/mocks/network/mocks.h"
+#include "test/test_common/test_runtime.h"
+
+#include "benchmark/benchmark.h"
+#include "gmock/gmock.h"
+
+namespace Envoy {
+namespace Http {
+namespace {
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+
+// A filter which passes everything through, or which responds to the request if it is the last
+// filter of the chain.
+class BenchmarkFilter : public StreamFilter {
+public:
+  explicit BenchmarkFilter(bool respond) : respond_(respond) {}
+
+  // StreamFilterBase
+  void onDestroy() override {}
+
+  // StreamDecoderFilter
+  FilterHeadersStatus decodeHeaders(RequestHeaderMap&, bool) override {
+    if (respond_) {
+      decoder_callbacks_->encodeHeaders(
+          createHeaderMap<ResponseHeaderMapImpl>({{Headers::get().Status, "200"}}), true,
+          "benchmark");
+      return FilterHeadersStatus::StopIteration;
+    }
+    return FilterHeadersStatus::Continue;
+  }
+  FilterDataStatus decodeData(Buffer::Instance&, bool) override {
+    return FilterDataStatus::Continue;
+  }
+  FilterTrailersStatus decodeTrailers(RequestTrailerMap&) override {
+    return FilterTrailersStatus::Continue;
+  }
+  void setDecoderFilterCallbacks(StreamDecoderFilterCallbacks& callbacks) override {
+    decoder_callbacks_ = &callbacks;
+  }
+
+  // StreamEncoderFilter
+  FilterHeadersStatus encode100ContinueHeaders(ResponseHeaderMap&) override {
+    return FilterHeadersStatus::Continue;
+  }
+  FilterHeadersStatus encodeHeaders(ResponseHeaderMap&, bool) override {
+    return FilterHeadersStatus::Continue;
+  }
+  FilterDataStatus encodeData(Buffer::Instance&, bool) override {
+    return FilterDataStatus::Continue;
+  }
+  FilterTrailersStatus encodeTrailers(ResponseTrailerMap&) override {
+    return FilterTrailersStatus::Continue;
+  }
+  FilterMetadataStatus encodeMetadata(MetadataMap&) override {
+    return FilterMetadataStatus::Continue;
+  }
+  void setEncoderFilterCallbacks(StreamEncoderFilterCallbacks&) override {}
+
+private:
+  const bool respond_;
+  StreamDecoderFilterCallbacks* decoder_callbacks_{};
+};
+
+// Runs header only requests through a chain of filters, creating and destroying the filter manager
+// of a stream for each request as the connection manager does.
+static void filterChain(benchmark::State& state, bool stream_arena) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.http_stream_arena", stream_arena ? "true" : "false"}});
+
+  const size_t filters = state.range(0);
+  NiceMock<MockFilterManagerCallbacks> filter_manager_callbacks;
+  NiceMock<Event::MockDispatcher> dispatcher;
+  NiceMock<Network::MockConnection> connection;
+  NiceMock<MockFilterChainFactory> filter_factory;
+  NiceMock<LocalReply::MockLocalReply> local_reply;
+  NiceMock<MockTimeSystem> time_source;
+  StreamInfo::FilterStateSharedPtr filter_state =
+      std::make_shared<StreamInfo::FilterStateImpl>(StreamInfo::FilterState::LifeSpan::Connection);
+  TestRequestHeaderMapImpl request_headers{
+      {":authority", "host"}, {":path", "/"}, {":method", "GET"}};
+
+  ON_CALL(filter_manager_callbacks, requestHeaders())
+      .WillByDefault(Return(makeOptRef<RequestHeaderMap>(request_headers)));
+  ON_CALL(filter_factory, createFilterChain(_))
+      .WillByDefault(Invoke([filters](FilterChainFactoryCallbacks& callbacks) {
+        for (size_t i = 0; i < filters; ++i) {
+          callbacks.addStreamFilter(std::make_shared<BenchmarkFilter>(i + 1 == filters));
+        }
+      }));
+
+  for (auto _ : state) {
+    FilterManager filter_manager(filter_manager_callbacks, dispatcher, connection, 0, true, 10000,
+                                 filter_factory, local_reply, Protocol::Http11, time_source,
+                                 filter_state, StreamInfo::FilterState::LifeSpan::Connection);
+    filter_manager.createFilterChain();
+    filter_manager.requestHeadersInitialized();
+    filter_manager.decodeHeaders(request_headers, true);
+    filter_manager.destroyFilters();
+  }
+}
+
+BENCHMARK_CAPTURE(filterChain, Heap, false)->Arg(1)->Arg(5)->Arg(20);
+BENCHMARK_CAPTURE(filterChain, StreamArena, true)->Arg(1)->Arg(5)->Arg(20);
+
+} // namespace
+} // namespace Http
+} // namespace Envoy
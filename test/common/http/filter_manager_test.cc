@@ -15,6 +15,7 @@
 #include "test/mocks/http/mocks.h"
 #include "test/mocks/local_reply/mocks.h"
 #include "test/mocks/network/mocks.h"
+#include "test/test_common/test_runtime.h"
 
 #include "gtest/gtest.h"
 
@@ -549,6 +550,53 @@ TEST_F(FilterManagerTest, MultipleOnLocalReply) {
   filter_manager_->destroyFilters();
 }
 
+
+// Verifies that filters are run and destroyed the same way when the filter wrappers are allocated
+// from the stream arena.
+TEST_F(FilterManagerTest, StreamArena) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.http_stream_arena", "true"}});
+  initialize();
+
+  std::shared_ptr<MockStreamDecoderFilter> decoder_filter(new NiceMock<MockStreamDecoderFilter>());
+  std::shared_ptr<MockStreamEncoderFilter> encoder_filter(new NiceMock<MockStreamEncoderFilter>());
+  std::shared_ptr<MockStreamFilter> stream_filter(new NiceMock<MockStreamFilter>());
+
+  RequestHeaderMapPtr headers{
+      new TestRequestHeaderMapImpl{{":authority", "host"}, {":path", "/"}, {":method", "GET"}}};
+
+  ON_CALL(filter_manager_callbacks_, requestHeaders()).WillByDefault(Return(makeOptRef(*headers)));
+
+  EXPECT_CALL(filter_factory_, createFilterChain(_))
+      .WillRepeatedly(Invoke([&](FilterChainFactoryCallbacks& callbacks) -> void {
+        callbacks.addStreamDecoderFilter(decoder_filter);
+        callbacks.addStreamFilter(stream_filter);
+        callbacks.addStreamEncoderFilter(encoder_filter);
+      }));
+
+  filter_manager_->createFilterChain();
+  filter_manager_->requestHeadersInitialized();
+
+  {
+    InSequence s;
+    EXPECT_CALL(*decoder_filter, decodeHeaders(_, true));
+    EXPECT_CALL(*stream_filter, decodeHeaders(_, true));
+    filter_manager_->decodeHeaders(*headers, true);
+
+    ResponseHeaderMapPtr response_headers{new TestResponseHeaderMapImpl{{":status", "200"}}};
+    EXPECT_CALL(*encoder_filter, encodeHeaders(_, true));
+    EXPECT_CALL(*stream_filter, encodeHeaders(_, true));
+    EXPECT_CALL(filter_manager_callbacks_, encodeHeaders(_, true));
+    decoder_filter->callbacks_->encodeHeaders(std::move(response_headers), true, "details");
+  }
+
+  EXPECT_CALL(*decoder_filter, onDestroy());
+  EXPECT_CALL(*stream_filter, onDestroy());
+  EXPECT_CALL(*encoder_filter, onDestroy());
+  filter_manager_->destroyFilters();
+}
+
 } // namespace
 } // namespace Http
 } // namespace Envoy
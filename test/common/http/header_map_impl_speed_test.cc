@@ -1,6 +1,7 @@
 #include "common/http/header_map_impl.h"
 #include "common/http/headers.h"
 
+#include "absl/strings/str_cat.h"
 #include "benchmark/benchmark.h"
 
 namespace Envoy {
@@ -295,5 +296,91 @@ static void headerMapImplRemovePrefix(benchmark::State& state) {
 }
 BENCHMARK(headerMapImplRemovePrefix)->Arg(0)->Arg(1)->Arg(5)->Arg(10)->Arg(50);
 
+/**
+ * Headers of a request with many custom headers, as sent by API clients and through chains of
+ * proxies, most of which are not O(1) headers.
+ */
+static std::vector<std::pair<std::string, std::string>> largeRequestHeaders(size_t num_custom) {
+  std::vector<std::pair<std::string, std::string>> headers = {
+      {":method", "GET"},
+      {":path", "/api/v1/catalog/items?category=shoes"},
+      {":scheme", "https"},
+      {":authority", "api.example.com"},
+      {"user-agent", "example-client/1.2.3"},
+      {"accept", "application/json"},
+      {"accept-encoding", "gzip, deflate, br"},
+      {"x-forwarded-for", "10.0.0.1, 10.0.0.2"},
+      {"x-request-id", "5b1c7e0e-8d4a-4b8e-9f1a-2c3d4e5f6a7b"},
+  };
+  for (size_t i = 0; i < num_custom; i++) {
+    headers.emplace_back(absl::StrCat("x-custom-header-", i), absl::StrCat("value-", i));
+  }
+  return headers;
+}
+
+/**
+ * Measure the speed of decoding a request with many headers the way the codecs do, by moving
+ * copied keys and values into a new header map, and then destroying the map. The numeric Arg is the
+ * number of custom headers in addition to nine common request headers.
+ */
+static void headerMapImplDecodeLargeRequest(benchmark::State& state) {
+  const auto headers_to_add = largeRequestHeaders(state.range(0));
+  for (auto _ : state) { // NOLINT
+    auto headers = Http::RequestHeaderMapImpl::create();
+    for (const auto& key_value : headers_to_add) {
+      HeaderString key;
+      key.setCopy(key_value.first);
+      HeaderString value;
+      value.setCopy(key_value.second);
+      headers->addViaMove(std::move(key), std::move(value));
+    }
+    benchmark::DoNotOptimize(headers->size());
+  }
+}
+BENCHMARK(headerMapImplDecodeLargeRequest)->Arg(0)->Arg(10)->Arg(30)->Arg(60);
+
+/**
+ * Measure the speed of looking up, rewriting and removing custom headers of a request with many
+ * headers, as header matching in routes and header mutation filters do.
+ */
+static void headerMapImplMutateLargeRequest(benchmark::State& state) {
+  const auto headers_to_add = largeRequestHeaders(state.range(0));
+  auto headers = Http::RequestHeaderMapImpl::create();
+  for (const auto& key_value : headers_to_add) {
+    headers->addCopy(LowerCaseString(key_value.first), key_value.second);
+  }
+  std::vector<LowerCaseString> keys;
+  for (size_t i = 0; i < static_cast<size_t>(state.range(0)); i += 3) {
+    keys.emplace_back(absl::StrCat("x-custom-header-", i));
+  }
+  const LowerCaseString missing("x-missing-header");
+  const LowerCaseString added("x-added-header");
+  size_t found = 0;
+  for (auto _ : state) { // NOLINT
+    for (const auto& key : keys) {
+      found += headers->get(key).size();
+    }
+    found += headers->get(missing).size();
+    headers->setCopy(added, "added");
+    headers->remove(added);
+  }
+  benchmark::DoNotOptimize(found);
+}
+BENCHMARK(headerMapImplMutateLargeRequest)->Arg(10)->Arg(30)->Arg(60);
+
+/** Measure the speed of copying a request with many headers, as done for retries and shadows. */
+static void headerMapImplCopyLargeRequest(benchmark::State& state) {
+  const auto headers_to_add = largeRequestHeaders(state.range(0));
+  auto headers = Http::RequestHeaderMapImpl::create();
+  for (const auto& key_value : headers_to_add) {
+    headers->addCopy(LowerCaseString(key_value.first), key_value.second);
+  }
+  for (auto _ : state) { // NOLINT
+    auto copy = createHeaderMap<RequestHeaderMapImpl>(*headers);
+    benchmark::DoNotOptimize(copy->size());
+  }
+}
+BENCHMARK(headerMapImplCopyLargeRequest)->Arg(10)->Arg(30)->Arg(60);
+
 } // namespace Http
 } // namespace Envoy
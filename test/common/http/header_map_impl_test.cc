@@ -383,7 +383,7 @@ public:
 };
 
 INSTANTIATE_TEST_SUITE_P(HeaderMapThreshold, HeaderMapImplTest,
-                         testing::Values(0, 1, std::numeric_limits<uint32_t>::max()),
+                         testing::Values(0, 1, 3, std::numeric_limits<uint32_t>::max()),
                          HeaderMapImplTest::testParamsToString);
 
 // Make sure that the same header registered twice points to the same location.
@@ -1017,6 +1017,47 @@ TEST_P(HeaderMapImplTest, TestHeaderList) {
   EXPECT_THAT(to_string_views(header_list.values()), ElementsAre("/", "world"));
 }
 
+// Entries keep their address while other headers are added and removed, and their storage is
+// reused once they are removed.
+TEST_P(HeaderMapImplTest, StableEntries) {
+  TestRequestHeaderMapImpl headers;
+  LowerCaseString first("first");
+  headers.addCopy(first, "1");
+  headers.setPath("/");
+  const HeaderEntry* first_entry = headers.get(first)[0];
+  const HeaderEntry* path_entry = headers.Path();
+
+  for (int i = 0; i < 200; i++) {
+    headers.addCopy(LowerCaseString(absl::StrCat("key-", i)), "value");
+  }
+  headers.removePrefix(LowerCaseString("key-1"));
+  headers.setMethod("GET");
+  EXPECT_EQ(first_entry, headers.get(first)[0]);
+  EXPECT_EQ(path_entry, headers.Path());
+  EXPECT_EQ(92, headers.size());
+
+  std::vector<absl::string_view> keys;
+  headers.iterate([&keys](const HeaderEntry& header) -> HeaderMap::Iterate {
+    keys.push_back(header.key().getStringView());
+    return HeaderMap::Iterate::Continue;
+  });
+  EXPECT_EQ(":path", keys[0]);
+  EXPECT_EQ(":method", keys[1]);
+  EXPECT_EQ("first", keys[2]);
+  EXPECT_EQ("key-0", keys[3]);
+  EXPECT_EQ("key-2", keys[4]);
+  EXPECT_EQ("key-99", keys.back());
+
+  headers.remove(first);
+  headers.addCopy(LowerCaseString("second"), "2");
+  EXPECT_EQ(first_entry, headers.get(LowerCaseString("second"))[0]);
+
+  headers.clear();
+  EXPECT_TRUE(headers.empty());
+  headers.addCopy(first, "1");
+  EXPECT_EQ("1", headers.get(first)[0]->value().getStringView());
+}
+
 TEST_P(HeaderMapImplTest, TestAppendHeader) {
   // Test appending to a string with a value.
   {
@@ -0,0 +1,116 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include "common/buffer/buffer_impl.h"
+#include "common/http/http1/codec_impl.h"
+#include "common/stats/isolated_store_impl.h"
+
+#include "test/mocks/http/mocks.h"
+#include "test/mocks/network/mocks.h"
+#include "test/test_common/utility.h"
+
+#include "benchmark/benchmark.h"
+#include "gmock/gmock.h"
+
+namespace Envoy {
+namespace Http {
+namespace Http1 {
+namespace {
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+
+// A request with the headers a browser sends when navigating to a page.
+constexpr absl::string_view BrowserRequest =
+    "GET /catalog/items?category=shoes&sort=price HTTP/1.1\r\n"
+    "Host: www.example.com\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:81.0) Gecko/20100101 Firefox/81.0\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/webp,*/*;q=0.8\r\n"
+    "Accept-Language: en-US,en;q=0.5\r\n"
+    "Accept-Encoding: gzip, deflate, br\r\n"
+    "Referer: https://www.example.com/catalog\r\n"
+    "Cookie: session=6f9a1c2e8b7d4a3f9e0c1b2a3d4e5f60; tracking=opt-out; theme=dark\r\n"
+    "Connection: keep-alive\r\n"
+    "Upgrade-Insecure-Requests: 1\r\n"
+    "Cache-Control: max-age=0\r\n"
+    "\r\n";
+
+// An API request with a body of two chunks.
+constexpr absl::string_view ChunkedRequest =
+    "POST /v1/orders HTTP/1.1\r\n"
+    "Host: api.example.com\r\n"
+    "Content-Type: application/json\r\n"
+    "Transfer-Encoding: chunked\r\n"
+    "\r\n"
+    "1a\r\n"
+    "{\"item\":\"shoes\",\"count\":2,\r\n"
+    "17\r\n"
+    "\"currency\":\"EUR\",\"v\":1}\r\n"
+    "0\r\n"
+    "\r\n";
+
+/**
+ * A server codec which completes each request it decodes with a header only response, so that
+ * requests can be dispatched on the same connection one after another.
+ */
+class ServerCodec {
+public:
+  ServerCodec(Http1Settings::Parser parser) {
+    settings_.parser_ = parser;
+    ON_CALL(connection_, write(_, _)).WillByDefault(Invoke([](Buffer::Instance& data, bool) {
+      data.drain(data.length());
+    }));
+    ON_CALL(callbacks_, newStream(_, _))
+        .WillByDefault(Invoke([this](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+          encoder_ = &encoder;
+          return decoder_;
+        }));
+    codec_ = std::make_unique<ServerConnectionImpl>(
+        connection_, CodecStats::atomicGet(stats_, store_), callbacks_, settings_,
+        Http::DEFAULT_MAX_REQUEST_HEADERS_KB, Http::DEFAULT_MAX_HEADERS_COUNT,
+        envoy::config::core::v3::HttpProtocolOptions::ALLOW);
+  }
+
+  void request(absl::string_view data) {
+    Buffer::OwnedImpl buffer(data);
+    const Status status = codec_->dispatch(buffer);
+    RELEASE_ASSERT(status.ok() && encoder_ != nullptr, "request was not decoded");
+    encoder_->encodeHeaders(response_headers_, true);
+    encoder_ = nullptr;
+  }
+
+private:
+  Stats::IsolatedStoreImpl store_;
+  CodecStats::AtomicPtr stats_;
+  NiceMock<Network::MockConnection> connection_;
+  NiceMock<MockServerConnectionCallbacks> callbacks_;
+  NiceMock<MockRequestDecoder> decoder_;
+  Http1Settings settings_;
+  TestResponseHeaderMapImpl response_headers_{{":status", "200"}, {"content-length", "0"}};
+  ResponseEncoder* encoder_{};
+  std::unique_ptr<ServerConnectionImpl> codec_;
+};
+
+static void serverRequest(benchmark::State& state, Http1Settings::Parser parser,
+                          absl::string_view request) {
+  ServerCodec codec(parser);
+  for (auto _ : state) {
+    codec.request(request);
+  }
+  state.SetBytesProcessed(state.iterations() * request.size());
+}
+
+BENCHMARK_CAPTURE(serverRequest, BrowserHttpParser, Http1Settings::Parser::HttpParser,
+                  BrowserRequest);
+BENCHMARK_CAPTURE(serverRequest, BrowserVectorized, Http1Settings::Parser::Vectorized,
+                  BrowserRequest);
+BENCHMARK_CAPTURE(serverRequest, ChunkedHttpParser, Http1Settings::Parser::HttpParser,
+                  ChunkedRequest);
+BENCHMARK_CAPTURE(serverRequest, ChunkedVectorized, Http1Settings::Parser::Vectorized,
+                  ChunkedRequest);
+
+} // namespace
+} // namespace Http1
+} // namespace Http
+} // namespace Envoy
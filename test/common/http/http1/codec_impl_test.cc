@@ -507,6 +507,55 @@ TEST_F(Http1ServerConnectionImplTest, ChunkedBody) {
   EXPECT_EQ(0U, buffer.length());
 }
 
+TEST_F(Http1ServerConnectionImplTest, ChunkedBodyVectorizedParser) {
+  codec_settings_.parser_ = Http1Settings::Parser::Vectorized;
+  initialize();
+
+  InSequence sequence;
+
+  MockRequestDecoder decoder;
+  EXPECT_CALL(callbacks_, newStream(_, _)).WillOnce(ReturnRef(decoder));
+
+  TestRequestHeaderMapImpl expected_headers{
+      {":path", "/"},
+      {":method", "POST"},
+      {"transfer-encoding", "chunked"},
+      {"folded", "a b"},
+  };
+  EXPECT_CALL(decoder, decodeHeaders_(HeaderMapEqual(&expected_headers), false));
+  Buffer::OwnedImpl expected_data("Hello World");
+  EXPECT_CALL(decoder, decodeData(BufferEqual(&expected_data), false));
+  Buffer::OwnedImpl empty("");
+  EXPECT_CALL(decoder, decodeData(BufferEqual(&empty), true));
+
+  Buffer::OwnedImpl buffer = createBufferWithNByteSlices(
+      "POST / HTTP/1.1\r\ntransfer-encoding: chunked\r\nfolded: a\r\n b \r\n\r\n"
+      "6\r\nHello \r\n"
+      "5\r\nWorld\r\n"
+      "0\r\n\r\n",
+      7);
+  auto status = codec_->dispatch(buffer);
+  EXPECT_TRUE(status.ok());
+  EXPECT_EQ(0U, buffer.length());
+}
+
+// The vectorized parser rejects whitespace in header names, which http-parser accepts.
+TEST_F(Http1ServerConnectionImplTest, HeaderNameWithSpaceVectorizedParser) {
+  codec_settings_.parser_ = Http1Settings::Parser::Vectorized;
+  initialize();
+
+  InSequence sequence;
+
+  MockRequestDecoder decoder;
+  EXPECT_CALL(callbacks_, newStream(_, _)).WillOnce(ReturnRef(decoder));
+
+  Buffer::OwnedImpl buffer("GET / HTTP/1.1\r\nbad name: value\r\n\r\n");
+  EXPECT_CALL(decoder, sendLocalReply(_, _, _, _, _, _));
+  auto status = codec_->dispatch(buffer);
+  EXPECT_TRUE(isCodecProtocolError(status));
+  EXPECT_EQ(status.message(), "http/1.1 protocol error: HPE_INVALID_HEADER_TOKEN");
+}
+
 // Verify dispatch behavior when dispatching an incomplete chunk, and resumption of the parse via a
 // second dispatch.
 TEST_F(Http1ServerConnectionImplTest, ChunkedBodySplitOverTwoDispatches) {
@@ -2411,6 +2460,32 @@ TEST_F(Http1ClientConnectionImplTest, ContinueHeaders) {
   EXPECT_TRUE(status.ok());
 }
 
+TEST_F(Http1ClientConnectionImplTest, ContinueHeadersVectorizedParser) {
+  codec_settings_.parser_ = Http1Settings::Parser::Vectorized;
+  initialize();
+
+  NiceMock<MockResponseDecoder> response_decoder;
+  Http::RequestEncoder& request_encoder = codec_->newStream(response_decoder);
+  TestRequestHeaderMapImpl headers{{":method", "GET"}, {":path", "/"}, {":authority", "host"}};
+  EXPECT_TRUE(request_encoder.encodeHeaders(headers, true).ok());
+
+  EXPECT_CALL(response_decoder, decode100ContinueHeaders_(_));
+  EXPECT_CALL(response_decoder, decodeData(_, _)).Times(0);
+  Buffer::OwnedImpl initial_response("HTTP/1.1 100 Continue\r\n\r\n");
+  auto status = codec_->dispatch(initial_response);
+  EXPECT_TRUE(status.ok());
+
+  TestResponseHeaderMapImpl expected_headers{{":status", "200"}, {"content-length", "5"}};
+  EXPECT_CALL(response_decoder, decodeHeaders_(HeaderMapEqual(&expected_headers), false));
+  Buffer::OwnedImpl expected_data("hello");
+  EXPECT_CALL(response_decoder, decodeData(BufferEqual(&expected_data), false));
+  Buffer::OwnedImpl empty("");
+  EXPECT_CALL(response_decoder, decodeData(BufferEqual(&empty), true));
+  Buffer::OwnedImpl response("HTTP/1.1 200 OK\r\ncontent-length: 5\r\n\r\nhello");
+  status = codec_->dispatch(response);
+  EXPECT_TRUE(status.ok());
+}
+
 // Multiple 100 responses are passed to the response encoder (who is responsible for coalescing).
 TEST_F(Http1ClientConnectionImplTest, MultipleContinueHeaders) {
   initialize();
@@ -0,0 +1,419 @@
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/http/http1/vectorized_parser_impl.h"
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Http {
+namespace Http1 {
+namespace {
+
+using Headers = std::vector<std::pair<std::string, std::string>>;
+
+struct Message {
+  bool operator==(const Message& rhs) const {
+    return url_ == rhs.url_ && headers_ == rhs.headers_ && trailers_ == rhs.trailers_ &&
+           body_ == rhs.body_ && chunk_headers_ == rhs.chunk_headers_ &&
+           headers_complete_ == rhs.headers_complete_ && complete_ == rhs.complete_;
+  }
+
+  std::string url_;
+  Headers headers_;
+  Headers trailers_;
+  std::string body_;
+  std::vector<bool> chunk_headers_;
+  bool headers_complete_{};
+  bool complete_{};
+};
+
+// Records the messages the parser reports. Header fields and values may be reported in pieces, and
+// are joined the way the codec joins them.
+class TestParserCallbacks : public ParserCallbacks {
+public:
+  Status onMessageBegin() override {
+    messages_.emplace_back();
+    in_field_ = false;
+    return okStatus();
+  }
+
+  Status onUrl(const char* data, size_t length) override {
+    messages_.back().url_.append(data, length);
+    return okStatus();
+  }
+
+  Status onHeaderField(const char* data, size_t length) override {
+    Headers& headers = currentHeaders();
+    if (!in_field_) {
+      headers.emplace_back();
+      in_field_ = true;
+    }
+    headers.back().first.append(data, length);
+    return okStatus();
+  }
+
+  Status onHeaderValue(const char* data, size_t length) override {
+    in_field_ = false;
+    currentHeaders().back().second.append(data, length);
+    if (absl::string_view(data, length).find('!') != absl::string_view::npos) {
+      return codecProtocolError("invalid value");
+    }
+    return okStatus();
+  }
+
+  StatusOr<ParserStatus> onHeadersComplete() override {
+    messages_.back().headers_complete_ = true;
+    in_field_ = false;
+    if (pause_on_headers_complete_) {
+      return parser_->pause();
+    }
+    return headers_complete_status_;
+  }
+
+  void bufferBody(const char* data, size_t length) override {
+    messages_.back().body_.append(data, length);
+  }
+
+  StatusOr<ParserStatus> onMessageComplete() override {
+    messages_.back().complete_ = true;
+    if (pause_on_message_complete_) {
+      return parser_->pause();
+    }
+    return ParserStatus::Success;
+  }
+
+  void onChunkHeader(bool is_final) override {
+    messages_.back().chunk_headers_.push_back(is_final);
+  }
+
+  int setAndCheckCallbackStatus(Status&& status) override {
+    return parser_->statusToInt(status.ok() ? ParserStatus::Success : ParserStatus::Error);
+  }
+
+  int setAndCheckCallbackStatusOr(StatusOr<ParserStatus>&& statusor) override {
+    return parser_->statusToInt(statusor.ok() ? statusor.value() : ParserStatus::Error);
+  }
+
+  Parser* parser_{};
+  std::vector<Message> messages_;
+  ParserStatus headers_complete_status_{ParserStatus::Success};
+  bool pause_on_headers_complete_{};
+  bool pause_on_message_complete_{true};
+
+private:
+  Headers& currentHeaders() {
+    Message& message = messages_.back();
+    return message.headers_complete_ ? message.trailers_ : message.headers_;
+  }
+
+  bool in_field_{};
+};
+
+class VectorizedParserImplTest : public testing::Test {
+protected:
+  void initialize(MessageType type) {
+    callbacks_.messages_.clear();
+    parser_ = std::make_unique<VectorizedParserImpl>(type, &callbacks_);
+    callbacks_.parser_ = parser_.get();
+  }
+
+  // Parses data in pieces of at most max_fragment bytes, resuming the parser whenever it pauses,
+  // like the codec does. Returns the name of the error, or HPE_OK if all data was parsed.
+  absl::string_view parse(absl::string_view data,
+                          size_t max_fragment = std::numeric_limits<size_t>::max()) {
+    while (!data.empty()) {
+      const absl::string_view fragment = data.substr(0, max_fragment);
+      parser_->resume();
+      const Parser::RcVal result = parser_->execute(fragment.data(), fragment.size());
+      if (parser_->getStatus() == ParserStatus::Error) {
+        return parser_->errnoName(result.rc);
+      }
+      data.remove_prefix(result.nread);
+    }
+    return parser_->errnoName(parser_->statusToInt(ParserStatus::Success));
+  }
+
+  absl::string_view parseEof() {
+    parser_->resume();
+    const int rc = parser_->execute(nullptr, 0).rc;
+    return parser_->errnoName(parser_->getStatus() == ParserStatus::Error
+                                  ? rc
+                                  : parser_->statusToInt(ParserStatus::Success));
+  }
+
+  // Checks that parsing data in pieces of any size reports the same messages as parsing it at
+  // once.
+  void expectSameFragmented(MessageType type, absl::string_view data) {
+    initialize(type);
+    EXPECT_EQ("HPE_OK", parse(data));
+    const std::vector<Message> expected = callbacks_.messages_;
+    for (size_t max_fragment = 1; max_fragment < data.size(); max_fragment++) {
+      initialize(type);
+      EXPECT_EQ("HPE_OK", parse(data, max_fragment));
+      EXPECT_TRUE(expected == callbacks_.messages_) << "fragments of " << max_fragment;
+    }
+  }
+
+  TestParserCallbacks callbacks_;
+  std::unique_ptr<VectorizedParserImpl> parser_;
+};
+
+TEST_F(VectorizedParserImplTest, Request) {
+  initialize(MessageType::Request);
+  EXPECT_EQ("HPE_OK", parse("GET /path?query HTTP/1.1\r\nHost: example.com\r\n"
+                            "Accept:  */* \r\nEmpty:\r\n\r\n"));
+  ASSERT_EQ(1, callbacks_.messages_.size());
+  const Message& message = callbacks_.messages_[0];
+  EXPECT_EQ("/path?query", message.url_);
+  EXPECT_EQ((Headers{{"Host", "example.com"}, {"Accept", "*/* "}, {"Empty", ""}}),
+            message.headers_);
+  EXPECT_TRUE(message.complete_);
+  EXPECT_EQ("GET", parser_->methodName());
+  EXPECT_EQ(1, parser_->httpMajor());
+  EXPECT_EQ(1, parser_->httpMinor());
+  EXPECT_FALSE(parser_->contentLength().has_value());
+  EXPECT_FALSE(parser_->isChunked());
+  EXPECT_EQ(0, parser_->hasTransferEncoding());
+}
+
+// The parser pauses after each message, and continues with the next when resumed.
+TEST_F(VectorizedParserImplTest, Pipelined) {
+  initialize(MessageType::Request);
+  const std::string request = "POST / HTTP/1.1\r\ncontent-length: 5\r\n\r\nhello";
+  const std::string data = absl::StrCat(request, "\r\n", request);
+  const Parser::RcVal result = parser_->execute(data.data(), data.size());
+  EXPECT_EQ(request.size(), result.nread);
+  EXPECT_EQ(ParserStatus::Paused, parser_->getStatus());
+  EXPECT_EQ(parser_->statusToInt(ParserStatus::Paused), result.rc);
+  EXPECT_EQ(5, parser_->contentLength().value());
+
+  EXPECT_EQ("HPE_OK", parse(absl::string_view(data).substr(request.size())));
+  ASSERT_EQ(2, callbacks_.messages_.size());
+  EXPECT_TRUE(callbacks_.messages_[0] == callbacks_.messages_[1]);
+  EXPECT_EQ("hello", callbacks_.messages_[1].body_);
+}
+
+TEST_F(VectorizedParserImplTest, Fragmented) {
+  expectSameFragmented(MessageType::Request,
+                       "\r\nGET /a/long/enough/path/to/cross/a/vector/boundary HTTP/1.1\r\n"
+                       "Host: host\r\nUser-Agent: a user agent string longer than 32 bytes\r\n"
+                       "Connection: keep-alive\r\n\r\n");
+  expectSameFragmented(MessageType::Request, "PUT / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+                                             "5;ext=1\r\nhello\r\n6\r\n world\r\n0\r\n"
+                                             "Trailer: value\r\n\r\n");
+  expectSameFragmented(MessageType::Response,
+                       "HTTP/1.1 200 OK\r\nContent-Length: 10\r\n\r\n0123456789");
+}
+
+TEST_F(VectorizedParserImplTest, Chunked) {
+  initialize(MessageType::Request);
+  EXPECT_EQ("HPE_OK", parse("POST / HTTP/1.1\r\nTransfer-Encoding: gzip, Chunked\r\n\r\n"
+                            "A\r\n0123456789\r\n1 ; ext\r\n!\r\n0\r\nx-trailer: foo\r\n\r\n"));
+  ASSERT_EQ(1, callbacks_.messages_.size());
+  const Message& message = callbacks_.messages_[0];
+  EXPECT_EQ("0123456789!", message.body_);
+  EXPECT_EQ((std::vector<bool>{false, false, true}), message.chunk_headers_);
+  EXPECT_EQ((Headers{{"x-trailer", "foo"}}), message.trailers_);
+  EXPECT_TRUE(message.complete_);
+  EXPECT_TRUE(parser_->isChunked());
+  EXPECT_EQ(1, parser_->hasTransferEncoding());
+}
+
+TEST_F(VectorizedParserImplTest, ResponseBodyUntilEof) {
+  initialize(MessageType::Response);
+  EXPECT_EQ("HPE_OK", parse("HTTP/1.0 200 OK\r\n\r\nbody"));
+  EXPECT_EQ(200, parser_->statusCode());
+  EXPECT_EQ(0, parser_->httpMinor());
+  ASSERT_EQ(1, callbacks_.messages_.size());
+  EXPECT_FALSE(callbacks_.messages_[0].complete_);
+
+  EXPECT_EQ("HPE_OK", parse(" more"));
+  EXPECT_EQ("HPE_OK", parseEof());
+  EXPECT_EQ("body more", callbacks_.messages_[0].body_);
+  EXPECT_TRUE(callbacks_.messages_[0].complete_);
+}
+
+// 1xx, 204 and 304 responses have no body, as have responses the codec says have none.
+TEST_F(VectorizedParserImplTest, ResponsesWithoutBody) {
+  initialize(MessageType::Response);
+  EXPECT_EQ("HPE_OK", parse("HTTP/1.1 100 Continue\r\n\r\nHTTP/1.1 204\r\n\r\n"
+                            "HTTP/1.1 304 Not Modified\r\n\r\n"));
+  ASSERT_EQ(3, callbacks_.messages_.size());
+  for (const Message& message : callbacks_.messages_) {
+    EXPECT_TRUE(message.complete_);
+  }
+
+  initialize(MessageType::Response);
+  callbacks_.headers_complete_status_ = ParserStatus::NoBody;
+  EXPECT_EQ("HPE_OK", parse("HTTP/1.1 200 OK\r\ncontent-length: 10\r\n\r\n"));
+  ASSERT_EQ(1, callbacks_.messages_.size());
+  EXPECT_TRUE(callbacks_.messages_[0].complete_);
+}
+
+// A pause in onHeadersComplete() leaves the final LF unparsed, like http-parser.
+TEST_F(VectorizedParserImplTest, PauseOnHeadersComplete) {
+  initialize(MessageType::Request);
+  callbacks_.pause_on_headers_complete_ = true;
+  const absl::string_view data = "GET / HTTP/1.1\r\nHost: host\r\n\r\n";
+  Parser::RcVal result = parser_->execute(data.data(), data.size());
+  EXPECT_EQ(data.size() - 1, result.nread);
+  EXPECT_EQ(ParserStatus::Paused, parser_->getStatus());
+  ASSERT_EQ(1, callbacks_.messages_.size());
+  EXPECT_FALSE(callbacks_.messages_[0].complete_);
+
+  // The parser does not parse while paused.
+  EXPECT_EQ(0, parser_->execute(data.data() + result.nread, 1).nread);
+
+  parser_->resume();
+  result = parser_->execute(data.data() + result.nread, 1);
+  EXPECT_EQ(1, result.nread);
+  EXPECT_TRUE(callbacks_.messages_[0].complete_);
+}
+
+TEST_F(VectorizedParserImplTest, Upgrade) {
+  initialize(MessageType::Request);
+  callbacks_.pause_on_message_complete_ = false;
+  const absl::string_view headers = "GET / HTTP/1.1\r\nConnection: keep-alive, Upgrade\r\n"
+                                    "Upgrade: websocket\r\n\r\n";
+  const std::string data = absl::StrCat(headers, "\x81\x05hello");
+  const Parser::RcVal result = parser_->execute(data.data(), data.size());
+  EXPECT_EQ(headers.size(), result.nread);
+  EXPECT_EQ(ParserStatus::Success, parser_->getStatus());
+  ASSERT_EQ(1, callbacks_.messages_.size());
+  EXPECT_TRUE(callbacks_.messages_[0].complete_);
+  EXPECT_EQ("", callbacks_.messages_[0].body_);
+
+  // The codec upgrades a request by returning NoBodyData.
+  initialize(MessageType::Request);
+  callbacks_.pause_on_message_complete_ = false;
+  callbacks_.headers_complete_status_ = ParserStatus::NoBodyData;
+  const absl::string_view connect = "CONNECT host:443 HTTP/1.1\r\n\r\n";
+  EXPECT_EQ(connect.size(), parser_->execute(connect.data(), connect.size()).nread);
+  EXPECT_EQ("CONNECT", parser_->methodName());
+  EXPECT_EQ("host:443", callbacks_.messages_[0].url_);
+}
+
+TEST_F(VectorizedParserImplTest, FoldedHeader) {
+  initialize(MessageType::Request);
+  EXPECT_EQ("HPE_OK", parse("GET / HTTP/1.1\r\nx-folded: a\r\n \t b\r\nContent-Length: 1\r\n\t\r\n"
+                            "\r\nz"));
+  ASSERT_EQ(1, callbacks_.messages_.size());
+  EXPECT_EQ((Headers{{"x-folded", "a b"}, {"Content-Length", "1 "}}),
+            callbacks_.messages_[0].headers_);
+  EXPECT_EQ("z", callbacks_.messages_[0].body_);
+}
+
+TEST_F(VectorizedParserImplTest, KeepAlive) {
+  // HTTP/1.1 connections persist unless closed.
+  initialize(MessageType::Request);
+  EXPECT_EQ("HPE_CLOSED_CONNECTION",
+            parse("GET / HTTP/1.1\r\nConnection: close\r\n\r\n\r\nGET / HTTP/1.1\r\n\r\n"));
+
+  // HTTP/1.0 connections close unless kept alive.
+  initialize(MessageType::Request);
+  EXPECT_EQ("HPE_CLOSED_CONNECTION", parse("GET / HTTP/1.0\r\n\r\nGET / HTTP/1.0\r\n\r\n"));
+  initialize(MessageType::Request);
+  EXPECT_EQ("HPE_OK", parse("GET / HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\nGET / HTTP/1.0\r\n\r\n"));
+  EXPECT_EQ(2, callbacks_.messages_.size());
+}
+
+TEST_F(VectorizedParserImplTest, Http09) {
+  initialize(MessageType::Request);
+  EXPECT_EQ("HPE_OK", parse("GET /\r\n\r\n"));
+  EXPECT_EQ(0, parser_->httpMajor());
+  EXPECT_EQ(9, parser_->httpMinor());
+}
+
+TEST_F(VectorizedParserImplTest, Errors) {
+  const std::vector<std::pair<std::string, std::string>> requests = {
+      {"get / HTTP/1.1\r\n\r\n", "HPE_INVALID_METHOD"},
+      {"BREW / HTTP/1.1\r\n\r\n", "HPE_INVALID_METHOD"},
+      {"GET \x01 HTTP/1.1\r\n\r\n", "HPE_INVALID_URL"},
+      {"GET ?query HTTP/1.1\r\n\r\n", "HPE_INVALID_URL"},
+      {"GET / http/1.1\r\n\r\n", "HPE_INVALID_CONSTANT"},
+      {"GET / HTTP/1.x\r\n\r\n", "HPE_INVALID_VERSION"},
+      {"GET / HTTP/1.1 \r\n\r\n", "HPE_INVALID_VERSION"},
+      {"GET / HTTP/1.1\rx\r\n\r\n", "HPE_LF_EXPECTED"},
+      {"GET / HTTP/1.1\r\nbad header: x\r\n\r\n", "HPE_INVALID_HEADER_TOKEN"},
+      {"GET / HTTP/1.1\r\n: x\r\n\r\n", "HPE_INVALID_HEADER_TOKEN"},
+      {"GET / HTTP/1.1\r\nheader: a\x7f\r\n\r\n", "HPE_INVALID_HEADER_TOKEN"},
+      {"GET / HTTP/1.1\r\nheader: a\rb\r\n\r\n", "HPE_LF_EXPECTED"},
+      {"GET / HTTP/1.1\r\nheader: !\r\n\r\n", "HPE_USER"},
+      {"GET / HTTP/1.1\r\ncontent-length: 1 2\r\n\r\n", "HPE_INVALID_CONTENT_LENGTH"},
+      {"GET / HTTP/1.1\r\ncontent-length: -1\r\n\r\n", "HPE_INVALID_CONTENT_LENGTH"},
+      {"GET / HTTP/1.1\r\ncontent-length:\r\n\r\n", "HPE_INVALID_CONTENT_LENGTH"},
+      {"GET / HTTP/1.1\r\ncontent-length: 99999999999999999999\r\n\r\n",
+       "HPE_INVALID_CONTENT_LENGTH"},
+      {"GET / HTTP/1.1\r\ncontent-length: 1\r\ncontent-length: 1\r\n\r\n",
+       "HPE_UNEXPECTED_CONTENT_LENGTH"},
+      {"GET / HTTP/1.1\r\ncontent-length: 1\r\ntransfer-encoding: gzip\r\n\r\n",
+       "HPE_UNEXPECTED_CONTENT_LENGTH"},
+      {"GET / HTTP/1.1\r\ntransfer-encoding: chunked, gzip\r\n\r\n",
+       "HPE_INVALID_TRANSFER_ENCODING"},
+      {"GET / HTTP/1.1\r\ntransfer-encoding: chunked\r\n\r\nx\r\n", "HPE_INVALID_CHUNK_SIZE"},
+      {"GET / HTTP/1.1\r\ntransfer-encoding: chunked\r\n\r\n1\n", "HPE_INVALID_CHUNK_SIZE"},
+      {"GET / HTTP/1.1\r\ntransfer-encoding: chunked\r\n\r\n11111111111111111\r\n",
+       "HPE_INVALID_CHUNK_SIZE"},
+      {"GET / HTTP/1.1\r\ntransfer-encoding: chunked\r\n\r\n1\r\nab\r\n", "HPE_LF_EXPECTED"},
+  };
+  for (const auto& [request, error] : requests) {
+    initialize(MessageType::Request);
+    EXPECT_EQ(error, parse(request)) << request;
+    // Once failed, the parser parses nothing more.
+    EXPECT_EQ(0, parser_->execute(request.data(), request.size()).nread);
+    EXPECT_EQ(ParserStatus::Error, parser_->getStatus());
+  }
+
+  const std::vector<std::pair<std::string, std::string>> responses = {
+      {"HTTP/1.1 2000 OK\r\n\r\n", "HPE_INVALID_STATUS"},
+      {"HTTP/1.1 OK\r\n\r\n", "HPE_INVALID_STATUS"},
+      {"HTTP/1.1\r\n\r\n", "HPE_INVALID_VERSION"},
+      {"ICY 200 OK\r\n\r\n", "HPE_INVALID_CONSTANT"},
+  };
+  for (const auto& [response, error] : responses) {
+    initialize(MessageType::Response);
+    EXPECT_EQ(error, parse(response)) << response;
+  }
+}
+
+TEST_F(VectorizedParserImplTest, Eof) {
+  initialize(MessageType::Request);
+  EXPECT_EQ("HPE_OK", parseEof());
+  EXPECT_EQ("HPE_OK", parse("POST / HTTP/1.1\r\ncontent-length: 5\r\n\r\nabc"));
+  EXPECT_EQ("HPE_INVALID_EOF_STATE", parseEof());
+}
+
+// Disallowed bytes are found at any offset, whether they fall in a vector or the scalar tail.
+TEST_F(VectorizedParserImplTest, DisallowedBytesAtAnyOffset) {
+  for (size_t offset = 0; offset < 100; offset++) {
+    std::string value(100, 'v');
+    initialize(MessageType::Request);
+    EXPECT_EQ("HPE_OK", parse(absl::StrCat("GET /", value, " HTTP/1.1\r\nname", value, ": ", value,
+                                           "\t\r\n\r\n")));
+    ASSERT_EQ(1, callbacks_.messages_.size());
+    EXPECT_EQ(absl::StrCat("/", value), callbacks_.messages_[0].url_);
+    EXPECT_EQ((Headers{{absl::StrCat("name", value), absl::StrCat(value, "\t")}}),
+              callbacks_.messages_[0].headers_);
+
+    value[offset] = '\x1f';
+    initialize(MessageType::Request);
+    EXPECT_EQ("HPE_INVALID_HEADER_TOKEN",
+              parse(absl::StrCat("GET / HTTP/1.1\r\nname: ", value, "\r\n\r\n")));
+    initialize(MessageType::Request);
+    EXPECT_EQ("HPE_INVALID_URL", parse(absl::StrCat("GET /", value, " HTTP/1.1\r\n\r\n")));
+
+    value[offset] = '@';
+    initialize(MessageType::Request);
+    EXPECT_EQ("HPE_INVALID_HEADER_TOKEN",
+              parse(absl::StrCat("GET / HTTP/1.1\r\nname", value, ": value\r\n\r\n")));
+  }
+}
+
+} // namespace
+} // namespace Http1
+} // namespace Http
+} // namespace Envoy
@@ -0,0 +1,160 @@
+#include <poll.h>
+#include <sys/socket.h>
+
+#include "common/io/io_uring_impl.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Io {
+namespace {
+
+class IoUringImplTest : public testing::Test {
+protected:
+  void SetUp() override {
+    if (!isIoUringSupported()) {
+      GTEST_SKIP() << "io_uring is not supported by the kernel";
+    }
+    io_uring_ = std::make_unique<IoUringImpl>(2, false);
+    event_fd_ = io_uring_->registerEventfd();
+    ASSERT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds_));
+  }
+
+  void TearDown() override {
+    for (os_fd_t fd : fds_) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+  }
+
+  // Waits until the completion queue signals the eventfd and collects all completions.
+  std::vector<std::pair<void*, int32_t>> waitForCompletions() {
+    struct pollfd pfd {};
+    pfd.fd = event_fd_;
+    pfd.events = POLLIN;
+    EXPECT_EQ(1, ::poll(&pfd, 1, 5000));
+    std::vector<std::pair<void*, int32_t>> completions;
+    io_uring_->forEveryCompletion(
+        [&completions](void* user_data, int32_t res) { completions.emplace_back(user_data, res); });
+    return completions;
+  }
+
+  std::unique_ptr<IoUringImpl> io_uring_;
+  os_fd_t event_fd_{-1};
+  os_fd_t fds_[2]{-1, -1};
+};
+
+TEST_F(IoUringImplTest, RegisterEventfd) {
+  EXPECT_TRUE(io_uring_->isEventfdRegistered());
+  io_uring_->unregisterEventfd();
+  EXPECT_FALSE(io_uring_->isEventfdRegistered());
+  event_fd_ = io_uring_->registerEventfd();
+  EXPECT_TRUE(io_uring_->isEventfdRegistered());
+}
+
+TEST_F(IoUringImplTest, ReadvWaitsForData) {
+  char buf[16];
+  struct iovec iov {
+    buf, sizeof(buf)
+  };
+  int user_data = 0;
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->prepareReadv(fds_[0], &iov, 1, 0, &user_data));
+  EXPECT_EQ(1, io_uring_->pendingSubmissions());
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->submit());
+  EXPECT_EQ(0, io_uring_->pendingSubmissions());
+
+  // Nothing has been posted yet as the socket has no data.
+  struct pollfd pfd {};
+  pfd.fd = event_fd_;
+  pfd.events = POLLIN;
+  EXPECT_EQ(0, ::poll(&pfd, 1, 10));
+
+  ASSERT_EQ(5, ::write(fds_[1], "hello", 5));
+  const auto completions = waitForCompletions();
+  ASSERT_EQ(1, completions.size());
+  EXPECT_EQ(&user_data, completions[0].first);
+  EXPECT_EQ(5, completions[0].second);
+  EXPECT_EQ("hello", absl::string_view(buf, 5));
+}
+
+TEST_F(IoUringImplTest, WritevAndPoll) {
+  char data[] = "hello";
+  struct iovec iov {
+    data, 5
+  };
+  int write_user_data = 0;
+  int poll_user_data = 0;
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->prepareWritev(fds_[0], &iov, 1, 0, &write_user_data));
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->preparePoll(fds_[1], POLLIN, &poll_user_data));
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->submit());
+
+  std::vector<std::pair<void*, int32_t>> completions;
+  while (completions.size() < 2) {
+    for (const auto& completion : waitForCompletions()) {
+      completions.push_back(completion);
+    }
+  }
+  for (const auto& completion : completions) {
+    if (completion.first == &write_user_data) {
+      EXPECT_EQ(5, completion.second);
+    } else {
+      EXPECT_EQ(&poll_user_data, completion.first);
+      EXPECT_TRUE(completion.second & POLLIN);
+    }
+  }
+}
+
+TEST_F(IoUringImplTest, CancelAndClose) {
+  char buf[16];
+  struct iovec iov {
+    buf, sizeof(buf)
+  };
+  int read_user_data = 0;
+  int cancel_user_data = 0;
+  int close_user_data = 0;
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->prepareReadv(fds_[0], &iov, 1, 0, &read_user_data));
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->submit());
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->prepareCancel(&read_user_data, &cancel_user_data));
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->submit());
+
+  std::vector<std::pair<void*, int32_t>> completions;
+  while (completions.size() < 2) {
+    for (const auto& completion : waitForCompletions()) {
+      completions.push_back(completion);
+    }
+  }
+  for (const auto& completion : completions) {
+    if (completion.first == &read_user_data) {
+      EXPECT_EQ(-ECANCELED, completion.second);
+    } else {
+      EXPECT_EQ(&cancel_user_data, completion.first);
+      EXPECT_EQ(0, completion.second);
+    }
+  }
+
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->prepareClose(fds_[0], &close_user_data));
+  ASSERT_EQ(IoUringResult::Ok, io_uring_->submit());
+  fds_[0] = -1;
+  const auto close_completions = waitForCompletions();
+  ASSERT_EQ(1, close_completions.size());
+  EXPECT_EQ(&close_user_data, close_completions[0].first);
+  EXPECT_EQ(0, close_completions[0].second);
+}
+
+TEST_F(IoUringImplTest, SubmissionQueueFull) {
+  char buf[16];
+  struct iovec iov {
+    buf, sizeof(buf)
+  };
+  // The ring was created with two entries.
+  EXPECT_EQ(IoUringResult::Ok, io_uring_->prepareReadv(fds_[0], &iov, 1, 0, nullptr));
+  EXPECT_EQ(IoUringResult::Ok, io_uring_->preparePoll(fds_[0], POLLIN, nullptr));
+  EXPECT_EQ(IoUringResult::Failed, io_uring_->preparePoll(fds_[0], POLLIN, nullptr));
+  EXPECT_EQ(IoUringResult::Ok, io_uring_->submit());
+  EXPECT_EQ(IoUringResult::Ok, io_uring_->preparePoll(fds_[0], POLLIN, nullptr));
+}
+
+} // namespace
+} // namespace Io
+} // namespace Envoy
@@ -559,7 +559,8 @@ TEST_P(ConnectionImplTest, SocketOptionsFailureTest) {
 struct MockConnectionStats {
   Connection::ConnectionStats toBufferStats() {
     return {rx_total_,   rx_current_,   tx_total_,
-            tx_current_, &bind_errors_, &delayed_close_timeouts_};
+            tx_current_, &bind_errors_, &delayed_close_timeouts_,
+            nullptr};
   }
 
   StrictMock<Stats::MockCounter> rx_total_;
@@ -573,7 +574,8 @@ struct MockConnectionStats {
 struct NiceMockConnectionStats {
   Connection::ConnectionStats toBufferStats() {
     return {rx_total_,   rx_current_,   tx_total_,
-            tx_current_, &bind_errors_, &delayed_close_timeouts_};
+            tx_current_, &bind_errors_, &delayed_close_timeouts_,
+            &read_calls_};
   }
 
   NiceMock<Stats::MockCounter> rx_total_;
@@ -582,6 +584,7 @@ struct NiceMockConnectionStats {
   NiceMock<Stats::MockGauge> tx_current_;
   NiceMock<Stats::MockCounter> bind_errors_;
   NiceMock<Stats::MockCounter> delayed_close_timeouts_;
+  NiceMock<Stats::MockCounter> read_calls_;
 };
 
 TEST_P(ConnectionImplTest, ConnectionHash) {
@@ -663,6 +666,33 @@ TEST_P(ConnectionImplTest, ConnectionStats) {
   dispatcher_->run(Event::Dispatcher::RunType::Block);
 }
 
+// Reads from the socket are counted, including the read which finds it has no more data.
+TEST_P(ConnectionImplTest, ReadCallStats) {
+  setUpBasicConnection();
+  connect();
+
+  NiceMockConnectionStats server_connection_stats;
+  server_connection_->setConnectionStats(server_connection_stats.toBufferStats());
+  uint64_t read_calls = 0;
+  EXPECT_CALL(server_connection_stats.read_calls_, add(_))
+      .WillRepeatedly(Invoke([&](uint64_t amount) { read_calls += amount; }));
+
+  EXPECT_CALL(*read_filter_, onData(_, false))
+      .WillOnce(Invoke([&](Buffer::Instance& data, bool) -> FilterStatus {
+        EXPECT_EQ("1234", data.toString());
+        data.drain(data.length());
+        dispatcher_->exit();
+        return FilterStatus::StopIteration;
+      }));
+
+  Buffer::OwnedImpl data("1234");
+  client_connection_->write(data, false);
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+  EXPECT_EQ(2, read_calls);
+
+  disconnect(true);
+}
+
 // Ensure the new counter logic in ReadDisable avoids tripping asserts in ReadDisable guarding
 // against actual enabling twice in a row.
 TEST_P(ConnectionImplTest, ReadDisable) {
@@ -2950,6 +2980,131 @@ TEST_F(PipeClientConnectionImplTest, SkipSourceAddress) {
   connection->close(ConnectionCloseType::NoFlush);
 }
 
+#if defined(__linux__)
+class ConnectionImplSpliceTest : public testing::Test {
+protected:
+  ConnectionImplSpliceTest()
+      : api_(Api::createApiForTest()), dispatcher_(api_->allocateDispatcher("test_thread")),
+        downstream_stream_info_(dispatcher_->timeSource(), nullptr),
+        upstream_stream_info_(dispatcher_->timeSource(), nullptr) {
+    downstream_ = createConnection(downstream_fds_, downstream_stream_info_);
+    upstream_ = createConnection(upstream_fds_, upstream_stream_info_);
+  }
+
+  ~ConnectionImplSpliceTest() override {
+    downstream_->close(ConnectionCloseType::NoFlush);
+    upstream_->close(ConnectionCloseType::NoFlush);
+    ::close(downstream_fds_[0]);
+    ::close(upstream_fds_[0]);
+  }
+
+  // The connection owns fds[1], the test writes to and reads from fds[0].
+  std::unique_ptr<ConnectionImpl> createConnection(os_fd_t (&fds)[2],
+                                                   StreamInfo::StreamInfo& stream_info) {
+    RELEASE_ASSERT(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) == 0, "");
+    return std::make_unique<ConnectionImpl>(
+        *dispatcher_,
+        std::make_unique<ConnectionSocketImpl>(std::make_unique<IoSocketHandleImpl>(fds[1]),
+                                               nullptr, nullptr),
+        Network::Test::createRawBufferSocket(), stream_info, true);
+  }
+
+  // Runs the event loop until size bytes have been read from fd.
+  std::string readAll(os_fd_t fd, uint64_t size) {
+    std::string data;
+    char buf[16384];
+    while (data.size() < size) {
+      dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+      const ssize_t rc = ::read(fd, buf, sizeof(buf));
+      if (rc > 0) {
+        data.append(buf, rc);
+      }
+    }
+    return data;
+  }
+
+  Api::ApiPtr api_;
+  Event::DispatcherPtr dispatcher_;
+  StreamInfo::StreamInfoImpl downstream_stream_info_;
+  StreamInfo::StreamInfoImpl upstream_stream_info_;
+  os_fd_t downstream_fds_[2];
+  os_fd_t upstream_fds_[2];
+  std::unique_ptr<ConnectionImpl> downstream_;
+  std::unique_ptr<ConnectionImpl> upstream_;
+};
+
+TEST_F(ConnectionImplSpliceTest, MovesDataBothWays) {
+  ASSERT_TRUE(upstream_->startSplice(*downstream_));
+  EXPECT_FALSE(upstream_->startSplice(*downstream_));
+
+  const std::string request(32 * 1024, 'a');
+  ASSERT_EQ(request.size(), ::write(downstream_fds_[0], request.data(), request.size()));
+  EXPECT_EQ(request, readAll(upstream_fds_[0], request.size()));
+  EXPECT_EQ(request.size(), downstream_stream_info_.bytesReceived());
+  EXPECT_EQ(request.size(), upstream_stream_info_.bytesSent());
+
+  ASSERT_EQ(5, ::write(upstream_fds_[0], "hello", 5));
+  EXPECT_EQ("hello", readAll(downstream_fds_[0], 5));
+  EXPECT_EQ(5, upstream_stream_info_.bytesReceived());
+  EXPECT_EQ(5, downstream_stream_info_.bytesSent());
+}
+
+TEST_F(ConnectionImplSpliceTest, WritesAfterSplicedData) {
+  ASSERT_TRUE(upstream_->startSplice(*downstream_));
+  ASSERT_EQ(5, ::write(downstream_fds_[0], "hello", 5));
+  dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  Buffer::OwnedImpl data(" world");
+  upstream_->write(data, false);
+  EXPECT_EQ("hello world", readAll(upstream_fds_[0], 11));
+}
+
+TEST_F(ConnectionImplSpliceTest, RespectsBufferLimit) {
+  upstream_->setBufferLimits(16384);
+  ASSERT_TRUE(upstream_->startSplice(*downstream_));
+
+  // Nothing drains the upstream socket, so the pipe fills up to the buffer limit.
+  std::string request(1024 * 1024, 'a');
+  ssize_t written = 0;
+  ssize_t rc;
+  while ((rc = ::write(downstream_fds_[0], request.data(), request.size())) > 0) {
+    written += rc;
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  }
+  EXPECT_LT(downstream_stream_info_.bytesReceived(), written);
+
+  EXPECT_EQ(std::string(written, 'a'), readAll(upstream_fds_[0], written));
+}
+
+TEST_F(ConnectionImplSpliceTest, RejectedWhenFilterNeedsData) {
+  downstream_->addReadFilter(std::make_shared<NiceMock<MockReadFilter>>());
+  EXPECT_FALSE(upstream_->startSplice(*downstream_));
+  EXPECT_FALSE(downstream_->startSplice(*upstream_));
+}
+
+TEST_F(ConnectionImplSpliceTest, RejectedWithBufferedData) {
+  Buffer::OwnedImpl data("hello");
+  downstream_->write(data, false);
+  EXPECT_FALSE(upstream_->startSplice(*downstream_));
+}
+
+TEST_F(ConnectionImplSpliceTest, CloseUnlinksPeer) {
+  ASSERT_TRUE(upstream_->startSplice(*downstream_));
+  auto read_filter = std::make_shared<NiceMock<MockReadFilter>>();
+  upstream_->addReadFilter(read_filter);
+  downstream_->close(ConnectionCloseType::NoFlush);
+
+  // The data goes through the filter chain of the upstream connection instead.
+  EXPECT_CALL(*read_filter, onData(BufferStringEqual("hello"), false))
+      .WillOnce(Invoke([](Buffer::Instance& data, bool) -> FilterStatus {
+        data.drain(data.length());
+        return FilterStatus::StopIteration;
+      }));
+  ASSERT_EQ(5, ::write(upstream_fds_[0], "hello", 5));
+  dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  EXPECT_EQ(Connection::State::Open, upstream_->state());
+}
+#endif
+
 } // namespace
 } // namespace Network
 } // namespace Envoy
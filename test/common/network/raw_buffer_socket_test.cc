@@ -1,16 +1,238 @@
+#include <fcntl.h>
+
+#include "common/buffer/buffer_impl.h"
+#include "common/network/io_socket_error_impl.h"
+#include "common/network/io_socket_handle_impl.h"
 #include "common/network/raw_buffer_socket.h"
 
+#include "test/common/stats/stat_test_utility.h"
+#include "test/mocks/network/io_handle.h"
+#include "test/mocks/network/mocks.h"
 #include "test/test_common/network_utility.h"
+#include "test/test_common/utility.h"
 
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+using testing::_;
+using testing::ByMove;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+using testing::ReturnRef;
+
 namespace Envoy {
 namespace Network {
+namespace {
 
 TEST(RawBufferSocketFactory, RawBufferSocketFactory) {
   TransportSocketFactoryPtr factory = Envoy::Network::Test::createRawBufferSocketFactory();
   EXPECT_FALSE(factory->usesProxyProtocolOptions());
 }
 
+#ifdef SO_ZEROCOPY
+
+class RawBufferSocketZeroCopyTest : public testing::Test {
+protected:
+  RawBufferSocketZeroCopyTest()
+      : api_(Api::createApiForTest()), dispatcher_(api_->allocateDispatcher("test_thread")) {}
+
+  void SetUp() override {
+    const int listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(listen_fd, 0);
+    // A small receive window keeps data queued on the client socket when the server doesn't read.
+    const int rcvbuf = 65536;
+    ASSERT_EQ(0, ::setsockopt(listen_fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = sizeof(addr);
+    ASSERT_EQ(0, ::bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), addr_len));
+    ASSERT_EQ(0, ::listen(listen_fd, 1));
+    ASSERT_EQ(0, ::getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr), &addr_len));
+
+    const int client_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(client_fd, 0);
+    ASSERT_EQ(0, ::connect(client_fd, reinterpret_cast<sockaddr*>(&addr), addr_len));
+    server_fd_ = ::accept(listen_fd, nullptr, nullptr);
+    ASSERT_GE(server_fd_, 0);
+    ::close(listen_fd);
+    ASSERT_EQ(0, ::fcntl(client_fd, F_SETFL, O_NONBLOCK));
+    ASSERT_EQ(0, ::fcntl(server_fd_, F_SETFL, O_NONBLOCK));
+    client_ = std::make_unique<IoSocketHandleImpl>(client_fd);
+
+    const int enable = 1;
+    if (::setsockopt(client_fd, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) != 0) {
+      GTEST_SKIP() << "SO_ZEROCOPY is not supported by the kernel";
+    }
+    ON_CALL(callbacks_, ioHandle()).WillByDefault(ReturnRef(*client_));
+    ON_CALL(callbacks_.connection_, dispatcher()).WillByDefault(ReturnRef(*dispatcher_));
+  }
+
+  void TearDown() override {
+    if (server_fd_ >= 0) {
+      ::close(server_fd_);
+    }
+  }
+
+  // Builds a buffer of the given length out of separately allocated slices.
+  static std::string makeData(uint64_t length) {
+    std::string data(length, 0);
+    for (uint64_t i = 0; i < length; i++) {
+      data[i] = 'a' + i % 26;
+    }
+    return data;
+  }
+
+  static void addSlices(Buffer::Instance& buffer, absl::string_view data) {
+    constexpr uint64_t SliceSize = 10000;
+    for (uint64_t offset = 0; offset < data.size(); offset += SliceSize) {
+      Buffer::OwnedImpl slice(data.substr(offset, SliceSize));
+      buffer.move(slice);
+    }
+  }
+
+  // Reads whatever the server socket has available.
+  bool readServer(std::string& received) {
+    char buf[65536];
+    const ssize_t rc = ::read(server_fd_, buf, sizeof(buf));
+    if (rc > 0) {
+      received.append(buf, rc);
+    }
+    return rc == 0;
+  }
+
+  Api::ApiPtr api_;
+  Event::DispatcherPtr dispatcher_;
+  Stats::TestUtil::TestStore store_;
+  NiceMock<MockTransportSocketCallbacks> callbacks_;
+  IoHandlePtr client_;
+  int server_fd_{-1};
+};
+
+TEST_F(RawBufferSocketZeroCopyTest, LargeWritesAreSentWithoutCopies) {
+  RawBufferSocket socket(std::make_shared<RawBufferZeroCopyConfig>(4096, store_));
+  socket.setTransportSocketCallbacks(callbacks_);
+
+  const std::string data = makeData(1024 * 1024);
+  Buffer::OwnedImpl buffer;
+  addSlices(buffer, data);
+  std::string received;
+  while (buffer.length() > 0 || received.size() < data.size()) {
+    EXPECT_EQ(PostIoAction::KeepOpen, socket.doWrite(buffer, false).action_);
+    readServer(received);
+  }
+  EXPECT_EQ(data, received);
+
+  // Writing an empty buffer reads the completions.
+  while (socket.zeroCopyBytes() + socket.zeroCopyFallbackBytes() < data.size()) {
+    socket.doWrite(buffer, false);
+  }
+  EXPECT_EQ(data.size(), socket.zeroCopyBytes() + socket.zeroCopyFallbackBytes());
+  // The kernel copies the data for loopback destinations.
+  EXPECT_EQ(data.size(), socket.zeroCopyFallbackBytes());
+  EXPECT_EQ(socket.zeroCopyBytes(), store_.counter("raw_buffer.zero_copy_bytes").value());
+  EXPECT_EQ(socket.zeroCopyFallbackBytes(),
+            store_.counter("raw_buffer.zero_copy_fallback_bytes").value());
+}
+
+TEST_F(RawBufferSocketZeroCopyTest, SmallWritesAreCopied) {
+  RawBufferSocket socket(std::make_shared<RawBufferZeroCopyConfig>(4096, store_));
+  socket.setTransportSocketCallbacks(callbacks_);
+
+  Buffer::OwnedImpl buffer("hello");
+  EXPECT_EQ(5, socket.doWrite(buffer, false).bytes_processed_);
+  std::string received;
+  while (received.size() < 5) {
+    readServer(received);
+  }
+  EXPECT_EQ("hello", received);
+  EXPECT_EQ(0, socket.zeroCopyBytes());
+  EXPECT_EQ(0, socket.zeroCopyFallbackBytes());
+}
+
+TEST_F(RawBufferSocketZeroCopyTest, CloseWithPendingSendsDeliversData) {
+  RawBufferSocket socket(std::make_shared<RawBufferZeroCopyConfig>(4096, store_));
+  socket.setTransportSocketCallbacks(callbacks_);
+
+  const std::string data = makeData(4 * 1024 * 1024);
+  Buffer::OwnedImpl buffer;
+  addSlices(buffer, data);
+  // The server doesn't read, so the socket fills up and the data stays queued.
+  const uint64_t bytes_written = socket.doWrite(buffer, false).bytes_processed_;
+  ASSERT_GT(buffer.length(), 0);
+
+  // The socket is duplicated into the lowest free descriptor.
+  const int drainer_fd = ::dup(server_fd_);
+  ::close(drainer_fd);
+  socket.closeSocket(ConnectionEvent::LocalClose);
+  // Released data must not be read by the kernel anymore.
+  buffer.drain(buffer.length());
+  client_->close();
+
+  std::string received;
+  while (!readServer(received)) {
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  }
+  EXPECT_EQ(data.substr(0, bytes_written), received);
+  while (::fcntl(drainer_fd, F_GETFD) != -1) {
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  }
+}
+
+TEST(RawBufferSocketZeroCopy, FallsBackToCopiesIfNotSupported) {
+  Stats::TestUtil::TestStore store;
+  RawBufferSocket socket(std::make_shared<RawBufferZeroCopyConfig>(4, store));
+  NiceMock<MockTransportSocketCallbacks> callbacks;
+  NiceMock<MockIoHandle> io_handle;
+  ON_CALL(callbacks, ioHandle()).WillByDefault(ReturnRef(io_handle));
+  socket.setTransportSocketCallbacks(callbacks);
+
+  EXPECT_CALL(io_handle, setOption(SOL_SOCKET, SO_ZEROCOPY, _, _))
+      .WillOnce(Return(Api::SysCallIntResult{0, 0}));
+  EXPECT_CALL(io_handle, writevZeroCopy(_, _))
+      .WillOnce(Return(ByMove(
+          Api::IoCallUint64Result(0, Api::IoErrorPtr(new IoSocketError(SOCKET_ERROR_NOT_SUP),
+                                                     IoSocketError::deleteIoError)))));
+  EXPECT_CALL(io_handle, write(_)).WillOnce(Invoke([](Buffer::Instance& buffer) {
+    const uint64_t length = buffer.length();
+    buffer.drain(length);
+    return Api::IoCallUint64Result(length,
+                                   Api::IoErrorPtr(nullptr, IoSocketError::deleteIoError));
+  }));
+  Buffer::OwnedImpl buffer("hello world");
+  EXPECT_EQ(11, socket.doWrite(buffer, false).bytes_processed_);
+  EXPECT_EQ(0, socket.zeroCopyBytes());
+  EXPECT_EQ(11, socket.zeroCopyFallbackBytes());
+  EXPECT_EQ(11, store.counter("raw_buffer.zero_copy_fallback_bytes").value());
+}
+
+TEST(RawBufferSocketZeroCopy, DisabledIfSocketOptionFails) {
+  Stats::TestUtil::TestStore store;
+  RawBufferSocket socket(std::make_shared<RawBufferZeroCopyConfig>(4, store));
+  NiceMock<MockTransportSocketCallbacks> callbacks;
+  NiceMock<MockIoHandle> io_handle;
+  ON_CALL(callbacks, ioHandle()).WillByDefault(ReturnRef(io_handle));
+  socket.setTransportSocketCallbacks(callbacks);
+
+  EXPECT_CALL(io_handle, setOption(SOL_SOCKET, SO_ZEROCOPY, _, _))
+      .WillOnce(Return(Api::SysCallIntResult{-1, SOCKET_ERROR_NOT_SUP}));
+  EXPECT_CALL(io_handle, writevZeroCopy(_, _)).Times(0);
+  EXPECT_CALL(io_handle, write(_)).Times(2).WillRepeatedly(Invoke([](Buffer::Instance& buffer) {
+    const uint64_t length = buffer.length();
+    buffer.drain(length);
+    return Api::IoCallUint64Result(length,
+                                   Api::IoErrorPtr(nullptr, IoSocketError::deleteIoError));
+  }));
+  Buffer::OwnedImpl buffer("hello world");
+  socket.doWrite(buffer, false);
+  buffer.add("hello again");
+  socket.doWrite(buffer, false);
+  EXPECT_EQ(0, socket.zeroCopyFallbackBytes());
+}
+
+#endif
+
+} // namespace
 } // namespace Network
 } // namespace Envoy
@@ -0,0 +1,91 @@
+#include "common/network/read_size_controller.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Network {
+namespace {
+
+constexpr uint64_t DefaultReadSize = Buffer::OwnedImpl::default_read_reservation_size_;
+constexpr uint64_t MaxReadSize = Buffer::OwnedImpl::max_read_reservation_size_;
+
+TEST(ReadSizeControllerTest, NotAdaptive) {
+  ReadSizeController controller(false);
+  EXPECT_EQ(DefaultReadSize, controller.readReservationLength());
+
+  controller.onReadCommitted(DefaultReadSize, DefaultReadSize);
+  controller.onReadCommitted(DefaultReadSize, 1);
+  controller.onReadCommitted(DefaultReadSize, 0);
+  EXPECT_EQ(DefaultReadSize, controller.readReservationLength());
+  EXPECT_EQ(3, controller.takeReads());
+  EXPECT_EQ(0, controller.takeReads());
+}
+
+// Reads which fill their reservation double the read size, up to the largest read reservation.
+TEST(ReadSizeControllerTest, GrowsOnFullReads) {
+  ReadSizeController controller(true);
+  EXPECT_EQ(ReadSizeController::InitialReadSize, controller.readReservationLength());
+
+  uint64_t expected = ReadSizeController::InitialReadSize;
+  while (expected < MaxReadSize) {
+    controller.onReadCommitted(expected, expected);
+    expected *= 2;
+    EXPECT_EQ(expected, controller.readReservationLength());
+  }
+  controller.onReadCommitted(MaxReadSize, MaxReadSize);
+  EXPECT_EQ(MaxReadSize, controller.readReservationLength());
+}
+
+// Reads which use at most a quarter of the read size halve it, down to a page.
+TEST(ReadSizeControllerTest, ShrinksOnSmallReads) {
+  ReadSizeController controller(true);
+  controller.onReadCommitted(16384, 4096);
+  EXPECT_EQ(8192, controller.readReservationLength());
+  controller.onReadCommitted(8192, 100);
+  EXPECT_EQ(ReadSizeController::MinReadSize, controller.readReservationLength());
+  controller.onReadCommitted(4096, 100);
+  EXPECT_EQ(ReadSizeController::MinReadSize, controller.readReservationLength());
+
+  // Reads in between keep the read size.
+  controller.onReadCommitted(4096, 2048);
+  EXPECT_EQ(ReadSizeController::MinReadSize, controller.readReservationLength());
+  controller.onReadCommitted(4096, 4096);
+  EXPECT_EQ(8192, controller.readReservationLength());
+  controller.onReadCommitted(8192, 4096);
+  EXPECT_EQ(8192, controller.readReservationLength());
+}
+
+// Reads which return no data do not change the read size, but are counted.
+TEST(ReadSizeControllerTest, EmptyReads) {
+  ReadSizeController controller(true);
+  controller.onReadCommitted(16384, 0);
+  controller.onReadCommitted(16384, 0);
+  EXPECT_EQ(ReadSizeController::InitialReadSize, controller.readReservationLength());
+  EXPECT_EQ(2, controller.takeReads());
+}
+
+// The buffer limit of the connection caps the read size, but never below the default read
+// reservation.
+TEST(ReadSizeControllerTest, BufferLimit) {
+  ReadSizeController controller(true);
+  for (uint64_t size = ReadSizeController::InitialReadSize; size < MaxReadSize; size *= 2) {
+    controller.onReadCommitted(size, size);
+  }
+  EXPECT_EQ(MaxReadSize, controller.readReservationLength());
+
+  controller.setBufferLimit(200 * 1024);
+  EXPECT_EQ(208 * 1024, controller.readReservationLength());
+  controller.onReadCommitted(208 * 1024, 208 * 1024);
+  EXPECT_EQ(208 * 1024, controller.readReservationLength());
+
+  controller.setBufferLimit(16 * 1024);
+  EXPECT_EQ(DefaultReadSize, controller.readReservationLength());
+
+  controller.setBufferLimit(0);
+  controller.onReadCommitted(DefaultReadSize, DefaultReadSize);
+  EXPECT_EQ(2 * DefaultReadSize, controller.readReservationLength());
+}
+
+} // namespace
+} // namespace Network
+} // namespace Envoy
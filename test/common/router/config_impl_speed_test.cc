@@ -6,6 +6,7 @@
 
 #include "test/mocks/server/instance.h"
 #include "test/mocks/stream_info/mocks.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
 #include "benchmark/benchmark.h"
@@ -59,7 +60,7 @@ static RouteConfiguration genRouteConfig(benchmark::State& state,
       break;
     }
     case RouteMatch::PathSpecifierCase::kPath: {
-      match->set_prefix(absl::StrCat("/shelves/shelf_", i, "/route_", i));
+      match->set_path(absl::StrCat("/shelves/shelf_", i, "/route_", i));
       break;
     }
     case RouteMatch::PathSpecifierCase::kSafeRegex: {
@@ -78,14 +79,19 @@ static RouteConfiguration genRouteConfig(benchmark::State& state,
 
 /**
  * Measure the speed of doing a route match against a route table of varying sizes.
- * Why? Currently, route matching is linear in first-to-win ordering.
+ * Why? Without the path index, route matching is linear in first-to-win ordering.
  *
  * We construct the first `n - 1` items in the route table so they are not
  * matched by the incoming request. Only the last route will be matched.
  * We then time how long it takes for the request to be matched against the
  * last route.
  */
-static void bmRouteTableSize(benchmark::State& state, RouteMatch::PathSpecifierCase match_type) {
+static void bmRouteTableSize(benchmark::State& state, RouteMatch::PathSpecifierCase match_type,
+                             bool path_index = true) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.route_path_index", path_index ? "true" : "false"}});
+
   // Setup router for benchmarking.
   Api::ApiPtr api = Api::createApiForTest();
   NiceMock<Server::Configuration::MockServerFactoryContext> factory_context;
@@ -114,6 +120,13 @@ static void bmRouteTableSizeWithPathPrefixMatch(benchmark::State& state) {
   bmRouteTableSize(state, RouteMatch::PathSpecifierCase::kPrefix);
 }
 
+/**
+ * Same as bmRouteTableSizeWithPathPrefixMatch, with routes matched by scanning the route table.
+ */
+static void bmRouteTableSizeWithPathPrefixMatchNoIndex(benchmark::State& state) {
+  bmRouteTableSize(state, RouteMatch::PathSpecifierCase::kPrefix, false);
+}
+
 /**
  * Benchmark a route table with exact path matchers in the form of:
  * - /shelves/shelf_1/route_1
@@ -124,6 +137,13 @@ static void bmRouteTableSizeWithExactPathMatch(benchmark::State& state) {
   bmRouteTableSize(state, RouteMatch::PathSpecifierCase::kPath);
 }
 
+/**
+ * Same as bmRouteTableSizeWithExactPathMatch, with routes matched by scanning the route table.
+ */
+static void bmRouteTableSizeWithExactPathMatchNoIndex(benchmark::State& state) {
+  bmRouteTableSize(state, RouteMatch::PathSpecifierCase::kPath, false);
+}
+
 /**
  * Benchmark a route table with regex path matchers in the form of:
  * - /shelves/{shelf_id}/route_1
@@ -136,9 +156,26 @@ static void bmRouteTableSizeWithRegexMatch(benchmark::State& state) {
   bmRouteTableSize(state, RouteMatch::PathSpecifierCase::kSafeRegex);
 }
 
-BENCHMARK(bmRouteTableSizeWithPathPrefixMatch)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
-BENCHMARK(bmRouteTableSizeWithExactPathMatch)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
-BENCHMARK(bmRouteTableSizeWithRegexMatch)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
+BENCHMARK(bmRouteTableSizeWithPathPrefixMatch)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 2 << 13}})
+    ->Arg(10000);
+BENCHMARK(bmRouteTableSizeWithPathPrefixMatchNoIndex)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 2 << 13}})
+    ->Arg(10000);
+BENCHMARK(bmRouteTableSizeWithExactPathMatch)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 2 << 13}})
+    ->Arg(10000);
+BENCHMARK(bmRouteTableSizeWithExactPathMatchNoIndex)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 2 << 13}})
+    ->Arg(10000);
+BENCHMARK(bmRouteTableSizeWithRegexMatch)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 2 << 13}})
+    ->Arg(10000);
 
 } // namespace
 } // namespace Router
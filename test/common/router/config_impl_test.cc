@@ -1880,6 +1880,69 @@ virtual_hosts:
   EXPECT_NO_THROW(TestConfigImpl config(route_config, factory_context_, true));
 }
 
+// Validates that a virtual host with enough routes to be indexed by path matches the same routes,
+// in the same order, as scanning its routes.
+TEST_F(RouteMatcherTest, RoutePathIndex) {
+  envoy::config::route::v3::RouteConfiguration route_config;
+  auto* virtual_host = route_config.add_virtual_hosts();
+  virtual_host->set_name("catalog");
+  virtual_host->add_domains("*");
+  auto add_route = [&](const std::string& cluster) {
+    auto* route = virtual_host->add_routes();
+    route->mutable_route()->set_cluster(cluster);
+    return route->mutable_match();
+  };
+  for (int i = 0; i < 20; i++) {
+    add_route(absl::StrCat("exact_", i))->set_path(absl::StrCat("/items/", i));
+    auto* header_match = add_route(absl::StrCat("header_", i));
+    header_match->set_prefix(absl::StrCat("/items/", i));
+    auto* header = header_match->add_headers();
+    header->set_name("x-version");
+    header->set_exact_match("2");
+    add_route(absl::StrCat("prefix_", i))->set_prefix(absl::StrCat("/items/", i));
+  }
+  auto* regex = add_route("regex")->mutable_safe_regex();
+  regex->mutable_google_re2();
+  regex->set_regex("/items/[0-9]+/reviews");
+  auto* case_insensitive = add_route("case_insensitive");
+  case_insensitive->set_prefix("/Reviews/");
+  case_insensitive->mutable_case_sensitive()->set_value(false);
+  add_route("reviews")->set_prefix("/reviews/");
+  add_route("catch_all")->set_prefix("/");
+
+  const std::vector<std::string> paths{
+      "/items/1",   "/items/1?x=1", "/items/10",         "/items/19/reviews", "/items/3/reviews",
+      "/items/",    "/reviews/1",   "/REVIEWS/1",        "/items/100",        "/",
+      "/other#top", "/Items/1",     "/items/2/reviews/x"};
+  auto route_clusters = [&](bool index) {
+    TestScopedRuntime scoped_runtime;
+    Runtime::LoaderSingleton::getExisting()->mergeValues(
+        {{"envoy.reloadable_features.route_path_index", index ? "true" : "false"}});
+    TestConfigImpl config(route_config, factory_context_, false);
+    std::vector<std::string> clusters;
+    for (const std::string& path : paths) {
+      for (const std::string& version : {"1", "2"}) {
+        Http::TestRequestHeaderMapImpl headers = genHeaders("www.example.com", path, "GET");
+        headers.addCopy("x-version", version);
+        RouteConstSharedPtr route = config.route(headers, 0);
+        clusters.push_back(route != nullptr ? route->routeEntry()->clusterName() : "none");
+      }
+    }
+    return clusters;
+  };
+
+  const std::vector<std::string> clusters = route_clusters(true);
+  EXPECT_EQ(route_clusters(false), clusters);
+  EXPECT_EQ("exact_1", clusters[0]);
+  EXPECT_EQ("exact_1", clusters[2]);
+  EXPECT_EQ("prefix_1", clusters[4]);
+  EXPECT_EQ("header_1", clusters[5]);
+  EXPECT_EQ("prefix_1", clusters[6]);
+  EXPECT_EQ("case_insensitive", clusters[14]);
+  EXPECT_EQ("case_insensitive", clusters[12]);
+  EXPECT_EQ("catch_all", clusters[18]);
+}
+
 // Validate that we can't remove :-prefixed request headers.
 TEST_F(RouteMatcherTest, TestRequestHeadersToRemoveNoPseudoHeader) {
   for (const std::string& header :
@@ -0,0 +1,128 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/router/route_path_index.h"
+
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Router {
+namespace {
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+TEST(RoutePathIndexTest, Prefix) {
+  RoutePathIndex index;
+  index.addPrefix("/shelves/", true, 0);
+  index.addPrefix("/shelves/shelf_1", true, 1);
+  index.addPrefix("/shelves/shelf_10/", true, 2);
+  index.addPrefix("/", true, 3);
+  index.addPrefix("/shop", true, 4);
+  EXPECT_EQ(5, index.indexedRoutes());
+
+  EXPECT_THAT(index.match("/shelves/shelf_10/book"), ElementsAre(0, 1, 2, 3));
+  EXPECT_THAT(index.match("/shelves/shelf_1"), ElementsAre(0, 1, 3));
+  EXPECT_THAT(index.match("/shelves/shelf_2"), ElementsAre(0, 3));
+  EXPECT_THAT(index.match("/shelves"), ElementsAre(3));
+  EXPECT_THAT(index.match("/shopping"), ElementsAre(3, 4));
+  EXPECT_THAT(index.match("/"), ElementsAre(3));
+  EXPECT_THAT(index.match("shelves"), IsEmpty());
+  EXPECT_THAT(index.match(""), IsEmpty());
+}
+
+TEST(RoutePathIndexTest, Path) {
+  RoutePathIndex index;
+  index.addPath("/shelves/shelf_1", true, 0);
+  index.addPath("/shelves/shelf_10", true, 1);
+  index.addPath("/shelves", true, 2);
+  index.addPath("/shelves/shelf_1", true, 3);
+
+  EXPECT_THAT(index.match("/shelves/shelf_1"), ElementsAre(0, 3));
+  EXPECT_THAT(index.match("/shelves/shelf_10"), ElementsAre(1));
+  EXPECT_THAT(index.match("/shelves"), ElementsAre(2));
+  EXPECT_THAT(index.match("/shelves/"), IsEmpty());
+  EXPECT_THAT(index.match("/shelves/shelf_100"), IsEmpty());
+  EXPECT_THAT(index.match("/shelves/shelf_"), IsEmpty());
+}
+
+TEST(RoutePathIndexTest, PrefixAndPath) {
+  RoutePathIndex index;
+  index.addPath("/api/v1/books", true, 0);
+  index.addPrefix("/api/v1/books", true, 1);
+  index.addPrefix("/api/", true, 2);
+  index.addPath("/api/v1", true, 3);
+
+  EXPECT_THAT(index.match("/api/v1/books"), ElementsAre(0, 1, 2));
+  EXPECT_THAT(index.match("/api/v1/books/1"), ElementsAre(1, 2));
+  EXPECT_THAT(index.match("/api/v1"), ElementsAre(2, 3));
+  EXPECT_THAT(index.match("/api"), IsEmpty());
+}
+
+TEST(RoutePathIndexTest, QueryAndFragment) {
+  RoutePathIndex index;
+  index.addPath("/books", true, 0);
+  index.addPrefix("/books?", true, 1);
+
+  EXPECT_THAT(index.match("/books?author=me"), ElementsAre(0));
+  EXPECT_THAT(index.match("/books#top"), ElementsAre(0));
+  EXPECT_THAT(index.match("/books/?author=me"), IsEmpty());
+}
+
+TEST(RoutePathIndexTest, CaseInsensitive) {
+  RoutePathIndex index;
+  index.addPrefix("/Books/", false, 0);
+  index.addPrefix("/books/", true, 1);
+  index.addPath("/BOOKS/all", false, 2);
+
+  EXPECT_THAT(index.match("/books/all"), ElementsAre(0, 1, 2));
+  EXPECT_THAT(index.match("/BOOKS/ALL"), ElementsAre(0, 2));
+  EXPECT_THAT(index.match("/bOoks/1"), ElementsAre(0));
+}
+
+TEST(RoutePathIndexTest, Unindexed) {
+  RoutePathIndex index;
+  index.addUnindexed(0);
+  index.addPrefix("/", true, 1);
+  index.addUnindexed(2);
+
+  EXPECT_EQ(1, index.indexedRoutes());
+  EXPECT_THAT(index.unindexedRoutes(), ElementsAre(0, 2));
+  EXPECT_THAT(index.match("/"), ElementsAre(1));
+}
+
+// Builds an index over many routes sharing long prefixes, and checks it against comparing each
+// route with the path.
+TEST(RoutePathIndexTest, ManyRoutes) {
+  RoutePathIndex index;
+  std::vector<std::pair<std::string, bool>> routes;
+  for (int i = 0; i < 200; i++) {
+    const std::string key = absl::StrCat("/catalog/", i % 7, "/items/", i);
+    routes.emplace_back(key, i % 3 != 0);
+    if (routes.back().second) {
+      index.addPrefix(key, true, i);
+    } else {
+      index.addPath(key, true, i);
+    }
+  }
+
+  for (int i = 0; i < 250; i++) {
+    const std::string path = absl::StrCat("/catalog/", i % 7, "/items/", i, i % 2 ? "" : "/x");
+    RoutePathIndex::Routes expected;
+    for (uint32_t route = 0; route < routes.size(); route++) {
+      const auto& [key, prefix] = routes[route];
+      if (prefix ? absl::StartsWith(path, key) : path == key) {
+        expected.push_back(route);
+      }
+    }
+    EXPECT_EQ(expected, index.match(path)) << path;
+  }
+}
+
+} // namespace
+} // namespace Router
+} // namespace Envoy
@@ -1,4 +1,5 @@
 #include <string>
+#include <vector>
 
 #include "common/stats/allocator_impl.h"
 
@@ -72,6 +73,105 @@ TEST_F(AllocatorImplTest, GaugesWithSameName) {
   EXPECT_EQ(0, g2->value());
 }
 
+// Striped counters sum the increments made by all threads, whichever stripes they use.
+TEST_F(AllocatorImplTest, StripedCounters) {
+  alloc_.setStripedCounters({"striped"}, 3);
+  CounterSharedPtr striped = alloc_.makeCounter(makeStat("striped.name"), makeStat("striped"), {});
+  CounterSharedPtr plain = alloc_.makeCounter(makeStat("plain.name"), makeStat("plain"), {});
+  EXPECT_FALSE(striped->used());
+  Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
+
+  const uint32_t num_threads = 6;
+  const uint32_t iters = 1000;
+  std::vector<Thread::ThreadPtr> threads;
+  absl::Notification go;
+  for (uint32_t i = 0; i < num_threads; ++i) {
+    threads.push_back(thread_factory.createThread([&]() {
+      go.WaitForNotification();
+      for (uint32_t i = 0; i < iters; ++i) {
+        striped->inc();
+        plain->inc();
+      }
+    }));
+  }
+  go.Notify();
+  for (uint32_t i = 0; i < num_threads; ++i) {
+    threads[i]->join();
+  }
+  EXPECT_TRUE(striped->used());
+  EXPECT_EQ(num_threads * iters, striped->value());
+  EXPECT_EQ(num_threads * iters, plain->value());
+  EXPECT_EQ(num_threads * iters, striped->latch());
+  EXPECT_EQ(0, striped->latch());
+
+  striped->add(5);
+  EXPECT_EQ(num_threads * iters + 5, striped->value());
+  EXPECT_EQ(5, striped->latch());
+  striped->reset();
+  EXPECT_EQ(0, striped->value());
+
+  // Release the names held by the allocator so that the symbol table is empty on teardown.
+  striped.reset();
+  plain.reset();
+  alloc_.setStripedCounters({}, 0);
+}
+
+std::vector<std::string> names(const std::vector<CounterSharedPtr>& counters) {
+  std::vector<std::string> ret;
+  for (const CounterSharedPtr& counter : counters) {
+    ret.push_back(counter->name());
+  }
+  return ret;
+}
+
+// The index of stat names is built on the first lookup and then follows the stats as they are
+// created and freed.
+TEST_F(AllocatorImplTest, Matching) {
+  CounterSharedPtr a = alloc_.makeCounter(makeStat("cluster.a.rq"), StatName(), {});
+  CounterSharedPtr b = alloc_.makeCounter(makeStat("cluster.b.rq"), StatName(), {});
+  CounterSharedPtr other = alloc_.makeCounter(makeStat("listener.rq"), StatName(), {});
+  GaugeSharedPtr gauge =
+      alloc_.makeGauge(makeStat("cluster.a.cx"), StatName(), {}, Gauge::ImportMode::Accumulate);
+  TextReadoutSharedPtr text_readout =
+      alloc_.makeTextReadout(makeStat("cluster.a.version"), StatName(), {});
+
+  StatNameFilter filter;
+  filter.prefix_ = "cluster.";
+  EXPECT_EQ(std::vector<std::string>({"cluster.a.rq", "cluster.b.rq"}),
+            names(alloc_.countersMatching(filter)));
+  ASSERT_EQ(1, alloc_.gaugesMatching(filter).size());
+  EXPECT_EQ(gauge.get(), alloc_.gaugesMatching(filter)[0].get());
+  ASSERT_EQ(1, alloc_.textReadoutsMatching(filter).size());
+  EXPECT_EQ(text_readout.get(), alloc_.textReadoutsMatching(filter)[0].get());
+
+  filter.prefix_ = "";
+  filter.substring_ = ".rq";
+  EXPECT_EQ(std::vector<std::string>({"cluster.a.rq", "cluster.b.rq", "listener.rq"}),
+            names(alloc_.countersMatching(filter)));
+
+  filter.used_only_ = true;
+  EXPECT_TRUE(alloc_.countersMatching(filter).empty());
+  b->inc();
+  EXPECT_EQ(std::vector<std::string>({"cluster.b.rq"}), names(alloc_.countersMatching(filter)));
+
+  // Stats created and freed after the index was built are added to and removed from it.
+  filter = StatNameFilter();
+  filter.prefix_ = "cluster.";
+  CounterSharedPtr c = alloc_.makeCounter(makeStat("cluster.c.rq"), StatName(), {});
+  a.reset();
+  EXPECT_EQ(std::vector<std::string>({"cluster.b.rq", "cluster.c.rq"}),
+            names(alloc_.countersMatching(filter)));
+
+  // A symbolic and a dynamic stat name may be the same string, and are different stats.
+  StatNameDynamicPool dynamic_pool(symbol_table_);
+  CounterSharedPtr dynamic = alloc_.makeCounter(dynamic_pool.add("cluster.c.rq"), StatName(), {});
+  EXPECT_NE(c.get(), dynamic.get());
+  EXPECT_EQ(3, alloc_.countersMatching(filter).size());
+  dynamic.reset();
+  EXPECT_EQ(std::vector<std::string>({"cluster.b.rq", "cluster.c.rq"}),
+            names(alloc_.countersMatching(filter)));
+}
+
 // Test for a race-condition where we may decrement the ref-count of a stat to
 // zero at the same time as we are allocating another instance of that
 // stat. This test reproduces that race organically by having a 12 threads each
@@ -0,0 +1,121 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+//
+// Compares recording values into, and merging, the circllhist histograms and the dense
+// LogLinearHistograms which ThreadLocalHistogramImpl may use on each worker.
+//
+// NOLINT(namespace-envoy)
+
+#include <cstdint>
+#include <vector>
+
+#include "common/stats/histogram_impl.h"
+
+#include "benchmark/benchmark.h"
+#include "circllhist.h"
+
+namespace {
+
+// Latency-like values spread over 5 decades, so that they fill a few hundred buckets.
+std::vector<uint64_t> makeValues() {
+  std::vector<uint64_t> values;
+  uint64_t seed = 42;
+  for (int i = 0; i < 1000; ++i) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    uint64_t value = 1 + (seed >> 54);
+    for (uint64_t decades = (seed >> 20) % 5; decades > 0; --decades) {
+      value *= 10;
+    }
+    values.push_back(value);
+  }
+  return values;
+}
+
+const std::vector<uint64_t>& values() {
+  static const std::vector<uint64_t>* values = new std::vector<uint64_t>(makeValues());
+  return *values;
+}
+
+} // namespace
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void bmCircllhistRecord(benchmark::State& state) {
+  histogram_t* histogram = hist_alloc();
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    for (uint64_t value : values()) {
+      hist_insert_intscale(histogram, value, 0, 1);
+    }
+  }
+  hist_free(histogram);
+}
+BENCHMARK(bmCircllhistRecord);
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void bmLogLinearRecord(benchmark::State& state) {
+  Envoy::Stats::LogLinearHistogram histogram;
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    for (uint64_t value : values()) {
+      histogram.recordValue(value);
+    }
+  }
+}
+BENCHMARK(bmLogLinearRecord);
+
+// Merges the histograms of state.range(0) workers into an interval histogram, as
+// ParentHistogramImpl::merge() does for each histogram on every stats flush.
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void bmCircllhistMerge(benchmark::State& state) {
+  std::vector<histogram_t*> workers(state.range(0));
+  for (histogram_t*& worker : workers) {
+    worker = hist_alloc();
+  }
+  histogram_t* interval = hist_alloc();
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    state.PauseTiming();
+    for (histogram_t* worker : workers) {
+      for (uint64_t value : values()) {
+        hist_insert_intscale(worker, value, 0, 1);
+      }
+    }
+    state.ResumeTiming();
+    hist_clear(interval);
+    for (histogram_t*& worker : workers) {
+      hist_accumulate(interval, &worker, 1);
+      hist_clear(worker);
+    }
+    benchmark::DoNotOptimize(hist_sample_count(interval));
+  }
+  for (histogram_t* worker : workers) {
+    hist_free(worker);
+  }
+  hist_free(interval);
+}
+BENCHMARK(bmCircllhistMerge)->Arg(1)->Arg(8)->Arg(32);
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void bmLogLinearMerge(benchmark::State& state) {
+  std::vector<Envoy::Stats::LogLinearHistogram> workers(state.range(0));
+  Envoy::Stats::LogLinearHistogram interval_log_linear;
+  histogram_t* interval = hist_alloc();
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    state.PauseTiming();
+    for (Envoy::Stats::LogLinearHistogram& worker : workers) {
+      for (uint64_t value : values()) {
+        worker.recordValue(value);
+      }
+    }
+    state.ResumeTiming();
+    hist_clear(interval);
+    for (Envoy::Stats::LogLinearHistogram& worker : workers) {
+      interval_log_linear.merge(worker);
+    }
+    interval_log_linear.moveTo(interval);
+    benchmark::DoNotOptimize(hist_sample_count(interval));
+  }
+  hist_free(interval);
+}
+BENCHMARK(bmLogLinearMerge)->Arg(1)->Arg(8)->Arg(32);
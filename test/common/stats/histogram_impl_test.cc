@@ -1,3 +1,5 @@
+#include <limits>
+
 #include "envoy/config/metrics/v3/stats.pb.h"
 
 #include "common/stats/histogram_impl.h"
@@ -95,5 +97,82 @@ TEST_F(HistogramSettingsImplTest, Priority) {
   EXPECT_EQ(settings_->buckets("abcd"), ConstSupportedBuckets({1, 2}));
 }
 
+TEST_F(HistogramSettingsImplTest, DenseThreadLocalHistograms) {
+  EXPECT_FALSE(HistogramSettingsImpl().denseThreadLocalHistograms());
+
+  envoy::config::metrics::v3::StatsConfig config;
+  config.set_dense_thread_local_histograms(true);
+  EXPECT_TRUE(HistogramSettingsImpl(config).denseThreadLocalHistograms());
+}
+
+class LogLinearHistogramTest : public testing::Test {
+public:
+  LogLinearHistogramTest() : expected_(hist_alloc()), actual_(hist_alloc()) {}
+  ~LogLinearHistogramTest() override {
+    hist_free(expected_);
+    hist_free(actual_);
+  }
+
+  void recordValue(uint64_t value) {
+    hist_insert_intscale(expected_, value, 0, 1);
+    histogram_.recordValue(value);
+  }
+
+  void expectSameStatistics() {
+    histogram_.moveTo(actual_);
+    EXPECT_EQ(0, histogram_.sampleCount());
+    HistogramStatisticsImpl expected(expected_, HistogramSettingsImpl::defaultBuckets());
+    HistogramStatisticsImpl actual(actual_, HistogramSettingsImpl::defaultBuckets());
+    EXPECT_EQ(expected.sampleCount(), actual.sampleCount());
+    EXPECT_EQ(expected.sampleSum(), actual.sampleSum());
+    EXPECT_EQ(expected.quantileSummary(), actual.quantileSummary());
+    EXPECT_EQ(expected.bucketSummary(), actual.bucketSummary());
+  }
+
+  histogram_t* expected_;
+  histogram_t* actual_;
+  LogLinearHistogram histogram_;
+};
+
+// Values are counted in the buckets circllhist would count them in, including at the boundaries
+// of decades and at the end of the range of values circllhist takes.
+TEST_F(LogLinearHistogramTest, SameBucketsAsCircllhist) {
+  uint64_t power_of_10 = 1;
+  for (int exponent = 0; exponent <= 18; ++exponent) {
+    recordValue(power_of_10 - 1);
+    recordValue(power_of_10);
+    recordValue(power_of_10 + 1);
+    recordValue(power_of_10 / 4 * 5);
+    power_of_10 *= 10;
+  }
+  recordValue(std::numeric_limits<int64_t>::max());
+  for (uint64_t value = 0; value < 1000; value += 7) {
+    recordValue(value);
+  }
+  EXPECT_EQ(220, histogram_.sampleCount());
+  expectSameStatistics();
+}
+
+TEST_F(LogLinearHistogramTest, Merge) {
+  LogLinearHistogram other;
+  for (uint64_t value = 0; value < 100000; value += 13) {
+    hist_insert_intscale(expected_, value, 0, 1);
+    (value % 2 == 0 ? histogram_ : other).recordValue(value);
+  }
+  histogram_.merge(other);
+  EXPECT_EQ(0, other.sampleCount());
+  EXPECT_EQ(hist_sample_count(expected_), histogram_.sampleCount());
+  expectSameStatistics();
+
+  // Merged and moved histograms can be reused.
+  other.recordValue(42);
+  histogram_.merge(other);
+  hist_clear(actual_);
+  histogram_.moveTo(actual_);
+  EXPECT_EQ(1, hist_sample_count(actual_));
+  EXPECT_EQ(1, hist_approx_count_below(actual_, 43));
+  EXPECT_EQ(0, hist_approx_count_below(actual_, 42));
+}
+
 } // namespace Stats
 } // namespace Envoy
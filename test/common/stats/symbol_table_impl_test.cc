@@ -19,7 +19,7 @@ namespace Stats {
 
 class StatNameTest : public testing::Test {
 protected:
-  StatNameTest() : pool_(table_) {}
+  explicit StatNameTest(bool concurrent = false) : table_(concurrent), pool_(table_) {}
   ~StatNameTest() override { clearStorage(); }
 
   void clearStorage() {
@@ -41,10 +41,63 @@ protected:
     return TestUtil::serializeDeserializeNumber(number);
   }
 
+  // Symbols past the first segment of the symbol strings are decoded, and reused once freed.
+  void testManySymbols() {
+    constexpr int num_names = 5000;
+    std::vector<StatName> names;
+    for (int i = 0; i < num_names; ++i) {
+      names.push_back(makeStat(absl::StrCat("name", i)));
+    }
+    EXPECT_EQ(num_names, table_.numSymbols());
+    for (int i = 0; i < num_names; ++i) {
+      EXPECT_EQ(absl::StrCat("name", i), table_.toString(names[i]));
+    }
+    const Symbol monotonic_counter = monotonicCounter();
+    clearStorage();
+
+    for (int i = 0; i < num_names; ++i) {
+      EXPECT_EQ(absl::StrCat("other", i), encodeDecode(absl::StrCat("other", i)));
+    }
+    EXPECT_EQ(monotonic_counter, monotonicCounter());
+  }
+
+  // Threads encode, decode and free names sharing some of their tokens with the names of other
+  // threads, so that symbols are concurrently created, reused and decoded.
+  void testRacingEncodeDecodeFree() {
+    Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
+    constexpr int num_threads = 16;
+    std::vector<Thread::ThreadPtr> threads;
+    threads.reserve(num_threads);
+    ConditionalInitializer start;
+    for (int i = 0; i < num_threads; ++i) {
+      threads.push_back(thread_factory.createThread([this, i, &start]() {
+        StatNameManagedStorage live(absl::StrCat("live.thread", i), table_);
+        start.wait();
+        for (int count = 0; count < 1000; ++count) {
+          const std::string name =
+              absl::StrCat("shared", count % 10, ".thread", i, ".count", count % 50);
+          StatNameManagedStorage storage(name, table_);
+          EXPECT_EQ(name, table_.toString(storage.statName()));
+          EXPECT_EQ(absl::StrCat("live.thread", i), table_.toString(live.statName()));
+        }
+      }));
+    }
+    start.setReady();
+    for (auto& thread : threads) {
+      thread->join();
+    }
+    EXPECT_EQ(0, table_.numSymbols());
+  }
+
   SymbolTableImpl table_;
   StatNamePool pool_;
 };
 
+class ConcurrentStatNameTest : public StatNameTest {
+protected:
+  ConcurrentStatNameTest() : StatNameTest(true) {}
+};
+
 TEST_F(StatNameTest, SerializeBytes) {
   EXPECT_EQ(std::vector<uint8_t>{1}, serializeDeserialize(1));
   EXPECT_EQ(std::vector<uint8_t>{127}, serializeDeserialize(127));
@@ -231,7 +284,6 @@ TEST_F(StatNameTest, TestSuccessfulDecode) {
 class StatNameDeathTest : public StatNameTest {
 public:
   void decodeSymbolVec(const SymbolVec& symbol_vec) {
-    Thread::LockGuard lock(table_.lock_);
     for (Symbol symbol : symbol_vec) {
       table_.fromSymbol(symbol);
     }
@@ -330,6 +382,22 @@ TEST_F(StatNameTest, FreePoolTest) {
   EXPECT_EQ(table_.numSymbols(), 6);
 }
 
+TEST_F(StatNameTest, ManySymbols) { testManySymbols(); }
+
+TEST_F(ConcurrentStatNameTest, ManySymbols) { testManySymbols(); }
+
+TEST_F(ConcurrentStatNameTest, FreePoolTest) {
+  makeStat("1a.2a");
+  makeStat("3a");
+  EXPECT_EQ(monotonicCounter(), 4);
+  clearStorage();
+
+  EXPECT_EQ("1b.2b", encodeDecode("1b.2b"));
+  EXPECT_EQ("3b", encodeDecode("3b"));
+  EXPECT_EQ(monotonicCounter(), 4);
+  EXPECT_EQ(table_.numSymbols(), 3);
+}
+
 TEST_F(StatNameTest, TestShrinkingExpectation) {
   // We expect that as we free stat names, the memory used to store those underlying symbols will
   // be freed.
@@ -552,6 +620,10 @@ TEST_F(StatNameTest, RacingSymbolCreation) {
   }
 }
 
+TEST_F(StatNameTest, RacingEncodeDecodeFree) { testRacingEncodeDecodeFree(); }
+
+TEST_F(ConcurrentStatNameTest, RacingEncodeDecodeFree) { testRacingEncodeDecodeFree(); }
+
 TEST_F(StatNameTest, MutexContentionOnExistingSymbols) {
   Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
   MutexTracerImpl& mutex_tracer = MutexTracerImpl::getOrCreateTracer();
@@ -12,6 +12,7 @@
 #include "test/common/stats/make_elements_helper.h"
 #include "test/test_common/utility.h"
 
+#include "absl/strings/str_cat.h"
 #include "absl/synchronization/blocking_counter.h"
 #include "benchmark/benchmark.h"
 
@@ -94,3 +95,25 @@ static void bmJoinElements(benchmark::State& state) {
   }
 }
 BENCHMARK(bmJoinElements);
+
+// Encodes, decodes and frees stat names from many threads at once, as workers do when creating
+// dynamic stats. The names share most of their tokens, and keep being created and freed, so that
+// both the lookups of existing symbols and the allocation of new ones contend. The argument selects
+// a concurrent symbol table.
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void bmEncodeDecodeConcurrent(benchmark::State& state) {
+  static Envoy::Stats::SymbolTableImpl default_table;
+  static Envoy::Stats::SymbolTableImpl concurrent_table(true);
+  Envoy::Stats::SymbolTableImpl& table = state.range(0) ? concurrent_table : default_table;
+  uint64_t count = 0;
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    const std::string name = absl::StrCat("cluster.service_", count % 100, ".upstream_rq_",
+                                          count % 7 == 0 ? "2xx" : "5xx");
+    Envoy::Stats::StatNameStorage storage(name, table);
+    benchmark::DoNotOptimize(table.toString(storage.statName()));
+    storage.free(table);
+    ++count;
+  }
+}
+BENCHMARK(bmEncodeDecodeConcurrent)->Arg(0)->Arg(1)->ThreadRange(1, 32)->UseRealTime();
@@ -55,5 +55,34 @@ TEST(TagProducerTest, CheckConstructor) {
       "No regex specified for tag specifier and no default regex for name: 'test_extractor'");
 }
 
+// Verifies that memoized extractions, including those re-computed after the memo fills and is
+// cleared, match the extractions done without a memo.
+TEST(TagProducerTest, Memoization) {
+  envoy::config::metrics::v3::StatsConfig stats_config;
+  auto& tag_specifier = *stats_config.mutable_stats_tags()->Add();
+  tag_specifier.set_tag_name("test.x");
+  tag_specifier.set_fixed_value("xxx");
+
+  const TagProducerImpl unmemoized{stats_config, 0};
+  const TagProducerImpl memoized{stats_config, 2};
+  const std::vector<std::string> names = {
+      "cluster.foo.upstream_rq_200",
+      "listener.127.0.0.1_3012.http.http_prefix.downstream_rq_5xx",
+      "cluster.bar.ssl.ciphers.ECDHE-RSA-AES128-GCM-SHA256",
+  };
+  for (uint32_t i = 0; i < 3; ++i) {
+    for (const std::string& name : names) {
+      TagVector expected_tags;
+      const std::string expected_name = unmemoized.produceTags(name, expected_tags);
+      TagVector tags{{"pre.existing", "tag"}};
+      EXPECT_EQ(expected_name, memoized.produceTags(name, tags));
+      ASSERT_EQ(expected_tags.size() + 1, tags.size());
+      EXPECT_EQ((Tag{"pre.existing", "tag"}), tags[0]);
+      EXPECT_EQ(expected_tags, TagVector(tags.begin() + 1, tags.end()));
+      EXPECT_EQ((Tag{"test.x", "xxx"}), tags[1]);
+    }
+  }
+}
+
 } // namespace Stats
 } // namespace Envoy
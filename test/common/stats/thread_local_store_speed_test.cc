@@ -17,6 +17,7 @@
 #include "test/test_common/test_time.h"
 #include "test/test_common/utility.h"
 
+#include "absl/strings/str_cat.h"
 #include "benchmark/benchmark.h"
 
 namespace Envoy {
@@ -75,6 +76,37 @@ private:
   std::vector<std::unique_ptr<Stats::StatNameStorage>> stat_names_;
 };
 
+// Holds a few counters which every thread increments, like the request counters workers increment
+// on every request.
+class HotCounterPerf {
+public:
+  explicit HotCounterPerf(bool striped) : heap_alloc_(symbol_table_), store_(heap_alloc_) {
+    std::vector<std::string> names;
+    for (uint32_t i = 0; i < 4; ++i) {
+      names.push_back(absl::StrCat("http.ingress_", i, ".downstream_rq_total"));
+    }
+    if (striped) {
+      // The store has no tag extractors, so tag extracted names are full names.
+      store_.setStripedCounters(names, 64);
+    }
+    for (const std::string& name : names) {
+      counters_.push_back(&store_.counterFromString(name));
+    }
+  }
+
+  void incCounters() {
+    for (Stats::Counter* counter : counters_) {
+      counter->inc();
+    }
+  }
+
+private:
+  Stats::SymbolTableImpl symbol_table_;
+  Stats::AllocatorImpl heap_alloc_;
+  Stats::ThreadLocalStoreImpl store_;
+  std::vector<Stats::Counter*> counters_;
+};
+
 } // namespace Envoy
 
 // Tests the single-threaded performance of the thread-local-store stats caches
@@ -105,3 +137,20 @@ BENCHMARK(BM_StatsWithTls);
 
 // TODO(jmarantz): add multi-threaded variant of this test, that aggressively
 // looks up stats in multiple threads to try to trigger contention issues.
+
+// Tests incrementing the same counters from several threads, with (range(0) == 1) and without
+// their values being striped across a cache line per thread.
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void BM_HotCounterInc(benchmark::State& state) {
+  static std::unique_ptr<Envoy::HotCounterPerf> context;
+  if (state.thread_index == 0) {
+    context = std::make_unique<Envoy::HotCounterPerf>(state.range(0) == 1);
+  }
+  for (auto _ : state) {
+    context->incCounters();
+  }
+  if (state.thread_index == 0) {
+    context.reset();
+  }
+}
+BENCHMARK(BM_HotCounterInc)->Arg(0)->Arg(1)->ThreadRange(1, 32)->UseRealTime();
@@ -1182,6 +1182,29 @@ TEST_F(StatsThreadLocalStoreTestNoFixture, MemoryWithTlsRealSymbolTable) {
   EXPECT_MEMORY_LE(memory_test.consumedBytes(), 0.9 * million_);
 }
 
+// Counters are striped by their tag extracted name, whatever the values of their tags.
+TEST_F(StatsThreadLocalStoreTestNoFixture, StripedCounters) {
+  store_.setStripedCounters({"http.downstream_rq_total"}, 4);
+  Counter& ingress = store_.counterFromString("http.ingress.downstream_rq_total");
+  TestUtil::MemoryTest memory_test;
+  Counter& egress = store_.counterFromString("http.egress.downstream_rq_total");
+  if (TestUtil::MemoryTest::mode() != TestUtil::MemoryTest::Mode::Disabled) {
+    // Each of the 4 stripes has its own cache line.
+    EXPECT_LE(4 * 64, memory_test.consumedBytes());
+  }
+  Counter& other = store_.counterFromString("http.ingress.downstream_cx_total");
+
+  ingress.inc();
+  ingress.add(2);
+  egress.inc();
+  other.inc();
+  EXPECT_EQ(3, ingress.value());
+  EXPECT_EQ(1, egress.value());
+  EXPECT_EQ(1, other.value());
+  EXPECT_EQ(3, ingress.latch());
+  EXPECT_EQ(0, ingress.latch());
+}
+
 TEST_F(StatsThreadLocalStoreTest, ShuttingDown) {
   InSequence s;
   store_->initializeThreading(main_thread_dispatcher_, tls_);
@@ -1434,6 +1457,35 @@ TEST_F(HistogramTest, ParentHistogramBucketSummary) {
             parent_histogram->bucketSummary());
 }
 
+class DenseHistogramTest : public HistogramTest {
+public:
+  void SetUp() override {
+    HistogramTest::SetUp();
+    envoy::config::metrics::v3::StatsConfig config;
+    config.set_dense_thread_local_histograms(true);
+    store_->setHistogramSettings(std::make_unique<HistogramSettingsImpl>(config));
+  }
+};
+
+// Dense TLS histograms produce the same statistics as circllhist ones, across merges.
+TEST_F(DenseHistogramTest, MultiHistogramMultipleMerges) {
+  Histogram& h1 = store_->histogramFromString("h1", Stats::Histogram::Unit::Unspecified);
+  Histogram& h2 = store_->histogramFromString("h2", Stats::Histogram::Unit::Unspecified);
+
+  expectCallAndAccumulate(h1, 0);
+  expectCallAndAccumulate(h1, 7);
+  expectCallAndAccumulate(h1, 43);
+  expectCallAndAccumulate(h2, 2201);
+  EXPECT_EQ(2, validateMerge());
+
+  expectCallAndAccumulate(h1, 415);
+  expectCallAndAccumulate(h2, 3201);
+  expectCallAndAccumulate(h2, 123456789);
+  EXPECT_EQ(2, validateMerge());
+
+  EXPECT_EQ(2, validateMerge());
+}
+
 class ThreadLocalRealThreadsTestBase : public ThreadLocalStoreNoMocksTestBase {
 protected:
   static constexpr uint32_t NumScopes = 1000;
@@ -53,6 +53,7 @@ using ::testing::DoAll;
 using ::testing::Invoke;
 using ::testing::InvokeWithoutArgs;
 using ::testing::NiceMock;
+using ::testing::Ref;
 using ::testing::Return;
 using ::testing::ReturnPointee;
 using ::testing::ReturnRef;
@@ -410,6 +411,42 @@ TEST_F(TcpProxyTest, UpstreamDisconnectDownstreamFlowControl) {
   filter_callbacks_.connection_.runLowWatermarkCallbacks();
 }
 
+TEST_F(TcpProxyTest, SpliceDisabledByDefault) {
+  setup(1);
+
+  EXPECT_CALL(*upstream_connections_.at(0), startSplice(_)).Times(0);
+  raiseEventUpstreamConnected(0);
+  EXPECT_EQ(0U, config_->stats().downstream_cx_splice_total_.value());
+}
+
+TEST_F(TcpProxyTest, SpliceStartedOnUpstreamConnection) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.tcp_proxy_splice", "true"}});
+  setup(1);
+
+  EXPECT_CALL(*upstream_connections_.at(0), startSplice(Ref(filter_callbacks_.connection_)))
+      .WillOnce(Return(true));
+  raiseEventUpstreamConnected(0);
+  EXPECT_EQ(1U, config_->stats().downstream_cx_splice_total_.value());
+  EXPECT_FALSE(filter_->needsData());
+}
+
+TEST_F(TcpProxyTest, SpliceRejected) {
+  TestScopedRuntime scoped_runtime;
+  Runtime::LoaderSingleton::getExisting()->mergeValues(
+      {{"envoy.reloadable_features.tcp_proxy_splice", "true"}});
+  setup(1);
+
+  EXPECT_CALL(*upstream_connections_.at(0), startSplice(_)).WillOnce(Return(false));
+  raiseEventUpstreamConnected(0);
+  EXPECT_EQ(0U, config_->stats().downstream_cx_splice_total_.value());
+
+  Buffer::OwnedImpl buffer("hello");
+  EXPECT_CALL(*upstream_connections_.at(0), write(BufferEqual(&buffer), _));
+  filter_->onData(buffer, false);
+}
+
 TEST_F(TcpProxyTest, DownstreamDisconnectRemote) {
   setup(1);
 
@@ -203,6 +203,31 @@ TEST_F(ClusterManagerImplTest, MultipleProtocolClusterAlpn) {
   create(parseBootstrapFromV3Yaml(yaml));
 }
 
+TEST_F(ClusterManagerImplTest, LazyClusterStats) {
+  const std::string yaml = R"EOF(
+  cluster_manager:
+    lazy_cluster_stats: true
+  static_resources:
+    clusters:
+    - name: cluster_1
+      connect_timeout: 0.250s
+      lb_policy: ROUND_ROBIN
+  )EOF";
+  create(parseBootstrapFromV3Yaml(yaml));
+  const ClusterStats* placeholder = cluster_manager_->clusterStatsPlaceholder();
+  ASSERT_NE(nullptr, placeholder);
+  auto info = cluster_manager_->clusters().active_clusters_.find("cluster_1")->second.get().info();
+  EXPECT_EQ(placeholder, &info->readOnlyStats());
+  EXPECT_EQ(nullptr,
+            TestUtility::findCounter(factory_.stats_, "cluster.cluster_1.upstream_cx_total"));
+  EXPECT_NE(nullptr,
+            TestUtility::findGauge(factory_.stats_, "cluster.cluster_1.membership_total"));
+
+  info->stats().upstream_cx_total_.inc();
+  EXPECT_NE(placeholder, &info->readOnlyStats());
+  EXPECT_EQ(1, factory_.stats_.counter("cluster.cluster_1.upstream_cx_total").value());
+}
+
 TEST_F(ClusterManagerImplTest, MultipleHealthCheckFail) {
   const std::string yaml = R"EOF(
  static_resources:
@@ -2793,6 +2818,58 @@ TEST_F(ClusterManagerImplTest, MergedUpdates) {
   EXPECT_EQ(1, factory_.stats_.counter("cluster_manager.update_merge_cancelled").value());
 }
 
+// Tests that delta only updates are forwarded to workers as such, unless they cancel a pending
+// merged update whose changes would otherwise be lost.
+TEST_F(ClusterManagerImplTest, DeltaOnlyUpdates) {
+  createWithLocalClusterUpdate();
+  EXPECT_CALL(local_cluster_update_, post(_, _, _)).Times(3);
+  EXPECT_CALL(local_hosts_removed_, post(_)).Times(2);
+
+  Event::MockTimer* timer = new NiceMock<Event::MockTimer>(&factory_.dispatcher_);
+  Cluster& cluster = cluster_manager_->activeClusters().begin()->second;
+  HostVectorSharedPtr hosts(
+      new HostVector(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()));
+  HostsPerLocalitySharedPtr hosts_per_locality = std::make_shared<HostsPerLocalityImpl>();
+  HostVector hosts_added;
+  HostVector hosts_removed;
+  const auto worker_host_set = [this]() -> const HostSet& {
+    return *cluster_manager_->getThreadLocalCluster("cluster_1")
+                ->prioritySet()
+                .hostSetsPerPriority()[0];
+  };
+
+  // A delta only removal is applied immediately and forwarded as a delta.
+  hosts_removed.push_back((*hosts)[0]);
+  auto params = updateHostsParams(hosts, hosts_per_locality,
+                                  std::make_shared<const HealthyHostVector>(*hosts),
+                                  hosts_per_locality);
+  params.delta_only = true;
+  cluster.prioritySet().updateHosts(0, std::move(params), {}, hosts_added, hosts_removed,
+                                    absl::nullopt);
+  EXPECT_TRUE(worker_host_set().deltaOnly());
+
+  // A health change is merged and not yet delivered.
+  hosts_removed.clear();
+  (*hosts)[1]->healthFlagSet(Host::HealthFlag::FAILED_EDS_HEALTH);
+  cluster.prioritySet().updateHosts(
+      0,
+      updateHostsParams(hosts, hosts_per_locality,
+                        std::make_shared<const HealthyHostVector>(*hosts), hosts_per_locality),
+      {}, hosts_added, hosts_removed, absl::nullopt);
+  EXPECT_TRUE(timer->enabled());
+
+  // The next delta only removal cancels the merge, so workers must rebuild in full.
+  hosts_removed.push_back((*hosts)[0]);
+  params = updateHostsParams(hosts, hosts_per_locality,
+                             std::make_shared<const HealthyHostVector>(*hosts),
+                             hosts_per_locality);
+  params.delta_only = true;
+  cluster.prioritySet().updateHosts(0, std::move(params), {}, hosts_added, hosts_removed,
+                                    absl::nullopt);
+  EXPECT_EQ(1, factory_.stats_.counter("cluster_manager.update_merge_cancelled").value());
+  EXPECT_FALSE(worker_host_set().deltaOnly());
+}
+
 // Tests that mergeable updates outside of a window get applied immediately.
 TEST_F(ClusterManagerImplTest, MergedUpdatesOutOfWindow) {
   createWithLocalClusterUpdate();
@@ -134,6 +134,43 @@ TEST(EdfSchedulerTest, ManyPeekahead) {
   }
 }
 
+// Validate that removed entries are neither picked nor returned from the peekahead list, and that
+// the remaining entries keep their place in the schedule.
+TEST(EdfSchedulerTest, RemoveIf) {
+  EdfScheduler<uint32_t> sched;
+  EdfScheduler<uint32_t> reference_sched;
+  constexpr uint32_t num_entries = 8;
+  std::shared_ptr<uint32_t> entries[num_entries];
+
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    entries[i] = std::make_shared<uint32_t>(i);
+    sched.add(i + 1, entries[i]);
+    reference_sched.add(i + 1, entries[i]);
+  }
+  const auto weight = [](const uint32_t& entry) { return entry + 1; };
+  for (uint32_t i = 0; i < 5; ++i) {
+    EXPECT_EQ(*reference_sched.pickAndAdd(weight), *sched.pickAndAdd(weight));
+  }
+  for (uint32_t i = 0; i < 3; ++i) {
+    sched.peekAgain(weight);
+  }
+
+  const auto odd = [](const uint32_t& entry) { return entry % 2 == 1; };
+  sched.removeIf(odd);
+  for (uint32_t i = 0; i < 100; ++i) {
+    // The reference schedule, skipping the removed entries.
+    std::shared_ptr<uint32_t> expected = reference_sched.pickAndAdd(weight);
+    while (odd(*expected)) {
+      expected = reference_sched.pickAndAdd(weight);
+    }
+    EXPECT_EQ(*expected, *sched.pickAndAdd(weight));
+  }
+
+  sched.removeIf([](const uint32_t&) { return true; });
+  EXPECT_TRUE(sched.empty());
+  EXPECT_EQ(nullptr, sched.pickAndAdd(weight));
+}
+
 } // namespace
 } // namespace Upstream
 } // namespace Envoy
@@ -14,6 +14,7 @@
 #include "common/config/utility.h"
 #include "common/singleton/manager_impl.h"
 #include "common/upstream/eds.h"
+#include "common/upstream/load_balancer_impl.h"
 
 #include "server/transport_socket_config_impl.h"
 
@@ -90,10 +91,20 @@ public:
         std::chrono::milliseconds(), false, Config::SubscriptionOptions());
   }
 
+  // Creates a weighted round robin load balancer over the cluster's hosts, which is patched or
+  // rebuilt by each update.
+  void addLoadBalancer() {
+    weighted_hosts_ = true;
+    lb_ = std::make_unique<RoundRobinLoadBalancer>(cluster_->prioritySet(), nullptr,
+                                                   cluster_->info()->lbStats(), runtime_, random_,
+                                                   common_lb_config_);
+  }
+
   // Set up an EDS config with multiple priorities, localities, weights and make sure
-  // they are loaded as expected.
+  // they are loaded as expected. The hosts are numbered from first_host, so that an update with a
+  // higher first_host removes the lowest numbered hosts and adds as many new ones.
   void priorityAndLocalityWeightedHelper(bool ignore_unknown_dynamic_fields, size_t num_hosts,
-                                         bool healthy) {
+                                         bool healthy, size_t first_host = 0) {
     state_.PauseTiming();
 
     envoy::config::endpoint::v3::ClusterLoadAssignment cluster_load_assignment;
@@ -109,8 +120,11 @@ public:
     endpoints->mutable_load_balancing_weight()->set_value(1);
 
     uint32_t port = 1000;
-    for (size_t i = 0; i < num_hosts; ++i) {
+    for (size_t i = first_host; i < first_host + num_hosts; ++i) {
       auto* lb_endpoint = endpoints->add_lb_endpoints();
+      if (weighted_hosts_) {
+        lb_endpoint->mutable_load_balancing_weight()->set_value(1 + i % 3);
+      }
       if (healthy) {
         lb_endpoint->set_health_status(envoy::config::core::v3::HEALTHY);
       } else {
@@ -171,6 +185,9 @@ public:
   NiceMock<Grpc::MockAsyncStream> async_stream_;
   Config::GrpcMuxImplSharedPtr grpc_mux_;
   Config::GrpcSubscriptionImplPtr subscription_;
+  bool weighted_hosts_{};
+  envoy::config::cluster::v3::Cluster::CommonLbConfig common_lb_config_;
+  std::unique_ptr<RoundRobinLoadBalancer> lb_;
 };
 
 } // namespace Upstream
@@ -223,3 +240,22 @@ static void healthOnlyUpdate(State& state) {
 }
 
 BENCHMARK(healthOnlyUpdate)->Range(1, 100000)->Unit(benchmark::kMillisecond);
+
+// Replaces 1% of the hosts of a cluster, as when a few endpoints of a large service are
+// rescheduled. The update only adds and removes hosts, so the load balancer patches its schedule
+// rather than rebuilding it.
+static void churnUpdate(State& state) {
+  Envoy::Thread::MutexBasicLockable lock;
+  Envoy::Logger::Context logging_state(spdlog::level::warn,
+                                       Envoy::Logger::Logger::DEFAULT_LOG_FORMAT, lock, false);
+  for (auto _ : state) {
+    Envoy::Upstream::EdsSpeedTest speed_test(state, false);
+    uint32_t endpoints = skipExpensiveBenchmarks() ? 1 : state.range(0);
+
+    speed_test.addLoadBalancer();
+    speed_test.priorityAndLocalityWeightedHelper(true, endpoints, true);
+    speed_test.priorityAndLocalityWeightedHelper(true, endpoints, true, endpoints / 100);
+  }
+}
+
+BENCHMARK(churnUpdate)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
@@ -579,6 +579,66 @@ TEST_F(EdsTest, EndpointHealthStatus) {
   EXPECT_EQ(rebuild_container + 1, stats_.counter("cluster.name.update_no_rebuild").value());
 }
 
+// Validate that updates which only add and remove hosts are marked as deltas.
+TEST_F(EdsTest, DeltaOnlyUpdates) {
+  envoy::config::endpoint::v3::ClusterLoadAssignment cluster_load_assignment;
+  cluster_load_assignment.set_cluster_name("fare");
+  auto* endpoints = cluster_load_assignment.add_endpoints();
+  endpoints->mutable_locality()->set_zone("us-east-1a");
+  auto add_endpoint = [](envoy::config::endpoint::v3::LocalityLbEndpoints& endpoints, int port) {
+    auto* socket_address = endpoints.add_lb_endpoints()
+                               ->mutable_endpoint()
+                               ->mutable_address()
+                               ->mutable_socket_address();
+    socket_address->set_address("1.2.3.4");
+    socket_address->set_port_value(port);
+  };
+  add_endpoint(*endpoints, 80);
+  add_endpoint(*endpoints, 81);
+
+  initialize();
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  const auto& host_set = *cluster_->prioritySet().hostSetsPerPriority()[0];
+  EXPECT_FALSE(host_set.deltaOnly());
+
+  add_endpoint(*endpoints, 82);
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  EXPECT_EQ(3, host_set.hosts().size());
+  EXPECT_TRUE(host_set.deltaOnly());
+
+  endpoints->mutable_lb_endpoints()->erase(endpoints->mutable_lb_endpoints()->begin());
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  EXPECT_EQ(2, host_set.hosts().size());
+  EXPECT_TRUE(host_set.deltaOnly());
+
+  // A change to the health of a remaining host needs a full update.
+  endpoints->mutable_lb_endpoints(0)->set_health_status(envoy::config::core::v3::UNHEALTHY);
+  add_endpoint(*endpoints, 83);
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  EXPECT_EQ(3, host_set.hosts().size());
+  EXPECT_FALSE(host_set.deltaOnly());
+
+  // So does a change to the weight of a remaining host.
+  endpoints->mutable_lb_endpoints(1)->mutable_load_balancing_weight()->set_value(2);
+  add_endpoint(*endpoints, 84);
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  EXPECT_EQ(4, host_set.hosts().size());
+  EXPECT_FALSE(host_set.deltaOnly());
+
+  // And so does a host in a new locality, since it changes the locality indices.
+  auto* other_endpoints = cluster_load_assignment.add_endpoints();
+  other_endpoints->mutable_locality()->set_zone("us-east-1b");
+  add_endpoint(*other_endpoints, 85);
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  EXPECT_EQ(5, host_set.hosts().size());
+  EXPECT_FALSE(host_set.deltaOnly());
+
+  add_endpoint(*other_endpoints, 86);
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  EXPECT_EQ(6, host_set.hosts().size());
+  EXPECT_TRUE(host_set.deltaOnly());
+}
+
 // Validate that onConfigUpdate() updates the hostname.
 TEST_F(EdsTest, Hostname) {
   envoy::config::endpoint::v3::ClusterLoadAssignment cluster_load_assignment;
@@ -66,8 +66,8 @@ public:
   PrioritySetImpl priority_set_;
   PrioritySetImpl local_priority_set_;
   Stats::IsolatedStoreImpl stats_store_;
-  ClusterStatNames stat_names_{stats_store_.symbolTable()};
-  ClusterStats stats_{ClusterInfoImpl::generateStats(stats_store_, stat_names_)};
+  ClusterLbStatNames stat_names_{stats_store_.symbolTable()};
+  ClusterLbStats stats_{ClusterInfoImpl::generateLbStats(stats_store_, stat_names_)};
   NiceMock<Runtime::MockLoader> runtime_;
   Random::RandomGeneratorImpl random_;
   envoy::config::cluster::v3::Cluster::CommonLbConfig common_config_;
@@ -165,7 +165,7 @@ public:
   MaglevTester(uint64_t num_hosts, uint32_t weighted_subset_percent = 0, uint32_t weight = 0)
       : BaseTester(num_hosts, weighted_subset_percent, weight) {
     maglev_lb_ = std::make_unique<MaglevLoadBalancer>(priority_set_, stats_, stats_store_, runtime_,
-                                                      random_, config_, common_config_);
+                                                      random_, simTime(), config_, common_config_);
   }
 
   absl::optional<envoy::config::cluster::v3::Cluster::MaglevLbConfig> config_;
@@ -541,10 +541,10 @@ public:
     *selector->mutable_keys()->Add() = metadata_key;
 
     subset_info_ = std::make_unique<LoadBalancerSubsetInfoImpl>(subset_config);
-    lb_ = std::make_unique<SubsetLoadBalancer>(LoadBalancerType::Random, priority_set_,
-                                               &local_priority_set_, stats_, stats_store_, runtime_,
-                                               random_, *subset_info_, absl::nullopt, absl::nullopt,
-                                               absl::nullopt, common_config_);
+    lb_ = std::make_unique<SubsetLoadBalancer>(
+        LoadBalancerType::Random, priority_set_, &local_priority_set_, stats_, stats_store_,
+        runtime_, random_, simTime(), *subset_info_, absl::nullopt, absl::nullopt, absl::nullopt,
+        common_config_);
 
     const HostVector& hosts = priority_set_.getOrCreateHostSet(0).hosts();
     ASSERT(hosts.size() == num_hosts);
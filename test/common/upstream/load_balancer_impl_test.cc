@@ -1,3 +1,4 @@
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -42,13 +43,13 @@ protected:
 
   LoadBalancerTestBase()
       : stat_names_(stats_store_.symbolTable()),
-        stats_(ClusterInfoImpl::generateStats(stats_store_, stat_names_)) {
+        stats_(ClusterInfoImpl::generateLbStats(stats_store_, stat_names_)) {
     least_request_lb_config_.mutable_choice_count()->set_value(2);
   }
 
   Stats::IsolatedStoreImpl stats_store_;
-  ClusterStatNames stat_names_;
-  ClusterStats stats_;
+  ClusterLbStatNames stat_names_;
+  ClusterLbStats stats_;
   NiceMock<Runtime::MockLoader> runtime_;
   NiceMock<Random::MockRandomGenerator> random_;
   NiceMock<MockPrioritySet> priority_set_;
@@ -61,7 +62,7 @@ protected:
 
 class TestLb : public LoadBalancerBase {
 public:
-  TestLb(const PrioritySet& priority_set, ClusterStats& stats, Runtime::Loader& runtime,
+  TestLb(const PrioritySet& priority_set, ClusterLbStats& stats, Runtime::Loader& runtime,
          Random::RandomGenerator& random,
          const envoy::config::cluster::v3::Cluster::CommonLbConfig& common_config)
       : LoadBalancerBase(priority_set, stats, runtime, random, common_config) {}
@@ -954,6 +955,46 @@ TEST_P(RoundRobinLoadBalancerTest, Weighted) {
   EXPECT_EQ(hostSet().healthy_hosts_[1], lb_->chooseHost(nullptr));
 }
 
+// Validate that a delta update patches the weighted schedule in place.
+TEST_P(RoundRobinLoadBalancerTest, WeightedDelta) {
+  hostSet().healthy_hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:80", simTime(), 1),
+                              makeTestHost(info_, "tcp://127.0.0.1:81", simTime(), 2),
+                              makeTestHost(info_, "tcp://127.0.0.1:82", simTime(), 3)};
+  hostSet().hosts_ = hostSet().healthy_hosts_;
+  init(false);
+  for (int i = 0; i < 5; ++i) {
+    lb_->chooseHost(nullptr);
+  }
+
+  // Replace the host of weight 2 with one of weight 4.
+  HostSharedPtr removed_host = hostSet().healthy_hosts_[1];
+  hostSet().healthy_hosts_[1] = makeTestHost(info_, "tcp://127.0.0.1:83", simTime(), 4);
+  hostSet().hosts_ = hostSet().healthy_hosts_;
+  hostSet().delta_only_ = true;
+  hostSet().runCallbacks({hostSet().healthy_hosts_[1]}, {removed_host});
+
+  std::map<HostConstSharedPtr, uint32_t> picks;
+  for (int i = 0; i < 800; ++i) {
+    ++picks[lb_->chooseHost(nullptr)];
+  }
+  EXPECT_EQ(0, picks.count(removed_host));
+  EXPECT_NEAR(100, picks[hostSet().healthy_hosts_[0]], 2);
+  EXPECT_NEAR(400, picks[hostSet().healthy_hosts_[1]], 2);
+  EXPECT_NEAR(300, picks[hostSet().healthy_hosts_[2]], 2);
+
+  // A delta that leaves all weights equal falls back to unweighted round robin.
+  HostVector removed_hosts = {hostSet().healthy_hosts_[1], hostSet().healthy_hosts_[2]};
+  hostSet().healthy_hosts_ = {hostSet().healthy_hosts_[0],
+                              makeTestHost(info_, "tcp://127.0.0.1:84", simTime(), 1)};
+  hostSet().hosts_ = hostSet().healthy_hosts_;
+  hostSet().runCallbacks({hostSet().healthy_hosts_[1]}, removed_hosts);
+  const HostConstSharedPtr first = lb_->chooseHost(nullptr);
+  const HostConstSharedPtr second = lb_->chooseHost(nullptr);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(first, lb_->chooseHost(nullptr));
+  EXPECT_EQ(second, lb_->chooseHost(nullptr));
+}
+
 // Validate that the RNG seed influences pick order when weighted RR.
 TEST_P(RoundRobinLoadBalancerTest, WeightedSeed) {
   hostSet().healthy_hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:80", simTime(), 1),
@@ -1473,14 +1514,12 @@ TEST_P(LeastRequestLoadBalancerTest, SingleHost) {
   // Host weight is 1.
   {
     EXPECT_CALL(random_, random()).WillOnce(Return(0)).WillOnce(Return(2)).WillOnce(Return(3));
-    stats_.max_host_weight_.set(1UL);
     EXPECT_EQ(hostSet().healthy_hosts_[0], lb_.chooseHost(nullptr));
   }
 
   // Host weight is 100.
   {
     EXPECT_CALL(random_, random()).WillOnce(Return(0)).WillOnce(Return(2)).WillOnce(Return(3));
-    stats_.max_host_weight_.set(100UL);
     EXPECT_EQ(hostSet().healthy_hosts_[0], lb_.chooseHost(nullptr));
   }
 
@@ -1505,7 +1544,6 @@ TEST_P(LeastRequestLoadBalancerTest, SingleHost) {
 TEST_P(LeastRequestLoadBalancerTest, Normal) {
   hostSet().healthy_hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:80", simTime()),
                               makeTestHost(info_, "tcp://127.0.0.1:81", simTime())};
-  stats_.max_host_weight_.set(1UL);
   hostSet().hosts_ = hostSet().healthy_hosts_;
   hostSet().runCallbacks({}, {}); // Trigger callbacks. The added/removed lists are not relevant.
 
@@ -1525,7 +1563,6 @@ TEST_P(LeastRequestLoadBalancerTest, PNC) {
                               makeTestHost(info_, "tcp://127.0.0.1:81", simTime()),
                               makeTestHost(info_, "tcp://127.0.0.1:82", simTime()),
                               makeTestHost(info_, "tcp://127.0.0.1:83", simTime())};
-  stats_.max_host_weight_.set(1UL);
   hostSet().hosts_ = hostSet().healthy_hosts_;
   hostSet().runCallbacks({}, {}); // Trigger callbacks. The added/removed lists are not relevant.
 
@@ -1572,7 +1609,6 @@ TEST_P(LeastRequestLoadBalancerTest, PNC) {
 TEST_P(LeastRequestLoadBalancerTest, WeightImbalance) {
   hostSet().healthy_hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:80", simTime(), 1),
                               makeTestHost(info_, "tcp://127.0.0.1:81", simTime(), 2)};
-  stats_.max_host_weight_.set(2UL);
 
   hostSet().hosts_ = hostSet().healthy_hosts_;
   hostSet().runCallbacks({}, {}); // Trigger callbacks. The added/removed lists are not relevant.
@@ -1697,7 +1733,6 @@ TEST_P(LeastRequestLoadBalancerTest, WeightImbalanceWithCustomActiveRequestBias)
 TEST_P(LeastRequestLoadBalancerTest, WeightImbalanceCallbacks) {
   hostSet().healthy_hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:80", simTime(), 1),
                               makeTestHost(info_, "tcp://127.0.0.1:81", simTime(), 2)};
-  stats_.max_host_weight_.set(2UL);
 
   hostSet().hosts_ = hostSet().healthy_hosts_;
   hostSet().runCallbacks({}, {}); // Trigger callbacks. The added/removed lists are not relevant.
@@ -70,9 +70,8 @@ TEST(DISABLED_LeastRequestLoadBalancerWeightTest, Weight) {
       {}, hosts, {}, absl::nullopt);
 
   Stats::IsolatedStoreImpl stats_store;
-  ClusterStatNames stat_names(stats_store.symbolTable());
-  ClusterStats stats{ClusterInfoImpl::generateStats(stats_store, stat_names)};
-  stats.max_host_weight_.set(weight);
+  ClusterLbStatNames stat_names(stats_store.symbolTable());
+  ClusterLbStats stats{ClusterInfoImpl::generateLbStats(stats_store, stat_names)};
   NiceMock<Runtime::MockLoader> runtime;
   Random::RandomGeneratorImpl random;
   envoy::config::cluster::v3::Cluster::LeastRequestLbConfig least_request_lb_config;
@@ -107,7 +106,7 @@ class DISABLED_SimulationTest : public testing::Test {
 public:
   DISABLED_SimulationTest()
       : stat_names_(stats_store_.symbolTable()),
-        stats_(ClusterInfoImpl::generateStats(stats_store_, stat_names_)) {
+        stats_(ClusterInfoImpl::generateLbStats(stats_store_, stat_names_)) {
     ON_CALL(runtime_.snapshot_, getInteger("upstream.healthy_panic_threshold", 50U))
         .WillByDefault(Return(50U));
     ON_CALL(runtime_.snapshot_, featureEnabled("upstream.zone_routing.enabled", 100))
@@ -245,8 +244,8 @@ public:
   NiceMock<MockTimeSystem> time_source_;
   Random::RandomGeneratorImpl random_;
   Stats::IsolatedStoreImpl stats_store_;
-  ClusterStatNames stat_names_;
-  ClusterStats stats_;
+  ClusterLbStatNames stat_names_;
+  ClusterLbStats stats_;
   envoy::config::cluster::v3::Cluster::CommonLbConfig common_config_;
 };
 
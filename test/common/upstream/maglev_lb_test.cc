@@ -44,11 +44,11 @@ class MaglevLoadBalancerTest : public Event::TestUsingSimulatedTime, public test
 public:
   MaglevLoadBalancerTest()
       : stat_names_(stats_store_.symbolTable()),
-        stats_(ClusterInfoImpl::generateStats(stats_store_, stat_names_)) {}
+        stats_(ClusterInfoImpl::generateLbStats(stats_store_, stat_names_)) {}
 
   void createLb() {
     lb_ = std::make_unique<MaglevLoadBalancer>(priority_set_, stats_, stats_store_, runtime_,
-                                               random_, config_, common_config_);
+                                               random_, simTime(), config_, common_config_);
   }
 
   void init(uint64_t table_size) {
@@ -63,8 +63,8 @@ public:
   MockHostSet& host_set_ = *priority_set_.getMockHostSet(0);
   std::shared_ptr<MockClusterInfo> info_{new NiceMock<MockClusterInfo>()};
   Stats::IsolatedStoreImpl stats_store_;
-  ClusterStatNames stat_names_;
-  ClusterStats stats_;
+  ClusterLbStatNames stat_names_;
+  ClusterLbStats stats_;
   absl::optional<envoy::config::cluster::v3::Cluster::MaglevLbConfig> config_;
   envoy::config::cluster::v3::Cluster::CommonLbConfig common_config_;
   NiceMock<Runtime::MockLoader> runtime_;
@@ -111,6 +111,8 @@ TEST_F(MaglevLoadBalancerTest, Basic) {
 
   EXPECT_EQ("maglev_lb.min_entries_per_host", lb_->stats().min_entries_per_host_.name());
   EXPECT_EQ("maglev_lb.max_entries_per_host", lb_->stats().max_entries_per_host_.name());
+  EXPECT_EQ("maglev_lb.table_build_time_us", lb_->stats().table_build_time_us_.name());
+  EXPECT_EQ(Stats::Histogram::Unit::Microseconds, lb_->stats().table_build_time_us_.unit());
   EXPECT_EQ(1, lb_->stats().min_entries_per_host_.value());
   EXPECT_EQ(2, lb_->stats().max_entries_per_host_.value());
 
@@ -130,6 +132,33 @@ TEST_F(MaglevLoadBalancerTest, Basic) {
   }
 }
 
+// An update to one priority only rebuilds the table of that priority.
+TEST_F(MaglevLoadBalancerTest, UpdateRebuildsOnlyUpdatedPriority) {
+  host_set_.hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:90", simTime()),
+                      makeTestHost(info_, "tcp://127.0.0.1:91", simTime())};
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  MockHostSet& failover_host_set = *priority_set_.getMockHostSet(1);
+  failover_host_set.hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:92", simTime())};
+  failover_host_set.healthy_hosts_ = failover_host_set.hosts_;
+  init(7);
+  // The failover table was built last.
+  EXPECT_EQ(7, lb_->stats().min_entries_per_host_.value());
+  EXPECT_EQ(7, lb_->stats().max_entries_per_host_.value());
+
+  host_set_.hosts_.push_back(makeTestHost(info_, "tcp://127.0.0.1:93", simTime()));
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({host_set_.hosts_.back()}, {});
+  // Only the table of priority 0 was built.
+  EXPECT_EQ(2, lb_->stats().min_entries_per_host_.value());
+  EXPECT_EQ(3, lb_->stats().max_entries_per_host_.value());
+
+  LoadBalancerPtr lb = lb_->factory()->create();
+  for (uint32_t i = 0; i < 7; ++i) {
+    TestLoadBalancerContext context(i);
+    EXPECT_NE(failover_host_set.hosts_[0], lb->chooseHost(&context));
+  }
+}
+
 // Basic with hostname.
 TEST_F(MaglevLoadBalancerTest, BasicWithHostName) {
   host_set_.hosts_ = {makeTestHost(info_, "90", "tcp://127.0.0.1:90", simTime()),
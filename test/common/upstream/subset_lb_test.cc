@@ -129,8 +129,7 @@ class SubsetLoadBalancerTest : public Event::TestUsingSimulatedTime,
 public:
   SubsetLoadBalancerTest()
       : scope_(stats_store_.createScope("testprefix")), stat_names_(stats_store_.symbolTable()),
-        stats_(ClusterInfoImpl::generateStats(stats_store_, stat_names_)) {
-    stats_.max_host_weight_.set(1UL);
+        stats_(ClusterInfoImpl::generateLbStats(stats_store_, stat_names_)) {
     least_request_lb_config_.mutable_choice_count()->set_value(2);
   }
 
@@ -197,8 +196,9 @@ public:
     }
 
     lb_ = std::make_shared<SubsetLoadBalancer>(
-        lb_type_, priority_set_, nullptr, stats_, *scope_, runtime_, random_, subset_info_,
-        ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+        lb_type_, priority_set_, nullptr, stats_, *scope_, runtime_, random_, simTime(),
+        subset_info_, ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_,
+        common_config_);
   }
 
   void zoneAwareInit(const std::vector<HostURLMetadataMap>& host_metadata_per_locality,
@@ -245,10 +245,10 @@ public:
             std::make_shared<ExcludedHostVector>(), HostsPerLocalityImpl::empty()),
         {}, {}, {}, absl::nullopt);
 
-    lb_ = std::make_shared<SubsetLoadBalancer>(lb_type_, priority_set_, &local_priority_set_,
-                                               stats_, *scope_, runtime_, random_, subset_info_,
-                                               ring_hash_lb_config_, maglev_lb_config_,
-                                               least_request_lb_config_, common_config_);
+    lb_ = std::make_shared<SubsetLoadBalancer>(
+        lb_type_, priority_set_, &local_priority_set_, stats_, *scope_, runtime_, random_,
+        simTime(), subset_info_, ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_,
+        common_config_);
   }
 
   HostSharedPtr makeHost(const std::string& url, const HostMetadata& metadata) {
@@ -477,8 +477,8 @@ public:
   NiceMock<Random::MockRandomGenerator> random_;
   Stats::IsolatedStoreImpl stats_store_;
   Stats::ScopePtr scope_;
-  ClusterStatNames stat_names_;
-  ClusterStats stats_;
+  ClusterLbStatNames stat_names_;
+  ClusterLbStats stats_;
   PrioritySetImpl local_priority_set_;
   HostVectorSharedPtr local_hosts_;
   HostsPerLocalitySharedPtr local_hosts_per_locality_;
@@ -1434,8 +1434,9 @@ TEST_F(SubsetLoadBalancerTest, IgnoresHostsWithoutMetadata) {
   host_set_.healthy_hosts_per_locality_ = host_set_.hosts_per_locality_;
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
-      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, simTime(),
+      subset_info_, ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_,
+      common_config_);
 
   TestLoadBalancerContext context_version({{"version", "1.0"}});
 
@@ -1853,8 +1854,9 @@ TEST_F(SubsetLoadBalancerTest, DisabledLocalityWeightAwareness) {
       host_set_, {1, 100});
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
-      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, simTime(),
+      subset_info_, ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_,
+      common_config_);
 
   TestLoadBalancerContext context({{"version", "1.1"}});
 
@@ -1876,8 +1878,9 @@ TEST_F(SubsetLoadBalancerTest, DoesNotCheckHostHealth) {
   EXPECT_CALL(*mock_host, weight()).WillRepeatedly(Return(1));
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
-      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, simTime(),
+      subset_info_, ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_,
+      common_config_);
 }
 
 TEST_F(SubsetLoadBalancerTest, EnabledLocalityWeightAwareness) {
@@ -1899,8 +1902,9 @@ TEST_F(SubsetLoadBalancerTest, EnabledLocalityWeightAwareness) {
       host_set_, {1, 100});
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
-      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, simTime(),
+      subset_info_, ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_,
+      common_config_);
 
   TestLoadBalancerContext context({{"version", "1.1"}});
 
@@ -1934,8 +1938,9 @@ TEST_F(SubsetLoadBalancerTest, EnabledScaleLocalityWeights) {
       host_set_, {50, 50});
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
-      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, simTime(),
+      subset_info_, ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_,
+      common_config_);
   TestLoadBalancerContext context({{"version", "1.1"}});
 
   // Since we scale the locality weights by number of hosts removed, we expect to see the second
@@ -1979,8 +1984,9 @@ TEST_F(SubsetLoadBalancerTest, EnabledScaleLocalityWeightsRounding) {
       host_set_, {2, 2});
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
-      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, simTime(),
+      subset_info_, ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_,
+      common_config_);
   TestLoadBalancerContext context({{"version", "1.0"}});
 
   // We expect to see a 33/66 split because 2 * 1 / 2 = 1 and 2 * 3 / 4 = 1.5 -> 2
@@ -2011,8 +2017,9 @@ TEST_F(SubsetLoadBalancerTest, ScaleLocalityWeightsWithNoLocalityWeights) {
       host_set_);
 
   lb_ = std::make_shared<SubsetLoadBalancer>(
-      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, subset_info_,
-      ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_, common_config_);
+      lb_type_, priority_set_, nullptr, stats_, stats_store_, runtime_, random_, simTime(),
+      subset_info_, ring_hash_lb_config_, maglev_lb_config_, least_request_lb_config_,
+      common_config_);
 }
 
 TEST_P(SubsetLoadBalancerTest, GaugesUpdatedOnDestroy) {
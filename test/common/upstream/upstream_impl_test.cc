@@ -1691,7 +1691,7 @@ TEST_F(StaticClusterImplTest, OutlierDetector) {
   cluster.initialize([] {});
 
   EXPECT_EQ(2UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(2UL, cluster.info()->stats().membership_healthy_.value());
+  EXPECT_EQ(2UL, cluster.info()->endpointStats().membership_healthy_.value());
 
   // Set a single host as having failed and fire outlier detector callbacks. This should result
   // in only a single healthy host.
@@ -1701,7 +1701,7 @@ TEST_F(StaticClusterImplTest, OutlierDetector) {
       Host::HealthFlag::FAILED_OUTLIER_CHECK);
   detector->runCallbacks(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]);
   EXPECT_EQ(1UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(1UL, cluster.info()->stats().membership_healthy_.value());
+  EXPECT_EQ(1UL, cluster.info()->endpointStats().membership_healthy_.value());
   EXPECT_NE(cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts()[0],
             cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]);
 
@@ -1710,7 +1710,7 @@ TEST_F(StaticClusterImplTest, OutlierDetector) {
       Host::HealthFlag::FAILED_OUTLIER_CHECK);
   detector->runCallbacks(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]);
   EXPECT_EQ(2UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(2UL, cluster.info()->stats().membership_healthy_.value());
+  EXPECT_EQ(2UL, cluster.info()->endpointStats().membership_healthy_.value());
 }
 
 TEST_F(StaticClusterImplTest, HealthyStat) {
@@ -1754,8 +1754,8 @@ TEST_F(StaticClusterImplTest, HealthyStat) {
 
   EXPECT_EQ(2UL, cluster.prioritySet().hostSetsPerPriority()[0]->hosts().size());
   EXPECT_EQ(0UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]->healthFlagClear(
       Host::HealthFlag::FAILED_ACTIVE_HC);
@@ -1771,46 +1771,46 @@ TEST_F(StaticClusterImplTest, HealthyStat) {
       Host::HealthFlag::FAILED_OUTLIER_CHECK);
   outlier_detector->runCallbacks(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]);
   EXPECT_EQ(1UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(1UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(1UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]->healthFlagSet(
       Host::HealthFlag::FAILED_ACTIVE_HC);
   health_checker->runCallbacks(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0],
                                HealthTransition::Changed);
   EXPECT_EQ(1UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(1UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(1UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]->healthFlagClear(
       Host::HealthFlag::FAILED_OUTLIER_CHECK);
   outlier_detector->runCallbacks(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]);
   EXPECT_EQ(1UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(1UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(1UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]->healthFlagClear(
       Host::HealthFlag::FAILED_ACTIVE_HC);
   health_checker->runCallbacks(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0],
                                HealthTransition::Changed);
   EXPECT_EQ(2UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(2UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(2UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]->healthFlagSet(
       Host::HealthFlag::FAILED_OUTLIER_CHECK);
   outlier_detector->runCallbacks(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[0]);
   EXPECT_EQ(1UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(1UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(1UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[1]->healthFlagSet(
       Host::HealthFlag::FAILED_ACTIVE_HC);
   health_checker->runCallbacks(cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[1],
                                HealthTransition::Changed);
   EXPECT_EQ(0UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[1]->healthFlagSet(
       Host::HealthFlag::DEGRADED_ACTIVE_HC);
@@ -1820,8 +1820,8 @@ TEST_F(StaticClusterImplTest, HealthyStat) {
                                HealthTransition::Changed);
   EXPECT_EQ(0UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
   EXPECT_EQ(1UL, cluster.prioritySet().hostSetsPerPriority()[0]->degradedHosts().size());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(1UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(1UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   // Mark the endpoint as unhealthy. This should decrement the degraded stat.
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[1]->healthFlagSet(
@@ -1830,8 +1830,8 @@ TEST_F(StaticClusterImplTest, HealthyStat) {
                                HealthTransition::Changed);
   EXPECT_EQ(0UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
   EXPECT_EQ(0UL, cluster.prioritySet().hostSetsPerPriority()[0]->degradedHosts().size());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   // Go back to degraded.
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[1]->healthFlagClear(
@@ -1840,8 +1840,8 @@ TEST_F(StaticClusterImplTest, HealthyStat) {
                                HealthTransition::Changed);
   EXPECT_EQ(0UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
   EXPECT_EQ(1UL, cluster.prioritySet().hostSetsPerPriority()[0]->degradedHosts().size());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(1UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(1UL, cluster.info()->endpointStats().membership_degraded_.value());
 
   // Then go healthy.
   cluster.prioritySet().hostSetsPerPriority()[0]->hosts()[1]->healthFlagClear(
@@ -1850,8 +1850,8 @@ TEST_F(StaticClusterImplTest, HealthyStat) {
                                HealthTransition::Changed);
   EXPECT_EQ(1UL, cluster.prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
   EXPECT_EQ(0UL, cluster.prioritySet().hostSetsPerPriority()[0]->degradedHosts().size());
-  EXPECT_EQ(1UL, cluster.info()->stats().membership_healthy_.value());
-  EXPECT_EQ(0UL, cluster.info()->stats().membership_degraded_.value());
+  EXPECT_EQ(1UL, cluster.info()->endpointStats().membership_healthy_.value());
+  EXPECT_EQ(0UL, cluster.info()->endpointStats().membership_degraded_.value());
 }
 
 TEST_F(StaticClusterImplTest, UrlConfig) {
@@ -2292,6 +2292,53 @@ TEST_F(ClusterInfoImplTest, Metadata) {
   EXPECT_EQ(LoadBalancerType::Maglev, cluster->info()->lbType());
 }
 
+// With a stats placeholder configured, traffic and load report stats are created on first use.
+TEST_F(ClusterInfoImplTest, LazyClusterStats) {
+  const std::string yaml = R"EOF(
+    name: name
+    connect_timeout: 0.25s
+    type: STRICT_DNS
+    lb_policy: ROUND_ROBIN
+  )EOF";
+
+  Stats::TestUtil::TestStore placeholder_store;
+  ClusterStats placeholder(
+      ClusterInfoImpl::generateStats(placeholder_store, cm_.clusterStatNames()));
+  ON_CALL(cm_, clusterStatsPlaceholder()).WillByDefault(Return(&placeholder));
+  auto cluster = makeCluster(yaml);
+
+  // Config update, endpoint and LB stats stay eager.
+  EXPECT_TRUE(stats_.findCounterByString("cluster.name.update_attempt").has_value());
+  EXPECT_TRUE(stats_.findGaugeByString("cluster.name.membership_total").has_value());
+  EXPECT_TRUE(stats_.findCounterByString("cluster.name.lb_healthy_panic").has_value());
+  EXPECT_FALSE(stats_.findCounterByString("cluster.name.upstream_cx_total").has_value());
+  EXPECT_EQ(&placeholder, &cluster->info()->readOnlyStats());
+  EXPECT_EQ(0, cluster->info()->readOnlyStats().upstream_cx_total_.value());
+
+  cluster->info()->stats().upstream_cx_total_.inc();
+  EXPECT_NE(&placeholder, &cluster->info()->readOnlyStats());
+  EXPECT_EQ(&cluster->info()->stats(), &cluster->info()->readOnlyStats());
+  EXPECT_EQ(1, stats_.counter("cluster.name.upstream_cx_total").value());
+  EXPECT_EQ(0, placeholder.upstream_cx_total_.value());
+
+  cluster->info()->loadReportStats().upstream_rq_dropped_.inc();
+  EXPECT_EQ(1, cluster->info()->loadReportStats().upstream_rq_dropped_.value());
+}
+
+// Without a placeholder, all cluster stats are created with the cluster.
+TEST_F(ClusterInfoImplTest, EagerClusterStats) {
+  const std::string yaml = R"EOF(
+    name: name
+    connect_timeout: 0.25s
+    type: STRICT_DNS
+    lb_policy: ROUND_ROBIN
+  )EOF";
+
+  auto cluster = makeCluster(yaml);
+  EXPECT_TRUE(stats_.findCounterByString("cluster.name.upstream_cx_total").has_value());
+  EXPECT_EQ(&cluster->info()->stats(), &cluster->info()->readOnlyStats());
+}
+
 // Verify retry budget default values are honored.
 TEST_F(ClusterInfoImplTest, RetryBudgetDefaultPopulation) {
   std::string yaml = R"EOF(
@@ -48,7 +48,6 @@ void ZoneAwareLoadBalancerFuzzBase::setupZoneAwareLoadBalancingSpecificLogic() {
   // Having 3 possible weights, 1, 2, and 3 to provide the state space at least some variation
   // in regards to weights, which do affect the load balancing algorithm. Cap the amount of
   // weights at 3 for simplicity's sake
-  stats_.max_host_weight_.set(3UL);
   addWeightsToHosts();
 }
 
@@ -680,7 +680,7 @@ TEST_F(RedisClusterTest, EmptyDnsResponse) {
 
   EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
   EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(1U, cluster_->info()->stats().update_empty_.value());
+  EXPECT_EQ(1U, cluster_->info()->configUpdateStats().update_empty_.value());
 
   // Does not recreate the timer on subsequent DNS resolve calls.
   EXPECT_CALL(*dns_timer, enableTimer(_, _));
@@ -689,7 +689,7 @@ TEST_F(RedisClusterTest, EmptyDnsResponse) {
 
   EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
   EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(2U, cluster_->info()->stats().update_empty_.value());
+  EXPECT_EQ(2U, cluster_->info()->configUpdateStats().update_empty_.value());
 }
 
 TEST_F(RedisClusterTest, FailedDnsResponse) {
@@ -705,7 +705,7 @@ TEST_F(RedisClusterTest, FailedDnsResponse) {
 
   EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
   EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(0U, cluster_->info()->stats().update_empty_.value());
+  EXPECT_EQ(0U, cluster_->info()->configUpdateStats().update_empty_.value());
 
   // Does not recreate the timer on subsequent DNS resolve calls.
   EXPECT_CALL(*dns_timer, enableTimer(_, _));
@@ -714,7 +714,7 @@ TEST_F(RedisClusterTest, FailedDnsResponse) {
 
   EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
   EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->healthyHosts().size());
-  EXPECT_EQ(1U, cluster_->info()->stats().update_empty_.value());
+  EXPECT_EQ(1U, cluster_->info()->configUpdateStats().update_empty_.value());
 }
 
 TEST_F(RedisClusterTest, Basic) {
@@ -760,8 +760,8 @@ TEST_F(RedisClusterTest, RedisResolveFailure) {
 
   // Initialization will wait til the redis cluster succeed.
   expectClusterSlotFailure();
-  EXPECT_EQ(1U, cluster_->info()->stats().update_attempt_.value());
-  EXPECT_EQ(1U, cluster_->info()->stats().update_failure_.value());
+  EXPECT_EQ(1U, cluster_->info()->configUpdateStats().update_attempt_.value());
+  EXPECT_EQ(1U, cluster_->info()->configUpdateStats().update_failure_.value());
 
   expectRedisResolve(true);
   resolve_timer_->invokeCallback();
@@ -776,8 +776,8 @@ TEST_F(RedisClusterTest, RedisResolveFailure) {
   resolve_timer_->invokeCallback();
   expectClusterSlotFailure();
   expectHealthyHosts(std::list<std::string>({"127.0.0.1:22120", "127.0.0.2:22120"}));
-  EXPECT_EQ(3U, cluster_->info()->stats().update_attempt_.value());
-  EXPECT_EQ(2U, cluster_->info()->stats().update_failure_.value());
+  EXPECT_EQ(3U, cluster_->info()->configUpdateStats().update_attempt_.value());
+  EXPECT_EQ(2U, cluster_->info()->configUpdateStats().update_failure_.value());
 }
 
 TEST_F(RedisClusterTest, FactoryInitNotRedisClusterTypeFailure) {
@@ -832,8 +832,8 @@ TEST_F(RedisClusterTest, RedisErrorResponse) {
 
   EXPECT_CALL(*cluster_callback_, onClusterSlotUpdate(_, _)).Times(0);
   expectClusterSlotResponse(std::move(hello_world_response));
-  EXPECT_EQ(1U, cluster_->info()->stats().update_attempt_.value());
-  EXPECT_EQ(1U, cluster_->info()->stats().update_failure_.value());
+  EXPECT_EQ(1U, cluster_->info()->configUpdateStats().update_attempt_.value());
+  EXPECT_EQ(1U, cluster_->info()->configUpdateStats().update_failure_.value());
 
   expectRedisResolve();
   resolve_timer_->invokeCallback();
@@ -858,9 +858,9 @@ TEST_F(RedisClusterTest, RedisErrorResponse) {
     }
     expectClusterSlotResponse(createResponse(flags, no_replica));
     expectHealthyHosts(std::list<std::string>({"127.0.0.1:22120"}));
-    EXPECT_EQ(++update_attempt, cluster_->info()->stats().update_attempt_.value());
+    EXPECT_EQ(++update_attempt, cluster_->info()->configUpdateStats().update_attempt_.value());
     if (!flags.all()) {
-      EXPECT_EQ(++update_failure, cluster_->info()->stats().update_failure_.value());
+      EXPECT_EQ(++update_failure, cluster_->info()->configUpdateStats().update_failure_.value());
     }
   }
 }
@@ -895,9 +895,9 @@ TEST_F(RedisClusterTest, RedisReplicaErrorResponse) {
     }
     expectHealthyHosts(std::list<std::string>({"127.0.0.1:22120"}));
     expectClusterSlotResponse(createResponse(single_slot_primary, replica_flags));
-    EXPECT_EQ(++update_attempt, cluster_->info()->stats().update_attempt_.value());
+    EXPECT_EQ(++update_attempt, cluster_->info()->configUpdateStats().update_attempt_.value());
     if (!(replica_flags.all() || replica_flags.none())) {
-      EXPECT_EQ(++update_failure, cluster_->info()->stats().update_failure_.value());
+      EXPECT_EQ(++update_failure, cluster_->info()->configUpdateStats().update_failure_.value());
     }
   }
 }
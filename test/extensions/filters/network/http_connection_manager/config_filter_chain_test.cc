@@ -105,6 +105,45 @@ http_filters:
   EXPECT_TRUE(stream_info.hasResponseFlag(StreamInfo::ResponseFlag::NoFilterConfigFound));
 }
 
+// A chain mixing static and dynamic filters looks up the config of its dynamic filters for each
+// stream, while its static filters are still created.
+TEST_F(FilterChainTest, CreateMixedFilterChain) {
+  const std::string yaml_string = R"EOF(
+codec_type: http1
+stat_prefix: router
+route_config:
+  virtual_hosts:
+  - name: service
+    domains:
+    - "*"
+    routes:
+    - match:
+        prefix: "/"
+      route:
+        cluster: cluster
+http_filters:
+- name: encoder-decoder-buffer-filter
+- name: foo
+  config_discovery:
+    config_source: { resource_api_version: V3, ads: {} }
+    type_urls:
+    - type.googleapis.com/envoy.extensions.filters.http.health_check.v3.HealthCheck
+- name: envoy.filters.http.router
+  )EOF";
+  HttpConnectionManagerConfig config(parseHttpConnectionManagerFromYaml(yaml_string), context_,
+                                     date_provider_, route_config_provider_manager_,
+                                     scoped_routes_config_provider_manager_, http_tracer_manager_,
+                                     filter_config_provider_manager_);
+
+  for (int i = 0; i < 2; ++i) {
+    Http::MockFilterChainFactoryCallbacks callbacks;
+    EXPECT_CALL(callbacks, addStreamFilter(_)); // Buffer
+    EXPECT_CALL(callbacks, addStreamDecoderFilter(_))
+        .Times(2); // MissingConfigFilter and router
+    config.createFilterChain(callbacks);
+  }
+}
+
 // Tests where upgrades are configured on via the HCM.
 TEST_F(FilterChainTest, CreateUpgradeFilterChain) {
   auto hcm_config = parseHttpConnectionManagerFromYaml(basic_config_);
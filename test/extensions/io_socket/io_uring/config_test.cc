@@ -0,0 +1,40 @@
+#include "envoy/extensions/network/socket_interface/v3/io_uring_socket_interface.pb.h"
+
+#include "common/network/socket_interface.h"
+
+#include "extensions/io_socket/io_uring/config.h"
+
+#include "test/mocks/server/instance.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace IoSocket {
+namespace IoUring {
+namespace {
+
+TEST(IoUringSocketInterfaceConfigTest, Registered) {
+  const Network::SocketInterface* sock_interface =
+      Network::socketInterface("envoy.io_socket.io_uring");
+  ASSERT_NE(nullptr, sock_interface);
+  EXPECT_NE(nullptr, dynamic_cast<const IoUringSocketInterface*>(sock_interface));
+}
+
+TEST(IoUringSocketInterfaceConfigTest, CreateBootstrapExtension) {
+  auto* factory = Registry::FactoryRegistry<
+      Server::Configuration::BootstrapExtensionFactory>::getFactory("envoy.io_socket.io_uring");
+  ASSERT_NE(nullptr, factory);
+  envoy::extensions::network::socket_interface::v3::IoUringSocketInterface config;
+  config.mutable_io_uring_size()->set_value(64);
+  config.mutable_read_buffer_size()->set_value(1024);
+  testing::NiceMock<Server::Configuration::MockServerFactoryContext> context;
+  Server::BootstrapExtensionPtr extension = factory->createBootstrapExtension(config, context);
+  ASSERT_NE(nullptr, extension);
+}
+
+} // namespace
+} // namespace IoUring
+} // namespace IoSocket
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,224 @@
+#include "common/buffer/buffer_impl.h"
+#include "common/io/io_uring_impl.h"
+#include "common/network/address_impl.h"
+
+#include "extensions/io_socket/io_uring/io_uring_socket_handle_impl.h"
+#include "extensions/io_socket/io_uring/io_uring_worker_impl.h"
+
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace IoSocket {
+namespace IoUring {
+namespace {
+
+class TestIoUringWorkerFactory : public IoUringWorkerFactory {
+public:
+  TestIoUringWorkerFactory(IoUringWorker& worker) : worker_(worker) {}
+
+  // IoUringWorkerFactory
+  OptRef<IoUringWorker> getIoUringWorker() override { return worker_; }
+  uint32_t readBufferSize() const override { return 4096; }
+
+private:
+  IoUringWorker& worker_;
+};
+
+class IoUringSocketHandleImplTest : public testing::Test {
+protected:
+  IoUringSocketHandleImplTest()
+      : api_(Api::createApiForTest()), dispatcher_(api_->allocateDispatcher("test_thread")) {}
+
+  void SetUp() override {
+    if (!Io::isIoUringSupported()) {
+      GTEST_SKIP() << "io_uring is not supported by the kernel";
+    }
+    worker_ = std::make_unique<IoUringWorker>(std::make_unique<Io::IoUringImpl>(16, false),
+                                              *dispatcher_);
+    factory_ = std::make_shared<TestIoUringWorkerFactory>(*worker_);
+  }
+
+  void TearDown() override {
+    server_.reset();
+    client_.reset();
+    listener_.reset();
+    // Let the pending close requests reach the kernel.
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  }
+
+  std::unique_ptr<IoUringSocketHandleImpl> makeSocket() {
+    const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    EXPECT_GE(fd, 0);
+    return std::make_unique<IoUringSocketHandleImpl>(factory_, fd, false, AF_INET);
+  }
+
+  // Runs the event loop until the condition holds.
+  void runUntil(const std::function<bool()>& condition) {
+    while (!condition()) {
+      dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+    }
+  }
+
+  // Creates a listener, connects a client to it and accepts the connection.
+  void connect() {
+    listener_ = makeSocket();
+    auto address = std::make_shared<Network::Address::Ipv4Instance>("127.0.0.1", 0);
+    ASSERT_EQ(0, listener_->bind(address).rc_);
+    ASSERT_EQ(0, listener_->listen(16).rc_);
+    uint32_t listener_events = 0;
+    listener_->initializeFileEvent(
+        *dispatcher_, [&listener_events](uint32_t events) { listener_events |= events; },
+        Event::FileTriggerType::Level, Event::FileReadyType::Read);
+    EXPECT_TRUE(listener_->usesIoUring());
+
+    client_ = makeSocket();
+    client_->initializeFileEvent(
+        *dispatcher_, [this](uint32_t events) { client_events_ |= events; },
+        Event::FileTriggerType::Edge, Event::FileReadyType::Read | Event::FileReadyType::Write);
+    EXPECT_TRUE(client_->usesIoUring());
+    const Api::SysCallIntResult result = client_->connect(listener_->localAddress());
+    EXPECT_EQ(-1, result.rc_);
+    EXPECT_EQ(SOCKET_ERROR_IN_PROGRESS, result.errno_);
+
+    runUntil([&]() { return listener_events != 0 && client_events_ != 0; });
+    EXPECT_EQ(Event::FileReadyType::Write, client_events_ & Event::FileReadyType::Write);
+    int error = -1;
+    socklen_t error_len = sizeof(error);
+    EXPECT_EQ(0, client_->getOption(SOL_SOCKET, SO_ERROR, &error, &error_len).rc_);
+    EXPECT_EQ(0, error);
+
+    sockaddr_storage remote_addr;
+    socklen_t remote_addr_len = sizeof(remote_addr);
+    Network::IoHandlePtr accepted =
+        listener_->accept(reinterpret_cast<sockaddr*>(&remote_addr), &remote_addr_len);
+    ASSERT_NE(nullptr, accepted);
+    EXPECT_EQ(AF_INET, remote_addr.ss_family);
+    EXPECT_EQ(nullptr, listener_->accept(reinterpret_cast<sockaddr*>(&remote_addr),
+                                         &remote_addr_len));
+    server_.reset(static_cast<IoUringSocketHandleImpl*>(accepted.release()));
+    server_->initializeFileEvent(
+        *dispatcher_, [this](uint32_t events) { server_events_ |= events; },
+        Event::FileTriggerType::Edge, Event::FileReadyType::Read | Event::FileReadyType::Write);
+    EXPECT_TRUE(server_->usesIoUring());
+    client_events_ = 0;
+  }
+
+  Api::ApiPtr api_;
+  Event::DispatcherPtr dispatcher_;
+  std::unique_ptr<IoUringWorker> worker_;
+  IoUringWorkerFactorySharedPtr factory_;
+  std::unique_ptr<IoUringSocketHandleImpl> listener_;
+  std::unique_ptr<IoUringSocketHandleImpl> client_;
+  std::unique_ptr<IoUringSocketHandleImpl> server_;
+  uint32_t client_events_{};
+  uint32_t server_events_{};
+};
+
+TEST_F(IoUringSocketHandleImplTest, ReadWrite) {
+  connect();
+
+  Buffer::OwnedImpl read_buffer;
+  EXPECT_TRUE(server_->read(read_buffer, absl::nullopt).wouldBlock());
+
+  Buffer::OwnedImpl write_buffer("hello world");
+  Api::IoCallUint64Result result = client_->write(write_buffer);
+  EXPECT_TRUE(result.ok());
+  EXPECT_EQ(11, result.rc_);
+  EXPECT_EQ(0, write_buffer.length());
+  // Only one write is in flight at a time.
+  Buffer::OwnedImpl second_buffer("again");
+  EXPECT_TRUE(client_->write(second_buffer).wouldBlock());
+  EXPECT_EQ(5, second_buffer.length());
+
+  runUntil([this]() { return (server_events_ & Event::FileReadyType::Read) != 0; });
+  result = server_->read(read_buffer, absl::nullopt);
+  EXPECT_TRUE(result.ok());
+  EXPECT_EQ("hello world", read_buffer.toString());
+  EXPECT_TRUE(server_->read(read_buffer, absl::nullopt).wouldBlock());
+
+  runUntil([this]() { return (client_events_ & Event::FileReadyType::Write) != 0; });
+  EXPECT_EQ(5, client_->write(second_buffer).rc_);
+  server_events_ = 0;
+  runUntil([this]() { return (server_events_ & Event::FileReadyType::Read) != 0; });
+  char peek[5];
+  EXPECT_EQ(5, server_->recv(peek, sizeof(peek), MSG_PEEK).rc_);
+  EXPECT_EQ("again", absl::string_view(peek, sizeof(peek)));
+  Buffer::RawSlice slice{peek, sizeof(peek)};
+  memset(peek, 0, sizeof(peek));
+  EXPECT_EQ(5, server_->readv(sizeof(peek), &slice, 1).rc_);
+  EXPECT_EQ("again", absl::string_view(peek, sizeof(peek)));
+}
+
+TEST_F(IoUringSocketHandleImplTest, PeerClose) {
+  connect();
+
+  EXPECT_TRUE(client_->close().ok());
+  runUntil([this]() { return (server_events_ & Event::FileReadyType::Read) != 0; });
+  Buffer::OwnedImpl read_buffer;
+  Api::IoCallUint64Result result = server_->read(read_buffer, absl::nullopt);
+  EXPECT_TRUE(result.ok());
+  EXPECT_EQ(0, result.rc_);
+}
+
+TEST_F(IoUringSocketHandleImplTest, CloseWithPendingWriteFlushesData) {
+  connect();
+
+  Buffer::OwnedImpl write_buffer(std::string(64 * 1024, 'a'));
+  EXPECT_EQ(64 * 1024, client_->write(write_buffer).rc_);
+  EXPECT_TRUE(client_->close().ok());
+
+  Buffer::OwnedImpl read_buffer;
+  bool eof = false;
+  runUntil([&]() {
+    Api::IoCallUint64Result result = server_->read(read_buffer, absl::nullopt);
+    eof = result.ok() && result.rc_ == 0;
+    return eof;
+  });
+  EXPECT_EQ(64 * 1024, read_buffer.length());
+}
+
+TEST_F(IoUringSocketHandleImplTest, ConnectRefused) {
+  // Grab a port nobody listens on.
+  auto reserved = makeSocket();
+  ASSERT_EQ(0,
+            reserved->bind(std::make_shared<Network::Address::Ipv4Instance>("127.0.0.1", 0)).rc_);
+  Network::Address::InstanceConstSharedPtr address = reserved->localAddress();
+  reserved->close();
+
+  client_ = makeSocket();
+  client_->initializeFileEvent(
+      *dispatcher_, [this](uint32_t events) { client_events_ |= events; },
+      Event::FileTriggerType::Edge, Event::FileReadyType::Read | Event::FileReadyType::Write);
+  client_->connect(address);
+  runUntil([this]() { return client_events_ != 0; });
+
+  int error = 0;
+  socklen_t error_len = sizeof(error);
+  EXPECT_EQ(0, client_->getOption(SOL_SOCKET, SO_ERROR, &error, &error_len).rc_);
+  EXPECT_EQ(ECONNREFUSED, error);
+}
+
+TEST_F(IoUringSocketHandleImplTest, LevelTriggeredConnectionUsesSystemCalls) {
+  auto handle = makeSocket();
+  handle->initializeFileEvent(
+      *dispatcher_, [](uint32_t) {}, Event::FileTriggerType::Level, Event::FileReadyType::Read);
+  EXPECT_FALSE(handle->usesIoUring());
+}
+
+TEST_F(IoUringSocketHandleImplTest, DatagramSocketUsesSystemCalls) {
+  const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  ASSERT_GE(fd, 0);
+  IoUringSocketHandleImpl handle(factory_, fd, false, AF_INET);
+  handle.initializeFileEvent(
+      *dispatcher_, [](uint32_t) {}, Event::FileTriggerType::Edge, Event::FileReadyType::Read);
+  EXPECT_FALSE(handle.usesIoUring());
+}
+
+} // namespace
+} // namespace IoUring
+} // namespace IoSocket
+} // namespace Extensions
+} // namespace Envoy
@@ -1086,6 +1086,12 @@ TEST_F(IoHandleImplNotImplementedTest, ErrorOnSendmsg) {
               IsInvalidAddress());
 }
 
+TEST_F(IoHandleImplNotImplementedTest, ErrorOnSendmmsg) {
+  EXPECT_THAT(io_handle_->sendmmsg(&slice_, 1, 0,
+                                   Network::Address::EnvoyInternalInstance("listener_id")),
+              IsInvalidAddress());
+}
+
 TEST_F(IoHandleImplNotImplementedTest, ErrorOnRecvmsg) {
   Network::IoHandle::RecvMsgOutput output_is_ignored(1, nullptr);
   EXPECT_THAT(io_handle_->recvmsg(&slice_, 0, 0, output_is_ignored), IsInvalidAddress());
@@ -7,6 +7,8 @@
 #include "common/network/address_impl.h"
 #include "common/network/socket_impl.h"
 #include "common/network/utility.h"
+#include "common/stats/allocator_impl.h"
+#include "common/stats/isolated_store_impl.h"
 
 #include "extensions/stat_sinks/common/statsd/statsd.h"
 
@@ -33,11 +35,19 @@ class MockWriter : public UdpStatsdSink::Writer {
 public:
   MOCK_METHOD(void, write, (const std::string& message));
   MOCK_METHOD(void, writeBuffer, (Buffer::Instance & buffer));
+  MOCK_METHOD(void, writeDatagrams, (absl::Span<const Buffer::RawSlice> datagrams));
 
   void delegateBufferFake() {
     ON_CALL(*this, writeBuffer).WillByDefault([this](Buffer::Instance& buffer) {
       this->buffer_writes.push_back(buffer.toString());
     });
+    ON_CALL(*this, writeDatagrams)
+        .WillByDefault([this](absl::Span<const Buffer::RawSlice> datagrams) {
+          for (const Buffer::RawSlice& datagram : datagrams) {
+            this->buffer_writes.emplace_back(static_cast<const char*>(datagram.mem_),
+                                             datagram.len_);
+          }
+        });
   }
 
   std::vector<std::string> buffer_writes;
@@ -116,6 +126,31 @@ TEST_P(UdpStatsdSinkTest, InitWithIpAddress) {
   tls_.shutdownThread();
 }
 
+TEST_P(UdpStatsdSinkTest, InitWithIpAddressBatchedDatagrams) {
+  Stats::IsolatedStoreImpl store;
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  NiceMock<Stats::MockMetricSnapshot> snapshot;
+  Network::Test::UdpSyncPeer server(GetParam());
+  UdpStatsdSink sink(tls_, server.localAddress(), false, getDefaultPrefix(), absl::nullopt, true);
+
+  Stats::Counter& counter = store.counterFromString("test_counter");
+  counter.inc();
+  snapshot.counters_.push_back({1, counter});
+  Stats::Gauge& gauge = store.gaugeFromString("test_gauge", Stats::Gauge::ImportMode::Accumulate);
+  gauge.set(1);
+  snapshot.gauges_.push_back(gauge);
+
+  sink.flush(snapshot);
+  Network::UdpRecvData data;
+  server.recv(data);
+  EXPECT_EQ("envoy.test_counter:1|c", data.buffer_->toString());
+  Network::UdpRecvData data2;
+  server.recv(data2);
+  EXPECT_EQ("envoy.test_gauge:1|g", data2.buffer_->toString());
+
+  tls_.shutdownThread();
+}
+
 class UdpStatsdSinkWithTagsTest : public testing::TestWithParam<Network::Address::IpVersion> {};
 INSTANTIATE_TEST_SUITE_P(IpVersions, UdpStatsdSinkWithTagsTest,
                          testing::ValuesIn(TestEnvironment::getIpVersionsForTest()),
@@ -300,6 +335,109 @@ TEST(UdpStatsdSinkTest, CheckBufferedWritesExceedingBufferSize) {
   tls_.shutdownThread();
 }
 
+// The batched mode packs the lines into the same datagrams as the buffered writes do.
+TEST(UdpStatsdSinkTest, CheckBatchedWritesExceedingBufferSize) {
+  Stats::IsolatedStoreImpl store;
+  NiceMock<Stats::MockMetricSnapshot> snapshot;
+  auto writer_ptr = std::make_shared<NiceMock<MockWriter>>();
+  writer_ptr->delegateBufferFake();
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  uint64_t buffer_size = 64;
+  UdpStatsdSink sink(tls_, writer_ptr, false, getDefaultPrefix(), buffer_size, true);
+
+  Stats::Counter& counter_1 = store.counterFromString("test_counter_1");
+  counter_1.inc();
+  snapshot.counters_.push_back({1, counter_1});
+  Stats::Counter& counter_2 = store.counterFromString("test_counter_2");
+  counter_2.inc();
+  snapshot.counters_.push_back({1, counter_2});
+  Stats::Counter& unused_counter = store.counterFromString("unused_counter");
+  snapshot.counters_.push_back({0, unused_counter});
+  Stats::Gauge& gauge = store.gaugeFromString("test_gauge", Stats::Gauge::ImportMode::Accumulate);
+  gauge.set(1);
+  snapshot.gauges_.push_back(gauge);
+  // Larger than the buffer, so that it is a datagram of its own.
+  Stats::Gauge& long_gauge = store.gaugeFromString(std::string(64, 'g'),
+                                                   Stats::Gauge::ImportMode::Accumulate);
+  long_gauge.set(2);
+  snapshot.gauges_.push_back(long_gauge);
+
+  EXPECT_CALL(*writer_ptr, writeBuffer(_)).Times(0);
+  EXPECT_CALL(*writer_ptr, writeDatagrams(_));
+  sink.flush(snapshot);
+  ASSERT_EQ(writer_ptr->buffer_writes.size(), 3);
+  EXPECT_EQ(writer_ptr->buffer_writes.at(0), "envoy.test_counter_1:1|c\nenvoy.test_counter_2:1|c");
+  EXPECT_EQ(writer_ptr->buffer_writes.at(1), "envoy.test_gauge:1|g");
+  EXPECT_EQ(writer_ptr->buffer_writes.at(2), absl::StrCat("envoy.", std::string(64, 'g'), ":2|g"));
+
+  // The cached names are used with the values of the next flush.
+  snapshot.counters_ = {{5, counter_1}};
+  gauge.set(3);
+  snapshot.gauges_ = {gauge};
+  EXPECT_CALL(*writer_ptr, writeDatagrams(_));
+  sink.flush(snapshot);
+  ASSERT_EQ(writer_ptr->buffer_writes.size(), 4);
+  EXPECT_EQ(writer_ptr->buffer_writes.at(3), "envoy.test_counter_1:5|c\nenvoy.test_gauge:3|g");
+
+  tls_.shutdownThread();
+}
+
+TEST(UdpStatsdSinkTest, CheckBatchedWritesOneMetricPerDatagram) {
+  Stats::IsolatedStoreImpl store;
+  Stats::AllocatorImpl allocator(store.symbolTable());
+  NiceMock<Stats::MockMetricSnapshot> snapshot;
+  auto writer_ptr = std::make_shared<NiceMock<MockWriter>>();
+  writer_ptr->delegateBufferFake();
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  UdpStatsdSink sink(tls_, writer_ptr, true, getDefaultPrefix(), absl::nullopt, true);
+
+  Stats::StatNamePool pool(store.symbolTable());
+  const Stats::StatNameTagVector tags{{pool.add("node"), pool.add("test")}};
+  std::vector<Stats::CounterSharedPtr> counters;
+  for (uint64_t i = 0; i < 100; ++i) {
+    const Stats::StatName name = pool.add(absl::StrCat("test_counter_", i, ".node.test"));
+    const Stats::StatName tag_extracted_name = pool.add(absl::StrCat("test_counter_", i));
+    counters.push_back(allocator.makeCounter(name, tag_extracted_name, tags));
+    counters.back()->add(i + 1);
+    snapshot.counters_.push_back({i + 1, *counters.back()});
+  }
+
+  // The datagrams are written in batches.
+  EXPECT_CALL(*writer_ptr, writeDatagrams(_)).Times(2);
+  sink.flush(snapshot);
+  ASSERT_EQ(writer_ptr->buffer_writes.size(), 100);
+  for (uint64_t i = 0; i < 100; ++i) {
+    EXPECT_EQ(writer_ptr->buffer_writes.at(i),
+              absl::StrCat("envoy.test_counter_", i, ":", i + 1, "|c|#node:test"));
+  }
+
+  tls_.shutdownThread();
+}
+
+// The cached metrics are referenced until a flush which does not include them.
+TEST(UdpStatsdSinkTest, CheckBatchedWritesReleaseMetrics) {
+  Stats::IsolatedStoreImpl store;
+  NiceMock<Stats::MockMetricSnapshot> snapshot;
+  auto writer_ptr = std::make_shared<NiceMock<MockWriter>>();
+  writer_ptr->delegateBufferFake();
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  UdpStatsdSink sink(tls_, writer_ptr, false, getDefaultPrefix(), 1024, true);
+
+  Stats::Counter& counter = store.counterFromString("test_counter");
+  counter.inc();
+  const uint32_t use_count = counter.use_count();
+  snapshot.counters_.push_back({1, counter});
+  sink.flush(snapshot);
+  EXPECT_EQ(use_count + 1, counter.use_count());
+
+  snapshot.counters_.clear();
+  sink.flush(snapshot);
+  EXPECT_EQ(use_count, counter.use_count());
+  EXPECT_EQ(writer_ptr->buffer_writes, std::vector<std::string>{"envoy.test_counter:1|c"});
+
+  tls_.shutdownThread();
+}
+
 TEST(UdpStatsdSinkTest, CheckActualStatsWithCustomPrefix) {
   NiceMock<Stats::MockMetricSnapshot> snapshot;
   auto writer_ptr = std::make_shared<NiceMock<MockWriter>>();
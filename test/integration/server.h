@@ -360,6 +360,18 @@ public:
     Thread::LockGuard lock(lock_);
     return store_.textReadouts();
   }
+  std::vector<CounterSharedPtr> countersMatching(const StatNameFilter& filter) override {
+    Thread::LockGuard lock(lock_);
+    return store_.countersMatching(filter);
+  }
+  std::vector<GaugeSharedPtr> gaugesMatching(const StatNameFilter& filter) override {
+    Thread::LockGuard lock(lock_);
+    return store_.gaugesMatching(filter);
+  }
+  std::vector<TextReadoutSharedPtr> textReadoutsMatching(const StatNameFilter& filter) override {
+    Thread::LockGuard lock(lock_);
+    return store_.textReadoutsMatching(filter);
+  }
 
   bool iterate(const IterateFn<Counter>& fn) const override { return store_.iterate(fn); }
   bool iterate(const IterateFn<Gauge>& fn) const override { return store_.iterate(fn); }
@@ -371,6 +383,7 @@ public:
   void setTagProducer(TagProducerPtr&&) override {}
   void setStatsMatcher(StatsMatcherPtr&&) override {}
   void setHistogramSettings(HistogramSettingsConstPtr&&) override {}
+  void setStripedCounters(const std::vector<std::string>&, uint32_t) override {}
   void initializeThreading(Event::Dispatcher&, ThreadLocal::Instance&) override {}
   void shutdownThreading() override {}
   void mergeHistograms(PostMergeCb cb) override { merge_cb_ = cb; }
@@ -76,6 +76,8 @@ public:
   MOCK_METHOD(SysCallIntResult, close, (os_fd_t));
   MOCK_METHOD(SysCallSizeResult, writev, (os_fd_t, const iovec*, int));
   MOCK_METHOD(SysCallSizeResult, sendmsg, (os_fd_t fd, const msghdr* msg, int flags));
+  MOCK_METHOD(SysCallIntResult, sendmmsg,
+              (os_fd_t fd, struct mmsghdr* msgvec, unsigned int vlen, int flags));
   MOCK_METHOD(SysCallSizeResult, readv, (os_fd_t, const iovec*, int));
   MOCK_METHOD(SysCallSizeResult, recv, (os_fd_t socket, void* buffer, size_t length, int flags));
   MOCK_METHOD(SysCallSizeResult, recvmsg, (os_fd_t socket, msghdr* msg, int flags));
@@ -117,6 +119,8 @@ class MockLinuxOsSysCalls : public LinuxOsSysCallsImpl {
 public:
   // Api::LinuxOsSysCalls
   MOCK_METHOD(SysCallIntResult, sched_getaffinity, (pid_t pid, size_t cpusetsize, cpu_set_t* mask));
+  MOCK_METHOD(SysCallIntResult, pipe2, (int pipefd[2], int flags));
+  MOCK_METHOD(SysCallSizeResult, splice, (int fd_in, int fd_out, size_t len, unsigned int flags));
 };
 #endif
 
@@ -27,4 +27,7 @@ template <> MockBufferBase<Buffer::OwnedImpl>::MockBufferBase() : Buffer::OwnedI
 MockBufferFactory::MockBufferFactory() = default;
 MockBufferFactory::~MockBufferFactory() = default;
 
+MockReadReservationPolicy::MockReadReservationPolicy() = default;
+MockReadReservationPolicy::~MockReadReservationPolicy() = default;
+
 } // namespace Envoy
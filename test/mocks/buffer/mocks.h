@@ -86,6 +86,15 @@ public:
                std::function<void()> above_overflow));
 };
 
+class MockReadReservationPolicy : public Buffer::ReadReservationPolicy {
+public:
+  MockReadReservationPolicy();
+  ~MockReadReservationPolicy() override;
+
+  MOCK_METHOD(uint64_t, readReservationLength, (), (const));
+  MOCK_METHOD(void, onReadCommitted, (uint64_t reserved, uint64_t committed));
+};
+
 MATCHER_P(BufferEqual, rhs, testing::PrintToString(*rhs)) {
   return TestUtility::buffersEqual(arg, *rhs);
 }
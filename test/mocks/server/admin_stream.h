@@ -14,6 +14,7 @@ public:
   ~MockAdminStream() override;
 
   MOCK_METHOD(void, setEndStreamOnComplete, (bool));
+  MOCK_METHOD(void, setResponseChunks, (ResponseChunkFn));
   MOCK_METHOD(void, addOnDestroyCallback, (std::function<void()>));
   MOCK_METHOD(const Buffer::Instance*, getRequestBody, (), (const));
   MOCK_METHOD(Http::RequestHeaderMap&, getRequestHeaders, (), (const));
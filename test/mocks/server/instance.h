@@ -136,6 +136,8 @@ public:
   MOCK_METHOD(const std::list<Stats::SinkPtr>&, sinks, (), (const));
   MOCK_METHOD(std::chrono::milliseconds, flushInterval, (), (const));
   MOCK_METHOD(bool, flushOnAdmin, (), (const));
+  MOCK_METHOD(bool, flushSnapshotOnThread, (), (const));
+  MOCK_METHOD(bool, flushDeltasOnly, (), (const));
 };
 
 class MockServerFactoryContext : public virtual ServerFactoryContext {
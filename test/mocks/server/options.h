@@ -47,6 +47,7 @@ public:
   MOCK_METHOD(bool, hotRestartDisabled, (), (const));
   MOCK_METHOD(bool, signalHandlingEnabled, (), (const));
   MOCK_METHOD(bool, mutexTracingEnabled, (), (const));
+  MOCK_METHOD(bool, concurrentSymbolTableEnabled, (), (const));
   MOCK_METHOD(bool, coreDumpEnabled, (), (const));
   MOCK_METHOD(bool, cpusetThreadsEnabled, (), (const));
   MOCK_METHOD(const std::vector<std::string>&, disabledExtensions, (), (const));
@@ -72,6 +73,7 @@ public:
   bool hot_restart_disabled_{};
   bool signal_handling_enabled_{true};
   bool mutex_tracing_enabled_{};
+  bool concurrent_symbol_table_enabled_{};
   bool core_dump_enabled_{};
   bool cpuset_threads_enabled_{};
   std::vector<std::string> disabled_extensions_;
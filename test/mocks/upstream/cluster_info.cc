@@ -40,11 +40,17 @@ MockClusterInfo::MockClusterInfo()
     : http2_options_(::Envoy::Http2::Utility::initializeAndValidateOptions(
           envoy::config::core::v3::Http2ProtocolOptions())),
       stat_names_(stats_store_.symbolTable()),
+      config_update_stat_names_(stats_store_.symbolTable()),
+      endpoint_stat_names_(stats_store_.symbolTable()), lb_stat_names_(stats_store_.symbolTable()),
       cluster_load_report_stat_names_(stats_store_.symbolTable()),
       cluster_circuit_breakers_stat_names_(stats_store_.symbolTable()),
       cluster_request_response_size_stat_names_(stats_store_.symbolTable()),
       cluster_timeout_budget_stat_names_(stats_store_.symbolTable()),
       stats_(ClusterInfoImpl::generateStats(stats_store_, stat_names_)),
+      config_update_stats_(
+          ClusterInfoImpl::generateConfigUpdateStats(stats_store_, config_update_stat_names_)),
+      endpoint_stats_(ClusterInfoImpl::generateEndpointStats(stats_store_, endpoint_stat_names_)),
+      lb_stats_(ClusterInfoImpl::generateLbStats(stats_store_, lb_stat_names_)),
       transport_socket_matcher_(new NiceMock<Upstream::MockTransportSocketMatcher>()),
       load_report_stats_(ClusterInfoImpl::generateLoadReportStats(load_report_stats_store_,
                                                                   cluster_load_report_stat_names_)),
@@ -77,6 +83,10 @@ MockClusterInfo::MockClusterInfo()
   ON_CALL(*this, maxRequestsPerConnection())
       .WillByDefault(ReturnPointee(&max_requests_per_connection_));
   ON_CALL(*this, stats()).WillByDefault(ReturnRef(stats_));
+  ON_CALL(*this, readOnlyStats()).WillByDefault(ReturnRef(stats_));
+  ON_CALL(*this, configUpdateStats()).WillByDefault(ReturnRef(config_update_stats_));
+  ON_CALL(*this, endpointStats()).WillByDefault(ReturnRef(endpoint_stats_));
+  ON_CALL(*this, lbStats()).WillByDefault(ReturnRef(lb_stats_));
   ON_CALL(*this, statsScope()).WillByDefault(ReturnRef(stats_store_));
   // TODO(incfly): The following is a hack because it's not possible to directly embed
   // a mock transport socket factory matcher due to circular dependencies. Fix this up in a follow
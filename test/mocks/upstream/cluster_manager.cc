@@ -17,7 +17,9 @@ using ::testing::ReturnRef;
 MockClusterManager::MockClusterManager(TimeSource&) : MockClusterManager() {}
 
 MockClusterManager::MockClusterManager()
-    : cluster_stat_names_(*symbol_table_), cluster_load_report_stat_names_(*symbol_table_),
+    : cluster_stat_names_(*symbol_table_), cluster_config_update_stat_names_(*symbol_table_),
+      cluster_endpoint_stat_names_(*symbol_table_), cluster_lb_stat_names_(*symbol_table_),
+      cluster_load_report_stat_names_(*symbol_table_),
       cluster_circuit_breakers_stat_names_(*symbol_table_),
       cluster_request_response_size_stat_names_(*symbol_table_),
       cluster_timeout_budget_stat_names_(*symbol_table_) {
@@ -50,6 +50,7 @@ public:
   void setOverprovisioningFactor(const uint32_t overprovisioning_factor) {
     overprovisioning_factor_ = overprovisioning_factor;
   }
+  bool deltaOnly() const override { return delta_only_; }
 
   HostVector hosts_;
   HostVector healthy_hosts_;
@@ -63,6 +64,7 @@ public:
   Common::CallbackManager<uint32_t, const HostVector&, const HostVector&> member_update_cb_helper_;
   uint32_t priority_{};
   uint32_t overprovisioning_factor_{};
+  bool delta_only_{};
   bool run_in_panic_mode_ = false;
 };
 } // namespace Upstream
@@ -1,5 +1,7 @@
 #include "server/admin/admin_filter.h"
 
+#include "test/mocks/buffer/mocks.h"
+#include "test/mocks/event/mocks.h"
 #include "test/mocks/server/instance.h"
 #include "test/test_common/environment.h"
 
@@ -7,6 +9,7 @@
 #include "gtest/gtest.h"
 
 using testing::InSequence;
+using testing::Invoke;
 using testing::NiceMock;
 
 namespace Envoy {
@@ -77,5 +80,70 @@ TEST_P(AdminFilterTest, Trailers) {
   EXPECT_EQ(Http::FilterTrailersStatus::StopIteration, filter_.decodeTrailers(request_trailers));
 }
 
+TEST_P(AdminFilterTest, ResponseChunks) {
+  std::vector<std::string> chunks{"b", "c"};
+  AdminFilter filter([&chunks](absl::string_view, Http::ResponseHeaderMap&,
+                               Buffer::OwnedImpl& response, AdminFilter& filter) {
+    response.add("a");
+    filter.setResponseChunks([&chunks](Buffer::Instance& chunk) {
+      chunk.add(chunks.front());
+      chunks.erase(chunks.begin());
+      return !chunks.empty();
+    });
+    return Http::Code::OK;
+  });
+  filter.setDecoderFilterCallbacks(callbacks_);
+  auto* next_chunk = new NiceMock<Event::MockSchedulableCallback>(&callbacks_.dispatcher_);
+
+  // The handler's response is encoded right away, and the chunks on the following iterations of
+  // the event loop.
+  EXPECT_CALL(callbacks_, encodeHeaders_(_, false));
+  EXPECT_CALL(callbacks_, encodeData(BufferStringEqual("a"), false));
+  EXPECT_CALL(callbacks_, addDownstreamWatermarkCallbacks(_));
+  filter.decodeHeaders(request_headers_, true);
+  EXPECT_TRUE(next_chunk->enabled_);
+
+  // Chunks are paused while the downstream is over its high watermark.
+  EXPECT_CALL(callbacks_, encodeData(BufferStringEqual("b"), false))
+      .WillOnce(Invoke([&filter](Buffer::Instance&, bool) {
+        filter.onAboveWriteBufferHighWatermark();
+        filter.onAboveWriteBufferHighWatermark();
+      }));
+  next_chunk->invokeCallback();
+  EXPECT_FALSE(next_chunk->enabled_);
+  filter.onBelowWriteBufferLowWatermark();
+  EXPECT_FALSE(next_chunk->enabled_);
+  filter.onBelowWriteBufferLowWatermark();
+  EXPECT_TRUE(next_chunk->enabled_);
+
+  // The last chunk ends the stream.
+  EXPECT_CALL(callbacks_, removeDownstreamWatermarkCallbacks(_));
+  EXPECT_CALL(callbacks_, encodeData(BufferStringEqual("c"), true));
+  next_chunk->invokeCallback();
+  EXPECT_FALSE(next_chunk->enabled_);
+  EXPECT_TRUE(chunks.empty());
+}
+
+TEST_P(AdminFilterTest, ResponseChunksDroppedOnDestroy) {
+  bool called = false;
+  AdminFilter filter([&called](absl::string_view, Http::ResponseHeaderMap&, Buffer::OwnedImpl&,
+                               AdminFilter& filter) {
+    filter.setResponseChunks([&called](Buffer::Instance&) {
+      called = true;
+      return false;
+    });
+    return Http::Code::OK;
+  });
+  filter.setDecoderFilterCallbacks(callbacks_);
+  new NiceMock<Event::MockSchedulableCallback>(&callbacks_.dispatcher_);
+
+  EXPECT_CALL(callbacks_, encodeHeaders_(_, false));
+  EXPECT_CALL(callbacks_, addDownstreamWatermarkCallbacks(_));
+  filter.decodeHeaders(request_headers_, true);
+  EXPECT_CALL(callbacks_, removeDownstreamWatermarkCallbacks(_));
+  filter.onDestroy();
+  EXPECT_FALSE(called);
+}
+
 } // namespace Server
 } // namespace Envoy
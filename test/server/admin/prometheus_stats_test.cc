@@ -701,5 +701,47 @@ envoy_cluster_test_1_upstream_cx_total{a_tag_name="a.tag-value"} 0
   EXPECT_EQ(expected_output, response.toString());
 }
 
+// Rendering in chunks produces the same output as rendering in one pass, and does not split the
+// metrics sharing a tag-extracted name.
+TEST_F(PrometheusStatsFormatterTest, RenderInChunks) {
+  for (int i = 0; i < 5; ++i) {
+    addCounter(absl::StrCat("cluster.test_", i, ".upstream_cx_total"),
+               {{makeStat("a.tag-name"), makeStat("a.tag-value")}});
+    addCounter(absl::StrCat("cluster.test_", i, ".upstream_cx_total"),
+               {{makeStat("another_tag_name"), makeStat("another_tag-value")}});
+    addGauge(absl::StrCat("cluster.test_", i, ".upstream_cx_active"),
+             {{makeStat("a.tag-name"), makeStat("a.tag-value")}});
+  }
+  HistogramWrapper h1_cumulative;
+  h1_cumulative.setHistogramValues({50, 20, 30});
+  Stats::HistogramStatisticsImpl h1_cumulative_statistics(h1_cumulative.getHistogram());
+  auto histogram = makeHistogram("cluster.test_1.upstream_rq_time", {});
+  ON_CALL(*histogram, cumulativeStatistics()).WillByDefault(ReturnRef(h1_cumulative_statistics));
+  addHistogram(histogram);
+
+  Buffer::OwnedImpl expected;
+  EXPECT_EQ(11UL, PrometheusStatsFormatter::statsAsPrometheus(counters_, gauges_, histograms_,
+                                                              expected, false, absl::nullopt));
+
+  PrometheusStatsRenderer renderer(std::vector<Stats::CounterSharedPtr>(counters_),
+                                   std::vector<Stats::GaugeSharedPtr>(gauges_),
+                                   std::vector<Stats::ParentHistogramSharedPtr>(histograms_),
+                                   false, absl::nullopt);
+  std::string actual;
+  uint64_t chunks = 0;
+  bool more = true;
+  while (more) {
+    Buffer::OwnedImpl chunk;
+    more = renderer.nextChunk(chunk, 1);
+    const std::string chunk_str = chunk.toString();
+    EXPECT_EQ(1, std::count(chunk_str.begin(), chunk_str.end(), '#')) << chunk_str;
+    actual += chunk_str;
+    ++chunks;
+  }
+  EXPECT_EQ(11UL, chunks);
+  EXPECT_EQ(11UL, renderer.metricNameCount());
+  EXPECT_EQ(expected.toString(), actual);
+}
+
 } // namespace Server
 } // namespace Envoy
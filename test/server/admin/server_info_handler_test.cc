@@ -59,6 +59,25 @@ TEST_P(AdminInstanceTest, Memory) {
                                   Property(&envoy::admin::v3::Memory::pageheap_unmapped, Ge(0)),
                                   Property(&envoy::admin::v3::Memory::pageheap_free, Ge(0)),
                                   Property(&envoy::admin::v3::Memory::total_thread_cache, Ge(0))));
+  EXPECT_FALSE(output_proto.has_lazy_cluster_stats());
+}
+
+TEST_P(AdminInstanceTest, MemoryLazyClusterStats) {
+  server_.cluster_manager_.initializeClusters({"idle", "busy"}, {});
+  // The idle cluster still reports the placeholder as its read-only stats.
+  const Upstream::ClusterStats& placeholder =
+      server_.cluster_manager_.active_clusters_["idle"]->info_->stats_;
+  ON_CALL(server_.cluster_manager_, clusterStatsPlaceholder()).WillByDefault(Return(&placeholder));
+  ON_CALL(server_.cluster_manager_, lazyClusterStatsBytes()).WillByDefault(Return(1000));
+
+  Http::TestResponseHeaderMapImpl header_map;
+  Buffer::OwnedImpl response;
+  EXPECT_EQ(Http::Code::OK, getCallback("/memory", header_map, response));
+  envoy::admin::v3::Memory output_proto;
+  TestUtility::loadFromJson(response.toString(), output_proto);
+  EXPECT_EQ(1, output_proto.lazy_cluster_stats().idle_clusters());
+  EXPECT_EQ(1000, output_proto.lazy_cluster_stats().bytes_per_cluster());
+  EXPECT_EQ(1000, output_proto.lazy_cluster_stats().bytes_saved());
 }
 
 TEST_P(AdminInstanceTest, GetReadyRequest) {
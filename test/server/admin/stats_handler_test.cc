@@ -3,6 +3,7 @@
 #include "common/stats/thread_local_store.h"
 
 #include "server/admin/stats_handler.h"
+#include "server/admin/utils.h"
 
 #include "test/server/admin/admin_instance.h"
 #include "test/test_common/logging.h"
@@ -11,6 +12,7 @@
 using testing::EndsWith;
 using testing::HasSubstr;
 using testing::InSequence;
+using testing::Not;
 using testing::Ref;
 using testing::StartsWith;
 
@@ -540,6 +542,65 @@ TEST_P(AdminInstanceTest, PrometheusStatsInvalidRegex) {
   EXPECT_THAT(data.toString(), EndsWith("\"\n"));
 }
 
+// Filters beginning with a literal are answered from the store's index of stat names, and select
+// the same stats as matching the regex against every stat.
+TEST_P(AdminInstanceTest, StatsFilterIndexed) {
+  Stats::Store& store = server_.stats();
+  store.counterFromString("cluster.a.rq").inc();
+  store.counterFromString("cluster.b.rq");
+  store.counterFromString("listener.rq").inc();
+  store.gaugeFromString("cluster.a.cx", Stats::Gauge::ImportMode::Accumulate).set(3);
+  store.textReadoutFromString("cluster.a.version").set("1");
+
+  const auto stats = [this](absl::string_view path) {
+    Http::TestResponseHeaderMapImpl header_map;
+    Buffer::OwnedImpl data;
+    EXPECT_EQ(Http::Code::OK, getCallback(path, header_map, data));
+    return data.toString();
+  };
+  EXPECT_EQ("cluster.a.version: \"1\"\ncluster.a.cx: 3\ncluster.a.rq: 1\n",
+            stats("/stats?filter=^cluster\\.a\\."));
+  EXPECT_EQ("cluster.b.rq: 0\n", stats("/stats?filter=cluster\\.b"));
+  EXPECT_EQ("cluster.a.rq: 1\nlistener.rq: 1\n", stats("/stats?filter=\\.rq$&usedonly"));
+  EXPECT_EQ("cluster.a.rq: 1\n", stats("/stats?filter=^cluster.a.rq$"));
+  // An alternation may match names without the literal, so it is matched against every stat.
+  EXPECT_EQ("cluster.b.rq: 0\nlistener.rq: 1\n", stats("/stats?filter=^listener\\.rq|cluster\\.b"));
+
+  const std::string prometheus = stats("/stats?format=prometheus&filter=^cluster\\.a\\.");
+  EXPECT_THAT(prometheus, HasSubstr("envoy_cluster_a_rq{} 1\n"));
+  EXPECT_THAT(prometheus, HasSubstr("envoy_cluster_a_cx{} 3\n"));
+  EXPECT_THAT(prometheus, Not(HasSubstr("cluster_b")));
+}
+
+TEST(StatsHandlerUtilityTest, StatNameFilter) {
+  const auto filter = [](absl::string_view pattern) -> absl::optional<Stats::StatNameFilter> {
+    Stats::StatNameFilter filter;
+    if (!Utility::statNameFilter(pattern, filter)) {
+      return absl::nullopt;
+    }
+    return filter;
+  };
+  EXPECT_EQ("cluster.foo.", filter("^cluster\\.foo\\.").value().prefix_);
+  EXPECT_EQ("", filter("^cluster\\.foo\\.").value().substring_);
+  EXPECT_EQ("cluster", filter("^cluster.foo").value().prefix_);
+  EXPECT_EQ("server.version", filter("^server\\.version$").value().prefix_);
+  EXPECT_EQ("upstream_rq_5xx", filter("upstream_rq_5xx").value().substring_);
+  EXPECT_EQ("", filter("upstream_rq_5xx").value().prefix_);
+  EXPECT_EQ("upstream_rq", filter("upstream_rq(_5xx)?").value().substring_);
+  // The character before a quantifier may not be in the name.
+  EXPECT_EQ("clust", filter("^cluste?r").value().prefix_);
+  EXPECT_EQ("a", filter("^a\\.*b").value().prefix_);
+  EXPECT_EQ("a", filter("^a(b|c)").value().prefix_);
+  EXPECT_EQ("a", filter("^a[|]").value().prefix_);
+
+  EXPECT_FALSE(filter(".*").has_value());
+  EXPECT_FALSE(filter("^\\d+").has_value());
+  EXPECT_FALSE(filter("a|b").has_value());
+  EXPECT_FALSE(filter("^a|b").has_value());
+  EXPECT_FALSE(filter("(a)").has_value());
+  EXPECT_FALSE(filter("").has_value());
+}
+
 TEST_P(AdminInstanceTest, TracingStatsDisabled) {
   const std::string& name = admin_.tracingStats().service_forced_.name();
   for (const Stats::CounterSharedPtr& counter : server_.stats().counters()) {
@@ -155,6 +155,43 @@ TEST_F(ConfigurationImplTest, StatsOnAdmin) {
   config.initialize(bootstrap, server_, cluster_manager_factory_);
 
   EXPECT_TRUE(config.statsConfig().flushOnAdmin());
+  EXPECT_FALSE(config.statsConfig().flushSnapshotOnThread());
+  EXPECT_FALSE(config.statsConfig().flushDeltasOnly());
+}
+
+TEST_F(ConfigurationImplTest, StatsFlushSnapshotOnThread) {
+  std::string json = R"EOF(
+  {
+    "stats_flush_snapshot_on_thread": true,
+    "stats_flush_deltas_only": true,
+
+    "admin": {
+      "access_log": [
+        {
+          "name": "envoy.access_loggers.file",
+          "typed_config": {
+            "@type": "type.googleapis.com/envoy.extensions.access_loggers.file.v3.FileAccessLog",
+            "path": "/dev/null"
+          }
+        }
+      ],
+      "address": {
+        "socket_address": {
+          "address": "1.2.3.4",
+          "port_value": 5678
+        }
+      }
+    }
+  }
+  )EOF";
+
+  auto bootstrap = Upstream::parseBootstrapFromV3Json(json);
+
+  MainImpl config;
+  config.initialize(bootstrap, server_, cluster_manager_factory_);
+
+  EXPECT_TRUE(config.statsConfig().flushSnapshotOnThread());
+  EXPECT_TRUE(config.statsConfig().flushDeltasOnly());
 }
 
 TEST_F(ConfigurationImplTest, NegativeStatsOnAdmin) {
@@ -94,7 +94,7 @@ TEST_F(OptionsImplTest, All) {
       "--log-path "
       "/foo/bar "
       "--disable-hot-restart --cpuset-threads --allow-unknown-static-fields "
-      "--reject-unknown-dynamic-fields --base-id 5 "
+      "--reject-unknown-dynamic-fields --concurrent-symbol-table --base-id 5 "
       "--use-dynamic-base-id --base-id-path /foo/baz "
       "--socket-path /foo/envoy_domain_socket --socket-mode 644");
   EXPECT_EQ(Server::Mode::Validate, options->mode());
@@ -118,6 +118,7 @@ TEST_F(OptionsImplTest, All) {
   EXPECT_TRUE(options->cpusetThreadsEnabled());
   EXPECT_TRUE(options->allowUnknownStaticFields());
   EXPECT_TRUE(options->rejectUnknownDynamicFields());
+  EXPECT_TRUE(options->concurrentSymbolTableEnabled());
   EXPECT_EQ(5U, options->baseId());
   EXPECT_TRUE(options->useDynamicBaseId());
   EXPECT_EQ("/foo/baz", options->baseIdPath());
@@ -262,6 +263,7 @@ TEST_F(OptionsImplTest, DefaultParams) {
   EXPECT_EQ(0, options->socketMode());
   EXPECT_FALSE(options->hotRestartDisabled());
   EXPECT_FALSE(options->cpusetThreadsEnabled());
+  EXPECT_FALSE(options->concurrentSymbolTableEnabled());
 
   // Validate that CommandLineOptions is constructed correctly with default params.
   Server::CommandLineOptionsPtr command_line_options = options->toCommandLineOptions();
@@ -44,6 +44,7 @@ using testing::InSequence;
 using testing::Invoke;
 using testing::InvokeWithoutArgs;
 using testing::Return;
+using testing::ReturnRef;
 using testing::SaveArg;
 using testing::StrictMock;
 
@@ -100,6 +101,81 @@ TEST(ServerInstanceUtil, flushHelper) {
   InstanceUtil::flushMetricsToSinks(sinks, mock_store, time_system);
 }
 
+TEST(ServerInstanceUtil, DeltaSnapshot) {
+  Stats::TestUtil::TestStore store;
+  Event::SimulatedTimeSystem time_system;
+  Stats::Counter& c1 = store.counter("c1");
+  Stats::Counter& c2 = store.counter("c2");
+  Stats::Gauge& g1 = store.gauge("g1", Stats::Gauge::ImportMode::Accumulate);
+  Stats::Gauge& g2 = store.gauge("g2", Stats::Gauge::ImportMode::Accumulate);
+  Stats::TextReadout& t1 = store.textReadout("t1");
+  Stats::TextReadout& t2 = store.textReadout("t2");
+  c1.inc();
+  g1.set(5);
+  t1.set("one");
+
+  MetricSnapshotImpl::FlushedValues flushed_values;
+  {
+    // Every gauge and text readout is new to the first snapshot.
+    MetricSnapshotImpl snapshot(store, time_system, flushed_values);
+    ASSERT_EQ(1, snapshot.counters().size());
+    EXPECT_EQ("c1", snapshot.counters()[0].counter_.get().name());
+    EXPECT_EQ(1, snapshot.counters()[0].delta_);
+    EXPECT_EQ(2, snapshot.gauges().size());
+    EXPECT_EQ(2, snapshot.textReadouts().size());
+  }
+
+  c2.add(3);
+  g2.set(7);
+  t2.set("two");
+  {
+    MetricSnapshotImpl snapshot(store, time_system, flushed_values);
+    ASSERT_EQ(1, snapshot.counters().size());
+    EXPECT_EQ("c2", snapshot.counters()[0].counter_.get().name());
+    EXPECT_EQ(3, snapshot.counters()[0].delta_);
+    ASSERT_EQ(1, snapshot.gauges().size());
+    EXPECT_EQ("g2", snapshot.gauges()[0].get().name());
+    ASSERT_EQ(1, snapshot.textReadouts().size());
+    EXPECT_EQ("t2", snapshot.textReadouts()[0].get().name());
+  }
+
+  // Setting a gauge to the value it was flushed with does not make it part of the delta.
+  g1.set(6);
+  g1.set(5);
+  {
+    MetricSnapshotImpl snapshot(store, time_system, flushed_values);
+    EXPECT_TRUE(snapshot.counters().empty());
+    EXPECT_TRUE(snapshot.gauges().empty());
+    EXPECT_TRUE(snapshot.textReadouts().empty());
+  }
+
+  // A full snapshot still has everything, and latches the counters.
+  c1.inc();
+  MetricSnapshotImpl snapshot(store, time_system);
+  EXPECT_EQ(2, snapshot.counters().size());
+  EXPECT_EQ(2, snapshot.gauges().size());
+  EXPECT_EQ(2, snapshot.textReadouts().size());
+  EXPECT_EQ(0, c1.latch());
+
+  // Histograms are only part of the delta if they were recorded into in the last interval.
+  NiceMock<Stats::MockStore> mock_store;
+  auto* recorded = new NiceMock<Stats::MockParentHistogram>();
+  Stats::ParentHistogramSharedPtr recorded_histogram(recorded);
+  Stats::ParentHistogramSharedPtr idle_histogram(new NiceMock<Stats::MockParentHistogram>());
+  Stats::HistogramStatisticsImpl recorded_statistics;
+  histogram_t* values = hist_alloc();
+  hist_insert_intscale(values, 1, 0, 1);
+  recorded_statistics.refresh(values);
+  hist_free(values);
+  ON_CALL(*recorded, intervalStatistics()).WillByDefault(ReturnRef(recorded_statistics));
+  std::vector<Stats::ParentHistogramSharedPtr> parent_histograms = {recorded_histogram,
+                                                                   idle_histogram};
+  ON_CALL(mock_store, histograms).WillByDefault(Return(parent_histograms));
+  MetricSnapshotImpl histogram_snapshot(mock_store, time_system, flushed_values);
+  ASSERT_EQ(1, histogram_snapshot.histograms().size());
+  EXPECT_EQ(recorded, &histogram_snapshot.histograms()[0].get());
+}
+
 class RunHelperTest : public testing::Test {
 public:
   RunHelperTest() {
@@ -351,6 +427,25 @@ TEST_P(ServerInstanceImplTest, StatsFlushWhenServerIsStillInitializing) {
   server_thread->join();
 }
 
+// Validates that stats are flushed to the sinks when the snapshots are taken on the flush thread.
+TEST_P(ServerInstanceImplTest, StatsFlushSnapshotOnThread) {
+  CustomStatsSinkFactory factory;
+  Registry::InjectFactory<Server::Configuration::StatsSinkFactory> registered(factory);
+  options_.bootstrap_version_ = 3;
+
+  auto server_thread =
+      startTestServer("test/server/test_data/server/stats_sink_flush_thread_bootstrap.yaml", true);
+  EXPECT_TRUE(server_->statsConfig().flushSnapshotOnThread());
+  EXPECT_TRUE(server_->statsConfig().flushDeltasOnly());
+
+  // The timer is only re-enabled once the sinks have been called back on the main thread.
+  TestUtility::waitForCounterEq(stats_store_, "stats.flushed", 1, time_system_);
+  TestUtility::waitForCounterEq(stats_store_, "stats.flushed", 2, time_system_);
+
+  server_->dispatcher().post([&] { server_->shutdown(); });
+  server_thread->join();
+}
+
 // Validates that the "server.version" is updated with stats_server_version_override from bootstrap.
 TEST_P(ServerInstanceImplTest, ProxyVersionOveridesFromBootstrap) {
   auto server_thread =
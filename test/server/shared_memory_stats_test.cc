@@ -0,0 +1,168 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "common/stats/isolated_store_impl.h"
+
+#include "server/shared_memory_stats.h"
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Server {
+namespace {
+
+// Reads a region the way a collector would, from a separate read-only mapping.
+class Collector {
+public:
+  explicit Collector(const std::string& name) {
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    RELEASE_ASSERT(fd != -1, "");
+    SharedMemoryStatsHeader header;
+    RELEASE_ASSERT(::read(fd, &header, sizeof(header)) == sizeof(header), "");
+    size_ = header.region_size_;
+    region_ = static_cast<char*>(mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0));
+    RELEASE_ASSERT(region_ != MAP_FAILED, "");
+    close(fd);
+  }
+  ~Collector() { munmap(region_, size_); }
+
+  const SharedMemoryStatsHeader& header() const {
+    return *reinterpret_cast<const SharedMemoryStatsHeader*>(region_);
+  }
+
+  // Returns the stats by name, with their types, following the seqlock protocol.
+  std::map<std::string, std::pair<SharedMemoryStatsType, uint64_t>> readStats() const {
+    while (true) {
+      const uint64_t sequence = header().sequence_.load(std::memory_order_acquire);
+      if (sequence % 2 == 1) {
+        continue;
+      }
+      std::map<std::string, std::pair<SharedMemoryStatsType, uint64_t>> stats;
+      const auto* entries =
+          reinterpret_cast<const SharedMemoryStatsEntry*>(region_ + header().entries_offset_);
+      const char* names = region_ + header().names_offset_;
+      for (uint64_t i = 0; i < header().num_entries_; ++i) {
+        stats[std::string(names + entries[i].name_offset_, entries[i].name_length_)] = {
+            static_cast<SharedMemoryStatsType>(entries[i].type_), entries[i].value_};
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (header().sequence_.load(std::memory_order_relaxed) == sequence) {
+        return stats;
+      }
+    }
+  }
+
+private:
+  char* region_;
+  size_t size_;
+};
+
+class SharedMemoryStatsTest : public testing::Test {
+protected:
+  SharedMemoryStatsTest() : name_(absl::StrCat("/envoy_shared_memory_stats_test_", getpid())) {}
+
+  const std::string name_;
+  Stats::IsolatedStoreImpl store_;
+};
+
+TEST_F(SharedMemoryStatsTest, Layout) {
+  SharedMemoryStats stats(name_, 10);
+  Collector collector(name_);
+
+  const SharedMemoryStatsHeader& header = collector.header();
+  EXPECT_EQ(SHARED_MEMORY_STATS_MAGIC, header.magic_);
+  EXPECT_EQ(0, memcmp(&header.magic_, "ENVOYSTS", 8));
+  EXPECT_EQ(SHARED_MEMORY_STATS_VERSION, header.version_);
+  EXPECT_EQ(sizeof(SharedMemoryStatsHeader), header.header_size_);
+  EXPECT_EQ(sizeof(SharedMemoryStatsHeader), header.entries_offset_);
+  EXPECT_EQ(10, header.max_entries_);
+  EXPECT_EQ(sizeof(SharedMemoryStatsEntry), header.entry_size_);
+  EXPECT_EQ(header.entries_offset_ + 10 * sizeof(SharedMemoryStatsEntry), header.names_offset_);
+  EXPECT_EQ(header.names_offset_ + header.names_size_, header.region_size_);
+  EXPECT_EQ(static_cast<uint64_t>(getpid()), header.pid_);
+  EXPECT_EQ(0, header.sequence_.load());
+  EXPECT_EQ(0, header.num_entries_);
+}
+
+TEST_F(SharedMemoryStatsTest, Update) {
+  SharedMemoryStats stats(name_, 10);
+  Collector collector(name_);
+  Stats::Counter& counter = store_.counterFromString("a.counter");
+  Stats::Gauge& gauge = store_.gaugeFromString("a.gauge", Stats::Gauge::ImportMode::Accumulate);
+  counter.add(5);
+  gauge.set(7);
+
+  stats.update(store_.counters(), store_.gauges(), SystemTime(std::chrono::milliseconds(1000)));
+  using Stat = std::pair<SharedMemoryStatsType, uint64_t>;
+  std::map<std::string, Stat> expected{{"a.counter", {SharedMemoryStatsType::Counter, 5}},
+                                       {"a.gauge", {SharedMemoryStatsType::Gauge, 7}}};
+  EXPECT_EQ(expected, collector.readStats());
+  EXPECT_EQ(2, collector.header().sequence_.load());
+  EXPECT_EQ(0, collector.header().dropped_);
+  EXPECT_EQ(1000, collector.header().update_time_ms_);
+
+  // The same metrics only have their values rewritten.
+  counter.add(1);
+  gauge.set(3);
+  stats.update(store_.counters(), store_.gauges(), SystemTime(std::chrono::milliseconds(2000)));
+  expected = {{"a.counter", {SharedMemoryStatsType::Counter, 6}},
+              {"a.gauge", {SharedMemoryStatsType::Gauge, 3}}};
+  EXPECT_EQ(expected, collector.readStats());
+  EXPECT_EQ(4, collector.header().sequence_.load());
+  EXPECT_EQ(2000, collector.header().update_time_ms_);
+
+  // A new metric rewrites the names.
+  store_.counterFromString("b.counter").add(9);
+  stats.update(store_.counters(), store_.gauges(), SystemTime(std::chrono::milliseconds(3000)));
+  expected["b.counter"] = {SharedMemoryStatsType::Counter, 9};
+  EXPECT_EQ(expected, collector.readStats());
+  EXPECT_EQ(3, collector.header().num_entries_);
+}
+
+TEST_F(SharedMemoryStatsTest, Dropped) {
+  SharedMemoryStats stats(name_, 2);
+  Collector collector(name_);
+  for (int i = 0; i < 3; ++i) {
+    store_.counterFromString(absl::StrCat("counter", i)).add(i + 1);
+  }
+  store_.gaugeFromString("gauge", Stats::Gauge::ImportMode::Accumulate).set(1);
+
+  stats.update(store_.counters(), store_.gauges(), SystemTime());
+  EXPECT_EQ(2, collector.header().num_entries_);
+  EXPECT_EQ(2, collector.header().dropped_);
+  for (const auto& stat : collector.readStats()) {
+    EXPECT_EQ(SharedMemoryStatsType::Counter, stat.second.first);
+  }
+
+  // Long names run out of name space before the entries run out.
+  SharedMemoryStats small(name_ + "_small", 4);
+  Collector small_collector(name_ + "_small");
+  store_.counterFromString(std::string(small_collector.header().names_size_, 'x'));
+  small.update(store_.counters(), {}, SystemTime());
+  EXPECT_LT(small_collector.header().num_entries_, 4);
+  EXPECT_EQ(store_.counters().size() - small_collector.header().num_entries_,
+            small_collector.header().dropped_);
+}
+
+TEST_F(SharedMemoryStatsTest, ReplacesAndUnlinks) {
+  {
+    SharedMemoryStats stats(name_, 10);
+    // A region left behind under the same name is replaced.
+    SharedMemoryStats replacement(name_, 20);
+    Collector collector(name_);
+    EXPECT_EQ(20, collector.header().max_entries_);
+  }
+  EXPECT_EQ(-1, shm_open(name_.c_str(), O_RDONLY, 0));
+  EXPECT_EQ(ENOENT, errno);
+}
+
+} // namespace
+} // namespace Server
+} // namespace Envoy